@@ -24,6 +24,7 @@ ls *.h *.c -1 >> CMakeLists.txt
 echo ')' >> CMakeLists.txt
 echo 'target_include_directories(libasn PUBLIC ${CMAKE_SOURCE_DIR}/include PUBLIC ${CMAKE_CURRENT_SOURCE_DIR})' >> CMakeLists.txt
 echo 'target_compile_options(libasn PRIVATE -Wall)' >> CMakeLists.txt
+echo 'target_link_libraries(libasn pthread)' >> CMakeLists.txt
 echo 'if (M32)' >> CMakeLists.txt
 echo '  set_target_properties(libasn PROPERTIES COMPILE_FLAGS "-m32" LINK_FLAGS "-m32")' >> CMakeLists.txt
 echo 'endif()' >> CMakeLists.txt
@@ -33,3 +34,7 @@ echo 'endif()' >> CMakeLists.txt
 cd ../../../
 patch -p1 < ./asn1/0001-PKIX1Explicit88-remove-broken-constraint-check-in-Ce.patch
 patch -p1 < ./asn1/0001-asn_internal-use-custom-memory-allocator-functions.patch
+patch -p1 < ./asn1/0001-asn_internal-add-arena-allocator-mode.patch
+patch -p1 < ./asn1/0001-OCTET_STRING-reference-large-strings-in-the-decoder-input.patch
+patch -p1 < ./asn1/0001-asn_arena-keep-the-state-per-thread-and-index-blocks-by-page.patch
+patch -p1 < ./asn1/0001-asn_arena-find-arena-memory-from-any-thread.patch
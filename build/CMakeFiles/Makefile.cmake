@@ -0,0 +1,130 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/ipa/CMakeLists.txt"
+  "/root/repo/src/ipa/libasn/CMakeLists.txt"
+  "/root/repo/src/ipa/libipa/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/activation_code/CMakeLists.txt"
+  "/root/repo/tests/asn_arena/CMakeLists.txt"
+  "/root/repo/tests/bpp_segments/CMakeLists.txt"
+  "/root/repo/tests/coap/CMakeLists.txt"
+  "/root/repo/tests/eim_pkg_inj/CMakeLists.txt"
+  "/root/repo/tests/es10x_stream/CMakeLists.txt"
+  "/root/repo/tests/esipa_compact/CMakeLists.txt"
+  "/root/repo/tests/esipa_retry/CMakeLists.txt"
+  "/root/repo/tests/euicc/CMakeLists.txt"
+  "/root/repo/tests/long_poll/CMakeLists.txt"
+  "/root/repo/tests/utils/CMakeLists.txt"
+  "/root/repo/tests/warm_start/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ipa/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ipa/libasn/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ipa/libipa/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/activation_code/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/bpp_segments/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/esipa_compact/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/coap/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/eim_pkg_inj/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/long_poll/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/asn_arena/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/esipa_retry/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/es10x_stream/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/euicc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/warm_start/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "src/ipa/CMakeFiles/http.dir/DependInfo.cmake"
+  "src/ipa/CMakeFiles/coap.dir/DependInfo.cmake"
+  "src/ipa/CMakeFiles/http_srv.dir/DependInfo.cmake"
+  "src/ipa/CMakeFiles/scard.dir/DependInfo.cmake"
+  "src/ipa/CMakeFiles/ipa.dir/DependInfo.cmake"
+  "src/ipa/libasn/CMakeFiles/libasn.dir/DependInfo.cmake"
+  "src/ipa/libipa/CMakeFiles/libipa.dir/DependInfo.cmake"
+  "tests/activation_code/CMakeFiles/activation_code_test.dir/DependInfo.cmake"
+  "tests/utils/CMakeFiles/utils_test.dir/DependInfo.cmake"
+  "tests/bpp_segments/CMakeFiles/bpp_segments_test.dir/DependInfo.cmake"
+  "tests/esipa_compact/CMakeFiles/esipa_compact_test.dir/DependInfo.cmake"
+  "tests/coap/CMakeFiles/coap_test.dir/DependInfo.cmake"
+  "tests/eim_pkg_inj/CMakeFiles/eim_pkg_inj_test.dir/DependInfo.cmake"
+  "tests/long_poll/CMakeFiles/long_poll_test.dir/DependInfo.cmake"
+  "tests/asn_arena/CMakeFiles/asn_arena_test.dir/DependInfo.cmake"
+  "tests/esipa_retry/CMakeFiles/esipa_retry_test.dir/DependInfo.cmake"
+  "tests/es10x_stream/CMakeFiles/es10x_stream_test.dir/DependInfo.cmake"
+  "tests/euicc/CMakeFiles/euicc_test.dir/DependInfo.cmake"
+  "tests/warm_start/CMakeFiles/warm_start_test.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/coap.dir/coap.c.o"
+  "CMakeFiles/coap.dir/coap.c.o.d"
+  "libcoap.a"
+  "libcoap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/coap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
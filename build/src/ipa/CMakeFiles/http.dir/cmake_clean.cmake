@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http.dir/http.c.o"
+  "CMakeFiles/http.dir/http.c.o.d"
+  "libhttp.a"
+  "libhttp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/http.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http_srv.dir/http_srv.c.o"
+  "CMakeFiles/http_srv.dir/http_srv.c.o.d"
+  "libhttp_srv.a"
+  "libhttp_srv.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/http_srv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
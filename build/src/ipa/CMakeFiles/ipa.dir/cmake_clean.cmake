@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ipa.dir/main.c.o"
+  "CMakeFiles/ipa.dir/main.c.o.d"
+  "ipa"
+  "ipa.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ipa.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scard.dir/scard.c.o"
+  "CMakeFiles/scard.dir/scard.c.o.d"
+  "libscard.a"
+  "libscard.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/scard.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
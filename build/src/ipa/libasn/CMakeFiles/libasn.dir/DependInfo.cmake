@@ -0,0 +1,493 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ipa/libasn/ADFRFMAccess.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ADFRFMAccess.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ADFRFMAccess.c.o.d"
+  "/root/repo/src/ipa/libasn/ANY.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ANY.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ANY.c.o.d"
+  "/root/repo/src/ipa/libasn/AccessDescription.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AccessDescription.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AccessDescription.c.o.d"
+  "/root/repo/src/ipa/libasn/AddEimResult.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AddEimResult.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AddEimResult.c.o.d"
+  "/root/repo/src/ipa/libasn/AddInitialEimRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AddInitialEimRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AddInitialEimRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/AddInitialEimResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AddInitialEimResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AddInitialEimResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/AdministrationDomainName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AdministrationDomainName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AdministrationDomainName.c.o.d"
+  "/root/repo/src/ipa/libasn/AlgoParameter.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AlgoParameter.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AlgoParameter.c.o.d"
+  "/root/repo/src/ipa/libasn/AlgorithmIdentifier.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AlgorithmIdentifier.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AlgorithmIdentifier.c.o.d"
+  "/root/repo/src/ipa/libasn/AnotherName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AnotherName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AnotherName.c.o.d"
+  "/root/repo/src/ipa/libasn/ApplicationIdentifier.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ApplicationIdentifier.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ApplicationIdentifier.c.o.d"
+  "/root/repo/src/ipa/libasn/ApplicationInstance.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ApplicationInstance.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ApplicationInstance.c.o.d"
+  "/root/repo/src/ipa/libasn/ApplicationLoadPackage.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ApplicationLoadPackage.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ApplicationLoadPackage.c.o.d"
+  "/root/repo/src/ipa/libasn/ApplicationSystemParameters.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ApplicationSystemParameters.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ApplicationSystemParameters.c.o.d"
+  "/root/repo/src/ipa/libasn/Attribute.c" "src/ipa/libasn/CMakeFiles/libasn.dir/Attribute.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/Attribute.c.o.d"
+  "/root/repo/src/ipa/libasn/AttributeType.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AttributeType.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AttributeType.c.o.d"
+  "/root/repo/src/ipa/libasn/AttributeTypeAndValue.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AttributeTypeAndValue.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AttributeTypeAndValue.c.o.d"
+  "/root/repo/src/ipa/libasn/AttributeValue.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AttributeValue.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AttributeValue.c.o.d"
+  "/root/repo/src/ipa/libasn/AuthenticateClientOk.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateClientOk.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateClientOk.c.o.d"
+  "/root/repo/src/ipa/libasn/AuthenticateClientOkDPEsipa.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateClientOkDPEsipa.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateClientOkDPEsipa.c.o.d"
+  "/root/repo/src/ipa/libasn/AuthenticateClientOkDSEsipa.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateClientOkDSEsipa.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateClientOkDSEsipa.c.o.d"
+  "/root/repo/src/ipa/libasn/AuthenticateClientOkEs11.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateClientOkEs11.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateClientOkEs11.c.o.d"
+  "/root/repo/src/ipa/libasn/AuthenticateClientRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateClientRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateClientRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/AuthenticateClientRequestEsipa.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateClientRequestEsipa.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateClientRequestEsipa.c.o.d"
+  "/root/repo/src/ipa/libasn/AuthenticateClientResponseEs11.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateClientResponseEs11.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateClientResponseEs11.c.o.d"
+  "/root/repo/src/ipa/libasn/AuthenticateClientResponseEs9.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateClientResponseEs9.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateClientResponseEs9.c.o.d"
+  "/root/repo/src/ipa/libasn/AuthenticateClientResponseEsipa.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateClientResponseEsipa.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateClientResponseEsipa.c.o.d"
+  "/root/repo/src/ipa/libasn/AuthenticateErrorCode.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateErrorCode.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateErrorCode.c.o.d"
+  "/root/repo/src/ipa/libasn/AuthenticateResponseError.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateResponseError.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateResponseError.c.o.d"
+  "/root/repo/src/ipa/libasn/AuthenticateResponseOk.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateResponseOk.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateResponseOk.c.o.d"
+  "/root/repo/src/ipa/libasn/AuthenticateServerRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateServerRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateServerRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/AuthenticateServerResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateServerResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthenticateServerResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/AuthorityInfoAccessSyntax.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthorityInfoAccessSyntax.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthorityInfoAccessSyntax.c.o.d"
+  "/root/repo/src/ipa/libasn/AuthorityKeyIdentifier.c" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthorityKeyIdentifier.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/AuthorityKeyIdentifier.c.o.d"
+  "/root/repo/src/ipa/libasn/BIT_STRING.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BIT_STRING.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BIT_STRING.c.o.d"
+  "/root/repo/src/ipa/libasn/BIT_STRING_oer.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BIT_STRING_oer.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BIT_STRING_oer.c.o.d"
+  "/root/repo/src/ipa/libasn/BMPString.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BMPString.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BMPString.c.o.d"
+  "/root/repo/src/ipa/libasn/BOOLEAN.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BOOLEAN.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BOOLEAN.c.o.d"
+  "/root/repo/src/ipa/libasn/BaseCRLNumber.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BaseCRLNumber.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BaseCRLNumber.c.o.d"
+  "/root/repo/src/ipa/libasn/BaseDistance.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BaseDistance.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BaseDistance.c.o.d"
+  "/root/repo/src/ipa/libasn/BasicConstraints.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BasicConstraints.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BasicConstraints.c.o.d"
+  "/root/repo/src/ipa/libasn/BoundProfilePackage-86tlv.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BoundProfilePackage-86tlv.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BoundProfilePackage-86tlv.c.o.d"
+  "/root/repo/src/ipa/libasn/BoundProfilePackage-87tlv.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BoundProfilePackage-87tlv.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BoundProfilePackage-87tlv.c.o.d"
+  "/root/repo/src/ipa/libasn/BoundProfilePackage-88tlv.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BoundProfilePackage-88tlv.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BoundProfilePackage-88tlv.c.o.d"
+  "/root/repo/src/ipa/libasn/BoundProfilePackage-FirstSequenceOf87.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BoundProfilePackage-FirstSequenceOf87.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BoundProfilePackage-FirstSequenceOf87.c.o.d"
+  "/root/repo/src/ipa/libasn/BoundProfilePackage-SecondSequenceOf87.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BoundProfilePackage-SecondSequenceOf87.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BoundProfilePackage-SecondSequenceOf87.c.o.d"
+  "/root/repo/src/ipa/libasn/BoundProfilePackage-SequenceOf86.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BoundProfilePackage-SequenceOf86.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BoundProfilePackage-SequenceOf86.c.o.d"
+  "/root/repo/src/ipa/libasn/BoundProfilePackage-SequenceOf88.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BoundProfilePackage-SequenceOf88.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BoundProfilePackage-SequenceOf88.c.o.d"
+  "/root/repo/src/ipa/libasn/BoundProfilePackage.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BoundProfilePackage.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BoundProfilePackage.c.o.d"
+  "/root/repo/src/ipa/libasn/BppCommandId.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BppCommandId.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BppCommandId.c.o.d"
+  "/root/repo/src/ipa/libasn/BuiltInDomainDefinedAttribute.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BuiltInDomainDefinedAttribute.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BuiltInDomainDefinedAttribute.c.o.d"
+  "/root/repo/src/ipa/libasn/BuiltInDomainDefinedAttributes.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BuiltInDomainDefinedAttributes.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BuiltInDomainDefinedAttributes.c.o.d"
+  "/root/repo/src/ipa/libasn/BuiltInStandardAttributes.c" "src/ipa/libasn/CMakeFiles/libasn.dir/BuiltInStandardAttributes.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/BuiltInStandardAttributes.c.o.d"
+  "/root/repo/src/ipa/libasn/CPSuri.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CPSuri.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CPSuri.c.o.d"
+  "/root/repo/src/ipa/libasn/CRLDistributionPoints.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CRLDistributionPoints.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CRLDistributionPoints.c.o.d"
+  "/root/repo/src/ipa/libasn/CRLNumber.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CRLNumber.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CRLNumber.c.o.d"
+  "/root/repo/src/ipa/libasn/CRLReason.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CRLReason.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CRLReason.c.o.d"
+  "/root/repo/src/ipa/libasn/CancelSessionOk.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CancelSessionOk.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CancelSessionOk.c.o.d"
+  "/root/repo/src/ipa/libasn/CancelSessionReason.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CancelSessionReason.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CancelSessionReason.c.o.d"
+  "/root/repo/src/ipa/libasn/CancelSessionRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CancelSessionRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CancelSessionRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/CancelSessionRequestEs9.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CancelSessionRequestEs9.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CancelSessionRequestEs9.c.o.d"
+  "/root/repo/src/ipa/libasn/CancelSessionRequestEsipa.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CancelSessionRequestEsipa.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CancelSessionRequestEsipa.c.o.d"
+  "/root/repo/src/ipa/libasn/CancelSessionResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CancelSessionResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CancelSessionResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/CancelSessionResponseEs9.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CancelSessionResponseEs9.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CancelSessionResponseEs9.c.o.d"
+  "/root/repo/src/ipa/libasn/CancelSessionResponseEsipa.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CancelSessionResponseEsipa.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CancelSessionResponseEsipa.c.o.d"
+  "/root/repo/src/ipa/libasn/CancelSessionResponseOk.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CancelSessionResponseOk.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CancelSessionResponseOk.c.o.d"
+  "/root/repo/src/ipa/libasn/CatSupportedClasses.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CatSupportedClasses.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CatSupportedClasses.c.o.d"
+  "/root/repo/src/ipa/libasn/CertPolicyId.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CertPolicyId.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CertPolicyId.c.o.d"
+  "/root/repo/src/ipa/libasn/Certificate.c" "src/ipa/libasn/CMakeFiles/libasn.dir/Certificate.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/Certificate.c.o.d"
+  "/root/repo/src/ipa/libasn/CertificateInfo.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CertificateInfo.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CertificateInfo.c.o.d"
+  "/root/repo/src/ipa/libasn/CertificateIssuer.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CertificateIssuer.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CertificateIssuer.c.o.d"
+  "/root/repo/src/ipa/libasn/CertificateList.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CertificateList.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CertificateList.c.o.d"
+  "/root/repo/src/ipa/libasn/CertificatePolicies.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CertificatePolicies.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CertificatePolicies.c.o.d"
+  "/root/repo/src/ipa/libasn/CertificateSerialNumber.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CertificateSerialNumber.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CertificateSerialNumber.c.o.d"
+  "/root/repo/src/ipa/libasn/CertificationDataObject.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CertificationDataObject.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CertificationDataObject.c.o.d"
+  "/root/repo/src/ipa/libasn/CommonName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CommonName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CommonName.c.o.d"
+  "/root/repo/src/ipa/libasn/CompactAuthenticateResponseOk.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactAuthenticateResponseOk.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactAuthenticateResponseOk.c.o.d"
+  "/root/repo/src/ipa/libasn/CompactCancelSessionResponseOk.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactCancelSessionResponseOk.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactCancelSessionResponseOk.c.o.d"
+  "/root/repo/src/ipa/libasn/CompactEuiccCancelSessionSigned.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactEuiccCancelSessionSigned.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactEuiccCancelSessionSigned.c.o.d"
+  "/root/repo/src/ipa/libasn/CompactEuiccSigned1.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactEuiccSigned1.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactEuiccSigned1.c.o.d"
+  "/root/repo/src/ipa/libasn/CompactEuiccSigned2.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactEuiccSigned2.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactEuiccSigned2.c.o.d"
+  "/root/repo/src/ipa/libasn/CompactOtherSignedNotification.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactOtherSignedNotification.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactOtherSignedNotification.c.o.d"
+  "/root/repo/src/ipa/libasn/CompactPrepareDownloadResponseOk.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactPrepareDownloadResponseOk.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactPrepareDownloadResponseOk.c.o.d"
+  "/root/repo/src/ipa/libasn/CompactProfileInstallationResult.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactProfileInstallationResult.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactProfileInstallationResult.c.o.d"
+  "/root/repo/src/ipa/libasn/CompactProfileInstallationResultData.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactProfileInstallationResultData.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactProfileInstallationResultData.c.o.d"
+  "/root/repo/src/ipa/libasn/CompactSuccessResult.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactSuccessResult.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CompactSuccessResult.c.o.d"
+  "/root/repo/src/ipa/libasn/ConfigureAutoEnableResult.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ConfigureAutoEnableResult.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ConfigureAutoEnableResult.c.o.d"
+  "/root/repo/src/ipa/libasn/ConfigureAutoProfileEnablingRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ConfigureAutoProfileEnablingRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ConfigureAutoProfileEnablingRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/ConfigureAutoProfileEnablingResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ConfigureAutoProfileEnablingResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ConfigureAutoProfileEnablingResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/ConfigureISDPRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ConfigureISDPRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ConfigureISDPRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/ControlRefTemplate.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ControlRefTemplate.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ControlRefTemplate.c.o.d"
+  "/root/repo/src/ipa/libasn/ControlReferenceTemplate.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ControlReferenceTemplate.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ControlReferenceTemplate.c.o.d"
+  "/root/repo/src/ipa/libasn/CountryName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CountryName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CountryName.c.o.d"
+  "/root/repo/src/ipa/libasn/CtxParams1.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CtxParams1.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CtxParams1.c.o.d"
+  "/root/repo/src/ipa/libasn/CtxParamsForCommonAuthentication.c" "src/ipa/libasn/CMakeFiles/libasn.dir/CtxParamsForCommonAuthentication.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/CtxParamsForCommonAuthentication.c.o.d"
+  "/root/repo/src/ipa/libasn/DeleteEimResult.c" "src/ipa/libasn/CMakeFiles/libasn.dir/DeleteEimResult.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/DeleteEimResult.c.o.d"
+  "/root/repo/src/ipa/libasn/DeleteProfileRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/DeleteProfileRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/DeleteProfileRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/DeleteProfileResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/DeleteProfileResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/DeleteProfileResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/DeleteProfileResult.c" "src/ipa/libasn/CMakeFiles/libasn.dir/DeleteProfileResult.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/DeleteProfileResult.c.o.d"
+  "/root/repo/src/ipa/libasn/DeviceAdditionalFeatureSupport.c" "src/ipa/libasn/CMakeFiles/libasn.dir/DeviceAdditionalFeatureSupport.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/DeviceAdditionalFeatureSupport.c.o.d"
+  "/root/repo/src/ipa/libasn/DeviceCapabilities.c" "src/ipa/libasn/CMakeFiles/libasn.dir/DeviceCapabilities.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/DeviceCapabilities.c.o.d"
+  "/root/repo/src/ipa/libasn/DeviceInfo.c" "src/ipa/libasn/CMakeFiles/libasn.dir/DeviceInfo.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/DeviceInfo.c.o.d"
+  "/root/repo/src/ipa/libasn/DirectoryString.c" "src/ipa/libasn/CMakeFiles/libasn.dir/DirectoryString.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/DirectoryString.c.o.d"
+  "/root/repo/src/ipa/libasn/DisableProfileRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/DisableProfileRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/DisableProfileRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/DisableProfileResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/DisableProfileResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/DisableProfileResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/DisableProfileResult.c" "src/ipa/libasn/CMakeFiles/libasn.dir/DisableProfileResult.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/DisableProfileResult.c.o.d"
+  "/root/repo/src/ipa/libasn/DisplayText.c" "src/ipa/libasn/CMakeFiles/libasn.dir/DisplayText.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/DisplayText.c.o.d"
+  "/root/repo/src/ipa/libasn/DistinguishedName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/DistinguishedName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/DistinguishedName.c.o.d"
+  "/root/repo/src/ipa/libasn/DistributionPoint.c" "src/ipa/libasn/CMakeFiles/libasn.dir/DistributionPoint.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/DistributionPoint.c.o.d"
+  "/root/repo/src/ipa/libasn/DistributionPointName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/DistributionPointName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/DistributionPointName.c.o.d"
+  "/root/repo/src/ipa/libasn/DomainComponent.c" "src/ipa/libasn/CMakeFiles/libasn.dir/DomainComponent.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/DomainComponent.c.o.d"
+  "/root/repo/src/ipa/libasn/DownloadErrorCode.c" "src/ipa/libasn/CMakeFiles/libasn.dir/DownloadErrorCode.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/DownloadErrorCode.c.o.d"
+  "/root/repo/src/ipa/libasn/DpProprietaryData.c" "src/ipa/libasn/CMakeFiles/libasn.dir/DpProprietaryData.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/DpProprietaryData.c.o.d"
+  "/root/repo/src/ipa/libasn/EDIPartyName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EDIPartyName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EDIPartyName.c.o.d"
+  "/root/repo/src/ipa/libasn/EUICCInfo1.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EUICCInfo1.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EUICCInfo1.c.o.d"
+  "/root/repo/src/ipa/libasn/EUICCInfo2.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EUICCInfo2.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EUICCInfo2.c.o.d"
+  "/root/repo/src/ipa/libasn/EUICCResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EUICCResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EUICCResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/EUICCSigned2.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EUICCSigned2.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EUICCSigned2.c.o.d"
+  "/root/repo/src/ipa/libasn/Eco.c" "src/ipa/libasn/CMakeFiles/libasn.dir/Eco.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/Eco.c.o.d"
+  "/root/repo/src/ipa/libasn/EimAcknowledgements.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EimAcknowledgements.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EimAcknowledgements.c.o.d"
+  "/root/repo/src/ipa/libasn/EimConfigurationData.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EimConfigurationData.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EimConfigurationData.c.o.d"
+  "/root/repo/src/ipa/libasn/EimIdInfo.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EimIdInfo.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EimIdInfo.c.o.d"
+  "/root/repo/src/ipa/libasn/EimIdType.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EimIdType.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EimIdType.c.o.d"
+  "/root/repo/src/ipa/libasn/EimSupportedProtocol.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EimSupportedProtocol.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EimSupportedProtocol.c.o.d"
+  "/root/repo/src/ipa/libasn/EmailAddress.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EmailAddress.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EmailAddress.c.o.d"
+  "/root/repo/src/ipa/libasn/EnableProfileRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EnableProfileRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EnableProfileRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/EnableProfileResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EnableProfileResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EnableProfileResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/EnableProfileResult.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EnableProfileResult.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EnableProfileResult.c.o.d"
+  "/root/repo/src/ipa/libasn/EnableUsingDDRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EnableUsingDDRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EnableUsingDDRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/EnableUsingDDResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EnableUsingDDResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EnableUsingDDResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/ErrorReason.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ErrorReason.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ErrorReason.c.o.d"
+  "/root/repo/src/ipa/libasn/ErrorResult.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ErrorResult.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ErrorResult.c.o.d"
+  "/root/repo/src/ipa/libasn/EsipaMessageFromEimToIpa.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EsipaMessageFromEimToIpa.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EsipaMessageFromEimToIpa.c.o.d"
+  "/root/repo/src/ipa/libasn/EsipaMessageFromIpaToEim.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EsipaMessageFromIpaToEim.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EsipaMessageFromIpaToEim.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccCancelSessionSigned.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccCancelSessionSigned.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccCancelSessionSigned.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccConfiguredAddressesRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccConfiguredAddressesRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccConfiguredAddressesRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccConfiguredAddressesResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccConfiguredAddressesResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccConfiguredAddressesResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccFormFactorType.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccFormFactorType.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccFormFactorType.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccMemoryResetRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccMemoryResetRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccMemoryResetRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccMemoryResetResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccMemoryResetResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccMemoryResetResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccPackage.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackage.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackage.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccPackageErrorCode.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackageErrorCode.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackageErrorCode.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccPackageErrorDataSigned.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackageErrorDataSigned.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackageErrorDataSigned.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccPackageErrorSigned.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackageErrorSigned.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackageErrorSigned.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccPackageErrorUnsigned.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackageErrorUnsigned.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackageErrorUnsigned.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccPackageRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackageRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackageRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccPackageResult.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackageResult.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackageResult.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccPackageResultDataSigned.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackageResultDataSigned.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackageResultDataSigned.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccPackageResultSigned.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackageResultSigned.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackageResultSigned.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccPackageSigned.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackageSigned.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccPackageSigned.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccResultData.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccResultData.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccResultData.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccSignPIR.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccSignPIR.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccSignPIR.c.o.d"
+  "/root/repo/src/ipa/libasn/EuiccSigned1.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccSigned1.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EuiccSigned1.c.o.d"
+  "/root/repo/src/ipa/libasn/EventEntries.c" "src/ipa/libasn/CMakeFiles/libasn.dir/EventEntries.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/EventEntries.c.o.d"
+  "/root/repo/src/ipa/libasn/ExpirationDate.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ExpirationDate.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ExpirationDate.c.o.d"
+  "/root/repo/src/ipa/libasn/ExtKeyUsageSyntax.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ExtKeyUsageSyntax.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ExtKeyUsageSyntax.c.o.d"
+  "/root/repo/src/ipa/libasn/ExtendedNetworkAddress.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ExtendedNetworkAddress.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ExtendedNetworkAddress.c.o.d"
+  "/root/repo/src/ipa/libasn/Extension.c" "src/ipa/libasn/CMakeFiles/libasn.dir/Extension.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/Extension.c.o.d"
+  "/root/repo/src/ipa/libasn/ExtensionAttribute.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ExtensionAttribute.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ExtensionAttribute.c.o.d"
+  "/root/repo/src/ipa/libasn/ExtensionAttributes.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ExtensionAttributes.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ExtensionAttributes.c.o.d"
+  "/root/repo/src/ipa/libasn/ExtensionORAddressComponents.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ExtensionORAddressComponents.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ExtensionORAddressComponents.c.o.d"
+  "/root/repo/src/ipa/libasn/ExtensionPhysicalDeliveryAddressComponents.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ExtensionPhysicalDeliveryAddressComponents.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ExtensionPhysicalDeliveryAddressComponents.c.o.d"
+  "/root/repo/src/ipa/libasn/Extensions.c" "src/ipa/libasn/CMakeFiles/libasn.dir/Extensions.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/Extensions.c.o.d"
+  "/root/repo/src/ipa/libasn/Fcp.c" "src/ipa/libasn/CMakeFiles/libasn.dir/Fcp.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/Fcp.c.o.d"
+  "/root/repo/src/ipa/libasn/File.c" "src/ipa/libasn/CMakeFiles/libasn.dir/File.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/File.c.o.d"
+  "/root/repo/src/ipa/libasn/FileManagement.c" "src/ipa/libasn/CMakeFiles/libasn.dir/FileManagement.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/FileManagement.c.o.d"
+  "/root/repo/src/ipa/libasn/FreshestCRL.c" "src/ipa/libasn/CMakeFiles/libasn.dir/FreshestCRL.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/FreshestCRL.c.o.d"
+  "/root/repo/src/ipa/libasn/GeneralName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GeneralName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GeneralName.c.o.d"
+  "/root/repo/src/ipa/libasn/GeneralNames.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GeneralNames.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GeneralNames.c.o.d"
+  "/root/repo/src/ipa/libasn/GeneralSubtree.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GeneralSubtree.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GeneralSubtree.c.o.d"
+  "/root/repo/src/ipa/libasn/GeneralSubtrees.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GeneralSubtrees.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GeneralSubtrees.c.o.d"
+  "/root/repo/src/ipa/libasn/GeneralizedTime.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GeneralizedTime.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GeneralizedTime.c.o.d"
+  "/root/repo/src/ipa/libasn/GetBoundProfilePackageOk.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetBoundProfilePackageOk.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetBoundProfilePackageOk.c.o.d"
+  "/root/repo/src/ipa/libasn/GetBoundProfilePackageOkEsipa.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetBoundProfilePackageOkEsipa.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetBoundProfilePackageOkEsipa.c.o.d"
+  "/root/repo/src/ipa/libasn/GetBoundProfilePackageRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetBoundProfilePackageRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetBoundProfilePackageRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/GetBoundProfilePackageRequestEsipa.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetBoundProfilePackageRequestEsipa.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetBoundProfilePackageRequestEsipa.c.o.d"
+  "/root/repo/src/ipa/libasn/GetBoundProfilePackageResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetBoundProfilePackageResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetBoundProfilePackageResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/GetBoundProfilePackageResponseEsipa.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetBoundProfilePackageResponseEsipa.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetBoundProfilePackageResponseEsipa.c.o.d"
+  "/root/repo/src/ipa/libasn/GetCertsRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetCertsRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetCertsRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/GetCertsResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetCertsResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetCertsResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/GetEimConfigurationDataRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEimConfigurationDataRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEimConfigurationDataRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/GetEimConfigurationDataResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEimConfigurationDataResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEimConfigurationDataResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/GetEimPackageRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEimPackageRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEimPackageRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/GetEimPackageResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEimPackageResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEimPackageResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/GetEuiccChallengeRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEuiccChallengeRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEuiccChallengeRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/GetEuiccChallengeResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEuiccChallengeResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEuiccChallengeResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/GetEuiccDataRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEuiccDataRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEuiccDataRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/GetEuiccDataResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEuiccDataResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEuiccDataResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/GetEuiccInfo1Request.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEuiccInfo1Request.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEuiccInfo1Request.c.o.d"
+  "/root/repo/src/ipa/libasn/GetEuiccInfo2Request.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEuiccInfo2Request.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetEuiccInfo2Request.c.o.d"
+  "/root/repo/src/ipa/libasn/GetRatRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetRatRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetRatRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/GetRatResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/GetRatResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/GetRatResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/HandleNotification.c" "src/ipa/libasn/CMakeFiles/libasn.dir/HandleNotification.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/HandleNotification.c.o.d"
+  "/root/repo/src/ipa/libasn/HandleNotificationEsipa.c" "src/ipa/libasn/CMakeFiles/libasn.dir/HandleNotificationEsipa.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/HandleNotificationEsipa.c.o.d"
+  "/root/repo/src/ipa/libasn/HoldInstructionCode.c" "src/ipa/libasn/CMakeFiles/libasn.dir/HoldInstructionCode.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/HoldInstructionCode.c.o.d"
+  "/root/repo/src/ipa/libasn/IA5String.c" "src/ipa/libasn/CMakeFiles/libasn.dir/IA5String.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/IA5String.c.o.d"
+  "/root/repo/src/ipa/libasn/INTEGER.c" "src/ipa/libasn/CMakeFiles/libasn.dir/INTEGER.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/INTEGER.c.o.d"
+  "/root/repo/src/ipa/libasn/INTEGER_oer.c" "src/ipa/libasn/CMakeFiles/libasn.dir/INTEGER_oer.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/INTEGER_oer.c.o.d"
+  "/root/repo/src/ipa/libasn/ISDRProprietaryApplicationTemplate.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ISDRProprietaryApplicationTemplate.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ISDRProprietaryApplicationTemplate.c.o.d"
+  "/root/repo/src/ipa/libasn/Iccid.c" "src/ipa/libasn/CMakeFiles/libasn.dir/Iccid.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/Iccid.c.o.d"
+  "/root/repo/src/ipa/libasn/IconType.c" "src/ipa/libasn/CMakeFiles/libasn.dir/IconType.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/IconType.c.o.d"
+  "/root/repo/src/ipa/libasn/InhibitAnyPolicy.c" "src/ipa/libasn/CMakeFiles/libasn.dir/InhibitAnyPolicy.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/InhibitAnyPolicy.c.o.d"
+  "/root/repo/src/ipa/libasn/InitialiseSecureChannelRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/InitialiseSecureChannelRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/InitialiseSecureChannelRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/InitiateAuthenticationOkEs9.c" "src/ipa/libasn/CMakeFiles/libasn.dir/InitiateAuthenticationOkEs9.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/InitiateAuthenticationOkEs9.c.o.d"
+  "/root/repo/src/ipa/libasn/InitiateAuthenticationOkEsipa.c" "src/ipa/libasn/CMakeFiles/libasn.dir/InitiateAuthenticationOkEsipa.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/InitiateAuthenticationOkEsipa.c.o.d"
+  "/root/repo/src/ipa/libasn/InitiateAuthenticationRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/InitiateAuthenticationRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/InitiateAuthenticationRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/InitiateAuthenticationRequestEsipa.c" "src/ipa/libasn/CMakeFiles/libasn.dir/InitiateAuthenticationRequestEsipa.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/InitiateAuthenticationRequestEsipa.c.o.d"
+  "/root/repo/src/ipa/libasn/InitiateAuthenticationResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/InitiateAuthenticationResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/InitiateAuthenticationResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/InitiateAuthenticationResponseEsipa.c" "src/ipa/libasn/CMakeFiles/libasn.dir/InitiateAuthenticationResponseEsipa.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/InitiateAuthenticationResponseEsipa.c.o.d"
+  "/root/repo/src/ipa/libasn/InvalidityDate.c" "src/ipa/libasn/CMakeFiles/libasn.dir/InvalidityDate.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/InvalidityDate.c.o.d"
+  "/root/repo/src/ipa/libasn/IoTSpecificInfo.c" "src/ipa/libasn/CMakeFiles/libasn.dir/IoTSpecificInfo.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/IoTSpecificInfo.c.o.d"
+  "/root/repo/src/ipa/libasn/IotOptions.c" "src/ipa/libasn/CMakeFiles/libasn.dir/IotOptions.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/IotOptions.c.o.d"
+  "/root/repo/src/ipa/libasn/IpaCapabilities.c" "src/ipa/libasn/CMakeFiles/libasn.dir/IpaCapabilities.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/IpaCapabilities.c.o.d"
+  "/root/repo/src/ipa/libasn/IpaEuiccData.c" "src/ipa/libasn/CMakeFiles/libasn.dir/IpaEuiccData.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/IpaEuiccData.c.o.d"
+  "/root/repo/src/ipa/libasn/IpaEuiccDataRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/IpaEuiccDataRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/IpaEuiccDataRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/IpaEuiccDataResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/IpaEuiccDataResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/IpaEuiccDataResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/IpaMode.c" "src/ipa/libasn/CMakeFiles/libasn.dir/IpaMode.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/IpaMode.c.o.d"
+  "/root/repo/src/ipa/libasn/IssuerAltName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/IssuerAltName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/IssuerAltName.c.o.d"
+  "/root/repo/src/ipa/libasn/IssuingDistributionPoint.c" "src/ipa/libasn/CMakeFiles/libasn.dir/IssuingDistributionPoint.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/IssuingDistributionPoint.c.o.d"
+  "/root/repo/src/ipa/libasn/KeyIdentifier.c" "src/ipa/libasn/CMakeFiles/libasn.dir/KeyIdentifier.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/KeyIdentifier.c.o.d"
+  "/root/repo/src/ipa/libasn/KeyObject.c" "src/ipa/libasn/CMakeFiles/libasn.dir/KeyObject.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/KeyObject.c.o.d"
+  "/root/repo/src/ipa/libasn/KeyPurposeId.c" "src/ipa/libasn/CMakeFiles/libasn.dir/KeyPurposeId.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/KeyPurposeId.c.o.d"
+  "/root/repo/src/ipa/libasn/KeyUsage.c" "src/ipa/libasn/CMakeFiles/libasn.dir/KeyUsage.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/KeyUsage.c.o.d"
+  "/root/repo/src/ipa/libasn/ListEimResult.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ListEimResult.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ListEimResult.c.o.d"
+  "/root/repo/src/ipa/libasn/ListNotificationRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ListNotificationRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ListNotificationRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/ListNotificationResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ListNotificationResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ListNotificationResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/LoadCRLRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/LoadCRLRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/LoadCRLRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/LoadCRLResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/LoadCRLResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/LoadCRLResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/LoadCRLResponseError.c" "src/ipa/libasn/CMakeFiles/libasn.dir/LoadCRLResponseError.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/LoadCRLResponseError.c.o.d"
+  "/root/repo/src/ipa/libasn/LoadCRLResponseOk.c" "src/ipa/libasn/CMakeFiles/libasn.dir/LoadCRLResponseOk.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/LoadCRLResponseOk.c.o.d"
+  "/root/repo/src/ipa/libasn/LocalPostalAttributes.c" "src/ipa/libasn/CMakeFiles/libasn.dir/LocalPostalAttributes.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/LocalPostalAttributes.c.o.d"
+  "/root/repo/src/ipa/libasn/LpaeActivationRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/LpaeActivationRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/LpaeActivationRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/LpaeActivationResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/LpaeActivationResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/LpaeActivationResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/MappingParameter.c" "src/ipa/libasn/CMakeFiles/libasn.dir/MappingParameter.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/MappingParameter.c.o.d"
+  "/root/repo/src/ipa/libasn/NULL.c" "src/ipa/libasn/CMakeFiles/libasn.dir/NULL.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/NULL.c.o.d"
+  "/root/repo/src/ipa/libasn/Name.c" "src/ipa/libasn/CMakeFiles/libasn.dir/Name.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/Name.c.o.d"
+  "/root/repo/src/ipa/libasn/NameConstraints.c" "src/ipa/libasn/CMakeFiles/libasn.dir/NameConstraints.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/NameConstraints.c.o.d"
+  "/root/repo/src/ipa/libasn/NativeEnumerated.c" "src/ipa/libasn/CMakeFiles/libasn.dir/NativeEnumerated.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/NativeEnumerated.c.o.d"
+  "/root/repo/src/ipa/libasn/NativeEnumerated_oer.c" "src/ipa/libasn/CMakeFiles/libasn.dir/NativeEnumerated_oer.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/NativeEnumerated_oer.c.o.d"
+  "/root/repo/src/ipa/libasn/NativeInteger.c" "src/ipa/libasn/CMakeFiles/libasn.dir/NativeInteger.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/NativeInteger.c.o.d"
+  "/root/repo/src/ipa/libasn/NativeInteger_oer.c" "src/ipa/libasn/CMakeFiles/libasn.dir/NativeInteger_oer.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/NativeInteger_oer.c.o.d"
+  "/root/repo/src/ipa/libasn/NetworkAddress.c" "src/ipa/libasn/CMakeFiles/libasn.dir/NetworkAddress.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/NetworkAddress.c.o.d"
+  "/root/repo/src/ipa/libasn/NoticeReference.c" "src/ipa/libasn/CMakeFiles/libasn.dir/NoticeReference.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/NoticeReference.c.o.d"
+  "/root/repo/src/ipa/libasn/NotificationConfigurationInformation.c" "src/ipa/libasn/CMakeFiles/libasn.dir/NotificationConfigurationInformation.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/NotificationConfigurationInformation.c.o.d"
+  "/root/repo/src/ipa/libasn/NotificationEvent.c" "src/ipa/libasn/CMakeFiles/libasn.dir/NotificationEvent.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/NotificationEvent.c.o.d"
+  "/root/repo/src/ipa/libasn/NotificationMetadata.c" "src/ipa/libasn/CMakeFiles/libasn.dir/NotificationMetadata.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/NotificationMetadata.c.o.d"
+  "/root/repo/src/ipa/libasn/NotificationSentRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/NotificationSentRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/NotificationSentRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/NotificationSentResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/NotificationSentResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/NotificationSentResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/NumericString.c" "src/ipa/libasn/CMakeFiles/libasn.dir/NumericString.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/NumericString.c.o.d"
+  "/root/repo/src/ipa/libasn/NumericUserIdentifier.c" "src/ipa/libasn/CMakeFiles/libasn.dir/NumericUserIdentifier.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/NumericUserIdentifier.c.o.d"
+  "/root/repo/src/ipa/libasn/OBJECT_IDENTIFIER.c" "src/ipa/libasn/CMakeFiles/libasn.dir/OBJECT_IDENTIFIER.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/OBJECT_IDENTIFIER.c.o.d"
+  "/root/repo/src/ipa/libasn/OCTET_STRING.c" "src/ipa/libasn/CMakeFiles/libasn.dir/OCTET_STRING.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/OCTET_STRING.c.o.d"
+  "/root/repo/src/ipa/libasn/OCTET_STRING_oer.c" "src/ipa/libasn/CMakeFiles/libasn.dir/OCTET_STRING_oer.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/OCTET_STRING_oer.c.o.d"
+  "/root/repo/src/ipa/libasn/OPEN_TYPE.c" "src/ipa/libasn/CMakeFiles/libasn.dir/OPEN_TYPE.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/OPEN_TYPE.c.o.d"
+  "/root/repo/src/ipa/libasn/OPEN_TYPE_oer.c" "src/ipa/libasn/CMakeFiles/libasn.dir/OPEN_TYPE_oer.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/OPEN_TYPE_oer.c.o.d"
+  "/root/repo/src/ipa/libasn/ORAddress.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ORAddress.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ORAddress.c.o.d"
+  "/root/repo/src/ipa/libasn/Octet1.c" "src/ipa/libasn/CMakeFiles/libasn.dir/Octet1.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/Octet1.c.o.d"
+  "/root/repo/src/ipa/libasn/Octet16.c" "src/ipa/libasn/CMakeFiles/libasn.dir/Octet16.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/Octet16.c.o.d"
+  "/root/repo/src/ipa/libasn/Octet2.c" "src/ipa/libasn/CMakeFiles/libasn.dir/Octet2.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/Octet2.c.o.d"
+  "/root/repo/src/ipa/libasn/Octet32.c" "src/ipa/libasn/CMakeFiles/libasn.dir/Octet32.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/Octet32.c.o.d"
+  "/root/repo/src/ipa/libasn/Octet4.c" "src/ipa/libasn/CMakeFiles/libasn.dir/Octet4.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/Octet4.c.o.d"
+  "/root/repo/src/ipa/libasn/Octet8.c" "src/ipa/libasn/CMakeFiles/libasn.dir/Octet8.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/Octet8.c.o.d"
+  "/root/repo/src/ipa/libasn/OctetTo16.c" "src/ipa/libasn/CMakeFiles/libasn.dir/OctetTo16.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/OctetTo16.c.o.d"
+  "/root/repo/src/ipa/libasn/OperatorId.c" "src/ipa/libasn/CMakeFiles/libasn.dir/OperatorId.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/OperatorId.c.o.d"
+  "/root/repo/src/ipa/libasn/OrganizationName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/OrganizationName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/OrganizationName.c.o.d"
+  "/root/repo/src/ipa/libasn/OrganizationalUnitName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/OrganizationalUnitName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/OrganizationalUnitName.c.o.d"
+  "/root/repo/src/ipa/libasn/OrganizationalUnitNames.c" "src/ipa/libasn/CMakeFiles/libasn.dir/OrganizationalUnitNames.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/OrganizationalUnitNames.c.o.d"
+  "/root/repo/src/ipa/libasn/OtherSignedNotification.c" "src/ipa/libasn/CMakeFiles/libasn.dir/OtherSignedNotification.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/OtherSignedNotification.c.o.d"
+  "/root/repo/src/ipa/libasn/PDSName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PDSName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PDSName.c.o.d"
+  "/root/repo/src/ipa/libasn/PDSParameter.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PDSParameter.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PDSParameter.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-AKAParameter.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-AKAParameter.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-AKAParameter.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-Application.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-Application.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-Application.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-CD.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-CD.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-CD.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-CDMAParameter.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-CDMAParameter.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-CDMAParameter.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-CSIM.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-CSIM.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-CSIM.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-DF-5GPROSE.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-DF-5GPROSE.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-DF-5GPROSE.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-DF-5GS.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-DF-5GS.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-DF-5GS.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-DF-SAIP.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-DF-SAIP.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-DF-SAIP.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-DF-SNPN.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-DF-SNPN.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-DF-SNPN.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-Dummy.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-Dummy.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-Dummy.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-EAP.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-EAP.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-EAP.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-End.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-End.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-End.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-GSM-ACCESS.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-GSM-ACCESS.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-GSM-ACCESS.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-GenericFileManagement.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-GenericFileManagement.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-GenericFileManagement.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-ISIM.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-ISIM.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-ISIM.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-IoT.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-IoT.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-IoT.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-MF.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-MF.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-MF.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-NonStandard.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-NonStandard.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-NonStandard.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-OPT-CSIM.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-OPT-CSIM.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-OPT-CSIM.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-OPT-ISIM.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-OPT-ISIM.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-OPT-ISIM.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-OPT-IoT.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-OPT-IoT.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-OPT-IoT.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-OPT-USIM.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-OPT-USIM.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-OPT-USIM.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-PHONEBOOK.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-PHONEBOOK.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-PHONEBOOK.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-PINCodes.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-PINCodes.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-PINCodes.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-PUKCodes.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-PUKCodes.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-PUKCodes.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-RFM.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-RFM.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-RFM.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-SecurityDomain.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-SecurityDomain.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-SecurityDomain.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-TELECOM.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-TELECOM.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-TELECOM.c.o.d"
+  "/root/repo/src/ipa/libasn/PE-USIM.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-USIM.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PE-USIM.c.o.d"
+  "/root/repo/src/ipa/libasn/PEHeader.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PEHeader.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PEHeader.c.o.d"
+  "/root/repo/src/ipa/libasn/PEStatus.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PEStatus.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PEStatus.c.o.d"
+  "/root/repo/src/ipa/libasn/PINConfiguration.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PINConfiguration.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PINConfiguration.c.o.d"
+  "/root/repo/src/ipa/libasn/PINKeyReferenceValue.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PINKeyReferenceValue.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PINKeyReferenceValue.c.o.d"
+  "/root/repo/src/ipa/libasn/PUKConfiguration.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PUKConfiguration.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PUKConfiguration.c.o.d"
+  "/root/repo/src/ipa/libasn/PUKKeyReferenceValue.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PUKKeyReferenceValue.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PUKKeyReferenceValue.c.o.d"
+  "/root/repo/src/ipa/libasn/PartialCrlNumber.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PartialCrlNumber.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PartialCrlNumber.c.o.d"
+  "/root/repo/src/ipa/libasn/PendingNotification.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PendingNotification.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PendingNotification.c.o.d"
+  "/root/repo/src/ipa/libasn/PersonalName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PersonalName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PersonalName.c.o.d"
+  "/root/repo/src/ipa/libasn/PhysicalDeliveryCountryName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PhysicalDeliveryCountryName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PhysicalDeliveryCountryName.c.o.d"
+  "/root/repo/src/ipa/libasn/PhysicalDeliveryOfficeName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PhysicalDeliveryOfficeName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PhysicalDeliveryOfficeName.c.o.d"
+  "/root/repo/src/ipa/libasn/PhysicalDeliveryOfficeNumber.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PhysicalDeliveryOfficeNumber.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PhysicalDeliveryOfficeNumber.c.o.d"
+  "/root/repo/src/ipa/libasn/PhysicalDeliveryOrganizationName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PhysicalDeliveryOrganizationName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PhysicalDeliveryOrganizationName.c.o.d"
+  "/root/repo/src/ipa/libasn/PhysicalDeliveryPersonalName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PhysicalDeliveryPersonalName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PhysicalDeliveryPersonalName.c.o.d"
+  "/root/repo/src/ipa/libasn/PolicyConstraints.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PolicyConstraints.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PolicyConstraints.c.o.d"
+  "/root/repo/src/ipa/libasn/PolicyInformation.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PolicyInformation.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PolicyInformation.c.o.d"
+  "/root/repo/src/ipa/libasn/PolicyMappings.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PolicyMappings.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PolicyMappings.c.o.d"
+  "/root/repo/src/ipa/libasn/PolicyQualifierId.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PolicyQualifierId.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PolicyQualifierId.c.o.d"
+  "/root/repo/src/ipa/libasn/PolicyQualifierInfo.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PolicyQualifierInfo.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PolicyQualifierInfo.c.o.d"
+  "/root/repo/src/ipa/libasn/PostOfficeBoxAddress.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PostOfficeBoxAddress.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PostOfficeBoxAddress.c.o.d"
+  "/root/repo/src/ipa/libasn/PostalCode.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PostalCode.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PostalCode.c.o.d"
+  "/root/repo/src/ipa/libasn/PosteRestanteAddress.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PosteRestanteAddress.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PosteRestanteAddress.c.o.d"
+  "/root/repo/src/ipa/libasn/PprIds.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PprIds.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PprIds.c.o.d"
+  "/root/repo/src/ipa/libasn/PrepareDownloadRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PrepareDownloadRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PrepareDownloadRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/PrepareDownloadResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PrepareDownloadResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PrepareDownloadResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/PrepareDownloadResponseError.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PrepareDownloadResponseError.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PrepareDownloadResponseError.c.o.d"
+  "/root/repo/src/ipa/libasn/PrepareDownloadResponseOk.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PrepareDownloadResponseOk.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PrepareDownloadResponseOk.c.o.d"
+  "/root/repo/src/ipa/libasn/PresentationAddress.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PresentationAddress.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PresentationAddress.c.o.d"
+  "/root/repo/src/ipa/libasn/PrintableString.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PrintableString.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PrintableString.c.o.d"
+  "/root/repo/src/ipa/libasn/PrivateDomainName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PrivateDomainName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PrivateDomainName.c.o.d"
+  "/root/repo/src/ipa/libasn/PrivateKeyUsagePeriod.c" "src/ipa/libasn/CMakeFiles/libasn.dir/PrivateKeyUsagePeriod.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/PrivateKeyUsagePeriod.c.o.d"
+  "/root/repo/src/ipa/libasn/ProfileClass.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileClass.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileClass.c.o.d"
+  "/root/repo/src/ipa/libasn/ProfileDownloadData.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileDownloadData.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileDownloadData.c.o.d"
+  "/root/repo/src/ipa/libasn/ProfileDownloadTriggerRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileDownloadTriggerRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileDownloadTriggerRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/ProfileDownloadTriggerResult.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileDownloadTriggerResult.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileDownloadTriggerResult.c.o.d"
+  "/root/repo/src/ipa/libasn/ProfileElement.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileElement.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileElement.c.o.d"
+  "/root/repo/src/ipa/libasn/ProfileHeader.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileHeader.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileHeader.c.o.d"
+  "/root/repo/src/ipa/libasn/ProfileInfo.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileInfo.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileInfo.c.o.d"
+  "/root/repo/src/ipa/libasn/ProfileInfoListError.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileInfoListError.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileInfoListError.c.o.d"
+  "/root/repo/src/ipa/libasn/ProfileInfoListRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileInfoListRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileInfoListRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/ProfileInfoListResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileInfoListResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileInfoListResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/ProfileInstallationResult.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileInstallationResult.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileInstallationResult.c.o.d"
+  "/root/repo/src/ipa/libasn/ProfileInstallationResultData.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileInstallationResultData.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileInstallationResultData.c.o.d"
+  "/root/repo/src/ipa/libasn/ProfilePolicyAuthorisationRule.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfilePolicyAuthorisationRule.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfilePolicyAuthorisationRule.c.o.d"
+  "/root/repo/src/ipa/libasn/ProfileRollbackRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileRollbackRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileRollbackRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/ProfileRollbackResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileRollbackResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileRollbackResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/ProfileState.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileState.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProfileState.c.o.d"
+  "/root/repo/src/ipa/libasn/ProprietaryInfo.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProprietaryInfo.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProprietaryInfo.c.o.d"
+  "/root/repo/src/ipa/libasn/ProvideEimPackageResult.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProvideEimPackageResult.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProvideEimPackageResult.c.o.d"
+  "/root/repo/src/ipa/libasn/ProvideEimPackageResultResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ProvideEimPackageResultResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ProvideEimPackageResultResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/Psmo.c" "src/ipa/libasn/CMakeFiles/libasn.dir/Psmo.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/Psmo.c.o.d"
+  "/root/repo/src/ipa/libasn/RDNSequence.c" "src/ipa/libasn/CMakeFiles/libasn.dir/RDNSequence.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/RDNSequence.c.o.d"
+  "/root/repo/src/ipa/libasn/ReasonFlags.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ReasonFlags.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ReasonFlags.c.o.d"
+  "/root/repo/src/ipa/libasn/RelativeDistinguishedName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/RelativeDistinguishedName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/RelativeDistinguishedName.c.o.d"
+  "/root/repo/src/ipa/libasn/RemoteOpId.c" "src/ipa/libasn/CMakeFiles/libasn.dir/RemoteOpId.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/RemoteOpId.c.o.d"
+  "/root/repo/src/ipa/libasn/RemoteProfileProvisioningRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/RemoteProfileProvisioningRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/RemoteProfileProvisioningRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/RemoteProfileProvisioningResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/RemoteProfileProvisioningResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/RemoteProfileProvisioningResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/ReplaceSessionKeysRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ReplaceSessionKeysRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ReplaceSessionKeysRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/RetrieveNotificationsListRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/RetrieveNotificationsListRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/RetrieveNotificationsListRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/RetrieveNotificationsListResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/RetrieveNotificationsListResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/RetrieveNotificationsListResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/RollbackProfileResult.c" "src/ipa/libasn/CMakeFiles/libasn.dir/RollbackProfileResult.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/RollbackProfileResult.c.o.d"
+  "/root/repo/src/ipa/libasn/RspCapability.c" "src/ipa/libasn/CMakeFiles/libasn.dir/RspCapability.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/RspCapability.c.o.d"
+  "/root/repo/src/ipa/libasn/RulesAuthorisationTable.c" "src/ipa/libasn/CMakeFiles/libasn.dir/RulesAuthorisationTable.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/RulesAuthorisationTable.c.o.d"
+  "/root/repo/src/ipa/libasn/SGP32-AuthenticateServerResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-AuthenticateServerResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-AuthenticateServerResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/SGP32-CancelSessionOk.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-CancelSessionOk.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-CancelSessionOk.c.o.d"
+  "/root/repo/src/ipa/libasn/SGP32-CancelSessionResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-CancelSessionResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-CancelSessionResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/SGP32-EUICCInfo2.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-EUICCInfo2.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-EUICCInfo2.c.o.d"
+  "/root/repo/src/ipa/libasn/SGP32-EuiccMemoryResetRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-EuiccMemoryResetRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-EuiccMemoryResetRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/SGP32-EuiccMemoryResetResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-EuiccMemoryResetResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-EuiccMemoryResetResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/SGP32-PendingNotification.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-PendingNotification.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-PendingNotification.c.o.d"
+  "/root/repo/src/ipa/libasn/SGP32-PrepareDownloadResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-PrepareDownloadResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-PrepareDownloadResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/SGP32-ProfileInfoListError.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-ProfileInfoListError.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-ProfileInfoListError.c.o.d"
+  "/root/repo/src/ipa/libasn/SGP32-ProfileInfoListResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-ProfileInfoListResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-ProfileInfoListResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/SGP32-ProfileInstallationResult.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-ProfileInstallationResult.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-ProfileInstallationResult.c.o.d"
+  "/root/repo/src/ipa/libasn/SGP32-RetrieveNotificationsListRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-RetrieveNotificationsListRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-RetrieveNotificationsListRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/SGP32-RetrieveNotificationsListResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-RetrieveNotificationsListResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SGP32-RetrieveNotificationsListResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/SegmentedCrlList.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SegmentedCrlList.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SegmentedCrlList.c.o.d"
+  "/root/repo/src/ipa/libasn/SequenceNumber.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SequenceNumber.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SequenceNumber.c.o.d"
+  "/root/repo/src/ipa/libasn/ServerSigned1.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ServerSigned1.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ServerSigned1.c.o.d"
+  "/root/repo/src/ipa/libasn/ServicesList.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ServicesList.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ServicesList.c.o.d"
+  "/root/repo/src/ipa/libasn/SetDefaultDpAddressRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SetDefaultDpAddressRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SetDefaultDpAddressRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/SetDefaultDpAddressResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SetDefaultDpAddressResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SetDefaultDpAddressResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/SetNicknameRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SetNicknameRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SetNicknameRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/SetNicknameResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SetNicknameResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SetNicknameResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/SkipCerts.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SkipCerts.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SkipCerts.c.o.d"
+  "/root/repo/src/ipa/libasn/SmdpSigned2.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SmdpSigned2.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SmdpSigned2.c.o.d"
+  "/root/repo/src/ipa/libasn/StoreMetadataRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/StoreMetadataRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/StoreMetadataRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/StreetAddress.c" "src/ipa/libasn/CMakeFiles/libasn.dir/StreetAddress.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/StreetAddress.c.o.d"
+  "/root/repo/src/ipa/libasn/SubjectAltName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SubjectAltName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SubjectAltName.c.o.d"
+  "/root/repo/src/ipa/libasn/SubjectDirectoryAttributes.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SubjectDirectoryAttributes.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SubjectDirectoryAttributes.c.o.d"
+  "/root/repo/src/ipa/libasn/SubjectInfoAccessSyntax.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SubjectInfoAccessSyntax.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SubjectInfoAccessSyntax.c.o.d"
+  "/root/repo/src/ipa/libasn/SubjectKeyIdentifier.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SubjectKeyIdentifier.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SubjectKeyIdentifier.c.o.d"
+  "/root/repo/src/ipa/libasn/SubjectPublicKeyInfo.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SubjectPublicKeyInfo.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SubjectPublicKeyInfo.c.o.d"
+  "/root/repo/src/ipa/libasn/SuccessResult.c" "src/ipa/libasn/CMakeFiles/libasn.dir/SuccessResult.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/SuccessResult.c.o.d"
+  "/root/repo/src/ipa/libasn/TBSCertList.c" "src/ipa/libasn/CMakeFiles/libasn.dir/TBSCertList.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/TBSCertList.c.o.d"
+  "/root/repo/src/ipa/libasn/TBSCertificate.c" "src/ipa/libasn/CMakeFiles/libasn.dir/TBSCertificate.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/TBSCertificate.c.o.d"
+  "/root/repo/src/ipa/libasn/TS102226AdditionalContactlessParameters.c" "src/ipa/libasn/CMakeFiles/libasn.dir/TS102226AdditionalContactlessParameters.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/TS102226AdditionalContactlessParameters.c.o.d"
+  "/root/repo/src/ipa/libasn/TeletexCommonName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/TeletexCommonName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/TeletexCommonName.c.o.d"
+  "/root/repo/src/ipa/libasn/TeletexDomainDefinedAttribute.c" "src/ipa/libasn/CMakeFiles/libasn.dir/TeletexDomainDefinedAttribute.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/TeletexDomainDefinedAttribute.c.o.d"
+  "/root/repo/src/ipa/libasn/TeletexDomainDefinedAttributes.c" "src/ipa/libasn/CMakeFiles/libasn.dir/TeletexDomainDefinedAttributes.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/TeletexDomainDefinedAttributes.c.o.d"
+  "/root/repo/src/ipa/libasn/TeletexOrganizationName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/TeletexOrganizationName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/TeletexOrganizationName.c.o.d"
+  "/root/repo/src/ipa/libasn/TeletexOrganizationalUnitName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/TeletexOrganizationalUnitName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/TeletexOrganizationalUnitName.c.o.d"
+  "/root/repo/src/ipa/libasn/TeletexOrganizationalUnitNames.c" "src/ipa/libasn/CMakeFiles/libasn.dir/TeletexOrganizationalUnitNames.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/TeletexOrganizationalUnitNames.c.o.d"
+  "/root/repo/src/ipa/libasn/TeletexPersonalName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/TeletexPersonalName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/TeletexPersonalName.c.o.d"
+  "/root/repo/src/ipa/libasn/TeletexString.c" "src/ipa/libasn/CMakeFiles/libasn.dir/TeletexString.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/TeletexString.c.o.d"
+  "/root/repo/src/ipa/libasn/TerminalIdentifier.c" "src/ipa/libasn/CMakeFiles/libasn.dir/TerminalIdentifier.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/TerminalIdentifier.c.o.d"
+  "/root/repo/src/ipa/libasn/TerminalType.c" "src/ipa/libasn/CMakeFiles/libasn.dir/TerminalType.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/TerminalType.c.o.d"
+  "/root/repo/src/ipa/libasn/Time.c" "src/ipa/libasn/CMakeFiles/libasn.dir/Time.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/Time.c.o.d"
+  "/root/repo/src/ipa/libasn/TotalPartialCrlNumber.c" "src/ipa/libasn/CMakeFiles/libasn.dir/TotalPartialCrlNumber.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/TotalPartialCrlNumber.c.o.d"
+  "/root/repo/src/ipa/libasn/TransactionId.c" "src/ipa/libasn/CMakeFiles/libasn.dir/TransactionId.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/TransactionId.c.o.d"
+  "/root/repo/src/ipa/libasn/TransferEimPackageRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/TransferEimPackageRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/TransferEimPackageRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/TransferEimPackageResponse.c" "src/ipa/libasn/CMakeFiles/libasn.dir/TransferEimPackageResponse.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/TransferEimPackageResponse.c.o.d"
+  "/root/repo/src/ipa/libasn/UICCApplicationParameters.c" "src/ipa/libasn/CMakeFiles/libasn.dir/UICCApplicationParameters.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/UICCApplicationParameters.c.o.d"
+  "/root/repo/src/ipa/libasn/UICCCapability.c" "src/ipa/libasn/CMakeFiles/libasn.dir/UICCCapability.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/UICCCapability.c.o.d"
+  "/root/repo/src/ipa/libasn/UInt15.c" "src/ipa/libasn/CMakeFiles/libasn.dir/UInt15.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/UInt15.c.o.d"
+  "/root/repo/src/ipa/libasn/UInt16.c" "src/ipa/libasn/CMakeFiles/libasn.dir/UInt16.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/UInt16.c.o.d"
+  "/root/repo/src/ipa/libasn/UInt31.c" "src/ipa/libasn/CMakeFiles/libasn.dir/UInt31.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/UInt31.c.o.d"
+  "/root/repo/src/ipa/libasn/UInt8.c" "src/ipa/libasn/CMakeFiles/libasn.dir/UInt8.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/UInt8.c.o.d"
+  "/root/repo/src/ipa/libasn/UTCTime.c" "src/ipa/libasn/CMakeFiles/libasn.dir/UTCTime.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/UTCTime.c.o.d"
+  "/root/repo/src/ipa/libasn/UTF8String.c" "src/ipa/libasn/CMakeFiles/libasn.dir/UTF8String.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/UTF8String.c.o.d"
+  "/root/repo/src/ipa/libasn/UnformattedPostalAddress.c" "src/ipa/libasn/CMakeFiles/libasn.dir/UnformattedPostalAddress.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/UnformattedPostalAddress.c.o.d"
+  "/root/repo/src/ipa/libasn/UniqueIdentifier.c" "src/ipa/libasn/CMakeFiles/libasn.dir/UniqueIdentifier.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/UniqueIdentifier.c.o.d"
+  "/root/repo/src/ipa/libasn/UniquePostalName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/UniquePostalName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/UniquePostalName.c.o.d"
+  "/root/repo/src/ipa/libasn/UniversalString.c" "src/ipa/libasn/CMakeFiles/libasn.dir/UniversalString.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/UniversalString.c.o.d"
+  "/root/repo/src/ipa/libasn/UpdateEimResult.c" "src/ipa/libasn/CMakeFiles/libasn.dir/UpdateEimResult.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/UpdateEimResult.c.o.d"
+  "/root/repo/src/ipa/libasn/UpdateMetadataRequest.c" "src/ipa/libasn/CMakeFiles/libasn.dir/UpdateMetadataRequest.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/UpdateMetadataRequest.c.o.d"
+  "/root/repo/src/ipa/libasn/UserNotice.c" "src/ipa/libasn/CMakeFiles/libasn.dir/UserNotice.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/UserNotice.c.o.d"
+  "/root/repo/src/ipa/libasn/Validity.c" "src/ipa/libasn/CMakeFiles/libasn.dir/Validity.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/Validity.c.o.d"
+  "/root/repo/src/ipa/libasn/VendorSpecificExtension.c" "src/ipa/libasn/CMakeFiles/libasn.dir/VendorSpecificExtension.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/VendorSpecificExtension.c.o.d"
+  "/root/repo/src/ipa/libasn/Version.c" "src/ipa/libasn/CMakeFiles/libasn.dir/Version.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/Version.c.o.d"
+  "/root/repo/src/ipa/libasn/VersionType.c" "src/ipa/libasn/CMakeFiles/libasn.dir/VersionType.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/VersionType.c.o.d"
+  "/root/repo/src/ipa/libasn/VisibleString.c" "src/ipa/libasn/CMakeFiles/libasn.dir/VisibleString.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/VisibleString.c.o.d"
+  "/root/repo/src/ipa/libasn/X121Address.c" "src/ipa/libasn/CMakeFiles/libasn.dir/X121Address.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/X121Address.c.o.d"
+  "/root/repo/src/ipa/libasn/X520CommonName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/X520CommonName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/X520CommonName.c.o.d"
+  "/root/repo/src/ipa/libasn/X520LocalityName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/X520LocalityName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/X520LocalityName.c.o.d"
+  "/root/repo/src/ipa/libasn/X520OrganizationName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/X520OrganizationName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/X520OrganizationName.c.o.d"
+  "/root/repo/src/ipa/libasn/X520OrganizationalUnitName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/X520OrganizationalUnitName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/X520OrganizationalUnitName.c.o.d"
+  "/root/repo/src/ipa/libasn/X520Pseudonym.c" "src/ipa/libasn/CMakeFiles/libasn.dir/X520Pseudonym.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/X520Pseudonym.c.o.d"
+  "/root/repo/src/ipa/libasn/X520SerialNumber.c" "src/ipa/libasn/CMakeFiles/libasn.dir/X520SerialNumber.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/X520SerialNumber.c.o.d"
+  "/root/repo/src/ipa/libasn/X520StateOrProvinceName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/X520StateOrProvinceName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/X520StateOrProvinceName.c.o.d"
+  "/root/repo/src/ipa/libasn/X520Title.c" "src/ipa/libasn/CMakeFiles/libasn.dir/X520Title.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/X520Title.c.o.d"
+  "/root/repo/src/ipa/libasn/X520countryName.c" "src/ipa/libasn/CMakeFiles/libasn.dir/X520countryName.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/X520countryName.c.o.d"
+  "/root/repo/src/ipa/libasn/X520dnQualifier.c" "src/ipa/libasn/CMakeFiles/libasn.dir/X520dnQualifier.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/X520dnQualifier.c.o.d"
+  "/root/repo/src/ipa/libasn/X520name.c" "src/ipa/libasn/CMakeFiles/libasn.dir/X520name.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/X520name.c.o.d"
+  "/root/repo/src/ipa/libasn/asn_SEQUENCE_OF.c" "src/ipa/libasn/CMakeFiles/libasn.dir/asn_SEQUENCE_OF.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/asn_SEQUENCE_OF.c.o.d"
+  "/root/repo/src/ipa/libasn/asn_SET_OF.c" "src/ipa/libasn/CMakeFiles/libasn.dir/asn_SET_OF.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/asn_SET_OF.c.o.d"
+  "/root/repo/src/ipa/libasn/asn_application.c" "src/ipa/libasn/CMakeFiles/libasn.dir/asn_application.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/asn_application.c.o.d"
+  "/root/repo/src/ipa/libasn/asn_arena.c" "src/ipa/libasn/CMakeFiles/libasn.dir/asn_arena.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/asn_arena.c.o.d"
+  "/root/repo/src/ipa/libasn/asn_bit_data.c" "src/ipa/libasn/CMakeFiles/libasn.dir/asn_bit_data.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/asn_bit_data.c.o.d"
+  "/root/repo/src/ipa/libasn/asn_codecs_prim.c" "src/ipa/libasn/CMakeFiles/libasn.dir/asn_codecs_prim.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/asn_codecs_prim.c.o.d"
+  "/root/repo/src/ipa/libasn/asn_internal.c" "src/ipa/libasn/CMakeFiles/libasn.dir/asn_internal.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/asn_internal.c.o.d"
+  "/root/repo/src/ipa/libasn/asn_random_fill.c" "src/ipa/libasn/CMakeFiles/libasn.dir/asn_random_fill.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/asn_random_fill.c.o.d"
+  "/root/repo/src/ipa/libasn/ber_decoder.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ber_decoder.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ber_decoder.c.o.d"
+  "/root/repo/src/ipa/libasn/ber_tlv_length.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ber_tlv_length.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ber_tlv_length.c.o.d"
+  "/root/repo/src/ipa/libasn/ber_tlv_tag.c" "src/ipa/libasn/CMakeFiles/libasn.dir/ber_tlv_tag.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/ber_tlv_tag.c.o.d"
+  "/root/repo/src/ipa/libasn/constr_CHOICE.c" "src/ipa/libasn/CMakeFiles/libasn.dir/constr_CHOICE.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/constr_CHOICE.c.o.d"
+  "/root/repo/src/ipa/libasn/constr_CHOICE_oer.c" "src/ipa/libasn/CMakeFiles/libasn.dir/constr_CHOICE_oer.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/constr_CHOICE_oer.c.o.d"
+  "/root/repo/src/ipa/libasn/constr_SEQUENCE.c" "src/ipa/libasn/CMakeFiles/libasn.dir/constr_SEQUENCE.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/constr_SEQUENCE.c.o.d"
+  "/root/repo/src/ipa/libasn/constr_SEQUENCE_OF.c" "src/ipa/libasn/CMakeFiles/libasn.dir/constr_SEQUENCE_OF.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/constr_SEQUENCE_OF.c.o.d"
+  "/root/repo/src/ipa/libasn/constr_SEQUENCE_oer.c" "src/ipa/libasn/CMakeFiles/libasn.dir/constr_SEQUENCE_oer.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/constr_SEQUENCE_oer.c.o.d"
+  "/root/repo/src/ipa/libasn/constr_SET.c" "src/ipa/libasn/CMakeFiles/libasn.dir/constr_SET.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/constr_SET.c.o.d"
+  "/root/repo/src/ipa/libasn/constr_SET_OF.c" "src/ipa/libasn/CMakeFiles/libasn.dir/constr_SET_OF.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/constr_SET_OF.c.o.d"
+  "/root/repo/src/ipa/libasn/constr_SET_OF_oer.c" "src/ipa/libasn/CMakeFiles/libasn.dir/constr_SET_OF_oer.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/constr_SET_OF_oer.c.o.d"
+  "/root/repo/src/ipa/libasn/constr_TYPE.c" "src/ipa/libasn/CMakeFiles/libasn.dir/constr_TYPE.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/constr_TYPE.c.o.d"
+  "/root/repo/src/ipa/libasn/constraints.c" "src/ipa/libasn/CMakeFiles/libasn.dir/constraints.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/constraints.c.o.d"
+  "/root/repo/src/ipa/libasn/der_encoder.c" "src/ipa/libasn/CMakeFiles/libasn.dir/der_encoder.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/der_encoder.c.o.d"
+  "/root/repo/src/ipa/libasn/oer_decoder.c" "src/ipa/libasn/CMakeFiles/libasn.dir/oer_decoder.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/oer_decoder.c.o.d"
+  "/root/repo/src/ipa/libasn/oer_encoder.c" "src/ipa/libasn/CMakeFiles/libasn.dir/oer_encoder.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/oer_encoder.c.o.d"
+  "/root/repo/src/ipa/libasn/oer_support.c" "src/ipa/libasn/CMakeFiles/libasn.dir/oer_support.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/oer_support.c.o.d"
+  "/root/repo/src/ipa/libasn/per_decoder.c" "src/ipa/libasn/CMakeFiles/libasn.dir/per_decoder.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/per_decoder.c.o.d"
+  "/root/repo/src/ipa/libasn/per_encoder.c" "src/ipa/libasn/CMakeFiles/libasn.dir/per_encoder.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/per_encoder.c.o.d"
+  "/root/repo/src/ipa/libasn/per_opentype.c" "src/ipa/libasn/CMakeFiles/libasn.dir/per_opentype.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/per_opentype.c.o.d"
+  "/root/repo/src/ipa/libasn/per_support.c" "src/ipa/libasn/CMakeFiles/libasn.dir/per_support.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/per_support.c.o.d"
+  "/root/repo/src/ipa/libasn/xer_decoder.c" "src/ipa/libasn/CMakeFiles/libasn.dir/xer_decoder.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/xer_decoder.c.o.d"
+  "/root/repo/src/ipa/libasn/xer_encoder.c" "src/ipa/libasn/CMakeFiles/libasn.dir/xer_encoder.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/xer_encoder.c.o.d"
+  "/root/repo/src/ipa/libasn/xer_support.c" "src/ipa/libasn/CMakeFiles/libasn.dir/xer_support.c.o" "gcc" "src/ipa/libasn/CMakeFiles/libasn.dir/xer_support.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
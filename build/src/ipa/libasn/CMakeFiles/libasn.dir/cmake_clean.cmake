@@ -0,0 +1,959 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libasn.dir/ADFRFMAccess.c.o"
+  "CMakeFiles/libasn.dir/ADFRFMAccess.c.o.d"
+  "CMakeFiles/libasn.dir/ANY.c.o"
+  "CMakeFiles/libasn.dir/ANY.c.o.d"
+  "CMakeFiles/libasn.dir/AccessDescription.c.o"
+  "CMakeFiles/libasn.dir/AccessDescription.c.o.d"
+  "CMakeFiles/libasn.dir/AddEimResult.c.o"
+  "CMakeFiles/libasn.dir/AddEimResult.c.o.d"
+  "CMakeFiles/libasn.dir/AddInitialEimRequest.c.o"
+  "CMakeFiles/libasn.dir/AddInitialEimRequest.c.o.d"
+  "CMakeFiles/libasn.dir/AddInitialEimResponse.c.o"
+  "CMakeFiles/libasn.dir/AddInitialEimResponse.c.o.d"
+  "CMakeFiles/libasn.dir/AdministrationDomainName.c.o"
+  "CMakeFiles/libasn.dir/AdministrationDomainName.c.o.d"
+  "CMakeFiles/libasn.dir/AlgoParameter.c.o"
+  "CMakeFiles/libasn.dir/AlgoParameter.c.o.d"
+  "CMakeFiles/libasn.dir/AlgorithmIdentifier.c.o"
+  "CMakeFiles/libasn.dir/AlgorithmIdentifier.c.o.d"
+  "CMakeFiles/libasn.dir/AnotherName.c.o"
+  "CMakeFiles/libasn.dir/AnotherName.c.o.d"
+  "CMakeFiles/libasn.dir/ApplicationIdentifier.c.o"
+  "CMakeFiles/libasn.dir/ApplicationIdentifier.c.o.d"
+  "CMakeFiles/libasn.dir/ApplicationInstance.c.o"
+  "CMakeFiles/libasn.dir/ApplicationInstance.c.o.d"
+  "CMakeFiles/libasn.dir/ApplicationLoadPackage.c.o"
+  "CMakeFiles/libasn.dir/ApplicationLoadPackage.c.o.d"
+  "CMakeFiles/libasn.dir/ApplicationSystemParameters.c.o"
+  "CMakeFiles/libasn.dir/ApplicationSystemParameters.c.o.d"
+  "CMakeFiles/libasn.dir/Attribute.c.o"
+  "CMakeFiles/libasn.dir/Attribute.c.o.d"
+  "CMakeFiles/libasn.dir/AttributeType.c.o"
+  "CMakeFiles/libasn.dir/AttributeType.c.o.d"
+  "CMakeFiles/libasn.dir/AttributeTypeAndValue.c.o"
+  "CMakeFiles/libasn.dir/AttributeTypeAndValue.c.o.d"
+  "CMakeFiles/libasn.dir/AttributeValue.c.o"
+  "CMakeFiles/libasn.dir/AttributeValue.c.o.d"
+  "CMakeFiles/libasn.dir/AuthenticateClientOk.c.o"
+  "CMakeFiles/libasn.dir/AuthenticateClientOk.c.o.d"
+  "CMakeFiles/libasn.dir/AuthenticateClientOkDPEsipa.c.o"
+  "CMakeFiles/libasn.dir/AuthenticateClientOkDPEsipa.c.o.d"
+  "CMakeFiles/libasn.dir/AuthenticateClientOkDSEsipa.c.o"
+  "CMakeFiles/libasn.dir/AuthenticateClientOkDSEsipa.c.o.d"
+  "CMakeFiles/libasn.dir/AuthenticateClientOkEs11.c.o"
+  "CMakeFiles/libasn.dir/AuthenticateClientOkEs11.c.o.d"
+  "CMakeFiles/libasn.dir/AuthenticateClientRequest.c.o"
+  "CMakeFiles/libasn.dir/AuthenticateClientRequest.c.o.d"
+  "CMakeFiles/libasn.dir/AuthenticateClientRequestEsipa.c.o"
+  "CMakeFiles/libasn.dir/AuthenticateClientRequestEsipa.c.o.d"
+  "CMakeFiles/libasn.dir/AuthenticateClientResponseEs11.c.o"
+  "CMakeFiles/libasn.dir/AuthenticateClientResponseEs11.c.o.d"
+  "CMakeFiles/libasn.dir/AuthenticateClientResponseEs9.c.o"
+  "CMakeFiles/libasn.dir/AuthenticateClientResponseEs9.c.o.d"
+  "CMakeFiles/libasn.dir/AuthenticateClientResponseEsipa.c.o"
+  "CMakeFiles/libasn.dir/AuthenticateClientResponseEsipa.c.o.d"
+  "CMakeFiles/libasn.dir/AuthenticateErrorCode.c.o"
+  "CMakeFiles/libasn.dir/AuthenticateErrorCode.c.o.d"
+  "CMakeFiles/libasn.dir/AuthenticateResponseError.c.o"
+  "CMakeFiles/libasn.dir/AuthenticateResponseError.c.o.d"
+  "CMakeFiles/libasn.dir/AuthenticateResponseOk.c.o"
+  "CMakeFiles/libasn.dir/AuthenticateResponseOk.c.o.d"
+  "CMakeFiles/libasn.dir/AuthenticateServerRequest.c.o"
+  "CMakeFiles/libasn.dir/AuthenticateServerRequest.c.o.d"
+  "CMakeFiles/libasn.dir/AuthenticateServerResponse.c.o"
+  "CMakeFiles/libasn.dir/AuthenticateServerResponse.c.o.d"
+  "CMakeFiles/libasn.dir/AuthorityInfoAccessSyntax.c.o"
+  "CMakeFiles/libasn.dir/AuthorityInfoAccessSyntax.c.o.d"
+  "CMakeFiles/libasn.dir/AuthorityKeyIdentifier.c.o"
+  "CMakeFiles/libasn.dir/AuthorityKeyIdentifier.c.o.d"
+  "CMakeFiles/libasn.dir/BIT_STRING.c.o"
+  "CMakeFiles/libasn.dir/BIT_STRING.c.o.d"
+  "CMakeFiles/libasn.dir/BIT_STRING_oer.c.o"
+  "CMakeFiles/libasn.dir/BIT_STRING_oer.c.o.d"
+  "CMakeFiles/libasn.dir/BMPString.c.o"
+  "CMakeFiles/libasn.dir/BMPString.c.o.d"
+  "CMakeFiles/libasn.dir/BOOLEAN.c.o"
+  "CMakeFiles/libasn.dir/BOOLEAN.c.o.d"
+  "CMakeFiles/libasn.dir/BaseCRLNumber.c.o"
+  "CMakeFiles/libasn.dir/BaseCRLNumber.c.o.d"
+  "CMakeFiles/libasn.dir/BaseDistance.c.o"
+  "CMakeFiles/libasn.dir/BaseDistance.c.o.d"
+  "CMakeFiles/libasn.dir/BasicConstraints.c.o"
+  "CMakeFiles/libasn.dir/BasicConstraints.c.o.d"
+  "CMakeFiles/libasn.dir/BoundProfilePackage-86tlv.c.o"
+  "CMakeFiles/libasn.dir/BoundProfilePackage-86tlv.c.o.d"
+  "CMakeFiles/libasn.dir/BoundProfilePackage-87tlv.c.o"
+  "CMakeFiles/libasn.dir/BoundProfilePackage-87tlv.c.o.d"
+  "CMakeFiles/libasn.dir/BoundProfilePackage-88tlv.c.o"
+  "CMakeFiles/libasn.dir/BoundProfilePackage-88tlv.c.o.d"
+  "CMakeFiles/libasn.dir/BoundProfilePackage-FirstSequenceOf87.c.o"
+  "CMakeFiles/libasn.dir/BoundProfilePackage-FirstSequenceOf87.c.o.d"
+  "CMakeFiles/libasn.dir/BoundProfilePackage-SecondSequenceOf87.c.o"
+  "CMakeFiles/libasn.dir/BoundProfilePackage-SecondSequenceOf87.c.o.d"
+  "CMakeFiles/libasn.dir/BoundProfilePackage-SequenceOf86.c.o"
+  "CMakeFiles/libasn.dir/BoundProfilePackage-SequenceOf86.c.o.d"
+  "CMakeFiles/libasn.dir/BoundProfilePackage-SequenceOf88.c.o"
+  "CMakeFiles/libasn.dir/BoundProfilePackage-SequenceOf88.c.o.d"
+  "CMakeFiles/libasn.dir/BoundProfilePackage.c.o"
+  "CMakeFiles/libasn.dir/BoundProfilePackage.c.o.d"
+  "CMakeFiles/libasn.dir/BppCommandId.c.o"
+  "CMakeFiles/libasn.dir/BppCommandId.c.o.d"
+  "CMakeFiles/libasn.dir/BuiltInDomainDefinedAttribute.c.o"
+  "CMakeFiles/libasn.dir/BuiltInDomainDefinedAttribute.c.o.d"
+  "CMakeFiles/libasn.dir/BuiltInDomainDefinedAttributes.c.o"
+  "CMakeFiles/libasn.dir/BuiltInDomainDefinedAttributes.c.o.d"
+  "CMakeFiles/libasn.dir/BuiltInStandardAttributes.c.o"
+  "CMakeFiles/libasn.dir/BuiltInStandardAttributes.c.o.d"
+  "CMakeFiles/libasn.dir/CPSuri.c.o"
+  "CMakeFiles/libasn.dir/CPSuri.c.o.d"
+  "CMakeFiles/libasn.dir/CRLDistributionPoints.c.o"
+  "CMakeFiles/libasn.dir/CRLDistributionPoints.c.o.d"
+  "CMakeFiles/libasn.dir/CRLNumber.c.o"
+  "CMakeFiles/libasn.dir/CRLNumber.c.o.d"
+  "CMakeFiles/libasn.dir/CRLReason.c.o"
+  "CMakeFiles/libasn.dir/CRLReason.c.o.d"
+  "CMakeFiles/libasn.dir/CancelSessionOk.c.o"
+  "CMakeFiles/libasn.dir/CancelSessionOk.c.o.d"
+  "CMakeFiles/libasn.dir/CancelSessionReason.c.o"
+  "CMakeFiles/libasn.dir/CancelSessionReason.c.o.d"
+  "CMakeFiles/libasn.dir/CancelSessionRequest.c.o"
+  "CMakeFiles/libasn.dir/CancelSessionRequest.c.o.d"
+  "CMakeFiles/libasn.dir/CancelSessionRequestEs9.c.o"
+  "CMakeFiles/libasn.dir/CancelSessionRequestEs9.c.o.d"
+  "CMakeFiles/libasn.dir/CancelSessionRequestEsipa.c.o"
+  "CMakeFiles/libasn.dir/CancelSessionRequestEsipa.c.o.d"
+  "CMakeFiles/libasn.dir/CancelSessionResponse.c.o"
+  "CMakeFiles/libasn.dir/CancelSessionResponse.c.o.d"
+  "CMakeFiles/libasn.dir/CancelSessionResponseEs9.c.o"
+  "CMakeFiles/libasn.dir/CancelSessionResponseEs9.c.o.d"
+  "CMakeFiles/libasn.dir/CancelSessionResponseEsipa.c.o"
+  "CMakeFiles/libasn.dir/CancelSessionResponseEsipa.c.o.d"
+  "CMakeFiles/libasn.dir/CancelSessionResponseOk.c.o"
+  "CMakeFiles/libasn.dir/CancelSessionResponseOk.c.o.d"
+  "CMakeFiles/libasn.dir/CatSupportedClasses.c.o"
+  "CMakeFiles/libasn.dir/CatSupportedClasses.c.o.d"
+  "CMakeFiles/libasn.dir/CertPolicyId.c.o"
+  "CMakeFiles/libasn.dir/CertPolicyId.c.o.d"
+  "CMakeFiles/libasn.dir/Certificate.c.o"
+  "CMakeFiles/libasn.dir/Certificate.c.o.d"
+  "CMakeFiles/libasn.dir/CertificateInfo.c.o"
+  "CMakeFiles/libasn.dir/CertificateInfo.c.o.d"
+  "CMakeFiles/libasn.dir/CertificateIssuer.c.o"
+  "CMakeFiles/libasn.dir/CertificateIssuer.c.o.d"
+  "CMakeFiles/libasn.dir/CertificateList.c.o"
+  "CMakeFiles/libasn.dir/CertificateList.c.o.d"
+  "CMakeFiles/libasn.dir/CertificatePolicies.c.o"
+  "CMakeFiles/libasn.dir/CertificatePolicies.c.o.d"
+  "CMakeFiles/libasn.dir/CertificateSerialNumber.c.o"
+  "CMakeFiles/libasn.dir/CertificateSerialNumber.c.o.d"
+  "CMakeFiles/libasn.dir/CertificationDataObject.c.o"
+  "CMakeFiles/libasn.dir/CertificationDataObject.c.o.d"
+  "CMakeFiles/libasn.dir/CommonName.c.o"
+  "CMakeFiles/libasn.dir/CommonName.c.o.d"
+  "CMakeFiles/libasn.dir/CompactAuthenticateResponseOk.c.o"
+  "CMakeFiles/libasn.dir/CompactAuthenticateResponseOk.c.o.d"
+  "CMakeFiles/libasn.dir/CompactCancelSessionResponseOk.c.o"
+  "CMakeFiles/libasn.dir/CompactCancelSessionResponseOk.c.o.d"
+  "CMakeFiles/libasn.dir/CompactEuiccCancelSessionSigned.c.o"
+  "CMakeFiles/libasn.dir/CompactEuiccCancelSessionSigned.c.o.d"
+  "CMakeFiles/libasn.dir/CompactEuiccSigned1.c.o"
+  "CMakeFiles/libasn.dir/CompactEuiccSigned1.c.o.d"
+  "CMakeFiles/libasn.dir/CompactEuiccSigned2.c.o"
+  "CMakeFiles/libasn.dir/CompactEuiccSigned2.c.o.d"
+  "CMakeFiles/libasn.dir/CompactOtherSignedNotification.c.o"
+  "CMakeFiles/libasn.dir/CompactOtherSignedNotification.c.o.d"
+  "CMakeFiles/libasn.dir/CompactPrepareDownloadResponseOk.c.o"
+  "CMakeFiles/libasn.dir/CompactPrepareDownloadResponseOk.c.o.d"
+  "CMakeFiles/libasn.dir/CompactProfileInstallationResult.c.o"
+  "CMakeFiles/libasn.dir/CompactProfileInstallationResult.c.o.d"
+  "CMakeFiles/libasn.dir/CompactProfileInstallationResultData.c.o"
+  "CMakeFiles/libasn.dir/CompactProfileInstallationResultData.c.o.d"
+  "CMakeFiles/libasn.dir/CompactSuccessResult.c.o"
+  "CMakeFiles/libasn.dir/CompactSuccessResult.c.o.d"
+  "CMakeFiles/libasn.dir/ConfigureAutoEnableResult.c.o"
+  "CMakeFiles/libasn.dir/ConfigureAutoEnableResult.c.o.d"
+  "CMakeFiles/libasn.dir/ConfigureAutoProfileEnablingRequest.c.o"
+  "CMakeFiles/libasn.dir/ConfigureAutoProfileEnablingRequest.c.o.d"
+  "CMakeFiles/libasn.dir/ConfigureAutoProfileEnablingResponse.c.o"
+  "CMakeFiles/libasn.dir/ConfigureAutoProfileEnablingResponse.c.o.d"
+  "CMakeFiles/libasn.dir/ConfigureISDPRequest.c.o"
+  "CMakeFiles/libasn.dir/ConfigureISDPRequest.c.o.d"
+  "CMakeFiles/libasn.dir/ControlRefTemplate.c.o"
+  "CMakeFiles/libasn.dir/ControlRefTemplate.c.o.d"
+  "CMakeFiles/libasn.dir/ControlReferenceTemplate.c.o"
+  "CMakeFiles/libasn.dir/ControlReferenceTemplate.c.o.d"
+  "CMakeFiles/libasn.dir/CountryName.c.o"
+  "CMakeFiles/libasn.dir/CountryName.c.o.d"
+  "CMakeFiles/libasn.dir/CtxParams1.c.o"
+  "CMakeFiles/libasn.dir/CtxParams1.c.o.d"
+  "CMakeFiles/libasn.dir/CtxParamsForCommonAuthentication.c.o"
+  "CMakeFiles/libasn.dir/CtxParamsForCommonAuthentication.c.o.d"
+  "CMakeFiles/libasn.dir/DeleteEimResult.c.o"
+  "CMakeFiles/libasn.dir/DeleteEimResult.c.o.d"
+  "CMakeFiles/libasn.dir/DeleteProfileRequest.c.o"
+  "CMakeFiles/libasn.dir/DeleteProfileRequest.c.o.d"
+  "CMakeFiles/libasn.dir/DeleteProfileResponse.c.o"
+  "CMakeFiles/libasn.dir/DeleteProfileResponse.c.o.d"
+  "CMakeFiles/libasn.dir/DeleteProfileResult.c.o"
+  "CMakeFiles/libasn.dir/DeleteProfileResult.c.o.d"
+  "CMakeFiles/libasn.dir/DeviceAdditionalFeatureSupport.c.o"
+  "CMakeFiles/libasn.dir/DeviceAdditionalFeatureSupport.c.o.d"
+  "CMakeFiles/libasn.dir/DeviceCapabilities.c.o"
+  "CMakeFiles/libasn.dir/DeviceCapabilities.c.o.d"
+  "CMakeFiles/libasn.dir/DeviceInfo.c.o"
+  "CMakeFiles/libasn.dir/DeviceInfo.c.o.d"
+  "CMakeFiles/libasn.dir/DirectoryString.c.o"
+  "CMakeFiles/libasn.dir/DirectoryString.c.o.d"
+  "CMakeFiles/libasn.dir/DisableProfileRequest.c.o"
+  "CMakeFiles/libasn.dir/DisableProfileRequest.c.o.d"
+  "CMakeFiles/libasn.dir/DisableProfileResponse.c.o"
+  "CMakeFiles/libasn.dir/DisableProfileResponse.c.o.d"
+  "CMakeFiles/libasn.dir/DisableProfileResult.c.o"
+  "CMakeFiles/libasn.dir/DisableProfileResult.c.o.d"
+  "CMakeFiles/libasn.dir/DisplayText.c.o"
+  "CMakeFiles/libasn.dir/DisplayText.c.o.d"
+  "CMakeFiles/libasn.dir/DistinguishedName.c.o"
+  "CMakeFiles/libasn.dir/DistinguishedName.c.o.d"
+  "CMakeFiles/libasn.dir/DistributionPoint.c.o"
+  "CMakeFiles/libasn.dir/DistributionPoint.c.o.d"
+  "CMakeFiles/libasn.dir/DistributionPointName.c.o"
+  "CMakeFiles/libasn.dir/DistributionPointName.c.o.d"
+  "CMakeFiles/libasn.dir/DomainComponent.c.o"
+  "CMakeFiles/libasn.dir/DomainComponent.c.o.d"
+  "CMakeFiles/libasn.dir/DownloadErrorCode.c.o"
+  "CMakeFiles/libasn.dir/DownloadErrorCode.c.o.d"
+  "CMakeFiles/libasn.dir/DpProprietaryData.c.o"
+  "CMakeFiles/libasn.dir/DpProprietaryData.c.o.d"
+  "CMakeFiles/libasn.dir/EDIPartyName.c.o"
+  "CMakeFiles/libasn.dir/EDIPartyName.c.o.d"
+  "CMakeFiles/libasn.dir/EUICCInfo1.c.o"
+  "CMakeFiles/libasn.dir/EUICCInfo1.c.o.d"
+  "CMakeFiles/libasn.dir/EUICCInfo2.c.o"
+  "CMakeFiles/libasn.dir/EUICCInfo2.c.o.d"
+  "CMakeFiles/libasn.dir/EUICCResponse.c.o"
+  "CMakeFiles/libasn.dir/EUICCResponse.c.o.d"
+  "CMakeFiles/libasn.dir/EUICCSigned2.c.o"
+  "CMakeFiles/libasn.dir/EUICCSigned2.c.o.d"
+  "CMakeFiles/libasn.dir/Eco.c.o"
+  "CMakeFiles/libasn.dir/Eco.c.o.d"
+  "CMakeFiles/libasn.dir/EimAcknowledgements.c.o"
+  "CMakeFiles/libasn.dir/EimAcknowledgements.c.o.d"
+  "CMakeFiles/libasn.dir/EimConfigurationData.c.o"
+  "CMakeFiles/libasn.dir/EimConfigurationData.c.o.d"
+  "CMakeFiles/libasn.dir/EimIdInfo.c.o"
+  "CMakeFiles/libasn.dir/EimIdInfo.c.o.d"
+  "CMakeFiles/libasn.dir/EimIdType.c.o"
+  "CMakeFiles/libasn.dir/EimIdType.c.o.d"
+  "CMakeFiles/libasn.dir/EimSupportedProtocol.c.o"
+  "CMakeFiles/libasn.dir/EimSupportedProtocol.c.o.d"
+  "CMakeFiles/libasn.dir/EmailAddress.c.o"
+  "CMakeFiles/libasn.dir/EmailAddress.c.o.d"
+  "CMakeFiles/libasn.dir/EnableProfileRequest.c.o"
+  "CMakeFiles/libasn.dir/EnableProfileRequest.c.o.d"
+  "CMakeFiles/libasn.dir/EnableProfileResponse.c.o"
+  "CMakeFiles/libasn.dir/EnableProfileResponse.c.o.d"
+  "CMakeFiles/libasn.dir/EnableProfileResult.c.o"
+  "CMakeFiles/libasn.dir/EnableProfileResult.c.o.d"
+  "CMakeFiles/libasn.dir/EnableUsingDDRequest.c.o"
+  "CMakeFiles/libasn.dir/EnableUsingDDRequest.c.o.d"
+  "CMakeFiles/libasn.dir/EnableUsingDDResponse.c.o"
+  "CMakeFiles/libasn.dir/EnableUsingDDResponse.c.o.d"
+  "CMakeFiles/libasn.dir/ErrorReason.c.o"
+  "CMakeFiles/libasn.dir/ErrorReason.c.o.d"
+  "CMakeFiles/libasn.dir/ErrorResult.c.o"
+  "CMakeFiles/libasn.dir/ErrorResult.c.o.d"
+  "CMakeFiles/libasn.dir/EsipaMessageFromEimToIpa.c.o"
+  "CMakeFiles/libasn.dir/EsipaMessageFromEimToIpa.c.o.d"
+  "CMakeFiles/libasn.dir/EsipaMessageFromIpaToEim.c.o"
+  "CMakeFiles/libasn.dir/EsipaMessageFromIpaToEim.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccCancelSessionSigned.c.o"
+  "CMakeFiles/libasn.dir/EuiccCancelSessionSigned.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccConfiguredAddressesRequest.c.o"
+  "CMakeFiles/libasn.dir/EuiccConfiguredAddressesRequest.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccConfiguredAddressesResponse.c.o"
+  "CMakeFiles/libasn.dir/EuiccConfiguredAddressesResponse.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccFormFactorType.c.o"
+  "CMakeFiles/libasn.dir/EuiccFormFactorType.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccMemoryResetRequest.c.o"
+  "CMakeFiles/libasn.dir/EuiccMemoryResetRequest.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccMemoryResetResponse.c.o"
+  "CMakeFiles/libasn.dir/EuiccMemoryResetResponse.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccPackage.c.o"
+  "CMakeFiles/libasn.dir/EuiccPackage.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccPackageErrorCode.c.o"
+  "CMakeFiles/libasn.dir/EuiccPackageErrorCode.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccPackageErrorDataSigned.c.o"
+  "CMakeFiles/libasn.dir/EuiccPackageErrorDataSigned.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccPackageErrorSigned.c.o"
+  "CMakeFiles/libasn.dir/EuiccPackageErrorSigned.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccPackageErrorUnsigned.c.o"
+  "CMakeFiles/libasn.dir/EuiccPackageErrorUnsigned.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccPackageRequest.c.o"
+  "CMakeFiles/libasn.dir/EuiccPackageRequest.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccPackageResult.c.o"
+  "CMakeFiles/libasn.dir/EuiccPackageResult.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccPackageResultDataSigned.c.o"
+  "CMakeFiles/libasn.dir/EuiccPackageResultDataSigned.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccPackageResultSigned.c.o"
+  "CMakeFiles/libasn.dir/EuiccPackageResultSigned.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccPackageSigned.c.o"
+  "CMakeFiles/libasn.dir/EuiccPackageSigned.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccResultData.c.o"
+  "CMakeFiles/libasn.dir/EuiccResultData.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccSignPIR.c.o"
+  "CMakeFiles/libasn.dir/EuiccSignPIR.c.o.d"
+  "CMakeFiles/libasn.dir/EuiccSigned1.c.o"
+  "CMakeFiles/libasn.dir/EuiccSigned1.c.o.d"
+  "CMakeFiles/libasn.dir/EventEntries.c.o"
+  "CMakeFiles/libasn.dir/EventEntries.c.o.d"
+  "CMakeFiles/libasn.dir/ExpirationDate.c.o"
+  "CMakeFiles/libasn.dir/ExpirationDate.c.o.d"
+  "CMakeFiles/libasn.dir/ExtKeyUsageSyntax.c.o"
+  "CMakeFiles/libasn.dir/ExtKeyUsageSyntax.c.o.d"
+  "CMakeFiles/libasn.dir/ExtendedNetworkAddress.c.o"
+  "CMakeFiles/libasn.dir/ExtendedNetworkAddress.c.o.d"
+  "CMakeFiles/libasn.dir/Extension.c.o"
+  "CMakeFiles/libasn.dir/Extension.c.o.d"
+  "CMakeFiles/libasn.dir/ExtensionAttribute.c.o"
+  "CMakeFiles/libasn.dir/ExtensionAttribute.c.o.d"
+  "CMakeFiles/libasn.dir/ExtensionAttributes.c.o"
+  "CMakeFiles/libasn.dir/ExtensionAttributes.c.o.d"
+  "CMakeFiles/libasn.dir/ExtensionORAddressComponents.c.o"
+  "CMakeFiles/libasn.dir/ExtensionORAddressComponents.c.o.d"
+  "CMakeFiles/libasn.dir/ExtensionPhysicalDeliveryAddressComponents.c.o"
+  "CMakeFiles/libasn.dir/ExtensionPhysicalDeliveryAddressComponents.c.o.d"
+  "CMakeFiles/libasn.dir/Extensions.c.o"
+  "CMakeFiles/libasn.dir/Extensions.c.o.d"
+  "CMakeFiles/libasn.dir/Fcp.c.o"
+  "CMakeFiles/libasn.dir/Fcp.c.o.d"
+  "CMakeFiles/libasn.dir/File.c.o"
+  "CMakeFiles/libasn.dir/File.c.o.d"
+  "CMakeFiles/libasn.dir/FileManagement.c.o"
+  "CMakeFiles/libasn.dir/FileManagement.c.o.d"
+  "CMakeFiles/libasn.dir/FreshestCRL.c.o"
+  "CMakeFiles/libasn.dir/FreshestCRL.c.o.d"
+  "CMakeFiles/libasn.dir/GeneralName.c.o"
+  "CMakeFiles/libasn.dir/GeneralName.c.o.d"
+  "CMakeFiles/libasn.dir/GeneralNames.c.o"
+  "CMakeFiles/libasn.dir/GeneralNames.c.o.d"
+  "CMakeFiles/libasn.dir/GeneralSubtree.c.o"
+  "CMakeFiles/libasn.dir/GeneralSubtree.c.o.d"
+  "CMakeFiles/libasn.dir/GeneralSubtrees.c.o"
+  "CMakeFiles/libasn.dir/GeneralSubtrees.c.o.d"
+  "CMakeFiles/libasn.dir/GeneralizedTime.c.o"
+  "CMakeFiles/libasn.dir/GeneralizedTime.c.o.d"
+  "CMakeFiles/libasn.dir/GetBoundProfilePackageOk.c.o"
+  "CMakeFiles/libasn.dir/GetBoundProfilePackageOk.c.o.d"
+  "CMakeFiles/libasn.dir/GetBoundProfilePackageOkEsipa.c.o"
+  "CMakeFiles/libasn.dir/GetBoundProfilePackageOkEsipa.c.o.d"
+  "CMakeFiles/libasn.dir/GetBoundProfilePackageRequest.c.o"
+  "CMakeFiles/libasn.dir/GetBoundProfilePackageRequest.c.o.d"
+  "CMakeFiles/libasn.dir/GetBoundProfilePackageRequestEsipa.c.o"
+  "CMakeFiles/libasn.dir/GetBoundProfilePackageRequestEsipa.c.o.d"
+  "CMakeFiles/libasn.dir/GetBoundProfilePackageResponse.c.o"
+  "CMakeFiles/libasn.dir/GetBoundProfilePackageResponse.c.o.d"
+  "CMakeFiles/libasn.dir/GetBoundProfilePackageResponseEsipa.c.o"
+  "CMakeFiles/libasn.dir/GetBoundProfilePackageResponseEsipa.c.o.d"
+  "CMakeFiles/libasn.dir/GetCertsRequest.c.o"
+  "CMakeFiles/libasn.dir/GetCertsRequest.c.o.d"
+  "CMakeFiles/libasn.dir/GetCertsResponse.c.o"
+  "CMakeFiles/libasn.dir/GetCertsResponse.c.o.d"
+  "CMakeFiles/libasn.dir/GetEimConfigurationDataRequest.c.o"
+  "CMakeFiles/libasn.dir/GetEimConfigurationDataRequest.c.o.d"
+  "CMakeFiles/libasn.dir/GetEimConfigurationDataResponse.c.o"
+  "CMakeFiles/libasn.dir/GetEimConfigurationDataResponse.c.o.d"
+  "CMakeFiles/libasn.dir/GetEimPackageRequest.c.o"
+  "CMakeFiles/libasn.dir/GetEimPackageRequest.c.o.d"
+  "CMakeFiles/libasn.dir/GetEimPackageResponse.c.o"
+  "CMakeFiles/libasn.dir/GetEimPackageResponse.c.o.d"
+  "CMakeFiles/libasn.dir/GetEuiccChallengeRequest.c.o"
+  "CMakeFiles/libasn.dir/GetEuiccChallengeRequest.c.o.d"
+  "CMakeFiles/libasn.dir/GetEuiccChallengeResponse.c.o"
+  "CMakeFiles/libasn.dir/GetEuiccChallengeResponse.c.o.d"
+  "CMakeFiles/libasn.dir/GetEuiccDataRequest.c.o"
+  "CMakeFiles/libasn.dir/GetEuiccDataRequest.c.o.d"
+  "CMakeFiles/libasn.dir/GetEuiccDataResponse.c.o"
+  "CMakeFiles/libasn.dir/GetEuiccDataResponse.c.o.d"
+  "CMakeFiles/libasn.dir/GetEuiccInfo1Request.c.o"
+  "CMakeFiles/libasn.dir/GetEuiccInfo1Request.c.o.d"
+  "CMakeFiles/libasn.dir/GetEuiccInfo2Request.c.o"
+  "CMakeFiles/libasn.dir/GetEuiccInfo2Request.c.o.d"
+  "CMakeFiles/libasn.dir/GetRatRequest.c.o"
+  "CMakeFiles/libasn.dir/GetRatRequest.c.o.d"
+  "CMakeFiles/libasn.dir/GetRatResponse.c.o"
+  "CMakeFiles/libasn.dir/GetRatResponse.c.o.d"
+  "CMakeFiles/libasn.dir/HandleNotification.c.o"
+  "CMakeFiles/libasn.dir/HandleNotification.c.o.d"
+  "CMakeFiles/libasn.dir/HandleNotificationEsipa.c.o"
+  "CMakeFiles/libasn.dir/HandleNotificationEsipa.c.o.d"
+  "CMakeFiles/libasn.dir/HoldInstructionCode.c.o"
+  "CMakeFiles/libasn.dir/HoldInstructionCode.c.o.d"
+  "CMakeFiles/libasn.dir/IA5String.c.o"
+  "CMakeFiles/libasn.dir/IA5String.c.o.d"
+  "CMakeFiles/libasn.dir/INTEGER.c.o"
+  "CMakeFiles/libasn.dir/INTEGER.c.o.d"
+  "CMakeFiles/libasn.dir/INTEGER_oer.c.o"
+  "CMakeFiles/libasn.dir/INTEGER_oer.c.o.d"
+  "CMakeFiles/libasn.dir/ISDRProprietaryApplicationTemplate.c.o"
+  "CMakeFiles/libasn.dir/ISDRProprietaryApplicationTemplate.c.o.d"
+  "CMakeFiles/libasn.dir/Iccid.c.o"
+  "CMakeFiles/libasn.dir/Iccid.c.o.d"
+  "CMakeFiles/libasn.dir/IconType.c.o"
+  "CMakeFiles/libasn.dir/IconType.c.o.d"
+  "CMakeFiles/libasn.dir/InhibitAnyPolicy.c.o"
+  "CMakeFiles/libasn.dir/InhibitAnyPolicy.c.o.d"
+  "CMakeFiles/libasn.dir/InitialiseSecureChannelRequest.c.o"
+  "CMakeFiles/libasn.dir/InitialiseSecureChannelRequest.c.o.d"
+  "CMakeFiles/libasn.dir/InitiateAuthenticationOkEs9.c.o"
+  "CMakeFiles/libasn.dir/InitiateAuthenticationOkEs9.c.o.d"
+  "CMakeFiles/libasn.dir/InitiateAuthenticationOkEsipa.c.o"
+  "CMakeFiles/libasn.dir/InitiateAuthenticationOkEsipa.c.o.d"
+  "CMakeFiles/libasn.dir/InitiateAuthenticationRequest.c.o"
+  "CMakeFiles/libasn.dir/InitiateAuthenticationRequest.c.o.d"
+  "CMakeFiles/libasn.dir/InitiateAuthenticationRequestEsipa.c.o"
+  "CMakeFiles/libasn.dir/InitiateAuthenticationRequestEsipa.c.o.d"
+  "CMakeFiles/libasn.dir/InitiateAuthenticationResponse.c.o"
+  "CMakeFiles/libasn.dir/InitiateAuthenticationResponse.c.o.d"
+  "CMakeFiles/libasn.dir/InitiateAuthenticationResponseEsipa.c.o"
+  "CMakeFiles/libasn.dir/InitiateAuthenticationResponseEsipa.c.o.d"
+  "CMakeFiles/libasn.dir/InvalidityDate.c.o"
+  "CMakeFiles/libasn.dir/InvalidityDate.c.o.d"
+  "CMakeFiles/libasn.dir/IoTSpecificInfo.c.o"
+  "CMakeFiles/libasn.dir/IoTSpecificInfo.c.o.d"
+  "CMakeFiles/libasn.dir/IotOptions.c.o"
+  "CMakeFiles/libasn.dir/IotOptions.c.o.d"
+  "CMakeFiles/libasn.dir/IpaCapabilities.c.o"
+  "CMakeFiles/libasn.dir/IpaCapabilities.c.o.d"
+  "CMakeFiles/libasn.dir/IpaEuiccData.c.o"
+  "CMakeFiles/libasn.dir/IpaEuiccData.c.o.d"
+  "CMakeFiles/libasn.dir/IpaEuiccDataRequest.c.o"
+  "CMakeFiles/libasn.dir/IpaEuiccDataRequest.c.o.d"
+  "CMakeFiles/libasn.dir/IpaEuiccDataResponse.c.o"
+  "CMakeFiles/libasn.dir/IpaEuiccDataResponse.c.o.d"
+  "CMakeFiles/libasn.dir/IpaMode.c.o"
+  "CMakeFiles/libasn.dir/IpaMode.c.o.d"
+  "CMakeFiles/libasn.dir/IssuerAltName.c.o"
+  "CMakeFiles/libasn.dir/IssuerAltName.c.o.d"
+  "CMakeFiles/libasn.dir/IssuingDistributionPoint.c.o"
+  "CMakeFiles/libasn.dir/IssuingDistributionPoint.c.o.d"
+  "CMakeFiles/libasn.dir/KeyIdentifier.c.o"
+  "CMakeFiles/libasn.dir/KeyIdentifier.c.o.d"
+  "CMakeFiles/libasn.dir/KeyObject.c.o"
+  "CMakeFiles/libasn.dir/KeyObject.c.o.d"
+  "CMakeFiles/libasn.dir/KeyPurposeId.c.o"
+  "CMakeFiles/libasn.dir/KeyPurposeId.c.o.d"
+  "CMakeFiles/libasn.dir/KeyUsage.c.o"
+  "CMakeFiles/libasn.dir/KeyUsage.c.o.d"
+  "CMakeFiles/libasn.dir/ListEimResult.c.o"
+  "CMakeFiles/libasn.dir/ListEimResult.c.o.d"
+  "CMakeFiles/libasn.dir/ListNotificationRequest.c.o"
+  "CMakeFiles/libasn.dir/ListNotificationRequest.c.o.d"
+  "CMakeFiles/libasn.dir/ListNotificationResponse.c.o"
+  "CMakeFiles/libasn.dir/ListNotificationResponse.c.o.d"
+  "CMakeFiles/libasn.dir/LoadCRLRequest.c.o"
+  "CMakeFiles/libasn.dir/LoadCRLRequest.c.o.d"
+  "CMakeFiles/libasn.dir/LoadCRLResponse.c.o"
+  "CMakeFiles/libasn.dir/LoadCRLResponse.c.o.d"
+  "CMakeFiles/libasn.dir/LoadCRLResponseError.c.o"
+  "CMakeFiles/libasn.dir/LoadCRLResponseError.c.o.d"
+  "CMakeFiles/libasn.dir/LoadCRLResponseOk.c.o"
+  "CMakeFiles/libasn.dir/LoadCRLResponseOk.c.o.d"
+  "CMakeFiles/libasn.dir/LocalPostalAttributes.c.o"
+  "CMakeFiles/libasn.dir/LocalPostalAttributes.c.o.d"
+  "CMakeFiles/libasn.dir/LpaeActivationRequest.c.o"
+  "CMakeFiles/libasn.dir/LpaeActivationRequest.c.o.d"
+  "CMakeFiles/libasn.dir/LpaeActivationResponse.c.o"
+  "CMakeFiles/libasn.dir/LpaeActivationResponse.c.o.d"
+  "CMakeFiles/libasn.dir/MappingParameter.c.o"
+  "CMakeFiles/libasn.dir/MappingParameter.c.o.d"
+  "CMakeFiles/libasn.dir/NULL.c.o"
+  "CMakeFiles/libasn.dir/NULL.c.o.d"
+  "CMakeFiles/libasn.dir/Name.c.o"
+  "CMakeFiles/libasn.dir/Name.c.o.d"
+  "CMakeFiles/libasn.dir/NameConstraints.c.o"
+  "CMakeFiles/libasn.dir/NameConstraints.c.o.d"
+  "CMakeFiles/libasn.dir/NativeEnumerated.c.o"
+  "CMakeFiles/libasn.dir/NativeEnumerated.c.o.d"
+  "CMakeFiles/libasn.dir/NativeEnumerated_oer.c.o"
+  "CMakeFiles/libasn.dir/NativeEnumerated_oer.c.o.d"
+  "CMakeFiles/libasn.dir/NativeInteger.c.o"
+  "CMakeFiles/libasn.dir/NativeInteger.c.o.d"
+  "CMakeFiles/libasn.dir/NativeInteger_oer.c.o"
+  "CMakeFiles/libasn.dir/NativeInteger_oer.c.o.d"
+  "CMakeFiles/libasn.dir/NetworkAddress.c.o"
+  "CMakeFiles/libasn.dir/NetworkAddress.c.o.d"
+  "CMakeFiles/libasn.dir/NoticeReference.c.o"
+  "CMakeFiles/libasn.dir/NoticeReference.c.o.d"
+  "CMakeFiles/libasn.dir/NotificationConfigurationInformation.c.o"
+  "CMakeFiles/libasn.dir/NotificationConfigurationInformation.c.o.d"
+  "CMakeFiles/libasn.dir/NotificationEvent.c.o"
+  "CMakeFiles/libasn.dir/NotificationEvent.c.o.d"
+  "CMakeFiles/libasn.dir/NotificationMetadata.c.o"
+  "CMakeFiles/libasn.dir/NotificationMetadata.c.o.d"
+  "CMakeFiles/libasn.dir/NotificationSentRequest.c.o"
+  "CMakeFiles/libasn.dir/NotificationSentRequest.c.o.d"
+  "CMakeFiles/libasn.dir/NotificationSentResponse.c.o"
+  "CMakeFiles/libasn.dir/NotificationSentResponse.c.o.d"
+  "CMakeFiles/libasn.dir/NumericString.c.o"
+  "CMakeFiles/libasn.dir/NumericString.c.o.d"
+  "CMakeFiles/libasn.dir/NumericUserIdentifier.c.o"
+  "CMakeFiles/libasn.dir/NumericUserIdentifier.c.o.d"
+  "CMakeFiles/libasn.dir/OBJECT_IDENTIFIER.c.o"
+  "CMakeFiles/libasn.dir/OBJECT_IDENTIFIER.c.o.d"
+  "CMakeFiles/libasn.dir/OCTET_STRING.c.o"
+  "CMakeFiles/libasn.dir/OCTET_STRING.c.o.d"
+  "CMakeFiles/libasn.dir/OCTET_STRING_oer.c.o"
+  "CMakeFiles/libasn.dir/OCTET_STRING_oer.c.o.d"
+  "CMakeFiles/libasn.dir/OPEN_TYPE.c.o"
+  "CMakeFiles/libasn.dir/OPEN_TYPE.c.o.d"
+  "CMakeFiles/libasn.dir/OPEN_TYPE_oer.c.o"
+  "CMakeFiles/libasn.dir/OPEN_TYPE_oer.c.o.d"
+  "CMakeFiles/libasn.dir/ORAddress.c.o"
+  "CMakeFiles/libasn.dir/ORAddress.c.o.d"
+  "CMakeFiles/libasn.dir/Octet1.c.o"
+  "CMakeFiles/libasn.dir/Octet1.c.o.d"
+  "CMakeFiles/libasn.dir/Octet16.c.o"
+  "CMakeFiles/libasn.dir/Octet16.c.o.d"
+  "CMakeFiles/libasn.dir/Octet2.c.o"
+  "CMakeFiles/libasn.dir/Octet2.c.o.d"
+  "CMakeFiles/libasn.dir/Octet32.c.o"
+  "CMakeFiles/libasn.dir/Octet32.c.o.d"
+  "CMakeFiles/libasn.dir/Octet4.c.o"
+  "CMakeFiles/libasn.dir/Octet4.c.o.d"
+  "CMakeFiles/libasn.dir/Octet8.c.o"
+  "CMakeFiles/libasn.dir/Octet8.c.o.d"
+  "CMakeFiles/libasn.dir/OctetTo16.c.o"
+  "CMakeFiles/libasn.dir/OctetTo16.c.o.d"
+  "CMakeFiles/libasn.dir/OperatorId.c.o"
+  "CMakeFiles/libasn.dir/OperatorId.c.o.d"
+  "CMakeFiles/libasn.dir/OrganizationName.c.o"
+  "CMakeFiles/libasn.dir/OrganizationName.c.o.d"
+  "CMakeFiles/libasn.dir/OrganizationalUnitName.c.o"
+  "CMakeFiles/libasn.dir/OrganizationalUnitName.c.o.d"
+  "CMakeFiles/libasn.dir/OrganizationalUnitNames.c.o"
+  "CMakeFiles/libasn.dir/OrganizationalUnitNames.c.o.d"
+  "CMakeFiles/libasn.dir/OtherSignedNotification.c.o"
+  "CMakeFiles/libasn.dir/OtherSignedNotification.c.o.d"
+  "CMakeFiles/libasn.dir/PDSName.c.o"
+  "CMakeFiles/libasn.dir/PDSName.c.o.d"
+  "CMakeFiles/libasn.dir/PDSParameter.c.o"
+  "CMakeFiles/libasn.dir/PDSParameter.c.o.d"
+  "CMakeFiles/libasn.dir/PE-AKAParameter.c.o"
+  "CMakeFiles/libasn.dir/PE-AKAParameter.c.o.d"
+  "CMakeFiles/libasn.dir/PE-Application.c.o"
+  "CMakeFiles/libasn.dir/PE-Application.c.o.d"
+  "CMakeFiles/libasn.dir/PE-CD.c.o"
+  "CMakeFiles/libasn.dir/PE-CD.c.o.d"
+  "CMakeFiles/libasn.dir/PE-CDMAParameter.c.o"
+  "CMakeFiles/libasn.dir/PE-CDMAParameter.c.o.d"
+  "CMakeFiles/libasn.dir/PE-CSIM.c.o"
+  "CMakeFiles/libasn.dir/PE-CSIM.c.o.d"
+  "CMakeFiles/libasn.dir/PE-DF-5GPROSE.c.o"
+  "CMakeFiles/libasn.dir/PE-DF-5GPROSE.c.o.d"
+  "CMakeFiles/libasn.dir/PE-DF-5GS.c.o"
+  "CMakeFiles/libasn.dir/PE-DF-5GS.c.o.d"
+  "CMakeFiles/libasn.dir/PE-DF-SAIP.c.o"
+  "CMakeFiles/libasn.dir/PE-DF-SAIP.c.o.d"
+  "CMakeFiles/libasn.dir/PE-DF-SNPN.c.o"
+  "CMakeFiles/libasn.dir/PE-DF-SNPN.c.o.d"
+  "CMakeFiles/libasn.dir/PE-Dummy.c.o"
+  "CMakeFiles/libasn.dir/PE-Dummy.c.o.d"
+  "CMakeFiles/libasn.dir/PE-EAP.c.o"
+  "CMakeFiles/libasn.dir/PE-EAP.c.o.d"
+  "CMakeFiles/libasn.dir/PE-End.c.o"
+  "CMakeFiles/libasn.dir/PE-End.c.o.d"
+  "CMakeFiles/libasn.dir/PE-GSM-ACCESS.c.o"
+  "CMakeFiles/libasn.dir/PE-GSM-ACCESS.c.o.d"
+  "CMakeFiles/libasn.dir/PE-GenericFileManagement.c.o"
+  "CMakeFiles/libasn.dir/PE-GenericFileManagement.c.o.d"
+  "CMakeFiles/libasn.dir/PE-ISIM.c.o"
+  "CMakeFiles/libasn.dir/PE-ISIM.c.o.d"
+  "CMakeFiles/libasn.dir/PE-IoT.c.o"
+  "CMakeFiles/libasn.dir/PE-IoT.c.o.d"
+  "CMakeFiles/libasn.dir/PE-MF.c.o"
+  "CMakeFiles/libasn.dir/PE-MF.c.o.d"
+  "CMakeFiles/libasn.dir/PE-NonStandard.c.o"
+  "CMakeFiles/libasn.dir/PE-NonStandard.c.o.d"
+  "CMakeFiles/libasn.dir/PE-OPT-CSIM.c.o"
+  "CMakeFiles/libasn.dir/PE-OPT-CSIM.c.o.d"
+  "CMakeFiles/libasn.dir/PE-OPT-ISIM.c.o"
+  "CMakeFiles/libasn.dir/PE-OPT-ISIM.c.o.d"
+  "CMakeFiles/libasn.dir/PE-OPT-IoT.c.o"
+  "CMakeFiles/libasn.dir/PE-OPT-IoT.c.o.d"
+  "CMakeFiles/libasn.dir/PE-OPT-USIM.c.o"
+  "CMakeFiles/libasn.dir/PE-OPT-USIM.c.o.d"
+  "CMakeFiles/libasn.dir/PE-PHONEBOOK.c.o"
+  "CMakeFiles/libasn.dir/PE-PHONEBOOK.c.o.d"
+  "CMakeFiles/libasn.dir/PE-PINCodes.c.o"
+  "CMakeFiles/libasn.dir/PE-PINCodes.c.o.d"
+  "CMakeFiles/libasn.dir/PE-PUKCodes.c.o"
+  "CMakeFiles/libasn.dir/PE-PUKCodes.c.o.d"
+  "CMakeFiles/libasn.dir/PE-RFM.c.o"
+  "CMakeFiles/libasn.dir/PE-RFM.c.o.d"
+  "CMakeFiles/libasn.dir/PE-SecurityDomain.c.o"
+  "CMakeFiles/libasn.dir/PE-SecurityDomain.c.o.d"
+  "CMakeFiles/libasn.dir/PE-TELECOM.c.o"
+  "CMakeFiles/libasn.dir/PE-TELECOM.c.o.d"
+  "CMakeFiles/libasn.dir/PE-USIM.c.o"
+  "CMakeFiles/libasn.dir/PE-USIM.c.o.d"
+  "CMakeFiles/libasn.dir/PEHeader.c.o"
+  "CMakeFiles/libasn.dir/PEHeader.c.o.d"
+  "CMakeFiles/libasn.dir/PEStatus.c.o"
+  "CMakeFiles/libasn.dir/PEStatus.c.o.d"
+  "CMakeFiles/libasn.dir/PINConfiguration.c.o"
+  "CMakeFiles/libasn.dir/PINConfiguration.c.o.d"
+  "CMakeFiles/libasn.dir/PINKeyReferenceValue.c.o"
+  "CMakeFiles/libasn.dir/PINKeyReferenceValue.c.o.d"
+  "CMakeFiles/libasn.dir/PUKConfiguration.c.o"
+  "CMakeFiles/libasn.dir/PUKConfiguration.c.o.d"
+  "CMakeFiles/libasn.dir/PUKKeyReferenceValue.c.o"
+  "CMakeFiles/libasn.dir/PUKKeyReferenceValue.c.o.d"
+  "CMakeFiles/libasn.dir/PartialCrlNumber.c.o"
+  "CMakeFiles/libasn.dir/PartialCrlNumber.c.o.d"
+  "CMakeFiles/libasn.dir/PendingNotification.c.o"
+  "CMakeFiles/libasn.dir/PendingNotification.c.o.d"
+  "CMakeFiles/libasn.dir/PersonalName.c.o"
+  "CMakeFiles/libasn.dir/PersonalName.c.o.d"
+  "CMakeFiles/libasn.dir/PhysicalDeliveryCountryName.c.o"
+  "CMakeFiles/libasn.dir/PhysicalDeliveryCountryName.c.o.d"
+  "CMakeFiles/libasn.dir/PhysicalDeliveryOfficeName.c.o"
+  "CMakeFiles/libasn.dir/PhysicalDeliveryOfficeName.c.o.d"
+  "CMakeFiles/libasn.dir/PhysicalDeliveryOfficeNumber.c.o"
+  "CMakeFiles/libasn.dir/PhysicalDeliveryOfficeNumber.c.o.d"
+  "CMakeFiles/libasn.dir/PhysicalDeliveryOrganizationName.c.o"
+  "CMakeFiles/libasn.dir/PhysicalDeliveryOrganizationName.c.o.d"
+  "CMakeFiles/libasn.dir/PhysicalDeliveryPersonalName.c.o"
+  "CMakeFiles/libasn.dir/PhysicalDeliveryPersonalName.c.o.d"
+  "CMakeFiles/libasn.dir/PolicyConstraints.c.o"
+  "CMakeFiles/libasn.dir/PolicyConstraints.c.o.d"
+  "CMakeFiles/libasn.dir/PolicyInformation.c.o"
+  "CMakeFiles/libasn.dir/PolicyInformation.c.o.d"
+  "CMakeFiles/libasn.dir/PolicyMappings.c.o"
+  "CMakeFiles/libasn.dir/PolicyMappings.c.o.d"
+  "CMakeFiles/libasn.dir/PolicyQualifierId.c.o"
+  "CMakeFiles/libasn.dir/PolicyQualifierId.c.o.d"
+  "CMakeFiles/libasn.dir/PolicyQualifierInfo.c.o"
+  "CMakeFiles/libasn.dir/PolicyQualifierInfo.c.o.d"
+  "CMakeFiles/libasn.dir/PostOfficeBoxAddress.c.o"
+  "CMakeFiles/libasn.dir/PostOfficeBoxAddress.c.o.d"
+  "CMakeFiles/libasn.dir/PostalCode.c.o"
+  "CMakeFiles/libasn.dir/PostalCode.c.o.d"
+  "CMakeFiles/libasn.dir/PosteRestanteAddress.c.o"
+  "CMakeFiles/libasn.dir/PosteRestanteAddress.c.o.d"
+  "CMakeFiles/libasn.dir/PprIds.c.o"
+  "CMakeFiles/libasn.dir/PprIds.c.o.d"
+  "CMakeFiles/libasn.dir/PrepareDownloadRequest.c.o"
+  "CMakeFiles/libasn.dir/PrepareDownloadRequest.c.o.d"
+  "CMakeFiles/libasn.dir/PrepareDownloadResponse.c.o"
+  "CMakeFiles/libasn.dir/PrepareDownloadResponse.c.o.d"
+  "CMakeFiles/libasn.dir/PrepareDownloadResponseError.c.o"
+  "CMakeFiles/libasn.dir/PrepareDownloadResponseError.c.o.d"
+  "CMakeFiles/libasn.dir/PrepareDownloadResponseOk.c.o"
+  "CMakeFiles/libasn.dir/PrepareDownloadResponseOk.c.o.d"
+  "CMakeFiles/libasn.dir/PresentationAddress.c.o"
+  "CMakeFiles/libasn.dir/PresentationAddress.c.o.d"
+  "CMakeFiles/libasn.dir/PrintableString.c.o"
+  "CMakeFiles/libasn.dir/PrintableString.c.o.d"
+  "CMakeFiles/libasn.dir/PrivateDomainName.c.o"
+  "CMakeFiles/libasn.dir/PrivateDomainName.c.o.d"
+  "CMakeFiles/libasn.dir/PrivateKeyUsagePeriod.c.o"
+  "CMakeFiles/libasn.dir/PrivateKeyUsagePeriod.c.o.d"
+  "CMakeFiles/libasn.dir/ProfileClass.c.o"
+  "CMakeFiles/libasn.dir/ProfileClass.c.o.d"
+  "CMakeFiles/libasn.dir/ProfileDownloadData.c.o"
+  "CMakeFiles/libasn.dir/ProfileDownloadData.c.o.d"
+  "CMakeFiles/libasn.dir/ProfileDownloadTriggerRequest.c.o"
+  "CMakeFiles/libasn.dir/ProfileDownloadTriggerRequest.c.o.d"
+  "CMakeFiles/libasn.dir/ProfileDownloadTriggerResult.c.o"
+  "CMakeFiles/libasn.dir/ProfileDownloadTriggerResult.c.o.d"
+  "CMakeFiles/libasn.dir/ProfileElement.c.o"
+  "CMakeFiles/libasn.dir/ProfileElement.c.o.d"
+  "CMakeFiles/libasn.dir/ProfileHeader.c.o"
+  "CMakeFiles/libasn.dir/ProfileHeader.c.o.d"
+  "CMakeFiles/libasn.dir/ProfileInfo.c.o"
+  "CMakeFiles/libasn.dir/ProfileInfo.c.o.d"
+  "CMakeFiles/libasn.dir/ProfileInfoListError.c.o"
+  "CMakeFiles/libasn.dir/ProfileInfoListError.c.o.d"
+  "CMakeFiles/libasn.dir/ProfileInfoListRequest.c.o"
+  "CMakeFiles/libasn.dir/ProfileInfoListRequest.c.o.d"
+  "CMakeFiles/libasn.dir/ProfileInfoListResponse.c.o"
+  "CMakeFiles/libasn.dir/ProfileInfoListResponse.c.o.d"
+  "CMakeFiles/libasn.dir/ProfileInstallationResult.c.o"
+  "CMakeFiles/libasn.dir/ProfileInstallationResult.c.o.d"
+  "CMakeFiles/libasn.dir/ProfileInstallationResultData.c.o"
+  "CMakeFiles/libasn.dir/ProfileInstallationResultData.c.o.d"
+  "CMakeFiles/libasn.dir/ProfilePolicyAuthorisationRule.c.o"
+  "CMakeFiles/libasn.dir/ProfilePolicyAuthorisationRule.c.o.d"
+  "CMakeFiles/libasn.dir/ProfileRollbackRequest.c.o"
+  "CMakeFiles/libasn.dir/ProfileRollbackRequest.c.o.d"
+  "CMakeFiles/libasn.dir/ProfileRollbackResponse.c.o"
+  "CMakeFiles/libasn.dir/ProfileRollbackResponse.c.o.d"
+  "CMakeFiles/libasn.dir/ProfileState.c.o"
+  "CMakeFiles/libasn.dir/ProfileState.c.o.d"
+  "CMakeFiles/libasn.dir/ProprietaryInfo.c.o"
+  "CMakeFiles/libasn.dir/ProprietaryInfo.c.o.d"
+  "CMakeFiles/libasn.dir/ProvideEimPackageResult.c.o"
+  "CMakeFiles/libasn.dir/ProvideEimPackageResult.c.o.d"
+  "CMakeFiles/libasn.dir/ProvideEimPackageResultResponse.c.o"
+  "CMakeFiles/libasn.dir/ProvideEimPackageResultResponse.c.o.d"
+  "CMakeFiles/libasn.dir/Psmo.c.o"
+  "CMakeFiles/libasn.dir/Psmo.c.o.d"
+  "CMakeFiles/libasn.dir/RDNSequence.c.o"
+  "CMakeFiles/libasn.dir/RDNSequence.c.o.d"
+  "CMakeFiles/libasn.dir/ReasonFlags.c.o"
+  "CMakeFiles/libasn.dir/ReasonFlags.c.o.d"
+  "CMakeFiles/libasn.dir/RelativeDistinguishedName.c.o"
+  "CMakeFiles/libasn.dir/RelativeDistinguishedName.c.o.d"
+  "CMakeFiles/libasn.dir/RemoteOpId.c.o"
+  "CMakeFiles/libasn.dir/RemoteOpId.c.o.d"
+  "CMakeFiles/libasn.dir/RemoteProfileProvisioningRequest.c.o"
+  "CMakeFiles/libasn.dir/RemoteProfileProvisioningRequest.c.o.d"
+  "CMakeFiles/libasn.dir/RemoteProfileProvisioningResponse.c.o"
+  "CMakeFiles/libasn.dir/RemoteProfileProvisioningResponse.c.o.d"
+  "CMakeFiles/libasn.dir/ReplaceSessionKeysRequest.c.o"
+  "CMakeFiles/libasn.dir/ReplaceSessionKeysRequest.c.o.d"
+  "CMakeFiles/libasn.dir/RetrieveNotificationsListRequest.c.o"
+  "CMakeFiles/libasn.dir/RetrieveNotificationsListRequest.c.o.d"
+  "CMakeFiles/libasn.dir/RetrieveNotificationsListResponse.c.o"
+  "CMakeFiles/libasn.dir/RetrieveNotificationsListResponse.c.o.d"
+  "CMakeFiles/libasn.dir/RollbackProfileResult.c.o"
+  "CMakeFiles/libasn.dir/RollbackProfileResult.c.o.d"
+  "CMakeFiles/libasn.dir/RspCapability.c.o"
+  "CMakeFiles/libasn.dir/RspCapability.c.o.d"
+  "CMakeFiles/libasn.dir/RulesAuthorisationTable.c.o"
+  "CMakeFiles/libasn.dir/RulesAuthorisationTable.c.o.d"
+  "CMakeFiles/libasn.dir/SGP32-AuthenticateServerResponse.c.o"
+  "CMakeFiles/libasn.dir/SGP32-AuthenticateServerResponse.c.o.d"
+  "CMakeFiles/libasn.dir/SGP32-CancelSessionOk.c.o"
+  "CMakeFiles/libasn.dir/SGP32-CancelSessionOk.c.o.d"
+  "CMakeFiles/libasn.dir/SGP32-CancelSessionResponse.c.o"
+  "CMakeFiles/libasn.dir/SGP32-CancelSessionResponse.c.o.d"
+  "CMakeFiles/libasn.dir/SGP32-EUICCInfo2.c.o"
+  "CMakeFiles/libasn.dir/SGP32-EUICCInfo2.c.o.d"
+  "CMakeFiles/libasn.dir/SGP32-EuiccMemoryResetRequest.c.o"
+  "CMakeFiles/libasn.dir/SGP32-EuiccMemoryResetRequest.c.o.d"
+  "CMakeFiles/libasn.dir/SGP32-EuiccMemoryResetResponse.c.o"
+  "CMakeFiles/libasn.dir/SGP32-EuiccMemoryResetResponse.c.o.d"
+  "CMakeFiles/libasn.dir/SGP32-PendingNotification.c.o"
+  "CMakeFiles/libasn.dir/SGP32-PendingNotification.c.o.d"
+  "CMakeFiles/libasn.dir/SGP32-PrepareDownloadResponse.c.o"
+  "CMakeFiles/libasn.dir/SGP32-PrepareDownloadResponse.c.o.d"
+  "CMakeFiles/libasn.dir/SGP32-ProfileInfoListError.c.o"
+  "CMakeFiles/libasn.dir/SGP32-ProfileInfoListError.c.o.d"
+  "CMakeFiles/libasn.dir/SGP32-ProfileInfoListResponse.c.o"
+  "CMakeFiles/libasn.dir/SGP32-ProfileInfoListResponse.c.o.d"
+  "CMakeFiles/libasn.dir/SGP32-ProfileInstallationResult.c.o"
+  "CMakeFiles/libasn.dir/SGP32-ProfileInstallationResult.c.o.d"
+  "CMakeFiles/libasn.dir/SGP32-RetrieveNotificationsListRequest.c.o"
+  "CMakeFiles/libasn.dir/SGP32-RetrieveNotificationsListRequest.c.o.d"
+  "CMakeFiles/libasn.dir/SGP32-RetrieveNotificationsListResponse.c.o"
+  "CMakeFiles/libasn.dir/SGP32-RetrieveNotificationsListResponse.c.o.d"
+  "CMakeFiles/libasn.dir/SegmentedCrlList.c.o"
+  "CMakeFiles/libasn.dir/SegmentedCrlList.c.o.d"
+  "CMakeFiles/libasn.dir/SequenceNumber.c.o"
+  "CMakeFiles/libasn.dir/SequenceNumber.c.o.d"
+  "CMakeFiles/libasn.dir/ServerSigned1.c.o"
+  "CMakeFiles/libasn.dir/ServerSigned1.c.o.d"
+  "CMakeFiles/libasn.dir/ServicesList.c.o"
+  "CMakeFiles/libasn.dir/ServicesList.c.o.d"
+  "CMakeFiles/libasn.dir/SetDefaultDpAddressRequest.c.o"
+  "CMakeFiles/libasn.dir/SetDefaultDpAddressRequest.c.o.d"
+  "CMakeFiles/libasn.dir/SetDefaultDpAddressResponse.c.o"
+  "CMakeFiles/libasn.dir/SetDefaultDpAddressResponse.c.o.d"
+  "CMakeFiles/libasn.dir/SetNicknameRequest.c.o"
+  "CMakeFiles/libasn.dir/SetNicknameRequest.c.o.d"
+  "CMakeFiles/libasn.dir/SetNicknameResponse.c.o"
+  "CMakeFiles/libasn.dir/SetNicknameResponse.c.o.d"
+  "CMakeFiles/libasn.dir/SkipCerts.c.o"
+  "CMakeFiles/libasn.dir/SkipCerts.c.o.d"
+  "CMakeFiles/libasn.dir/SmdpSigned2.c.o"
+  "CMakeFiles/libasn.dir/SmdpSigned2.c.o.d"
+  "CMakeFiles/libasn.dir/StoreMetadataRequest.c.o"
+  "CMakeFiles/libasn.dir/StoreMetadataRequest.c.o.d"
+  "CMakeFiles/libasn.dir/StreetAddress.c.o"
+  "CMakeFiles/libasn.dir/StreetAddress.c.o.d"
+  "CMakeFiles/libasn.dir/SubjectAltName.c.o"
+  "CMakeFiles/libasn.dir/SubjectAltName.c.o.d"
+  "CMakeFiles/libasn.dir/SubjectDirectoryAttributes.c.o"
+  "CMakeFiles/libasn.dir/SubjectDirectoryAttributes.c.o.d"
+  "CMakeFiles/libasn.dir/SubjectInfoAccessSyntax.c.o"
+  "CMakeFiles/libasn.dir/SubjectInfoAccessSyntax.c.o.d"
+  "CMakeFiles/libasn.dir/SubjectKeyIdentifier.c.o"
+  "CMakeFiles/libasn.dir/SubjectKeyIdentifier.c.o.d"
+  "CMakeFiles/libasn.dir/SubjectPublicKeyInfo.c.o"
+  "CMakeFiles/libasn.dir/SubjectPublicKeyInfo.c.o.d"
+  "CMakeFiles/libasn.dir/SuccessResult.c.o"
+  "CMakeFiles/libasn.dir/SuccessResult.c.o.d"
+  "CMakeFiles/libasn.dir/TBSCertList.c.o"
+  "CMakeFiles/libasn.dir/TBSCertList.c.o.d"
+  "CMakeFiles/libasn.dir/TBSCertificate.c.o"
+  "CMakeFiles/libasn.dir/TBSCertificate.c.o.d"
+  "CMakeFiles/libasn.dir/TS102226AdditionalContactlessParameters.c.o"
+  "CMakeFiles/libasn.dir/TS102226AdditionalContactlessParameters.c.o.d"
+  "CMakeFiles/libasn.dir/TeletexCommonName.c.o"
+  "CMakeFiles/libasn.dir/TeletexCommonName.c.o.d"
+  "CMakeFiles/libasn.dir/TeletexDomainDefinedAttribute.c.o"
+  "CMakeFiles/libasn.dir/TeletexDomainDefinedAttribute.c.o.d"
+  "CMakeFiles/libasn.dir/TeletexDomainDefinedAttributes.c.o"
+  "CMakeFiles/libasn.dir/TeletexDomainDefinedAttributes.c.o.d"
+  "CMakeFiles/libasn.dir/TeletexOrganizationName.c.o"
+  "CMakeFiles/libasn.dir/TeletexOrganizationName.c.o.d"
+  "CMakeFiles/libasn.dir/TeletexOrganizationalUnitName.c.o"
+  "CMakeFiles/libasn.dir/TeletexOrganizationalUnitName.c.o.d"
+  "CMakeFiles/libasn.dir/TeletexOrganizationalUnitNames.c.o"
+  "CMakeFiles/libasn.dir/TeletexOrganizationalUnitNames.c.o.d"
+  "CMakeFiles/libasn.dir/TeletexPersonalName.c.o"
+  "CMakeFiles/libasn.dir/TeletexPersonalName.c.o.d"
+  "CMakeFiles/libasn.dir/TeletexString.c.o"
+  "CMakeFiles/libasn.dir/TeletexString.c.o.d"
+  "CMakeFiles/libasn.dir/TerminalIdentifier.c.o"
+  "CMakeFiles/libasn.dir/TerminalIdentifier.c.o.d"
+  "CMakeFiles/libasn.dir/TerminalType.c.o"
+  "CMakeFiles/libasn.dir/TerminalType.c.o.d"
+  "CMakeFiles/libasn.dir/Time.c.o"
+  "CMakeFiles/libasn.dir/Time.c.o.d"
+  "CMakeFiles/libasn.dir/TotalPartialCrlNumber.c.o"
+  "CMakeFiles/libasn.dir/TotalPartialCrlNumber.c.o.d"
+  "CMakeFiles/libasn.dir/TransactionId.c.o"
+  "CMakeFiles/libasn.dir/TransactionId.c.o.d"
+  "CMakeFiles/libasn.dir/TransferEimPackageRequest.c.o"
+  "CMakeFiles/libasn.dir/TransferEimPackageRequest.c.o.d"
+  "CMakeFiles/libasn.dir/TransferEimPackageResponse.c.o"
+  "CMakeFiles/libasn.dir/TransferEimPackageResponse.c.o.d"
+  "CMakeFiles/libasn.dir/UICCApplicationParameters.c.o"
+  "CMakeFiles/libasn.dir/UICCApplicationParameters.c.o.d"
+  "CMakeFiles/libasn.dir/UICCCapability.c.o"
+  "CMakeFiles/libasn.dir/UICCCapability.c.o.d"
+  "CMakeFiles/libasn.dir/UInt15.c.o"
+  "CMakeFiles/libasn.dir/UInt15.c.o.d"
+  "CMakeFiles/libasn.dir/UInt16.c.o"
+  "CMakeFiles/libasn.dir/UInt16.c.o.d"
+  "CMakeFiles/libasn.dir/UInt31.c.o"
+  "CMakeFiles/libasn.dir/UInt31.c.o.d"
+  "CMakeFiles/libasn.dir/UInt8.c.o"
+  "CMakeFiles/libasn.dir/UInt8.c.o.d"
+  "CMakeFiles/libasn.dir/UTCTime.c.o"
+  "CMakeFiles/libasn.dir/UTCTime.c.o.d"
+  "CMakeFiles/libasn.dir/UTF8String.c.o"
+  "CMakeFiles/libasn.dir/UTF8String.c.o.d"
+  "CMakeFiles/libasn.dir/UnformattedPostalAddress.c.o"
+  "CMakeFiles/libasn.dir/UnformattedPostalAddress.c.o.d"
+  "CMakeFiles/libasn.dir/UniqueIdentifier.c.o"
+  "CMakeFiles/libasn.dir/UniqueIdentifier.c.o.d"
+  "CMakeFiles/libasn.dir/UniquePostalName.c.o"
+  "CMakeFiles/libasn.dir/UniquePostalName.c.o.d"
+  "CMakeFiles/libasn.dir/UniversalString.c.o"
+  "CMakeFiles/libasn.dir/UniversalString.c.o.d"
+  "CMakeFiles/libasn.dir/UpdateEimResult.c.o"
+  "CMakeFiles/libasn.dir/UpdateEimResult.c.o.d"
+  "CMakeFiles/libasn.dir/UpdateMetadataRequest.c.o"
+  "CMakeFiles/libasn.dir/UpdateMetadataRequest.c.o.d"
+  "CMakeFiles/libasn.dir/UserNotice.c.o"
+  "CMakeFiles/libasn.dir/UserNotice.c.o.d"
+  "CMakeFiles/libasn.dir/Validity.c.o"
+  "CMakeFiles/libasn.dir/Validity.c.o.d"
+  "CMakeFiles/libasn.dir/VendorSpecificExtension.c.o"
+  "CMakeFiles/libasn.dir/VendorSpecificExtension.c.o.d"
+  "CMakeFiles/libasn.dir/Version.c.o"
+  "CMakeFiles/libasn.dir/Version.c.o.d"
+  "CMakeFiles/libasn.dir/VersionType.c.o"
+  "CMakeFiles/libasn.dir/VersionType.c.o.d"
+  "CMakeFiles/libasn.dir/VisibleString.c.o"
+  "CMakeFiles/libasn.dir/VisibleString.c.o.d"
+  "CMakeFiles/libasn.dir/X121Address.c.o"
+  "CMakeFiles/libasn.dir/X121Address.c.o.d"
+  "CMakeFiles/libasn.dir/X520CommonName.c.o"
+  "CMakeFiles/libasn.dir/X520CommonName.c.o.d"
+  "CMakeFiles/libasn.dir/X520LocalityName.c.o"
+  "CMakeFiles/libasn.dir/X520LocalityName.c.o.d"
+  "CMakeFiles/libasn.dir/X520OrganizationName.c.o"
+  "CMakeFiles/libasn.dir/X520OrganizationName.c.o.d"
+  "CMakeFiles/libasn.dir/X520OrganizationalUnitName.c.o"
+  "CMakeFiles/libasn.dir/X520OrganizationalUnitName.c.o.d"
+  "CMakeFiles/libasn.dir/X520Pseudonym.c.o"
+  "CMakeFiles/libasn.dir/X520Pseudonym.c.o.d"
+  "CMakeFiles/libasn.dir/X520SerialNumber.c.o"
+  "CMakeFiles/libasn.dir/X520SerialNumber.c.o.d"
+  "CMakeFiles/libasn.dir/X520StateOrProvinceName.c.o"
+  "CMakeFiles/libasn.dir/X520StateOrProvinceName.c.o.d"
+  "CMakeFiles/libasn.dir/X520Title.c.o"
+  "CMakeFiles/libasn.dir/X520Title.c.o.d"
+  "CMakeFiles/libasn.dir/X520countryName.c.o"
+  "CMakeFiles/libasn.dir/X520countryName.c.o.d"
+  "CMakeFiles/libasn.dir/X520dnQualifier.c.o"
+  "CMakeFiles/libasn.dir/X520dnQualifier.c.o.d"
+  "CMakeFiles/libasn.dir/X520name.c.o"
+  "CMakeFiles/libasn.dir/X520name.c.o.d"
+  "CMakeFiles/libasn.dir/asn_SEQUENCE_OF.c.o"
+  "CMakeFiles/libasn.dir/asn_SEQUENCE_OF.c.o.d"
+  "CMakeFiles/libasn.dir/asn_SET_OF.c.o"
+  "CMakeFiles/libasn.dir/asn_SET_OF.c.o.d"
+  "CMakeFiles/libasn.dir/asn_application.c.o"
+  "CMakeFiles/libasn.dir/asn_application.c.o.d"
+  "CMakeFiles/libasn.dir/asn_arena.c.o"
+  "CMakeFiles/libasn.dir/asn_arena.c.o.d"
+  "CMakeFiles/libasn.dir/asn_bit_data.c.o"
+  "CMakeFiles/libasn.dir/asn_bit_data.c.o.d"
+  "CMakeFiles/libasn.dir/asn_codecs_prim.c.o"
+  "CMakeFiles/libasn.dir/asn_codecs_prim.c.o.d"
+  "CMakeFiles/libasn.dir/asn_internal.c.o"
+  "CMakeFiles/libasn.dir/asn_internal.c.o.d"
+  "CMakeFiles/libasn.dir/asn_random_fill.c.o"
+  "CMakeFiles/libasn.dir/asn_random_fill.c.o.d"
+  "CMakeFiles/libasn.dir/ber_decoder.c.o"
+  "CMakeFiles/libasn.dir/ber_decoder.c.o.d"
+  "CMakeFiles/libasn.dir/ber_tlv_length.c.o"
+  "CMakeFiles/libasn.dir/ber_tlv_length.c.o.d"
+  "CMakeFiles/libasn.dir/ber_tlv_tag.c.o"
+  "CMakeFiles/libasn.dir/ber_tlv_tag.c.o.d"
+  "CMakeFiles/libasn.dir/constr_CHOICE.c.o"
+  "CMakeFiles/libasn.dir/constr_CHOICE.c.o.d"
+  "CMakeFiles/libasn.dir/constr_CHOICE_oer.c.o"
+  "CMakeFiles/libasn.dir/constr_CHOICE_oer.c.o.d"
+  "CMakeFiles/libasn.dir/constr_SEQUENCE.c.o"
+  "CMakeFiles/libasn.dir/constr_SEQUENCE.c.o.d"
+  "CMakeFiles/libasn.dir/constr_SEQUENCE_OF.c.o"
+  "CMakeFiles/libasn.dir/constr_SEQUENCE_OF.c.o.d"
+  "CMakeFiles/libasn.dir/constr_SEQUENCE_oer.c.o"
+  "CMakeFiles/libasn.dir/constr_SEQUENCE_oer.c.o.d"
+  "CMakeFiles/libasn.dir/constr_SET.c.o"
+  "CMakeFiles/libasn.dir/constr_SET.c.o.d"
+  "CMakeFiles/libasn.dir/constr_SET_OF.c.o"
+  "CMakeFiles/libasn.dir/constr_SET_OF.c.o.d"
+  "CMakeFiles/libasn.dir/constr_SET_OF_oer.c.o"
+  "CMakeFiles/libasn.dir/constr_SET_OF_oer.c.o.d"
+  "CMakeFiles/libasn.dir/constr_TYPE.c.o"
+  "CMakeFiles/libasn.dir/constr_TYPE.c.o.d"
+  "CMakeFiles/libasn.dir/constraints.c.o"
+  "CMakeFiles/libasn.dir/constraints.c.o.d"
+  "CMakeFiles/libasn.dir/der_encoder.c.o"
+  "CMakeFiles/libasn.dir/der_encoder.c.o.d"
+  "CMakeFiles/libasn.dir/oer_decoder.c.o"
+  "CMakeFiles/libasn.dir/oer_decoder.c.o.d"
+  "CMakeFiles/libasn.dir/oer_encoder.c.o"
+  "CMakeFiles/libasn.dir/oer_encoder.c.o.d"
+  "CMakeFiles/libasn.dir/oer_support.c.o"
+  "CMakeFiles/libasn.dir/oer_support.c.o.d"
+  "CMakeFiles/libasn.dir/per_decoder.c.o"
+  "CMakeFiles/libasn.dir/per_decoder.c.o.d"
+  "CMakeFiles/libasn.dir/per_encoder.c.o"
+  "CMakeFiles/libasn.dir/per_encoder.c.o.d"
+  "CMakeFiles/libasn.dir/per_opentype.c.o"
+  "CMakeFiles/libasn.dir/per_opentype.c.o.d"
+  "CMakeFiles/libasn.dir/per_support.c.o"
+  "CMakeFiles/libasn.dir/per_support.c.o.d"
+  "CMakeFiles/libasn.dir/xer_decoder.c.o"
+  "CMakeFiles/libasn.dir/xer_decoder.c.o.d"
+  "CMakeFiles/libasn.dir/xer_encoder.c.o"
+  "CMakeFiles/libasn.dir/xer_encoder.c.o.d"
+  "CMakeFiles/libasn.dir/xer_support.c.o"
+  "CMakeFiles/libasn.dir/xer_support.c.o.d"
+  "liblibasn.a"
+  "liblibasn.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libasn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,67 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ipa/libipa/activation_code.c" "src/ipa/libipa/CMakeFiles/libipa.dir/activation_code.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/activation_code.c.o.d"
+  "/root/repo/src/ipa/libipa/bpp_segments.c" "src/ipa/libipa/CMakeFiles/libipa.dir/bpp_segments.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/bpp_segments.c.o.d"
+  "/root/repo/src/ipa/libipa/es10a_get_euicc_cfg_addr.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10a_get_euicc_cfg_addr.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10a_get_euicc_cfg_addr.c.o.d"
+  "/root/repo/src/ipa/libipa/es10b_add_init_eim.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_add_init_eim.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_add_init_eim.c.o.d"
+  "/root/repo/src/ipa/libipa/es10b_auth_serv.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_auth_serv.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_auth_serv.c.o.d"
+  "/root/repo/src/ipa/libipa/es10b_cancel_session.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_cancel_session.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_cancel_session.c.o.d"
+  "/root/repo/src/ipa/libipa/es10b_enable_using_dd.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_enable_using_dd.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_enable_using_dd.c.o.d"
+  "/root/repo/src/ipa/libipa/es10b_euicc_mem_rst.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_euicc_mem_rst.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_euicc_mem_rst.c.o.d"
+  "/root/repo/src/ipa/libipa/es10b_get_certs.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_get_certs.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_get_certs.c.o.d"
+  "/root/repo/src/ipa/libipa/es10b_get_eim_cfg_data.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_get_eim_cfg_data.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_get_eim_cfg_data.c.o.d"
+  "/root/repo/src/ipa/libipa/es10b_get_euicc_chlg.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_get_euicc_chlg.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_get_euicc_chlg.c.o.d"
+  "/root/repo/src/ipa/libipa/es10b_get_euicc_info.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_get_euicc_info.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_get_euicc_info.c.o.d"
+  "/root/repo/src/ipa/libipa/es10b_get_rat.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_get_rat.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_get_rat.c.o.d"
+  "/root/repo/src/ipa/libipa/es10b_load_bnd_prfle_pkg.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_load_bnd_prfle_pkg.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_load_bnd_prfle_pkg.c.o.d"
+  "/root/repo/src/ipa/libipa/es10b_load_euicc_pkg.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_load_euicc_pkg.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_load_euicc_pkg.c.o.d"
+  "/root/repo/src/ipa/libipa/es10b_prep_dwnld.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_prep_dwnld.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_prep_dwnld.c.o.d"
+  "/root/repo/src/ipa/libipa/es10b_prfle_rollback.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_prfle_rollback.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_prfle_rollback.c.o.d"
+  "/root/repo/src/ipa/libipa/es10b_retr_notif_from_lst.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_retr_notif_from_lst.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_retr_notif_from_lst.c.o.d"
+  "/root/repo/src/ipa/libipa/es10b_rm_notif_from_lst.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_rm_notif_from_lst.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10b_rm_notif_from_lst.c.o.d"
+  "/root/repo/src/ipa/libipa/es10c_delete_prfle.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10c_delete_prfle.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10c_delete_prfle.c.o.d"
+  "/root/repo/src/ipa/libipa/es10c_disable_prfle.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10c_disable_prfle.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10c_disable_prfle.c.o.d"
+  "/root/repo/src/ipa/libipa/es10c_enable_prfle.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10c_enable_prfle.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10c_enable_prfle.c.o.d"
+  "/root/repo/src/ipa/libipa/es10c_get_eid.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10c_get_eid.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10c_get_eid.c.o.d"
+  "/root/repo/src/ipa/libipa/es10c_get_prfle_info.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10c_get_prfle_info.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10c_get_prfle_info.c.o.d"
+  "/root/repo/src/ipa/libipa/es10x.c" "src/ipa/libipa/CMakeFiles/libipa.dir/es10x.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/es10x.c.o.d"
+  "/root/repo/src/ipa/libipa/esipa.c" "src/ipa/libipa/CMakeFiles/libipa.dir/esipa.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/esipa.c.o.d"
+  "/root/repo/src/ipa/libipa/esipa_auth_clnt.c" "src/ipa/libipa/CMakeFiles/libipa.dir/esipa_auth_clnt.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/esipa_auth_clnt.c.o.d"
+  "/root/repo/src/ipa/libipa/esipa_cancel_session.c" "src/ipa/libipa/CMakeFiles/libipa.dir/esipa_cancel_session.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/esipa_cancel_session.c.o.d"
+  "/root/repo/src/ipa/libipa/esipa_get_bnd_prfle_pkg.c" "src/ipa/libipa/CMakeFiles/libipa.dir/esipa_get_bnd_prfle_pkg.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/esipa_get_bnd_prfle_pkg.c.o.d"
+  "/root/repo/src/ipa/libipa/esipa_get_eim_pkg.c" "src/ipa/libipa/CMakeFiles/libipa.dir/esipa_get_eim_pkg.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/esipa_get_eim_pkg.c.o.d"
+  "/root/repo/src/ipa/libipa/esipa_handle_notif.c" "src/ipa/libipa/CMakeFiles/libipa.dir/esipa_handle_notif.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/esipa_handle_notif.c.o.d"
+  "/root/repo/src/ipa/libipa/esipa_init_auth.c" "src/ipa/libipa/CMakeFiles/libipa.dir/esipa_init_auth.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/esipa_init_auth.c.o.d"
+  "/root/repo/src/ipa/libipa/esipa_prvde_eim_pkg_rslt.c" "src/ipa/libipa/CMakeFiles/libipa.dir/esipa_prvde_eim_pkg_rslt.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/esipa_prvde_eim_pkg_rslt.c.o.d"
+  "/root/repo/src/ipa/libipa/esipa_transfer_eim_pkg.c" "src/ipa/libipa/CMakeFiles/libipa.dir/esipa_transfer_eim_pkg.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/esipa_transfer_eim_pkg.c.o.d"
+  "/root/repo/src/ipa/libipa/euicc.c" "src/ipa/libipa/CMakeFiles/libipa.dir/euicc.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/euicc.c.o.d"
+  "/root/repo/src/ipa/libipa/ipad.c" "src/ipa/libipa/CMakeFiles/libipa.dir/ipad.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/ipad.c.o.d"
+  "/root/repo/src/ipa/libipa/log.c" "src/ipa/libipa/CMakeFiles/libipa.dir/log.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/log.c.o.d"
+  "/root/repo/src/ipa/libipa/proc_cmn_cancel_sess.c" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_cmn_cancel_sess.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_cmn_cancel_sess.c.o.d"
+  "/root/repo/src/ipa/libipa/proc_cmn_mtl_auth.c" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_cmn_mtl_auth.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_cmn_mtl_auth.c.o.d"
+  "/root/repo/src/ipa/libipa/proc_eim_pkg_inj.c" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_eim_pkg_inj.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_eim_pkg_inj.c.o.d"
+  "/root/repo/src/ipa/libipa/proc_eim_pkg_retr.c" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_eim_pkg_retr.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_eim_pkg_retr.c.o.d"
+  "/root/repo/src/ipa/libipa/proc_euicc_data_req.c" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_euicc_data_req.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_euicc_data_req.c.o.d"
+  "/root/repo/src/ipa/libipa/proc_euicc_pkg_dwnld_exec.c" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_euicc_pkg_dwnld_exec.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_euicc_pkg_dwnld_exec.c.o.d"
+  "/root/repo/src/ipa/libipa/proc_indirect_prfle_dwnld.c" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_indirect_prfle_dwnld.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_indirect_prfle_dwnld.c.o.d"
+  "/root/repo/src/ipa/libipa/proc_notif_delivery.c" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_notif_delivery.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_notif_delivery.c.o.d"
+  "/root/repo/src/ipa/libipa/proc_prfle_dwnld.c" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_prfle_dwnld.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_prfle_dwnld.c.o.d"
+  "/root/repo/src/ipa/libipa/proc_prfle_inst.c" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_prfle_inst.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/proc_prfle_inst.c.o.d"
+  "/root/repo/src/ipa/libipa/utils.c" "src/ipa/libipa/CMakeFiles/libipa.dir/utils.c.o" "gcc" "src/ipa/libipa/CMakeFiles/libipa.dir/utils.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/src/ipa/libasn/CMakeFiles/libasn.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,105 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libipa.dir/activation_code.c.o"
+  "CMakeFiles/libipa.dir/activation_code.c.o.d"
+  "CMakeFiles/libipa.dir/bpp_segments.c.o"
+  "CMakeFiles/libipa.dir/bpp_segments.c.o.d"
+  "CMakeFiles/libipa.dir/es10a_get_euicc_cfg_addr.c.o"
+  "CMakeFiles/libipa.dir/es10a_get_euicc_cfg_addr.c.o.d"
+  "CMakeFiles/libipa.dir/es10b_add_init_eim.c.o"
+  "CMakeFiles/libipa.dir/es10b_add_init_eim.c.o.d"
+  "CMakeFiles/libipa.dir/es10b_auth_serv.c.o"
+  "CMakeFiles/libipa.dir/es10b_auth_serv.c.o.d"
+  "CMakeFiles/libipa.dir/es10b_cancel_session.c.o"
+  "CMakeFiles/libipa.dir/es10b_cancel_session.c.o.d"
+  "CMakeFiles/libipa.dir/es10b_enable_using_dd.c.o"
+  "CMakeFiles/libipa.dir/es10b_enable_using_dd.c.o.d"
+  "CMakeFiles/libipa.dir/es10b_euicc_mem_rst.c.o"
+  "CMakeFiles/libipa.dir/es10b_euicc_mem_rst.c.o.d"
+  "CMakeFiles/libipa.dir/es10b_get_certs.c.o"
+  "CMakeFiles/libipa.dir/es10b_get_certs.c.o.d"
+  "CMakeFiles/libipa.dir/es10b_get_eim_cfg_data.c.o"
+  "CMakeFiles/libipa.dir/es10b_get_eim_cfg_data.c.o.d"
+  "CMakeFiles/libipa.dir/es10b_get_euicc_chlg.c.o"
+  "CMakeFiles/libipa.dir/es10b_get_euicc_chlg.c.o.d"
+  "CMakeFiles/libipa.dir/es10b_get_euicc_info.c.o"
+  "CMakeFiles/libipa.dir/es10b_get_euicc_info.c.o.d"
+  "CMakeFiles/libipa.dir/es10b_get_rat.c.o"
+  "CMakeFiles/libipa.dir/es10b_get_rat.c.o.d"
+  "CMakeFiles/libipa.dir/es10b_load_bnd_prfle_pkg.c.o"
+  "CMakeFiles/libipa.dir/es10b_load_bnd_prfle_pkg.c.o.d"
+  "CMakeFiles/libipa.dir/es10b_load_euicc_pkg.c.o"
+  "CMakeFiles/libipa.dir/es10b_load_euicc_pkg.c.o.d"
+  "CMakeFiles/libipa.dir/es10b_prep_dwnld.c.o"
+  "CMakeFiles/libipa.dir/es10b_prep_dwnld.c.o.d"
+  "CMakeFiles/libipa.dir/es10b_prfle_rollback.c.o"
+  "CMakeFiles/libipa.dir/es10b_prfle_rollback.c.o.d"
+  "CMakeFiles/libipa.dir/es10b_retr_notif_from_lst.c.o"
+  "CMakeFiles/libipa.dir/es10b_retr_notif_from_lst.c.o.d"
+  "CMakeFiles/libipa.dir/es10b_rm_notif_from_lst.c.o"
+  "CMakeFiles/libipa.dir/es10b_rm_notif_from_lst.c.o.d"
+  "CMakeFiles/libipa.dir/es10c_delete_prfle.c.o"
+  "CMakeFiles/libipa.dir/es10c_delete_prfle.c.o.d"
+  "CMakeFiles/libipa.dir/es10c_disable_prfle.c.o"
+  "CMakeFiles/libipa.dir/es10c_disable_prfle.c.o.d"
+  "CMakeFiles/libipa.dir/es10c_enable_prfle.c.o"
+  "CMakeFiles/libipa.dir/es10c_enable_prfle.c.o.d"
+  "CMakeFiles/libipa.dir/es10c_get_eid.c.o"
+  "CMakeFiles/libipa.dir/es10c_get_eid.c.o.d"
+  "CMakeFiles/libipa.dir/es10c_get_prfle_info.c.o"
+  "CMakeFiles/libipa.dir/es10c_get_prfle_info.c.o.d"
+  "CMakeFiles/libipa.dir/es10x.c.o"
+  "CMakeFiles/libipa.dir/es10x.c.o.d"
+  "CMakeFiles/libipa.dir/esipa.c.o"
+  "CMakeFiles/libipa.dir/esipa.c.o.d"
+  "CMakeFiles/libipa.dir/esipa_auth_clnt.c.o"
+  "CMakeFiles/libipa.dir/esipa_auth_clnt.c.o.d"
+  "CMakeFiles/libipa.dir/esipa_cancel_session.c.o"
+  "CMakeFiles/libipa.dir/esipa_cancel_session.c.o.d"
+  "CMakeFiles/libipa.dir/esipa_get_bnd_prfle_pkg.c.o"
+  "CMakeFiles/libipa.dir/esipa_get_bnd_prfle_pkg.c.o.d"
+  "CMakeFiles/libipa.dir/esipa_get_eim_pkg.c.o"
+  "CMakeFiles/libipa.dir/esipa_get_eim_pkg.c.o.d"
+  "CMakeFiles/libipa.dir/esipa_handle_notif.c.o"
+  "CMakeFiles/libipa.dir/esipa_handle_notif.c.o.d"
+  "CMakeFiles/libipa.dir/esipa_init_auth.c.o"
+  "CMakeFiles/libipa.dir/esipa_init_auth.c.o.d"
+  "CMakeFiles/libipa.dir/esipa_prvde_eim_pkg_rslt.c.o"
+  "CMakeFiles/libipa.dir/esipa_prvde_eim_pkg_rslt.c.o.d"
+  "CMakeFiles/libipa.dir/esipa_transfer_eim_pkg.c.o"
+  "CMakeFiles/libipa.dir/esipa_transfer_eim_pkg.c.o.d"
+  "CMakeFiles/libipa.dir/euicc.c.o"
+  "CMakeFiles/libipa.dir/euicc.c.o.d"
+  "CMakeFiles/libipa.dir/ipad.c.o"
+  "CMakeFiles/libipa.dir/ipad.c.o.d"
+  "CMakeFiles/libipa.dir/log.c.o"
+  "CMakeFiles/libipa.dir/log.c.o.d"
+  "CMakeFiles/libipa.dir/proc_cmn_cancel_sess.c.o"
+  "CMakeFiles/libipa.dir/proc_cmn_cancel_sess.c.o.d"
+  "CMakeFiles/libipa.dir/proc_cmn_mtl_auth.c.o"
+  "CMakeFiles/libipa.dir/proc_cmn_mtl_auth.c.o.d"
+  "CMakeFiles/libipa.dir/proc_eim_pkg_inj.c.o"
+  "CMakeFiles/libipa.dir/proc_eim_pkg_inj.c.o.d"
+  "CMakeFiles/libipa.dir/proc_eim_pkg_retr.c.o"
+  "CMakeFiles/libipa.dir/proc_eim_pkg_retr.c.o.d"
+  "CMakeFiles/libipa.dir/proc_euicc_data_req.c.o"
+  "CMakeFiles/libipa.dir/proc_euicc_data_req.c.o.d"
+  "CMakeFiles/libipa.dir/proc_euicc_pkg_dwnld_exec.c.o"
+  "CMakeFiles/libipa.dir/proc_euicc_pkg_dwnld_exec.c.o.d"
+  "CMakeFiles/libipa.dir/proc_indirect_prfle_dwnld.c.o"
+  "CMakeFiles/libipa.dir/proc_indirect_prfle_dwnld.c.o.d"
+  "CMakeFiles/libipa.dir/proc_notif_delivery.c.o"
+  "CMakeFiles/libipa.dir/proc_notif_delivery.c.o.d"
+  "CMakeFiles/libipa.dir/proc_prfle_dwnld.c.o"
+  "CMakeFiles/libipa.dir/proc_prfle_dwnld.c.o.d"
+  "CMakeFiles/libipa.dir/proc_prfle_inst.c.o"
+  "CMakeFiles/libipa.dir/proc_prfle_inst.c.o.d"
+  "CMakeFiles/libipa.dir/utils.c.o"
+  "CMakeFiles/libipa.dir/utils.c.o.d"
+  "liblibipa.a"
+  "liblibipa.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libipa.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
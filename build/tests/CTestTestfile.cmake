@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("activation_code")
+subdirs("utils")
+subdirs("bpp_segments")
+subdirs("esipa_compact")
+subdirs("coap")
+subdirs("eim_pkg_inj")
+subdirs("long_poll")
+subdirs("asn_arena")
+subdirs("esipa_retry")
+subdirs("es10x_stream")
+subdirs("euicc")
+subdirs("warm_start")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/activation_code_test.dir/activation_code_test.c.o"
+  "CMakeFiles/activation_code_test.dir/activation_code_test.c.o.d"
+  "activation_code_test"
+  "activation_code_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/activation_code_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
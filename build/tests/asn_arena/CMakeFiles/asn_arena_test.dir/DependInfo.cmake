@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/asn_arena/asn_arena_test.c" "tests/asn_arena/CMakeFiles/asn_arena_test.dir/asn_arena_test.c.o" "gcc" "tests/asn_arena/CMakeFiles/asn_arena_test.dir/asn_arena_test.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/src/ipa/libipa/CMakeFiles/libipa.dir/DependInfo.cmake"
+  "/root/repo/build/src/ipa/libasn/CMakeFiles/libasn.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
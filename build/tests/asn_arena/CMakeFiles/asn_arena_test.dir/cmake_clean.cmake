@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/asn_arena_test.dir/asn_arena_test.c.o"
+  "CMakeFiles/asn_arena_test.dir/asn_arena_test.c.o.d"
+  "asn_arena_test"
+  "asn_arena_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/asn_arena_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/asn_arena
+# Build directory: /root/repo/build/tests/asn_arena
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[asn_arena_test]=] "sh" "-c" "/root/repo/build/tests/asn_arena/asn_arena_test ../../../tests/bpp_segments/bpp.ber > asn_arena_test.out 2> asn_arena_test.err")
+set_tests_properties([=[asn_arena_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/asn_arena/CMakeLists.txt;13;add_test;/root/repo/tests/asn_arena/CMakeLists.txt;0;")
+add_test([=[asn_arena_compare_stdout]=] "/usr/bin/cmake" "-E" "compare_files" "/root/repo/build/tests/asn_arena/asn_arena_test.out" "/root/repo/tests/asn_arena/asn_arena_test.ok")
+set_tests_properties([=[asn_arena_compare_stdout]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/asn_arena/CMakeLists.txt;16;add_test;/root/repo/tests/asn_arena/CMakeLists.txt;0;")
+add_test([=[asn_arena_compare_stderr]=] "/usr/bin/cmake" "-E" "compare_files" "/root/repo/build/tests/asn_arena/asn_arena_test.err" "/root/repo/tests/asn_arena/asn_arena_test.err")
+set_tests_properties([=[asn_arena_compare_stderr]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/asn_arena/CMakeLists.txt;21;add_test;/root/repo/tests/asn_arena/CMakeLists.txt;0;")
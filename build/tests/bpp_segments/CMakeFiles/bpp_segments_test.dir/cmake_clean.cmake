@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bpp_segments_test.dir/bpp_segments_test.c.o"
+  "CMakeFiles/bpp_segments_test.dir/bpp_segments_test.c.o.d"
+  "bpp_segments_test"
+  "bpp_segments_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bpp_segments_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/bpp_segments
+# Build directory: /root/repo/build/tests/bpp_segments
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[bpp_segments_test]=] "sh" "-c" "/root/repo/build/tests/bpp_segments/bpp_segments_test ../../../tests/bpp_segments/bpp.ber > bpp_segments_test.out 2> bpp_segments_test.err")
+set_tests_properties([=[bpp_segments_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/bpp_segments/CMakeLists.txt;13;add_test;/root/repo/tests/bpp_segments/CMakeLists.txt;0;")
+add_test([=[bpp_segments_compare_stdout]=] "/usr/bin/cmake" "-E" "compare_files" "/root/repo/build/tests/bpp_segments/bpp_segments_test.out" "/root/repo/tests/bpp_segments/bpp_segments_test.ok")
+set_tests_properties([=[bpp_segments_compare_stdout]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/bpp_segments/CMakeLists.txt;16;add_test;/root/repo/tests/bpp_segments/CMakeLists.txt;0;")
+add_test([=[bpp_segments_compare_stderr]=] "/usr/bin/cmake" "-E" "compare_files" "/root/repo/build/tests/bpp_segments/bpp_segments_test.err" "/root/repo/tests/bpp_segments/bpp_segments_test.err")
+set_tests_properties([=[bpp_segments_compare_stderr]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/bpp_segments/CMakeLists.txt;21;add_test;/root/repo/tests/bpp_segments/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/coap_test.dir/coap_test.c.o"
+  "CMakeFiles/coap_test.dir/coap_test.c.o.d"
+  "coap_test"
+  "coap_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/coap_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
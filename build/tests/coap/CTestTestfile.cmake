@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/coap
+# Build directory: /root/repo/build/tests/coap
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[coap_test]=] "sh" "-c" "/root/repo/build/tests/coap/coap_test > coap_test.out 2> coap_test.err")
+set_tests_properties([=[coap_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/coap/CMakeLists.txt;14;add_test;/root/repo/tests/coap/CMakeLists.txt;0;")
+add_test([=[coap_compare_stdout]=] "/usr/bin/cmake" "-E" "compare_files" "/root/repo/build/tests/coap/coap_test.out" "/root/repo/tests/coap/coap_test.ok")
+set_tests_properties([=[coap_compare_stdout]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/coap/CMakeLists.txt;17;add_test;/root/repo/tests/coap/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/eim_pkg_inj_test.dir/eim_pkg_inj_test.c.o"
+  "CMakeFiles/eim_pkg_inj_test.dir/eim_pkg_inj_test.c.o.d"
+  "eim_pkg_inj_test"
+  "eim_pkg_inj_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/eim_pkg_inj_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
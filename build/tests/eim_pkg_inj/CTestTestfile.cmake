@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/eim_pkg_inj
+# Build directory: /root/repo/build/tests/eim_pkg_inj
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[eim_pkg_inj_test]=] "sh" "-c" "/root/repo/build/tests/eim_pkg_inj/eim_pkg_inj_test > eim_pkg_inj_test.out 2> eim_pkg_inj_test.err")
+set_tests_properties([=[eim_pkg_inj_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/eim_pkg_inj/CMakeLists.txt;13;add_test;/root/repo/tests/eim_pkg_inj/CMakeLists.txt;0;")
+add_test([=[eim_pkg_inj_compare_stdout]=] "/usr/bin/cmake" "-E" "compare_files" "/root/repo/build/tests/eim_pkg_inj/eim_pkg_inj_test.out" "/root/repo/tests/eim_pkg_inj/eim_pkg_inj_test.ok")
+set_tests_properties([=[eim_pkg_inj_compare_stdout]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/eim_pkg_inj/CMakeLists.txt;16;add_test;/root/repo/tests/eim_pkg_inj/CMakeLists.txt;0;")
+add_test([=[eim_pkg_inj_compare_stderr]=] "/usr/bin/cmake" "-E" "compare_files" "/root/repo/build/tests/eim_pkg_inj/eim_pkg_inj_test.err" "/root/repo/tests/eim_pkg_inj/eim_pkg_inj_test.err")
+set_tests_properties([=[eim_pkg_inj_compare_stderr]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/eim_pkg_inj/CMakeLists.txt;21;add_test;/root/repo/tests/eim_pkg_inj/CMakeLists.txt;0;")
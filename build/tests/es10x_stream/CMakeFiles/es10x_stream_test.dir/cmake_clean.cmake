@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/es10x_stream_test.dir/es10x_stream_test.c.o"
+  "CMakeFiles/es10x_stream_test.dir/es10x_stream_test.c.o.d"
+  "es10x_stream_test"
+  "es10x_stream_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/es10x_stream_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/es10x_stream
+# Build directory: /root/repo/build/tests/es10x_stream
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[es10x_stream_test]=] "sh" "-c" "/root/repo/build/tests/es10x_stream/es10x_stream_test > es10x_stream_test.out 2> es10x_stream_test.err")
+set_tests_properties([=[es10x_stream_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/es10x_stream/CMakeLists.txt;13;add_test;/root/repo/tests/es10x_stream/CMakeLists.txt;0;")
+add_test([=[es10x_stream_compare_stdout]=] "/usr/bin/cmake" "-E" "compare_files" "/root/repo/build/tests/es10x_stream/es10x_stream_test.out" "/root/repo/tests/es10x_stream/es10x_stream_test.ok")
+set_tests_properties([=[es10x_stream_compare_stdout]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/es10x_stream/CMakeLists.txt;16;add_test;/root/repo/tests/es10x_stream/CMakeLists.txt;0;")
+add_test([=[es10x_stream_compare_stderr]=] "/usr/bin/cmake" "-E" "compare_files" "/root/repo/build/tests/es10x_stream/es10x_stream_test.err" "/root/repo/tests/es10x_stream/es10x_stream_test.err")
+set_tests_properties([=[es10x_stream_compare_stderr]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/es10x_stream/CMakeLists.txt;21;add_test;/root/repo/tests/es10x_stream/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/esipa_compact_test.dir/esipa_compact_test.c.o"
+  "CMakeFiles/esipa_compact_test.dir/esipa_compact_test.c.o.d"
+  "esipa_compact_test"
+  "esipa_compact_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/esipa_compact_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/esipa_compact
+# Build directory: /root/repo/build/tests/esipa_compact
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[esipa_compact_test]=] "sh" "-c" "/root/repo/build/tests/esipa_compact/esipa_compact_test ../../../tests/esipa_compact > esipa_compact_test.out 2> esipa_compact_test.err")
+set_tests_properties([=[esipa_compact_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/esipa_compact/CMakeLists.txt;13;add_test;/root/repo/tests/esipa_compact/CMakeLists.txt;0;")
+add_test([=[esipa_compact_compare_stdout]=] "/usr/bin/cmake" "-E" "compare_files" "/root/repo/build/tests/esipa_compact/esipa_compact_test.out" "/root/repo/tests/esipa_compact/esipa_compact_test.ok")
+set_tests_properties([=[esipa_compact_compare_stdout]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/esipa_compact/CMakeLists.txt;16;add_test;/root/repo/tests/esipa_compact/CMakeLists.txt;0;")
+add_test([=[esipa_compact_compare_stderr]=] "/usr/bin/cmake" "-E" "compare_files" "/root/repo/build/tests/esipa_compact/esipa_compact_test.err" "/root/repo/tests/esipa_compact/esipa_compact_test.err")
+set_tests_properties([=[esipa_compact_compare_stderr]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/esipa_compact/CMakeLists.txt;21;add_test;/root/repo/tests/esipa_compact/CMakeLists.txt;0;")
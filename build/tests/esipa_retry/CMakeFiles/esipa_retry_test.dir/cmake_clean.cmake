@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/esipa_retry_test.dir/esipa_retry_test.c.o"
+  "CMakeFiles/esipa_retry_test.dir/esipa_retry_test.c.o.d"
+  "esipa_retry_test"
+  "esipa_retry_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/esipa_retry_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/euicc_test.dir/euicc_test.c.o"
+  "CMakeFiles/euicc_test.dir/euicc_test.c.o.d"
+  "euicc_test"
+  "euicc_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/euicc_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/euicc
+# Build directory: /root/repo/build/tests/euicc
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[euicc_test]=] "sh" "-c" "/root/repo/build/tests/euicc/euicc_test > euicc_test.out 2> euicc_test.err")
+set_tests_properties([=[euicc_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/euicc/CMakeLists.txt;13;add_test;/root/repo/tests/euicc/CMakeLists.txt;0;")
+add_test([=[euicc_compare_stdout]=] "/usr/bin/cmake" "-E" "compare_files" "/root/repo/build/tests/euicc/euicc_test.out" "/root/repo/tests/euicc/euicc_test.ok")
+set_tests_properties([=[euicc_compare_stdout]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/euicc/CMakeLists.txt;16;add_test;/root/repo/tests/euicc/CMakeLists.txt;0;")
+add_test([=[euicc_compare_stderr]=] "/usr/bin/cmake" "-E" "compare_files" "/root/repo/build/tests/euicc/euicc_test.err" "/root/repo/tests/euicc/euicc_test.err")
+set_tests_properties([=[euicc_compare_stderr]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/euicc/CMakeLists.txt;21;add_test;/root/repo/tests/euicc/CMakeLists.txt;0;")
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/long_poll/long_poll_test.c" "tests/long_poll/CMakeFiles/long_poll_test.dir/long_poll_test.c.o" "gcc" "tests/long_poll/CMakeFiles/long_poll_test.dir/long_poll_test.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/src/ipa/libipa/CMakeFiles/libipa.dir/DependInfo.cmake"
+  "/root/repo/build/src/ipa/CMakeFiles/http.dir/DependInfo.cmake"
+  "/root/repo/build/src/ipa/CMakeFiles/coap.dir/DependInfo.cmake"
+  "/root/repo/build/src/ipa/CMakeFiles/http_srv.dir/DependInfo.cmake"
+  "/root/repo/build/src/ipa/libasn/CMakeFiles/libasn.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/long_poll_test.dir/long_poll_test.c.o"
+  "CMakeFiles/long_poll_test.dir/long_poll_test.c.o.d"
+  "long_poll_test"
+  "long_poll_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/long_poll_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
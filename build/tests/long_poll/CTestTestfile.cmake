@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/long_poll
+# Build directory: /root/repo/build/tests/long_poll
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[long_poll_test]=] "sh" "-c" "/root/repo/build/tests/long_poll/long_poll_test > long_poll_test.out 2> long_poll_test.err")
+set_tests_properties([=[long_poll_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/long_poll/CMakeLists.txt;14;add_test;/root/repo/tests/long_poll/CMakeLists.txt;0;")
+add_test([=[long_poll_compare_stdout]=] "/usr/bin/cmake" "-E" "compare_files" "/root/repo/build/tests/long_poll/long_poll_test.out" "/root/repo/tests/long_poll/long_poll_test.ok")
+set_tests_properties([=[long_poll_compare_stdout]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/long_poll/CMakeLists.txt;17;add_test;/root/repo/tests/long_poll/CMakeLists.txt;0;")
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/utils
+# Build directory: /root/repo/build/tests/utils
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[utils_test]=] "sh" "-c" "/root/repo/build/tests/utils/utils_test ../../../tests")
+set_tests_properties([=[utils_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/utils/CMakeLists.txt;13;add_test;/root/repo/tests/utils/CMakeLists.txt;0;")
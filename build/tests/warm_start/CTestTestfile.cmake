@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/warm_start
+# Build directory: /root/repo/build/tests/warm_start
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[warm_start_test]=] "sh" "-c" "/root/repo/build/tests/warm_start/warm_start_test > warm_start_test.out 2> warm_start_test.err")
+set_tests_properties([=[warm_start_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/warm_start/CMakeLists.txt;14;add_test;/root/repo/tests/warm_start/CMakeLists.txt;0;")
+add_test([=[warm_start_compare_stdout]=] "/usr/bin/cmake" "-E" "compare_files" "/root/repo/build/tests/warm_start/warm_start_test.out" "/root/repo/tests/warm_start/warm_start_test.ok")
+set_tests_properties([=[warm_start_compare_stdout]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/warm_start/CMakeLists.txt;17;add_test;/root/repo/tests/warm_start/CMakeLists.txt;0;")
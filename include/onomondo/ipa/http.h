@@ -1,12 +1,28 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
 struct ipa_buf;
 
 /* This is the initial buffer size. The HTTP client will automatically re-alloc more memory if needed. */
 #define IPA_LEN_HTTP_RESPONSE_BUF 512	/* bytes */
 
+/*! Callback that receives the HTTP response chunk by chunk (see ipa_http_req_stream).
+ *  \param[in] data pointer to the received chunk.
+ *  \param[in] len length of the received chunk.
+ *  \param[in] priv private data pointer that was passed to ipa_http_req_stream.
+ *  \returns 0 on success, negative to abort the request. */
+typedef int (*ipa_http_res_cb)(const uint8_t *data, size_t len, void *priv);
+
 void *ipa_http_init(const char *cabundle, bool no_verif);
 struct ipa_buf *ipa_http_req(void *http_ctx, const struct ipa_buf *req, const char *url);
+struct ipa_buf *ipa_http_req_timeout(void *http_ctx, const struct ipa_buf *req, const char *url, unsigned int timeout);
+int ipa_http_req_stream(void *http_ctx, const struct ipa_buf *req, const char *url, ipa_http_res_cb res_cb,
+			void *priv);
+void ipa_http_recycle(void *http_ctx, struct ipa_buf *buf);
 void ipa_http_close(void *http_ctx);
+struct ipa_buf *ipa_http_export_session(void *http_ctx);
+int ipa_http_import_session(void *http_ctx, const struct ipa_buf *session);
+void ipa_http_stats(void *http_ctx, unsigned int *handshakes, unsigned int *reuses);
 void ipa_http_free(void *http_ctx);
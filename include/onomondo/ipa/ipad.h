@@ -27,6 +27,15 @@ enum ipa_poll_rc {
 	 *  been resettled. */
 	IPA_POLL_AGAIN_WHEN_ONLINE = 2,
 
+	/*! A request towards the eIM has failed and will be retried. The API user shall call ipa_poll() again after
+	 *  the delay that ipa_poll_delay() returns (earlier calls return IPA_POLL_RETRY immediately). The ESipa
+	 *  function that has failed is then resumed. */
+	IPA_POLL_RETRY = 3,
+
+	/*! The long poll (see eim_long_poll_timeout) has ended without an eIM package. The API user shall call
+	 *  ipa_poll() again immediately to start the next long poll. */
+	IPA_POLL_LONG_POLL_TIMEOUT = 4,
+
 	/*! Communication with the eUICC was not possible. The caller shall call ipa_popp() again when connectivity to
 	 *  the eUICC has been recovered. */
 	IPA_POLL_CHECK_SCARD = -1000,
@@ -55,9 +64,45 @@ struct ipa_config {
 	/*! The caller may choose to disable SSL certificate verification in a test environment to simplify debugging. */
 	bool eim_disable_ssl_verif;
 
-	/*! Configure the number of retries to apply in case a request (HTTP) to the eIM fails */
+	/*! Use CoAP over DTLS (coaps://) instead of HTTPS to reach the eIM. Large ESipa messages are transferred
+	 *  block-wise, so that no datagram exceeds the path MTU. (When eim_disable_ssl is set, plain CoAP over UDP is
+	 *  used) */
+	bool eim_coap;
+
+	/*! Announce that the eIM may inject eIM packages (ipaInjectHttps). The API user must then accept the eIM
+	 *  packages from the eIM (HTTPS server) and pass them to ipa_inject_eim_pkg(). */
+	bool eim_inject;
+
+	/*! Keep the connection towards the eIM open across poll cycles (for as long as the eIM permits it). When this
+	 *  option is not set, a fresh connection is used for each poll cycle. (In both cases the TLS session is cached,
+	 *  so that a new connection can resume the previous TLS session) */
+	bool eim_keep_alive;
+
+	/*! Long poll the eIM for eIM packages. The eIM may hold the GetEimPackage request for up to the configured time
+	 *  (seconds) until an eIM package becomes available. When the time expires (or the eIM responds without
+	 *  content), ipa_poll() returns IPA_POLL_LONG_POLL_TIMEOUT. (0 = disabled, should be combined with
+	 *  eim_keep_alive, the eIM must support long polling) */
+	unsigned int eim_long_poll_timeout;
+
+	/*! Configure the number of retries to apply in case a request (HTTP) to the eIM fails. The retries do not block,
+	 *  ipa_poll() returns IPA_POLL_RETRY instead and the delay between the retries grows exponentially (with random
+	 *  jitter, see also ipa_poll_delay()) */
 	unsigned int esipa_req_retries;
 
+	/*! Stream the BoundProfilePackage into the eUICC while it is downloaded. Each ES8+ segment is loaded into the
+	 *  eUICC as soon as it has been received, so that the BoundProfilePackage does not have to be held in memory as
+	 *  a whole and the download overlaps with the installation. (Since the installation starts during the download,
+	 *  the end user consent is requested before the download. A failed download is not retried.) */
+	bool esipa_bpp_stream;
+
+	/*! Minimize the ESipa traffic (minimizeEsipaBytes, see also SGP.32, section 5.14). The IPA capability is
+	 *  announced to the eIM and the eUICC responses are forwarded in their compact format, which leaves out all
+	 *  fields that the eIM can reconstruct by itself. euiccInfo1 and the eUICC/EUM certificates are omitted once the
+	 *  eIM has received them. SGP.32 does not let the IPA learn whether the eIM supports the compact formats, so
+	 *  only enable this when the eIM is known to support them. When the eIM responds with an error, euiccInfo1 and
+	 *  the certificates are sent again with the next requests. */
+	bool esipa_minimize_bytes;
+
 	/*! When a profile rollback is performed an optional refresh flag can be set. (See also SGP.32, section 5.9.16)
 	 *  In case the IoT eUICC emulation is enabled (iot_euicc_emu_enabled), then this flag also plays a role when
 	 *  profiles are disabled or enabled. (See also SGP.22, section 5.7.16 and section 5.7.17) */
@@ -69,6 +114,23 @@ struct ipa_config {
 	/*! Number of the logical channel that is used to communicate with the ISD-R */
 	uint8_t euicc_channel;
 
+	/*! The caller may choose to disable the use of extended length APDUs. By default extended length APDUs are used
+	 *  to transfer ES10x requests and responses in large blocks when the eUICC indicates support in its ATR.
+	 *  (In case the eUICC or the cardreader reject an extended length APDU, the IPAd will automatically fall back
+	 *  to short APDUs) With short APDUs, an ES10x request is limited to 256 STORE DATA blocks of 255 bytes (about
+	 *  64 KB), larger requests are refused. */
+	bool euicc_disable_ext_apdu;
+
+	/*! Enable warm start. ATR and EID of the eUICC are cached in the nvstate. When the eUICC presents the cached ATR
+	 *  on the next start, the IPAd assumes that it is the same eUICC in the same state. TERMINAL CAPABILITIES is not
+	 *  sent again and the EID is taken from the cache. (Only use this when the eUICC cannot be swapped.) */
+	bool euicc_warm_start;
+
+	/*! Do not close the logical channel when the context is freed. On a warm start (see above) the IPAd will then
+	 *  try to reuse the channel, in which ISD-R is still selected. (This only makes sense when the eUICC is not
+	 *  powered down between two starts) */
+	bool euicc_keep_channel;
+
 	/*! Enable IoT eUICC emulation.
 	 *  This IPAd also supports the use of consumer eUICCs, which have a slightly different interface. When the
 	 *  IoT eUICC emulation is enabled, the IPAd will adapt the interface on ES10x function level so that the
@@ -89,5 +151,7 @@ int ipa_add_init_eim_cfg(struct ipa_context *ctx, struct ipa_buf *cfg);
 int ipa_euicc_mem_rst(struct ipa_context *ctx, bool operatnl_profiles, bool test_profiles, bool default_smdp_addr,
 		      bool eim_cfg_data, bool auto_enable_cfg);
 int ipa_poll(struct ipa_context *ctx);
+unsigned int ipa_poll_delay(struct ipa_context *ctx);
+struct ipa_buf *ipa_inject_eim_pkg(struct ipa_context *ctx, const struct ipa_buf *eim_pkg);
 void ipa_close(struct ipa_context *ctx);
 struct ipa_buf *ipa_free_ctx(struct ipa_context *ctx);
@@ -1,8 +1,14 @@
 #pragma once
 
+int ipa_scard_num_readers(void);
 void *ipa_scard_init(unsigned int reader_num);
 int ipa_scard_reset(void *scard_ctx);
 int ipa_scard_atr(void *scard_ctx, struct ipa_buf *atr);
+int ipa_scard_protocol(void *scard_ctx);
 int ipa_scard_transceive(void *scard_ctx, struct ipa_buf *res,
 			 const struct ipa_buf *req);
+int ipa_scard_transceive_v(void *scard_ctx, struct ipa_buf *res,
+			   const struct ipa_buf *req_iov, unsigned int req_iov_count);
+int ipa_scard_begin_transaction(void *scard_ctx);
+int ipa_scard_end_transaction(void *scard_ctx);
 int ipa_scard_free(void *scard_ctx);
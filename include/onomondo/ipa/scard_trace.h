@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stdbool.h>
+
+/*! Operating modes of the APDU trace smartcard backend (see also scard_trace.c) */
+enum ipa_scard_trace_mode {
+	/*! pass all APDUs through to the PC/SC smartcard backend, no trace is written. */
+	IPA_SCARD_TRACE_OFF,
+	/*! pass all APDUs through to the PC/SC smartcard backend and record them (with timestamps) to a trace file. */
+	IPA_SCARD_TRACE_RECORD,
+	/*! serve the responses from a previously recorded trace file, no smartcard reader is needed. */
+	IPA_SCARD_TRACE_REPLAY,
+};
+
+void ipa_scard_trace_cfg(enum ipa_scard_trace_mode mode, const char *path, bool realtime);
@@ -0,0 +1,1024 @@
+/*
+ * Author: Philipp Maier <pmaier@sysmocom.de> / sysmocom - s.f.m.c. GmbH
+ *
+ * CoAP transport: The ESipa messages are transferred as CoAP POST requests (RFC 7252) over DTLS (coaps://) or over
+ * plain UDP (coap://, only for testing). Requests and responses that do not fit into a single block are transferred
+ * block-wise (RFC 7959), the request using the Block1 option and the response using the Block2 option. This keeps
+ * the datagrams below the path MTU, so that large messages (e.g. a BoundProfilePackage) are never fragmented on the
+ * IP layer. The functions in this file are called from http.c, which selects the transport by the URL scheme.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <errno.h>
+#include <assert.h>
+#include <string.h>
+#include <time.h>
+#include <poll.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <openssl/ssl.h>
+#include <openssl/err.h>
+#include <onomondo/ipa/utils.h>
+#include <onomondo/ipa/http.h>
+#include <onomondo/ipa/log.h>
+#include <onomondo/ipa/mem.h>
+#include "coap.h"
+
+#define PREFIX_COAP "coap://"
+#define PREFIX_COAPS "coaps://"
+#define COAP_DEFAULT_PORT "5683"
+#define COAPS_DEFAULT_PORT "5684"
+
+/* Message format, see also RFC 7252, section 3 */
+#define COAP_VERSION 1
+#define COAP_TYPE_CON 0
+#define COAP_TYPE_NON 1
+#define COAP_TYPE_ACK 2
+#define COAP_TYPE_RST 3
+#define COAP_CODE(class, detail) (((class) << 5) | (detail))
+#define COAP_CODE_CLASS(code) ((code) >> 5)
+#define COAP_CODE_DETAIL(code) ((code) & 0x1f)
+#define COAP_CODE_EMPTY COAP_CODE(0, 0)
+#define COAP_CODE_POST COAP_CODE(0, 2)
+#define COAP_CODE_CONTINUE COAP_CODE(2, 31)
+#define COAP_PAYLOAD_MARKER 0xFF
+#define COAP_TOKEN_LEN 4
+
+/* Options, see also RFC 7252, section 5.10 and RFC 7959, section 2 */
+#define COAP_OPT_URI_HOST 3
+#define COAP_OPT_URI_PATH 11
+#define COAP_OPT_CONTENT_FORMAT 12
+#define COAP_OPT_BLOCK2 23
+#define COAP_OPT_BLOCK1 27
+#define COAP_OPT_SIZE2 28
+#define COAP_OPT_SIZE1 60
+#define COAP_CONTENT_FORMAT_OCTET_STREAM 42
+
+/* Block size (2^(SZX + 4) bytes), 1024 bytes per block keep a datagram (including CoAP header, options and DTLS
+ * record overhead) below the IPv6 minimum MTU of 1280 bytes. */
+#define COAP_BLOCK_SZX 6
+#define COAP_BLOCK_SIZE(szx) (1 << ((szx) + 4))
+
+/* Maximum size of a datagram we send or receive (one block plus header and options) */
+#define COAP_MAX_MSG_LEN 1280
+
+/* Maximum length of the options of a request other than Uri-Host and Uri-Path (Content-Format, Block2, Block1 and
+ * Size1, each with up to 3 bytes of option header and up to 4 bytes of value) */
+#define COAP_MAX_FIXED_OPTS_LEN (4 * 7)
+
+/* Largest response that is accepted (see also HTTP_MAX_RES_LEN) */
+#define COAP_MAX_RES_LEN (4 * 1024 * 1024)
+
+/* Transmission parameters (milliseconds), see also RFC 7252, section 4.8. When a separate response is announced (empty
+ * ACK), we wait for the response for as long as we would wait for an HTTP response (see also HTTP_TIMEOUT). */
+#define COAP_ACK_TIMEOUT 2000
+#define COAP_MAX_RETRANSMIT 4
+#define COAP_SEPARATE_TIMEOUT 5000
+
+/* Parsed URL */
+struct coap_url {
+	bool dtls;
+	char host[256];
+	char port[8];
+	char path[256];
+};
+
+/* Parsed CoAP message (only the fields and options we are interested in) */
+struct coap_msg {
+	uint8_t type;
+	uint8_t code;
+	uint16_t msg_id;
+	uint8_t token[8];
+	size_t token_len;
+	bool block1_present;
+	uint32_t block1;
+	bool block2_present;
+	uint32_t block2;
+	bool size2_present;
+	uint32_t size2;
+	const uint8_t *payload;
+	size_t payload_len;
+};
+
+/* Decoded Block1/Block2 option value, see also RFC 7959, section 2.2 */
+struct coap_block {
+	uint32_t num;
+	bool more;
+	uint8_t szx;
+};
+
+struct coap_ctx {
+	char *cabundle;
+	bool no_verif;
+
+	/* Connection towards the server (socket and DTLS session) and the URL it was established for */
+	int fd;
+	SSL_CTX *ssl_ctx;
+	SSL *ssl;
+	struct coap_url conn_url;
+	bool connected;
+	bool new_conn;
+
+	/* DTLS session of the previous connection, offered to the server on the next connection (abbreviated
+	 * handshake) */
+	SSL_SESSION *dtls_session;
+
+	uint16_t msg_id;
+	uint32_t token;
+	unsigned int seed;
+
+	/* Buffer for received datagrams */
+	uint8_t rx_buf[COAP_MAX_MSG_LEN];
+
+	/* Sink that receives the payload of the response (see exchange) */
+	struct ipa_buf *res;
+	ipa_http_res_cb res_cb;
+	void *res_cb_priv;
+
+	/* see also ipa_http_stats */
+	unsigned int handshakes;
+	unsigned int reuses;
+};
+
+static uint64_t now_ms(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static int parse_url(struct coap_url *coap_url, const char *url)
+{
+	const char *host;
+	const char *host_end;
+	const char *path;
+	const char *port = NULL;
+	size_t host_len;
+
+	memset(coap_url, 0, sizeof(*coap_url));
+	if (strncmp(url, PREFIX_COAPS, strlen(PREFIX_COAPS)) == 0) {
+		coap_url->dtls = true;
+		host = url + strlen(PREFIX_COAPS);
+	} else if (strncmp(url, PREFIX_COAP, strlen(PREFIX_COAP)) == 0) {
+		host = url + strlen(PREFIX_COAP);
+	} else {
+		return -EINVAL;
+	}
+
+	path = strchr(host, '/');
+	if (!path)
+		path = host + strlen(host);
+
+	/* IPv6 address literal, e.g. [::1]:5684 */
+	if (host[0] == '[') {
+		host++;
+		host_end = memchr(host, ']', path - host);
+		if (!host_end)
+			return -EINVAL;
+		if (host_end[1] == ':')
+			port = host_end + 2;
+	} else {
+		host_end = memchr(host, ':', path - host);
+		if (host_end)
+			port = host_end + 1;
+		else
+			host_end = path;
+	}
+
+	host_len = host_end - host;
+	if (host_len == 0 || host_len >= sizeof(coap_url->host))
+		return -EINVAL;
+	memcpy(coap_url->host, host, host_len);
+
+	if (port && path - port > 0 && (size_t)(path - port) < sizeof(coap_url->port))
+		memcpy(coap_url->port, port, path - port);
+	else
+		strcpy(coap_url->port, coap_url->dtls ? COAPS_DEFAULT_PORT : COAP_DEFAULT_PORT);
+
+	if (strlen(path) >= sizeof(coap_url->path))
+		return -EINVAL;
+	strcpy(coap_url->path, path);
+
+	return 0;
+}
+
+/*! Check whether an URL refers to the CoAP transport.
+ *  \param[in] url URL to check.
+ *  \returns true when the URL scheme is coap:// or coaps://. */
+bool ipa_coap_url(const char *url)
+{
+	return url && (strncmp(url, PREFIX_COAP, strlen(PREFIX_COAP)) == 0 ||
+		       strncmp(url, PREFIX_COAPS, strlen(PREFIX_COAPS)) == 0);
+}
+
+/*! Initialize CoAP client (no connection is established yet).
+ *  \param[in] cabundle path to a CA bundle (used to verify the DTLS server certificate).
+ *  \param[in] no_verif skip DTLS certificate verification (insecure).
+ *  \returns pointer to newly allocated CoAP client context. */
+void *ipa_coap_init(const char *cabundle, bool no_verif)
+{
+	struct coap_ctx *ctx = IPA_ALLOC_ZERO(struct coap_ctx);
+	assert(ctx);
+
+	if (cabundle) {
+		ctx->cabundle = IPA_ALLOC_N(strlen(cabundle) + 1);
+		assert(ctx->cabundle);
+		strcpy(ctx->cabundle, cabundle);
+	}
+	ctx->no_verif = no_verif;
+	ctx->fd = -1;
+
+	/* Message ID and token must not be predictable (see also RFC 7252, section 4.4 and 5.3.1) */
+	ctx->seed = (unsigned int)now_ms() ^ (unsigned int)(uintptr_t) ctx;
+	ctx->msg_id = rand_r(&ctx->seed);
+	ctx->token = rand_r(&ctx->seed);
+
+	return ctx;
+}
+
+static SSL_CTX *dtls_ctx(struct coap_ctx *ctx)
+{
+	SSL_CTX *ssl_ctx;
+
+	ssl_ctx = SSL_CTX_new(DTLS_client_method());
+	if (!ssl_ctx)
+		return NULL;
+	SSL_CTX_set_min_proto_version(ssl_ctx, DTLS1_2_VERSION);
+	SSL_CTX_set_session_cache_mode(ssl_ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL);
+
+	if (ctx->no_verif) {
+		SSL_CTX_set_verify(ssl_ctx, SSL_VERIFY_NONE, NULL);
+		IPA_LOGP(SHTTP, LINFO, "security disabled: will not verify server certificate and hostname\n");
+		return ssl_ctx;
+	}
+
+	if (ctx->cabundle) {
+		if (SSL_CTX_load_verify_locations(ssl_ctx, ctx->cabundle, NULL) != 1) {
+			IPA_LOGP(SHTTP, LERROR, "unable to load CA bundle %s!\n", ctx->cabundle);
+			SSL_CTX_free(ssl_ctx);
+			return NULL;
+		}
+	} else {
+		SSL_CTX_set_default_verify_paths(ssl_ctx);
+	}
+	SSL_CTX_set_verify(ssl_ctx, SSL_VERIFY_PEER, NULL);
+
+	return ssl_ctx;
+}
+
+static int dtls_handshake(struct coap_ctx *ctx, const struct sockaddr *addr)
+{
+	BIO *bio;
+	const char *err_str;
+	int rc;
+
+	if (!ctx->ssl_ctx) {
+		ctx->ssl_ctx = dtls_ctx(ctx);
+		if (!ctx->ssl_ctx) {
+			IPA_LOGP(SHTTP, LERROR, "cannot create DTLS context!\n");
+			return -EINVAL;
+		}
+	}
+
+	ctx->ssl = SSL_new(ctx->ssl_ctx);
+	bio = BIO_new_dgram(ctx->fd, BIO_NOCLOSE);
+	if (!ctx->ssl || !bio) {
+		BIO_free(bio);
+		return -ENOMEM;
+	}
+	BIO_ctrl(bio, BIO_CTRL_DGRAM_SET_CONNECTED, 0, (void *)addr);
+	SSL_set_bio(ctx->ssl, bio, bio);
+
+	SSL_set_tlsext_host_name(ctx->ssl, ctx->conn_url.host);
+	if (!ctx->no_verif)
+		SSL_set1_host(ctx->ssl, ctx->conn_url.host);
+	if (ctx->dtls_session && SSL_set_session(ctx->ssl, ctx->dtls_session) == 1)
+		IPA_LOGP(SHTTP, LDEBUG, "offering previous DTLS session for resumption\n");
+
+	/* The socket is blocking, OpenSSL takes care of the retransmissions during the handshake */
+	rc = SSL_connect(ctx->ssl);
+	if (rc != 1) {
+		err_str = ERR_reason_error_string(ERR_get_error());
+		IPA_LOGP(SHTTP, LERROR, "DTLS handshake with %s:%s failed: %s\n", ctx->conn_url.host, ctx->conn_url.port,
+			 err_str ? err_str : "unknown error");
+		return -EIO;
+	}
+	IPA_LOGP(SHTTP, LDEBUG, "DTLS handshake done (%s)\n",
+		 SSL_session_reused(ctx->ssl) ? "session resumed" : "full handshake");
+
+	SSL_SESSION_free(ctx->dtls_session);
+	ctx->dtls_session = SSL_get1_session(ctx->ssl);
+
+	return 0;
+}
+
+/*! Close the connection (DTLS session and socket) towards the server.
+ *  \param[inout] coap_ctx CoAP client context. */
+void ipa_coap_close(void *coap_ctx)
+{
+	struct coap_ctx *ctx = coap_ctx;
+
+	if (ctx->ssl) {
+		if (ctx->connected)
+			SSL_shutdown(ctx->ssl);
+		SSL_free(ctx->ssl);
+		ctx->ssl = NULL;
+	}
+	if (ctx->fd >= 0) {
+		close(ctx->fd);
+		ctx->fd = -1;
+	}
+	ctx->connected = false;
+}
+
+/* Establish a connection towards the server (if not already present) */
+static int conn_open(struct coap_ctx *ctx, const struct coap_url *url)
+{
+	struct addrinfo hints = { 0 };
+	struct addrinfo *addr_list = NULL;
+	struct addrinfo *addr;
+	int rc;
+
+	ctx->new_conn = false;
+	if (ctx->connected && ctx->conn_url.dtls == url->dtls && strcmp(ctx->conn_url.host, url->host) == 0 &&
+	    strcmp(ctx->conn_url.port, url->port) == 0)
+		return 0;
+
+	ipa_coap_close(ctx);
+	ctx->conn_url = *url;
+
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_DGRAM;
+	rc = getaddrinfo(url->host, url->port, &hints, &addr_list);
+	if (rc != 0) {
+		IPA_LOGP(SHTTP, LERROR, "cannot resolve %s: %s\n", url->host, gai_strerror(rc));
+		return -EIO;
+	}
+
+	for (addr = addr_list; addr; addr = addr->ai_next) {
+		ctx->fd = socket(addr->ai_family, addr->ai_socktype, addr->ai_protocol);
+		if (ctx->fd < 0)
+			continue;
+		if (connect(ctx->fd, addr->ai_addr, addr->ai_addrlen) == 0)
+			break;
+		close(ctx->fd);
+		ctx->fd = -1;
+	}
+	if (ctx->fd < 0) {
+		IPA_LOGP(SHTTP, LERROR, "cannot connect to %s:%s\n", url->host, url->port);
+		freeaddrinfo(addr_list);
+		return -EIO;
+	}
+
+	if (url->dtls) {
+		rc = dtls_handshake(ctx, addr->ai_addr);
+		if (rc < 0) {
+			freeaddrinfo(addr_list);
+			ipa_coap_close(ctx);
+			return rc;
+		}
+	}
+
+	freeaddrinfo(addr_list);
+	ctx->connected = true;
+	ctx->new_conn = true;
+	return 0;
+}
+
+static int conn_send(struct coap_ctx *ctx, const uint8_t *msg, size_t len)
+{
+	ssize_t rc;
+
+	if (ctx->ssl)
+		rc = SSL_write(ctx->ssl, msg, len);
+	else
+		rc = send(ctx->fd, msg, len, 0);
+	if (rc != (ssize_t)len) {
+		IPA_LOGP(SHTTP, LERROR, "cannot send CoAP message (%zu bytes)\n", len);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+/* Receive one datagram, returns the length of the datagram, 0 when nothing was received within the timeout */
+static int conn_recv(struct coap_ctx *ctx, unsigned int timeout_ms)
+{
+	struct pollfd pfd = { .fd = ctx->fd, .events = POLLIN };
+	int rc;
+
+	if (!ctx->ssl || !SSL_pending(ctx->ssl)) {
+		rc = poll(&pfd, 1, timeout_ms);
+		if (rc < 0)
+			return -EIO;
+		else if (rc == 0)
+			return 0;
+	}
+
+	if (ctx->ssl) {
+		rc = SSL_read(ctx->ssl, ctx->rx_buf, sizeof(ctx->rx_buf));
+		if (rc <= 0) {
+			/* Not every DTLS record carries application data (and records that fail to authenticate are
+			 * silently discarded) */
+			if (SSL_get_error(ctx->ssl, rc) == SSL_ERROR_WANT_READ)
+				return 0;
+			return -EIO;
+		}
+	} else {
+		rc = recv(ctx->fd, ctx->rx_buf, sizeof(ctx->rx_buf), 0);
+		if (rc < 0)
+			return -EIO;
+	}
+
+	return rc;
+}
+
+static uint32_t decode_uint(const uint8_t *val, size_t len)
+{
+	uint32_t res = 0;
+	size_t i;
+
+	for (i = 0; i < len && i < 4; i++)
+		res = (res << 8) | val[i];
+	return res;
+}
+
+static int parse_msg(struct coap_msg *msg, const uint8_t *data, size_t len)
+{
+	const uint8_t *ptr = data;
+	const uint8_t *end = data + len;
+	unsigned int opt_num = 0;
+	unsigned int delta;
+	size_t opt_len;
+
+	memset(msg, 0, sizeof(*msg));
+	if (len < 4 || (data[0] >> 6) != COAP_VERSION)
+		return -EINVAL;
+	msg->type = (data[0] >> 4) & 0x03;
+	msg->token_len = data[0] & 0x0f;
+	msg->code = data[1];
+	msg->msg_id = (data[2] << 8) | data[3];
+	ptr += 4;
+	if (msg->token_len > sizeof(msg->token) || ptr + msg->token_len > end)
+		return -EINVAL;
+	memcpy(msg->token, ptr, msg->token_len);
+	ptr += msg->token_len;
+
+	while (ptr < end) {
+		if (*ptr == COAP_PAYLOAD_MARKER) {
+			ptr++;
+			if (ptr == end)
+				return -EINVAL;
+			msg->payload = ptr;
+			msg->payload_len = end - ptr;
+			break;
+		}
+
+		/* Option delta and length (including the extended forms), see also RFC 7252, section 3.1 */
+		delta = *ptr >> 4;
+		opt_len = *ptr & 0x0f;
+		ptr++;
+		if (delta == 15 || opt_len == 15)
+			return -EINVAL;
+		if (delta == 13) {
+			if (ptr + 1 > end)
+				return -EINVAL;
+			delta = *ptr++ + 13;
+		} else if (delta == 14) {
+			if (ptr + 2 > end)
+				return -EINVAL;
+			delta = ((ptr[0] << 8) | ptr[1]) + 269;
+			ptr += 2;
+		}
+		if (opt_len == 13) {
+			if (ptr + 1 > end)
+				return -EINVAL;
+			opt_len = *ptr++ + 13;
+		} else if (opt_len == 14) {
+			if (ptr + 2 > end)
+				return -EINVAL;
+			opt_len = ((ptr[0] << 8) | ptr[1]) + 269;
+			ptr += 2;
+		}
+		if (ptr + opt_len > end)
+			return -EINVAL;
+
+		opt_num += delta;
+		switch (opt_num) {
+		case COAP_OPT_BLOCK1:
+			msg->block1_present = true;
+			msg->block1 = decode_uint(ptr, opt_len);
+			break;
+		case COAP_OPT_BLOCK2:
+			msg->block2_present = true;
+			msg->block2 = decode_uint(ptr, opt_len);
+			break;
+		case COAP_OPT_SIZE2:
+			msg->size2_present = true;
+			msg->size2 = decode_uint(ptr, opt_len);
+			break;
+		default:
+			break;
+		}
+		ptr += opt_len;
+	}
+
+	return 0;
+}
+
+static struct coap_block decode_block(uint32_t val)
+{
+	struct coap_block block;
+
+	block.num = val >> 4;
+	block.more = (val >> 3) & 1;
+	block.szx = val & 0x07;
+	return block;
+}
+
+static uint32_t encode_block(uint32_t num, bool more, uint8_t szx)
+{
+	return (num << 4) | (more ? 0x08 : 0) | szx;
+}
+
+/* Append an option to a message, options must be appended in ascending order */
+static uint8_t *put_opt(uint8_t *ptr, unsigned int *last_num, unsigned int num, const uint8_t *val, size_t len)
+{
+	unsigned int delta = num - *last_num;
+	uint8_t *hdr = ptr++;
+
+	assert(num >= *last_num && len < 269);
+	*last_num = num;
+
+	if (delta < 13) {
+		*hdr = delta << 4;
+	} else if (delta < 269) {
+		*hdr = 13 << 4;
+		*ptr++ = delta - 13;
+	} else {
+		*hdr = 14 << 4;
+		*ptr++ = (delta - 269) >> 8;
+		*ptr++ = (delta - 269) & 0xff;
+	}
+
+	if (len < 13) {
+		*hdr |= len;
+	} else {
+		*hdr |= 13;
+		*ptr++ = len - 13;
+	}
+
+	memcpy(ptr, val, len);
+	return ptr + len;
+}
+
+/* Append an option with an unsigned integer value (in its shortest form, see also RFC 7252, section 3.2) */
+static uint8_t *put_opt_uint(uint8_t *ptr, unsigned int *last_num, unsigned int num, uint32_t val)
+{
+	uint8_t buf[4];
+	size_t len = 0;
+
+	if (val > 0xffffff)
+		buf[len++] = val >> 24;
+	if (val > 0xffff)
+		buf[len++] = val >> 16;
+	if (val > 0xff)
+		buf[len++] = val >> 8;
+	if (val > 0)
+		buf[len++] = val;
+	return put_opt(ptr, last_num, num, buf, len);
+}
+
+/* Parameters of a request message */
+struct coap_req {
+	const struct coap_url *url;
+	bool block1_present;
+	uint32_t block1;
+	bool size1_present;
+	uint32_t size1;
+	bool block2_present;
+	uint32_t block2;
+	const uint8_t *payload;
+	size_t payload_len;
+};
+
+/* Compute the maximum length the Uri-Host and Uri-Path options of a request may take (see also build_req) */
+static size_t uri_opts_len(const struct coap_url *url)
+{
+	const char *segment;
+	const char *segment_end;
+	size_t len;
+
+	/* Each option takes up to 4 bytes of option header (delta and length may be extended) */
+	len = 4 + strlen(url->host);
+	for (segment = url->path; *segment; segment = segment_end) {
+		if (*segment == '/')
+			segment++;
+		segment_end = strchrnul(segment, '/');
+		len += 4 + (segment_end - segment);
+	}
+
+	return len;
+}
+
+/* Encode a POST request (confirmable), returns the length of the encoded message */
+static size_t build_req(struct coap_ctx *ctx, uint8_t *msg, const struct coap_req *req)
+{
+	uint8_t *ptr = msg;
+	unsigned int last_num = 0;
+	struct in6_addr addr;
+	const char *segment;
+	const char *segment_end;
+	uint8_t token[COAP_TOKEN_LEN];
+
+	ctx->msg_id++;
+	token[0] = ctx->token >> 24;
+	token[1] = ctx->token >> 16;
+	token[2] = ctx->token >> 8;
+	token[3] = ctx->token;
+
+	*ptr++ = (COAP_VERSION << 6) | (COAP_TYPE_CON << 4) | sizeof(token);
+	*ptr++ = COAP_CODE_POST;
+	*ptr++ = ctx->msg_id >> 8;
+	*ptr++ = ctx->msg_id & 0xff;
+	memcpy(ptr, token, sizeof(token));
+	ptr += sizeof(token);
+
+	/* The Uri-Host option is only needed when the host is not given as an IP address literal */
+	if (inet_pton(AF_INET, req->url->host, &addr) != 1 && inet_pton(AF_INET6, req->url->host, &addr) != 1)
+		ptr = put_opt(ptr, &last_num, COAP_OPT_URI_HOST, (uint8_t *) req->url->host, strlen(req->url->host));
+
+	for (segment = req->url->path; *segment; segment = segment_end) {
+		if (*segment == '/')
+			segment++;
+		segment_end = strchrnul(segment, '/');
+		if (segment_end > segment)
+			ptr = put_opt(ptr, &last_num, COAP_OPT_URI_PATH, (uint8_t *) segment, segment_end - segment);
+	}
+
+	if (req->payload_len)
+		ptr = put_opt_uint(ptr, &last_num, COAP_OPT_CONTENT_FORMAT, COAP_CONTENT_FORMAT_OCTET_STREAM);
+	if (req->block2_present)
+		ptr = put_opt_uint(ptr, &last_num, COAP_OPT_BLOCK2, req->block2);
+	if (req->block1_present)
+		ptr = put_opt_uint(ptr, &last_num, COAP_OPT_BLOCK1, req->block1);
+	if (req->size1_present)
+		ptr = put_opt_uint(ptr, &last_num, COAP_OPT_SIZE1, req->size1);
+
+	if (req->payload_len) {
+		assert(ptr + 1 + req->payload_len <= msg + COAP_MAX_MSG_LEN);
+		*ptr++ = COAP_PAYLOAD_MARKER;
+		memcpy(ptr, req->payload, req->payload_len);
+		ptr += req->payload_len;
+	}
+
+	return ptr - msg;
+}
+
+/* Send an empty message (ACK or RST) in reply to a message from the server */
+static void send_empty(struct coap_ctx *ctx, uint8_t type, uint16_t msg_id)
+{
+	uint8_t msg[4];
+
+	msg[0] = (COAP_VERSION << 6) | (type << 4);
+	msg[1] = COAP_CODE_EMPTY;
+	msg[2] = msg_id >> 8;
+	msg[3] = msg_id & 0xff;
+	conn_send(ctx, msg, sizeof(msg));
+}
+
+static bool token_match(struct coap_ctx *ctx, const struct coap_msg *msg)
+{
+	uint8_t token[COAP_TOKEN_LEN];
+
+	token[0] = ctx->token >> 24;
+	token[1] = ctx->token >> 16;
+	token[2] = ctx->token >> 8;
+	token[3] = ctx->token;
+	return msg->token_len == sizeof(token) && memcmp(msg->token, token, sizeof(token)) == 0;
+}
+
+/* Send a request message (confirmable) and wait for the response. The request is retransmitted with exponential
+ * back-off until it is acknowledged, the response may be piggybacked on the ACK or sent separately. */
+static int transact(struct coap_ctx *ctx, struct coap_msg *res, const struct coap_req *req)
+{
+	uint8_t msg[COAP_MAX_MSG_LEN];
+	size_t msg_len;
+	uint16_t msg_id;
+	unsigned int timeout;
+	unsigned int retransmit;
+	uint64_t deadline;
+	uint64_t now;
+	bool acked = false;
+	int rc;
+
+	msg_len = build_req(ctx, msg, req);
+	msg_id = ctx->msg_id;
+
+	/* Initial timeout is randomized between ACK_TIMEOUT and ACK_TIMEOUT * ACK_RANDOM_FACTOR (1.5) */
+	timeout = COAP_ACK_TIMEOUT + rand_r(&ctx->seed) % (COAP_ACK_TIMEOUT / 2);
+
+	for (retransmit = 0; retransmit <= COAP_MAX_RETRANSMIT; retransmit++) {
+		if (retransmit)
+			IPA_LOGP(SHTTP, LDEBUG, "no response, retransmitting CoAP message (mid: %u, retransmission: %u)\n",
+				 msg_id, retransmit);
+		rc = conn_send(ctx, msg, msg_len);
+		if (rc < 0)
+			return rc;
+
+		deadline = now_ms() + timeout;
+		while ((now = now_ms()) < deadline) {
+			rc = conn_recv(ctx, deadline - now);
+			if (rc < 0)
+				return rc;
+			else if (rc == 0)
+				continue;
+			if (parse_msg(res, ctx->rx_buf, rc) < 0) {
+				IPA_LOGP(SHTTP, LDEBUG, "ignoring malformed CoAP message\n");
+				continue;
+			}
+
+			if (res->type == COAP_TYPE_RST && res->msg_id == msg_id) {
+				IPA_LOGP(SHTTP, LERROR, "CoAP request rejected by server (RST)\n");
+				return -ECONNREFUSED;
+			} else if (res->type == COAP_TYPE_ACK && res->msg_id == msg_id && res->code == COAP_CODE_EMPTY) {
+				/* Separate response will follow, see also RFC 7252, section 5.2.2 */
+				IPA_LOGP(SHTTP, LDEBUG, "CoAP request acknowledged, waiting for separate response\n");
+				acked = true;
+				deadline = now_ms() + COAP_SEPARATE_TIMEOUT;
+			} else if (res->type == COAP_TYPE_ACK && res->msg_id == msg_id && token_match(ctx, res)) {
+				return 0;
+			} else if ((res->type == COAP_TYPE_CON || res->type == COAP_TYPE_NON) && token_match(ctx, res)) {
+				if (res->type == COAP_TYPE_CON)
+					send_empty(ctx, COAP_TYPE_ACK, res->msg_id);
+				return 0;
+			} else if (res->type == COAP_TYPE_CON) {
+				/* Unrelated message (e.g. a late duplicate) */
+				send_empty(ctx, COAP_TYPE_RST, res->msg_id);
+			}
+		}
+
+		/* After the server has acknowledged the request, we must not retransmit it anymore */
+		if (acked)
+			break;
+		timeout *= 2;
+	}
+
+	IPA_LOGP(SHTTP, LERROR, "CoAP request timed out\n");
+	return -ETIMEDOUT;
+}
+
+/* Check the response code of a response, a response that is not a success (2.xx) ends the exchange */
+static int check_code(const struct coap_msg *res)
+{
+	if (COAP_CODE_CLASS(res->code) == 2)
+		return 0;
+
+	IPA_LOGP(SHTTP, LERROR, "CoAP request failed with response code %u.%02u\n", COAP_CODE_CLASS(res->code),
+		 COAP_CODE_DETAIL(res->code));
+	return -EIO;
+}
+
+/* Pass a part of the response on to the API user (or into the response buffer) */
+static int deliver(struct coap_ctx *ctx, const struct coap_msg *res)
+{
+	size_t realloc_size;
+
+	if (!res->payload_len)
+		return 0;
+
+	if (ctx->res_cb) {
+		if (ctx->res_cb(res->payload, res->payload_len, ctx->res_cb_priv) < 0)
+			return -ECANCELED;
+		return 0;
+	}
+
+	if (ctx->res->len + res->payload_len > COAP_MAX_RES_LEN) {
+		IPA_LOGP(SHTTP, LERROR, "CoAP response exceeds maximum length (%u bytes), aborting!\n", COAP_MAX_RES_LEN);
+		return -EMSGSIZE;
+	}
+
+	/* The server may announce the total size of the response (Size2), otherwise the buffer grows geometrically */
+	if (ctx->res->len + res->payload_len > ctx->res->data_len) {
+		realloc_size = ctx->res->data_len * 2;
+		if (res->size2_present && res->size2 >= ctx->res->len + res->payload_len && res->size2 <= COAP_MAX_RES_LEN)
+			realloc_size = res->size2;
+		if (realloc_size < ctx->res->len + res->payload_len)
+			realloc_size = ctx->res->len + res->payload_len;
+		IPA_LOGP(SHTTP, LDEBUG,
+			 "CoAP response buffer exhausted, reallocating more memory (have: %zu bytes, required: %zu bytes, will allocate: %zu bytes)\n",
+			 ctx->res->data_len, ctx->res->len + res->payload_len, realloc_size);
+		ctx->res = ipa_buf_realloc(ctx->res, realloc_size);
+		assert(ctx->res);
+	}
+
+	memcpy(ctx->res->data + ctx->res->len, res->payload, res->payload_len);
+	ctx->res->len += res->payload_len;
+	return 0;
+}
+
+/* Perform a complete request/response exchange, block-wise where necessary (see also RFC 7959, section 3) */
+static int exchange(struct coap_ctx *ctx, const struct ipa_buf *req_buf, const char *url)
+{
+	struct coap_url coap_url;
+	struct coap_req req = { 0 };
+	struct coap_msg res;
+	struct coap_block block;
+	uint8_t szx = COAP_BLOCK_SZX;
+	size_t offset = 0;
+	size_t block_size;
+	size_t hdr_len;
+	uint32_t num = 0;
+	unsigned int blocks = 0;
+	int rc;
+
+	if (parse_url(&coap_url, url) < 0) {
+		IPA_LOGP(SHTTP, LERROR, "invalid CoAP URL: %s\n", url);
+		return -EINVAL;
+	}
+	req.url = &coap_url;
+
+	/* Header, options and payload marker must leave enough room for the payload, with a long URL we have to use
+	 * smaller blocks */
+	hdr_len = 4 + COAP_TOKEN_LEN + uri_opts_len(&coap_url) + COAP_MAX_FIXED_OPTS_LEN + 1;
+	while (szx > 0 && hdr_len + COAP_BLOCK_SIZE(szx) > COAP_MAX_MSG_LEN)
+		szx--;
+	if (hdr_len + COAP_BLOCK_SIZE(szx) > COAP_MAX_MSG_LEN) {
+		IPA_LOGP(SHTTP, LERROR, "CoAP URL too long: %s\n", url);
+		return -EINVAL;
+	}
+
+	rc = conn_open(ctx, &coap_url);
+	if (rc < 0)
+		return rc;
+	if (ctx->new_conn)
+		ctx->handshakes++;
+	else
+		ctx->reuses++;
+
+	/* All messages of one exchange use the same token */
+	ctx->token++;
+
+	/* Send the request (Block1), the server confirms each block but the last one with 2.31 (Continue) */
+	while (1) {
+		block_size = COAP_BLOCK_SIZE(szx);
+		req.payload = req_buf->data + offset;
+		req.payload_len = req_buf->len - offset < block_size ? req_buf->len - offset : block_size;
+		req.block1_present = req_buf->len > block_size || offset > 0;
+		req.block1 = encode_block(num, offset + req.payload_len < req_buf->len, szx);
+		req.size1_present = req.block1_present && offset == 0;
+		req.size1 = req_buf->len;
+
+		/* Together with the last block we indicate our preferred block size for the response */
+		req.block2_present = offset + req.payload_len >= req_buf->len;
+		req.block2 = encode_block(0, false, COAP_BLOCK_SZX);
+
+		rc = transact(ctx, &res, &req);
+		if (rc < 0)
+			return rc;
+		rc = check_code(&res);
+		if (rc < 0)
+			return rc;
+		blocks++;
+
+		offset += req.payload_len;
+		if (offset >= req_buf->len)
+			break;
+
+		/* The server may ask for smaller blocks (the block number is then scaled accordingly) */
+		if (res.block1_present) {
+			block = decode_block(res.block1);
+			if (block.szx < szx && block.szx != 7)
+				szx = block.szx;
+		}
+		num = offset / COAP_BLOCK_SIZE(szx);
+	}
+
+	/* Receive the response (Block2), further blocks are requested by repeating the request without payload */
+	rc = deliver(ctx, &res);
+	if (rc < 0)
+		return rc;
+	while (res.block2_present) {
+		block = decode_block(res.block2);
+		if (!block.more || block.szx == 7)
+			break;
+
+		memset(&req, 0, sizeof(req));
+		req.url = &coap_url;
+		req.block2_present = true;
+		req.block2 = encode_block(block.num + 1, false, block.szx);
+		rc = transact(ctx, &res, &req);
+		if (rc < 0)
+			return rc;
+		rc = check_code(&res);
+		if (rc < 0)
+			return rc;
+		if (!res.block2_present || decode_block(res.block2).num != block.num + 1) {
+			IPA_LOGP(SHTTP, LERROR, "CoAP server responded with unexpected block\n");
+			return -EIO;
+		}
+		blocks++;
+
+		rc = deliver(ctx, &res);
+		if (rc < 0)
+			return rc;
+	}
+
+	IPA_LOGP(SHTTP, LDEBUG, "CoAP exchange done (%zu bytes sent, %u blocks, response code %u.%02u)\n",
+		 req_buf->len, blocks, COAP_CODE_CLASS(res.code), COAP_CODE_DETAIL(res.code));
+	return 0;
+}
+
+/* A failed exchange leaves the connection in an unknown state, so it is not reused */
+static void exchange_failed(struct coap_ctx *ctx, const char *url, int rc)
+{
+	IPA_LOGP(SHTTP, LERROR, "CoAP request to %s failed (%d)\n", url, rc);
+	ipa_coap_close(ctx);
+}
+
+/*! Perform CoAP request (connection is established if not already present).
+ *  \param[inout] coap_ctx CoAP client context.
+ *  \param[inout] res buffer that receives the response (may be reallocated, freed on failure).
+ *  \param[in] req buffer with request (POST).
+ *  \param[in] url URL of the request (coap:// or coaps://).
+ *  \returns response on success, NULL on failure. */
+struct ipa_buf *ipa_coap_req(void *coap_ctx, struct ipa_buf *res, const struct ipa_buf *req, const char *url)
+{
+	struct coap_ctx *ctx = coap_ctx;
+	int rc;
+
+	ctx->res = res;
+	rc = exchange(ctx, req, url);
+	res = ctx->res;
+	ctx->res = NULL;
+	if (rc < 0) {
+		exchange_failed(ctx, url, rc);
+		ipa_buf_free(res);
+		return NULL;
+	}
+
+	IPA_LOGP(SHTTP, LINFO, "CoAP request to %s successful\n", url);
+	return res;
+}
+
+/*! Perform CoAP request, the response is passed to a callback function block by block as it arrives.
+ *  \param[inout] coap_ctx CoAP client context.
+ *  \param[in] req buffer with request (POST).
+ *  \param[in] url URL of the request (coap:// or coaps://).
+ *  \param[in] res_cb callback function that receives the response.
+ *  \param[in] priv private data pointer that is passed to the callback function.
+ *  \returns 0 on success, negative on failure (-ECANCELED when the callback function fails). */
+int ipa_coap_req_stream(void *coap_ctx, const struct ipa_buf *req, const char *url, ipa_http_res_cb res_cb,
+			void *priv)
+{
+	struct coap_ctx *ctx = coap_ctx;
+	int rc;
+
+	ctx->res_cb = res_cb;
+	ctx->res_cb_priv = priv;
+	rc = exchange(ctx, req, url);
+	ctx->res_cb = NULL;
+	ctx->res_cb_priv = NULL;
+	if (rc < 0) {
+		exchange_failed(ctx, url, rc);
+		return rc;
+	}
+
+	IPA_LOGP(SHTTP, LINFO, "CoAP request to %s successful\n", url);
+	return 0;
+}
+
+/*! Read the connection statistics of the CoAP client (see also ipa_http_stats).
+ *  \param[in] coap_ctx CoAP client context.
+ *  \param[out] handshakes number of requests that required a new connection (DTLS handshake).
+ *  \param[out] reuses number of requests that were sent over an already established connection. */
+void ipa_coap_stats(void *coap_ctx, unsigned int *handshakes, unsigned int *reuses)
+{
+	struct coap_ctx *ctx = coap_ctx;
+
+	*handshakes = ctx->handshakes;
+	*reuses = ctx->reuses;
+}
+
+/*! Free CoAP client.
+ *  \param[inout] coap_ctx CoAP client context. */
+void ipa_coap_free(void *coap_ctx)
+{
+	struct coap_ctx *ctx = coap_ctx;
+
+	if (!ctx)
+		return;
+
+	ipa_coap_close(ctx);
+	SSL_SESSION_free(ctx->dtls_session);
+	SSL_CTX_free(ctx->ssl_ctx);
+	IPA_FREE(ctx->cabundle);
+	IPA_FREE(ctx);
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+/* CoAP transport (coap.c), used by the HTTP client (http.c) for eIM URLs with the scheme coap:// or coaps:// */
+
+#include <stdbool.h>
+#include <onomondo/ipa/http.h>
+struct ipa_buf;
+
+bool ipa_coap_url(const char *url);
+void *ipa_coap_init(const char *cabundle, bool no_verif);
+struct ipa_buf *ipa_coap_req(void *coap_ctx, struct ipa_buf *res, const struct ipa_buf *req, const char *url);
+int ipa_coap_req_stream(void *coap_ctx, const struct ipa_buf *req, const char *url, ipa_http_res_cb res_cb,
+			void *priv);
+void ipa_coap_close(void *coap_ctx);
+void ipa_coap_stats(void *coap_ctx, unsigned int *handshakes, unsigned int *reuses);
+void ipa_coap_free(void *coap_ctx);
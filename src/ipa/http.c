@@ -10,20 +10,118 @@
 #include <errno.h>
 #include <assert.h>
 #include <string.h>
+#include <pthread.h>
 #include <curl/curl.h>
 #include <onomondo/ipa/utils.h>
 #include <onomondo/ipa/http.h>
 #include <onomondo/ipa/http_hdr.h>
 #include <onomondo/ipa/log.h>
 #include <onomondo/ipa/mem.h>
+#include "coap.h"
 
 struct http_ctx {
 	bool initialized;
-	const char *cabundle;
 	bool no_verif;
 	CURL *curl;
+
+	/* Everything that does not change between requests is prepared once in ipa_http_init (header list, CA bundle)
+	 * and configured once when the curl handle is created (see setup_handle). */
+	struct curl_slist *headers;
+	struct ipa_buf *cabundle;
+
+	/* URL that is currently configured on the curl handle */
+	char *url;
+
+	/* Buffer that receives the response of the ongoing request (see store_response_cb) */
+	struct ipa_buf *res;
+	unsigned int res_reallocs;
+
+	/* Callback that receives the response of the ongoing request instead of the buffer (see ipa_http_req_stream) */
+	ipa_http_res_cb res_cb;
+	void *res_cb_priv;
+	bool res_cb_failed;
+
+	/* The last request has failed because the timeout expired while the server held the request: the request was
+	 * sent, but nothing was received (see ipa_http_req_timeout) */
+	bool timed_out;
+
+	/* Response buffer that the API user has handed back for reuse (see ipa_http_recycle) */
+	struct ipa_buf *spare;
+
+	/* TLS sessions are kept in a share object, which outlives the curl handle, so that a new connection can
+	 * resume the TLS session of a previous connection (abbreviated handshake). The sessions in the share object
+	 * can be exported/imported to survive a restart of the IPAd (see ipa_http_export_session and
+	 * ipa_http_import_session). */
+	CURLSH *share;
+
+	/* Number of requests that required a new connection (TCP + TLS handshake) and number of requests that were
+	 * sent over an already established connection. */
+	unsigned int handshakes;
+	unsigned int reuses;
+
+	/* CoAP client, which handles the requests to coap:// and coaps:// URLs (see also coap.c). The CoAP client is
+	 * only created when the first such URL is used, so an HTTP only setup does not pay for it. */
+	void *coap;
+	char *coap_cabundle;
 };
 
+/* curl_global_init() and curl_global_cleanup() are not thread safe and must only be called once for the whole
+ * process. Since multiple HTTP client contexts may be active at the same time (one per ipa_context, see also multi
+ * instance mode in main.c), we keep track of the number of users. */
+static pthread_mutex_t curl_global_lock = PTHREAD_MUTEX_INITIALIZER;
+static unsigned int curl_global_users = 0;
+
+static void curl_global_get(void)
+{
+	pthread_mutex_lock(&curl_global_lock);
+	if (curl_global_users == 0)
+		curl_global_init(CURL_GLOBAL_DEFAULT);
+	curl_global_users++;
+	pthread_mutex_unlock(&curl_global_lock);
+}
+
+static void curl_global_put(void)
+{
+	pthread_mutex_lock(&curl_global_lock);
+	assert(curl_global_users > 0);
+	curl_global_users--;
+	if (curl_global_users == 0)
+		curl_global_cleanup();
+	pthread_mutex_unlock(&curl_global_lock);
+}
+
+/* Load the CA bundle into memory, so that it does not have to be read from the file system again for each new
+ * connection (see also CURLOPT_CAINFO_BLOB) */
+static struct ipa_buf *load_cabundle(const char *path)
+{
+	FILE *file;
+	struct ipa_buf *cabundle;
+	long size;
+
+	file = fopen(path, "r");
+	if (!file) {
+		IPA_LOGP(SHTTP, LERROR, "unable to open CA bundle %s!\n", path);
+		return NULL;
+	}
+
+	fseek(file, 0L, SEEK_END);
+	size = ftell(file);
+	rewind(file);
+	if (size <= 0) {
+		IPA_LOGP(SHTTP, LERROR, "CA bundle %s is empty!\n", path);
+		fclose(file);
+		return NULL;
+	}
+
+	cabundle = ipa_buf_alloc(size);
+	assert(cabundle);
+	cabundle->len = fread(cabundle->data, 1, cabundle->data_len, file);
+	fclose(file);
+
+	IPA_LOGP(SHTTP, LDEBUG, "loaded CA bundle %s (%zu bytes)\n", path, cabundle->len);
+	return cabundle;
+}
+
 /*! Initialize HTTP client.
  *  \param[in] cabundle path to a CA bundle.
  *  \param[in] no_verif skip SSL certificate verification (insecure).
@@ -34,30 +132,96 @@ void *ipa_http_init(const char *cabundle, bool no_verif)
 	assert(ctx);
 	memset(ctx, 0, sizeof(*ctx));
 
-	curl_global_init(CURL_GLOBAL_DEFAULT);
+	if (cabundle) {
+		ctx->cabundle = load_cabundle(cabundle);
+		if (!ctx->cabundle) {
+			IPA_FREE(ctx);
+			return NULL;
+		}
+	}
+
+	curl_global_get();
+
+	ctx->share = curl_share_init();
+	if (ctx->share)
+		curl_share_setopt(ctx->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+	else
+		IPA_LOGP(SHTTP, LERROR, "cannot create TLS session cache, TLS sessions will not be resumed!\n");
+
+	/* Setup header, see also SGP.32, section 6.1.1 */
+	ctx->headers = curl_slist_append(ctx->headers, "Accept:");
+	ctx->headers = curl_slist_append(ctx->headers, "User-Agent: " IPA_HTTP_USER_AGENT);
+	ctx->headers = curl_slist_append(ctx->headers, "X-Admin-Protocol: " IPA_HTTP_X_ADMIN_PROTOCOL);
+	ctx->headers = curl_slist_append(ctx->headers, "Content-Type: " IPA_HTTP_CONTENT_TYPE);
+	assert(ctx->headers);
+
 	ctx->initialized = true;
-	ctx->cabundle = cabundle;
 	ctx->no_verif = no_verif;
+	if (cabundle) {
+		ctx->coap_cabundle = IPA_ALLOC_N(strlen(cabundle) + 1);
+		assert(ctx->coap_cabundle);
+		strcpy(ctx->coap_cabundle, cabundle);
+	}
 
 	IPA_LOGP(SHTTP, LINFO, "HTTP client initialized.\n");
 
 	return ctx;
 }
 
+/* Get the CoAP client, create it when it is used for the first time */
+static void *coap_ctx(struct http_ctx *ctx)
+{
+	if (!ctx->coap)
+		ctx->coap = ipa_coap_init(ctx->coap_cabundle, ctx->no_verif);
+	return ctx->coap;
+}
+
+/* Largest response that is accepted (the largest ESipa responses carry a BoundProfilePackage, which is far smaller) */
+#define HTTP_MAX_RES_LEN (4 * 1024 * 1024)
+
 /* Callback function to extract the HTTP response */
 static size_t store_response_cb(void *ptr, size_t size, size_t nmemb, void *clientp)
 {
-	struct ipa_buf *buf = *(struct ipa_buf **)clientp;
-	size_t realloc_size;
+	struct http_ctx *ctx = clientp;
+	struct ipa_buf *buf = ctx->res;
+	size_t realloc_size = 0;
+	curl_off_t content_length = -1;
 
-	if (buf->len + size * nmemb > buf->data_len) {
-		realloc_size = ((buf->len + size * nmemb) / IPA_LEN_HTTP_RESPONSE_BUF + 1) * IPA_LEN_HTTP_RESPONSE_BUF;
-		IPA_LOGP(SIPA, LDEBUG,
+	/* The response is passed on as it arrives (returning a short count makes curl abort the transfer) */
+	if (ctx->res_cb) {
+		if (ctx->res_cb(ptr, size * nmemb, ctx->res_cb_priv) < 0) {
+			ctx->res_cb_failed = true;
+			return 0;
+		}
+		return size * nmemb;
+	}
+
+	/* When the server announces the length of the response (Content-Length), we allocate the full length at once
+	 * when the first chunk of the response arrives. */
+	if (buf->len == 0)
+		curl_easy_getinfo(ctx->curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &content_length);
+	if (content_length > HTTP_MAX_RES_LEN || buf->len + size * nmemb > HTTP_MAX_RES_LEN) {
+		IPA_LOGP(SHTTP, LERROR, "HTTP response exceeds maximum length (%u bytes), aborting!\n", HTTP_MAX_RES_LEN);
+		return 0;
+	}
+	if (content_length > 0 && (size_t)content_length > buf->data_len && (size_t)content_length >= size * nmemb)
+		realloc_size = content_length;
+
+	/* Otherwise (chunked transfer encoding) we grow the buffer geometrically */
+	else if (buf->len + size * nmemb > buf->data_len) {
+		realloc_size = buf->data_len * 2;
+		if (realloc_size < buf->len + size * nmemb)
+			realloc_size = buf->len + size * nmemb;
+	}
+
+	if (realloc_size) {
+		IPA_LOGP(SHTTP, LDEBUG,
 			 "HTTP response buffer exhausted, reallocating more memory (have: %zu bytes, required: %zu bytes, will allocate: %zu bytes)\n",
 			 buf->data_len, buf->len + size * nmemb, realloc_size);
 		buf = ipa_buf_realloc(buf, realloc_size);
 		assert(buf);
-		*(struct ipa_buf **)clientp = buf;
+		ctx->res = buf;
+		ctx->res_reallocs++;
 	}
 
 	memcpy(buf->data + buf->len, ptr, size * nmemb);
@@ -66,110 +230,442 @@ static size_t store_response_cb(void *ptr, size_t size, size_t nmemb, void *clie
 	return size * nmemb;
 }
 
-/*! Open a TCP connection (if not already present) and Perform HTTP request.
- *  \param[inout] http_ctx HTTP client context.
- *  \param[in] req buffer with HTTP request (POST).
- *  \param[in] url URL with HTTP request.
- *  \returns HTTP response on success, NULL on failure. */
-struct ipa_buf *ipa_http_req(void *http_ctx, const struct ipa_buf *req, const char *url)
-{
-	struct http_ctx *ctx = http_ctx;
-	CURLcode rc;
-	struct curl_slist *list = NULL;
-	struct ipa_buf *res = ipa_buf_alloc(IPA_LEN_HTTP_RESPONSE_BUF);
+/* Timeout for a complete request (seconds) */
+#define HTTP_TIMEOUT 5L
 
-	assert(ctx->initialized);
+/* A streamed response is aborted when it stalls (no data received) for this long (seconds). This is longer than
+ * HTTP_TIMEOUT since the transfer also pauses while the callback function processes the response. */
+#define HTTP_STALL_TIMEOUT 30L
 
-	/* Create a new curl context (also represents an ongoing connection) in case it does not exist */
+#define HTTP_SETOPT(ctx, opt, val) \
+do { \
+	CURLcode __rc = curl_easy_setopt((ctx)->curl, opt, val); \
+	if (__rc != CURLE_OK) { \
+		IPA_LOGP(SHTTP, LERROR, "internal HTTP-client failure (%s): %s\n", #opt, curl_easy_strerror(__rc)); \
+		goto error; \
+	} \
+} while (0)
+
+/* Create a new curl handle and configure all options that stay the same for all requests */
+static int setup_handle(struct http_ctx *ctx)
+{
+	struct curl_blob cabundle_blob;
+
+	ctx->curl = curl_easy_init();
 	if (!ctx->curl) {
-		ctx->curl = curl_easy_init();
-		if (!ctx->curl) {
-			IPA_LOGP(SHTTP, LERROR, "internal HTTP-client failure!\n");
-			goto error;
-		}
+		IPA_LOGP(SHTTP, LERROR, "internal HTTP-client failure!\n");
+		return -EINVAL;
 	}
+
+	/* Do not use signals for DNS timeouts, signals are not usable in multi threaded programs */
+	HTTP_SETOPT(ctx, CURLOPT_NOSIGNAL, 1L);
+
+	if (ctx->share)
+		HTTP_SETOPT(ctx, CURLOPT_SHARE, ctx->share);
+
 	if (ctx->cabundle) {
-		rc = curl_easy_setopt(ctx->curl, CURLOPT_CAINFO, ctx->cabundle);
-		if (rc != CURLE_OK) {
-			IPA_LOGP(SHTTP, LERROR, "internal HTTP-client failure: %s\n", curl_easy_strerror(rc));
-			goto error;
-		}
+		cabundle_blob.data = ctx->cabundle->data;
+		cabundle_blob.len = ctx->cabundle->len;
+		cabundle_blob.flags = CURL_BLOB_NOCOPY;
+		HTTP_SETOPT(ctx, CURLOPT_CAINFO_BLOB, &cabundle_blob);
 	}
 
 	if (ctx->no_verif) {
 		/* Bypass SSL certificate verification (only for debug, disable in productive use!) */
-		rc = curl_easy_setopt(ctx->curl, CURLOPT_SSL_VERIFYPEER, 0L);
-		if (rc != CURLE_OK) {
-			IPA_LOGP(SHTTP, LERROR, "internal HTTP-client failure: %s\n", curl_easy_strerror(rc));
-			goto error;
-		}
+		HTTP_SETOPT(ctx, CURLOPT_SSL_VERIFYPEER, 0L);
 
 		/* Bypass SSL hostname verification (only for debug, disable in productive use!) */
-		rc = curl_easy_setopt(ctx->curl, CURLOPT_SSL_VERIFYHOST, 0L);
-		if (rc != CURLE_OK) {
-			IPA_LOGP(SHTTP, LERROR, "internal HTTP-client failure: %s\n", curl_easy_strerror(rc));
-			goto error;
-		}
+		HTTP_SETOPT(ctx, CURLOPT_SSL_VERIFYHOST, 0L);
 		IPA_LOGP(SHTTP, LINFO, "security disabled: will not verify server certificate and hostname\n");
 	}
 
-	/* Setup header, see also SGP.32, section 6.1.1 */
-	list = curl_slist_append(list, "Accept:");
-	list = curl_slist_append(list, "User-Agent: " IPA_HTTP_USER_AGENT);
-	list = curl_slist_append(list, "X-Admin-Protocol: " IPA_HTTP_X_ADMIN_PROTOCOL);
-	list = curl_slist_append(list, "Content-Type: " IPA_HTTP_CONTENT_TYPE);
-	rc = curl_easy_setopt(ctx->curl, CURLOPT_HTTPHEADER, list);
+	HTTP_SETOPT(ctx, CURLOPT_HTTPHEADER, ctx->headers);
+	HTTP_SETOPT(ctx, CURLOPT_POST, 1L);
+	HTTP_SETOPT(ctx, CURLOPT_WRITEFUNCTION, store_response_cb);
+	HTTP_SETOPT(ctx, CURLOPT_WRITEDATA, ctx);
+	HTTP_SETOPT(ctx, CURLOPT_CONNECTTIMEOUT, HTTP_TIMEOUT);
+	HTTP_SETOPT(ctx, CURLOPT_TIMEOUT, HTTP_TIMEOUT);
+
+	return 0;
+error:
+	curl_easy_cleanup(ctx->curl);
+	ctx->curl = NULL;
+	return -EINVAL;
+}
+
+/* Configure the URL on the curl handle (only when it differs from the URL of the previous request) */
+static int set_url(struct http_ctx *ctx, const char *url)
+{
+	if (ctx->url && strcmp(ctx->url, url) == 0)
+		return 0;
+
+	IPA_FREE(ctx->url);
+	ctx->url = NULL;
+	HTTP_SETOPT(ctx, CURLOPT_URL, url);
+	ctx->url = IPA_ALLOC_N(strlen(url) + 1);
+	assert(ctx->url);
+	strcpy(ctx->url, url);
+
+	return 0;
+error:
+	return -EINVAL;
+}
+
+/* Find out whether the last request had to establish a new connection */
+static void count_connects(struct http_ctx *ctx)
+{
+	long num_connects = 0;
+
+	if (curl_easy_getinfo(ctx->curl, CURLINFO_NUM_CONNECTS, &num_connects) != CURLE_OK)
+		return;
+
+	if (num_connects > 0)
+		ctx->handshakes++;
+	else
+		ctx->reuses++;
+
+	IPA_LOGP(SHTTP, LDEBUG, "%s connection (handshakes: %u, reuses: %u)\n", num_connects > 0 ? "new" : "reused",
+		 ctx->handshakes, ctx->reuses);
+}
+
+/* Check whether the last request was sent completely and the server did not respond anything yet. (A timeout during
+ * connect, TLS handshake or while the response is received is a failure, not an expired long poll.) */
+static bool request_held(struct http_ctx *ctx)
+{
+	long request_size = 0;
+	long header_size = 0;
+	curl_off_t download_size = 0;
+
+	curl_easy_getinfo(ctx->curl, CURLINFO_REQUEST_SIZE, &request_size);
+	curl_easy_getinfo(ctx->curl, CURLINFO_HEADER_SIZE, &header_size);
+	curl_easy_getinfo(ctx->curl, CURLINFO_SIZE_DOWNLOAD_T, &download_size);
+
+	return request_size > 0 && header_size == 0 && download_size == 0;
+}
+
+/* Open a TCP connection (if not already present) and Perform HTTP request */
+static int perform(struct http_ctx *ctx, const struct ipa_buf *req, const char *url)
+{
+	CURLcode rc;
+
+	assert(ctx->initialized);
+
+	/* Create a new curl context (also represents an ongoing connection) in case it does not exist */
+	if (!ctx->curl && setup_handle(ctx) < 0)
+		return -EINVAL;
+
+	/* Perform HTTP Request, only URL and request body are configured per request */
+	if (set_url(ctx, url) < 0)
+		return -EINVAL;
+	HTTP_SETOPT(ctx, CURLOPT_POSTFIELDS, req->data);
+	HTTP_SETOPT(ctx, CURLOPT_POSTFIELDSIZE, (long)req->len);
+
+	rc = curl_easy_perform(ctx->curl);
+	ctx->timed_out = rc == CURLE_OPERATION_TIMEDOUT && request_held(ctx);
 	if (rc != CURLE_OK) {
-		IPA_LOGP(SHTTP, LERROR, "internal HTTP-client failure: %s\n", curl_easy_strerror(rc));
-		goto error;
+		/* curl discards a broken connection by itself, so there is no need to throw away the curl handle
+		 * (and with it the cached TLS session) here. */
+		IPA_LOGP(SHTTP, LERROR, "HTTP request to %s failed: %s\n", url, curl_easy_strerror(rc));
+		return -EIO;
 	}
+	IPA_LOGP(SHTTP, LINFO, "HTTP request to %s successful: %s\n", url, curl_easy_strerror(rc));
+	count_connects(ctx);
 
-	/* Perform HTTP Request */
-	rc = curl_easy_setopt(ctx->curl, CURLOPT_URL, url);
-	if (rc != CURLE_OK) {
-		IPA_LOGP(SHTTP, LERROR, "internal HTTP-client failure: %s\n", curl_easy_strerror(rc));
-		goto error;
+	return 0;
+error:
+	return -EINVAL;
+}
+
+/*! Open a TCP connection (if not already present) and Perform HTTP request.
+ *  \param[inout] http_ctx HTTP client context.
+ *  \param[in] req buffer with HTTP request (POST).
+ *  \param[in] url URL with HTTP request.
+ *  \returns HTTP response on success, NULL on failure. */
+struct ipa_buf *ipa_http_req(void *http_ctx, const struct ipa_buf *req, const char *url)
+{
+	struct http_ctx *ctx = http_ctx;
+	struct ipa_buf *res;
+
+	/* Use the buffer that the API user handed back to us, if there is one */
+	if (ctx->spare) {
+		ctx->res = ctx->spare;
+		ctx->res->len = 0;
+		ctx->spare = NULL;
+	} else {
+		ctx->res = ipa_buf_alloc(IPA_LEN_HTTP_RESPONSE_BUF);
+		assert(ctx->res);
 	}
-	rc = curl_easy_setopt(ctx->curl, CURLOPT_POSTFIELDS, req->data);
-	if (rc != CURLE_OK) {
-		IPA_LOGP(SHTTP, LERROR, "internal HTTP-client failure: %s\n", curl_easy_strerror(rc));
-		goto error;
+	ctx->res_reallocs = 0;
+
+	if (ipa_coap_url(url))
+		return ipa_coap_req(coap_ctx(ctx), ctx->res, req, url);
+
+	if (perform(ctx, req, url) < 0) {
+		ipa_buf_free(ctx->res);
+		ctx->res = NULL;
+		return NULL;
 	}
-	rc = curl_easy_setopt(ctx->curl, CURLOPT_POSTFIELDSIZE, req->len);
-	if (rc != CURLE_OK) {
-		IPA_LOGP(SHTTP, LERROR, "internal HTTP-client failure: %s\n", curl_easy_strerror(rc));
-		goto error;
+	IPA_LOGP(SHTTP, LDEBUG, "received %zu bytes (buffer reallocated %u times)\n", ctx->res->len,
+		 ctx->res_reallocs);
+
+	res = ctx->res;
+	ctx->res = NULL;
+	return res;
+}
+
+/*! Open a TCP connection (if not already present) and Perform HTTP request with an individual timeout. This is
+ *  intended for long polling, where the server holds the request until it has something to respond. A timeout that
+ *  expires while the server holds the request is therefore not treated as a failure, an empty response is returned
+ *  instead (just as if the server had responded without content). A timeout during connection setup or while the
+ *  response is received is a failure as usual (so that the caller backs off before it tries again). (CoAP requests
+ *  are performed as usual, the timeout does not apply to them.)
+ *  \param[inout] http_ctx HTTP client context.
+ *  \param[in] req buffer with HTTP request (POST).
+ *  \param[in] url URL with HTTP request.
+ *  \param[in] timeout timeout for the complete request in seconds.
+ *  \returns HTTP response on success (empty when the timeout expired), NULL on failure. */
+struct ipa_buf *ipa_http_req_timeout(void *http_ctx, const struct ipa_buf *req, const char *url, unsigned int timeout)
+{
+	struct http_ctx *ctx = http_ctx;
+	struct ipa_buf *res;
+
+	if (ipa_coap_url(url))
+		return ipa_http_req(http_ctx, req, url);
+
+	if (!ctx->curl && setup_handle(ctx) < 0)
+		return NULL;
+	HTTP_SETOPT(ctx, CURLOPT_TIMEOUT, (long)timeout);
+
+	res = ipa_http_req(http_ctx, req, url);
+	if (!res && ctx->timed_out) {
+		IPA_LOGP(SHTTP, LINFO, "HTTP request to %s timed out after %u seconds without response\n", url,
+			 timeout);
+		res = ipa_buf_alloc(IPA_LEN_HTTP_RESPONSE_BUF);
+		assert(res);
 	}
-	rc = curl_easy_setopt(ctx->curl, CURLOPT_WRITEFUNCTION, store_response_cb);
-	if (rc != CURLE_OK) {
-		IPA_LOGP(SHTTP, LERROR, "internal HTTP-client failure: %s\n", curl_easy_strerror(rc));
-		goto error;
+
+	/* Restore the regular timeout (this cannot fail, since the option was already set successfully before) */
+	curl_easy_setopt(ctx->curl, CURLOPT_TIMEOUT, HTTP_TIMEOUT);
+	return res;
+error:
+	return NULL;
+}
+
+/*! Open a TCP connection (if not already present) and Perform HTTP request, the response is not buffered but passed
+ *  to a callback function as it arrives. Since the callback function may take its time to process the response,
+ *  the request is not subject to the overall request timeout (the connect timeout still applies), it is only aborted
+ *  when the transfer stalls (see HTTP_STALL_TIMEOUT).
+ *  \param[inout] http_ctx HTTP client context.
+ *  \param[in] req buffer with HTTP request (POST).
+ *  \param[in] url URL with HTTP request.
+ *  \param[in] res_cb callback function that receives the HTTP response.
+ *  \param[in] priv private data pointer that is passed to the callback function.
+ *  \returns 0 on success, negative on failure (also when the callback function fails). */
+int ipa_http_req_stream(void *http_ctx, const struct ipa_buf *req, const char *url, ipa_http_res_cb res_cb,
+			void *priv)
+{
+	struct http_ctx *ctx = http_ctx;
+	int rc;
+
+	if (ipa_coap_url(url))
+		return ipa_coap_req_stream(coap_ctx(ctx), req, url, res_cb, priv);
+
+	if (!ctx->curl && setup_handle(ctx) < 0)
+		return -EINVAL;
+	HTTP_SETOPT(ctx, CURLOPT_TIMEOUT, 0L);
+	HTTP_SETOPT(ctx, CURLOPT_LOW_SPEED_LIMIT, 1L);
+	HTTP_SETOPT(ctx, CURLOPT_LOW_SPEED_TIME, HTTP_STALL_TIMEOUT);
+
+	ctx->res_cb = res_cb;
+	ctx->res_cb_priv = priv;
+	ctx->res_cb_failed = false;
+	rc = perform(ctx, req, url);
+	ctx->res_cb = NULL;
+	ctx->res_cb_priv = NULL;
+	if (ctx->res_cb_failed) {
+		IPA_LOGP(SHTTP, LERROR, "HTTP request to %s aborted by API user\n", url);
+		rc = -ECANCELED;
 	}
-	rc = curl_easy_setopt(ctx->curl, CURLOPT_WRITEDATA, (void *)&res);
-	if (rc != CURLE_OK) {
-		IPA_LOGP(SHTTP, LERROR, "internal HTTP-client failure: %s\n", curl_easy_strerror(rc));
-		goto error;
+
+	HTTP_SETOPT(ctx, CURLOPT_TIMEOUT, HTTP_TIMEOUT);
+	HTTP_SETOPT(ctx, CURLOPT_LOW_SPEED_LIMIT, 0L);
+	return rc;
+error:
+	return -EINVAL;
+}
+
+/*! Hand a response buffer back to the HTTP client, so that it can be reused for the next response. This may also be
+ *  used to supply a preallocated buffer before the first request is made. (The HTTP client keeps one buffer, a
+ *  previously handed back buffer is freed)
+ *  \param[inout] http_ctx HTTP client context.
+ *  \param[in] buf buffer to reuse (the HTTP client takes ownership). */
+void ipa_http_recycle(void *http_ctx, struct ipa_buf *buf)
+{
+	struct http_ctx *ctx = http_ctx;
+
+	if (!buf)
+		return;
+
+	if (ctx->spare && ctx->spare->data_len >= buf->data_len) {
+		ipa_buf_free(buf);
+		return;
 	}
-	rc = curl_easy_setopt(ctx->curl, CURLOPT_TIMEOUT, 5);
-	if (rc != CURLE_OK) {
-		IPA_LOGP(SHTTP, LERROR, "internal HTTP-client failure: %s\n", curl_easy_strerror(rc));
-		goto error;
+
+	ipa_buf_free(ctx->spare);
+	ctx->spare = buf;
+}
+
+/* TLS sessions can only be exported/imported when curl provides the API for it (curl >= 8.12.0, built with the
+ * SSLS-EXPORT feature), see the check for HAVE_CURL_SSLS_EXPORT in CMakeLists.txt */
+#ifdef HAVE_CURL_SSLS_EXPORT
+/* An exported TLS session consists of the salted hash of the session key (shmac), which identifies the server the
+ * session belongs to, and the session data (sdata). Both are serialized into one buffer: 2 byte length of shmac,
+ * shmac, sdata (see also curl_easy_ssls_export and curl_easy_ssls_import). */
+#define HTTP_SESSION_HDR_LEN 2
+
+struct session_export {
+	struct ipa_buf *buf;
+	curl_off_t valid_until;
+};
+
+/* Create a curl handle that only serves to access the TLS session cache in the share object */
+static CURL *session_handle(struct http_ctx *ctx)
+{
+	CURL *curl;
+
+	if (!ctx->share)
+		return NULL;
+
+	curl = curl_easy_init();
+	if (!curl)
+		return NULL;
+	if (curl_easy_setopt(curl, CURLOPT_SHARE, ctx->share) != CURLE_OK) {
+		curl_easy_cleanup(curl);
+		return NULL;
 	}
 
-	rc = curl_easy_perform(ctx->curl);
+	return curl;
+}
+
+/* Called by curl for each TLS session in the session cache, we keep the session that stays valid for the longest
+ * time (the eIM is the only server the HTTP client talks to) */
+static CURLcode session_export_cb(CURL *curl, void *userptr, const char *session_key, const unsigned char *shmac,
+				  size_t shmac_len, const unsigned char *sdata, size_t sdata_len, curl_off_t valid_until,
+				  int ietf_tls_id, const char *alpn, size_t earlydata_max)
+{
+	struct session_export *export = userptr;
+
+	if (!shmac || shmac_len == 0 || shmac_len > 0xffff || !sdata || sdata_len == 0)
+		return CURLE_OK;
+	if (export->buf && valid_until < export->valid_until)
+		return CURLE_OK;
+
+	ipa_buf_free(export->buf);
+	export->buf = ipa_buf_alloc(HTTP_SESSION_HDR_LEN + shmac_len + sdata_len);
+	if (!export->buf)
+		return CURLE_OUT_OF_MEMORY;
+	export->buf->data[0] = (shmac_len >> 8) & 0xff;
+	export->buf->data[1] = shmac_len & 0xff;
+	memcpy(export->buf->data + HTTP_SESSION_HDR_LEN, shmac, shmac_len);
+	memcpy(export->buf->data + HTTP_SESSION_HDR_LEN + shmac_len, sdata, sdata_len);
+	export->buf->len = export->buf->data_len;
+	export->valid_until = valid_until;
+
+	return CURLE_OK;
+}
+#endif
+
+/*! Export the TLS session of the most recent connection (to be stored in non volatile memory).
+ *  \param[in] http_ctx HTTP client context.
+ *  \returns newly allocated ipa_buf with the serialized TLS session, NULL when no TLS session is available. */
+struct ipa_buf *ipa_http_export_session(void *http_ctx)
+{
+#ifdef HAVE_CURL_SSLS_EXPORT
+	struct http_ctx *ctx = http_ctx;
+	struct session_export export = { 0 };
+	CURL *curl;
+	CURLcode rc;
+
+	curl = session_handle(ctx);
+	if (!curl)
+		return NULL;
+	rc = curl_easy_ssls_export(curl, session_export_cb, &export);
+	curl_easy_cleanup(curl);
 	if (rc != CURLE_OK) {
-		IPA_LOGP(SHTTP, LERROR, "HTTP request to %s failed: %s\n", url, curl_easy_strerror(rc));
+		IPA_LOGP(SHTTP, LDEBUG, "unable to export TLS session: %s\n", curl_easy_strerror(rc));
+		ipa_buf_free(export.buf);
+		return NULL;
+	}
+
+	if (export.buf)
+		IPA_LOGP(SHTTP, LDEBUG, "exported TLS session (%zu bytes)\n", export.buf->len);
+	return export.buf;
+#else
+	/* curl has no API to export TLS sessions (see above) */
+	return NULL;
+#endif
+}
+
+/*! Import a TLS session (previously exported with ipa_http_export_session), the session will be offered to the
+ *  server when the next connection is established.
+ *  \param[inout] http_ctx HTTP client context.
+ *  \param[in] session buffer with the serialized TLS session.
+ *  \returns 0 on success, -ENOTSUP when not supported by curl, -EINVAL when the session is invalid. */
+int ipa_http_import_session(void *http_ctx, const struct ipa_buf *session)
+{
+#ifdef HAVE_CURL_SSLS_EXPORT
+	struct http_ctx *ctx = http_ctx;
+	size_t shmac_len;
+	CURL *curl;
+	CURLcode rc;
+
+	if (session->len < HTTP_SESSION_HDR_LEN)
 		goto error;
+	shmac_len = session->data[0] << 8 | session->data[1];
+	if (shmac_len == 0 || session->len <= HTTP_SESSION_HDR_LEN + shmac_len)
+		goto error;
+
+	curl = session_handle(ctx);
+	if (!curl)
+		return -ENOTSUP;
+	rc = curl_easy_ssls_import(curl, NULL, session->data + HTTP_SESSION_HDR_LEN, shmac_len,
+				   session->data + HTTP_SESSION_HDR_LEN + shmac_len,
+				   session->len - HTTP_SESSION_HDR_LEN - shmac_len);
+	curl_easy_cleanup(curl);
+	if (rc == CURLE_NOT_BUILT_IN) {
+		IPA_LOGP(SHTTP, LINFO, "curl does not support TLS session import\n");
+		return -ENOTSUP;
+	} else if (rc != CURLE_OK) {
+		IPA_LOGP(SHTTP, LERROR, "unable to import TLS session: %s\n", curl_easy_strerror(rc));
+		return -EINVAL;
 	}
-	IPA_LOGP(SHTTP, LINFO, "HTTP request to %s successful: %s\n", url, curl_easy_strerror(rc));
 
-	curl_slist_free_all(list);
-	return res;
+	IPA_LOGP(SHTTP, LDEBUG, "imported TLS session (%zu bytes)\n", session->len);
+	return 0;
 error:
-	ipa_http_close(http_ctx);
-	curl_slist_free_all(list);
-	ipa_buf_free(res);
-	return NULL;
+	IPA_LOGP(SHTTP, LERROR, "unable to import TLS session, invalid data\n");
+	return -EINVAL;
+#else
+	/* curl has no API to import TLS sessions (see above) */
+	IPA_LOGP(SHTTP, LINFO, "curl does not support TLS session import\n");
+	return -ENOTSUP;
+#endif
+}
+
+/*! Read the connection statistics of the HTTP client.
+ *  \param[in] http_ctx HTTP client context.
+ *  \param[out] handshakes number of requests that required a new connection (TCP + TLS handshake).
+ *  \param[out] reuses number of requests that were sent over an already established connection. */
+void ipa_http_stats(void *http_ctx, unsigned int *handshakes, unsigned int *reuses)
+{
+	struct http_ctx *ctx = http_ctx;
+	unsigned int coap_handshakes = 0;
+	unsigned int coap_reuses = 0;
+
+	if (ctx->coap)
+		ipa_coap_stats(ctx->coap, &coap_handshakes, &coap_reuses);
+	*handshakes = ctx->handshakes + coap_handshakes;
+	*reuses = ctx->reuses + coap_reuses;
 }
 
 /*! Close the TCP underlying TCP connection (to be called after the last request).
@@ -177,10 +673,17 @@ error:
 void ipa_http_close(void *http_ctx)
 {
 	struct http_ctx *ctx = http_ctx;
+
+	if (ctx->coap)
+		ipa_coap_close(ctx->coap);
 	if (!ctx->curl)
 		return;
 	curl_easy_cleanup(ctx->curl);
 	ctx->curl = NULL;
+
+	/* The URL must be configured again on the next curl handle */
+	IPA_FREE(ctx->url);
+	ctx->url = NULL;
 }
 
 /*! Free HTTP client.
@@ -193,7 +696,14 @@ void ipa_http_free(void *http_ctx)
 		return;
 
 	ipa_http_close(http_ctx);
-	curl_global_cleanup();
+	if (ctx->share)
+		curl_share_cleanup(ctx->share);
+	curl_slist_free_all(ctx->headers);
+	ipa_buf_free(ctx->cabundle);
+	ipa_buf_free(ctx->spare);
+	ipa_coap_free(ctx->coap);
+	IPA_FREE(ctx->coap_cabundle);
+	curl_global_put();
+	IPA_LOGP(SHTTP, LINFO, "HTTP client freed (handshakes: %u, reuses: %u).\n", ctx->handshakes, ctx->reuses);
 	IPA_FREE(ctx);
-	IPA_LOGP(SHTTP, LINFO, "HTTP client freed.\n");
 }
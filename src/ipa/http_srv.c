@@ -0,0 +1,349 @@
+/*
+ * Author: Philipp Maier <pmaier@sysmocom.de> / sysmocom - s.f.m.c. GmbH
+ *
+ * Lightweight HTTP(S) server: The eIM may push eIM packages to the IPAd (eIM Package Injection, see also SGP.32,
+ * section 6.1). The server accepts one connection at a time and handles exactly one POST request per connection,
+ * which is all that is needed for this purpose. Without a certificate, plain HTTP is used (only for testing). With a
+ * certificate, the eIM must authenticate itself with a client certificate (mutual TLS).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <errno.h>
+#include <assert.h>
+#include <string.h>
+#include <strings.h>
+#include <poll.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <openssl/ssl.h>
+#include <openssl/err.h>
+#include <onomondo/ipa/utils.h>
+#include <onomondo/ipa/http_hdr.h>
+#include <onomondo/ipa/log.h>
+#include <onomondo/ipa/mem.h>
+#include "http_srv.h"
+
+/* The eIM uses the same resource path as the IPAd (see also SUFFIX in esipa.c) */
+#define HTTP_SRV_PATH "/gsma/rsp2/asn1"
+
+/* Unless configured otherwise, only local clients (e.g. a reverse proxy in front of the IPAd) can connect */
+#define HTTP_SRV_DEFAULT_ADDR "127.0.0.1"
+
+/* Timeout (seconds) for the eIM to deliver its request once the connection is accepted, see also HTTP_TIMEOUT */
+#define HTTP_SRV_TIMEOUT 5
+
+#define HTTP_SRV_MAX_HDR_LEN 4096
+#define HTTP_SRV_MAX_BODY_LEN (1024 * 1024)
+
+struct http_srv_ctx {
+	int fd;
+	SSL_CTX *ssl_ctx;
+
+	/* Connection of the request that is currently being handled */
+	int conn_fd;
+	SSL *ssl;
+};
+
+/* Get a printable description of the last OpenSSL error */
+static const char *ssl_err_str(void)
+{
+	const char *err_str = ERR_reason_error_string(ERR_get_error());
+
+	return err_str ? err_str : "unknown error";
+}
+
+/*! Initialize HTTP(S) server and start listening for connections.
+ *  \param[in] bind_addr IPv4 or IPv6 address to listen on ("::" for all addresses), NULL for the loopback address.
+ *  \param[in] port TCP port to listen on.
+ *  \param[in] cert path to a PEM file with server certificate (chain) and private key, NULL for plain HTTP.
+ *  \param[in] cabundle path to a PEM file with the CA certificates to verify the client (eIM) certificate against,
+ *                      required when cert is set.
+ *  \returns pointer to newly allocated HTTP server context, NULL on failure. */
+void *ipa_http_srv_init(const char *bind_addr, uint16_t port, const char *cert, const char *cabundle)
+{
+	struct http_srv_ctx *ctx = IPA_ALLOC_ZERO(struct http_srv_ctx);
+	struct sockaddr_in6 addr6 = { 0 };
+	struct sockaddr_in addr4 = { 0 };
+	struct sockaddr *addr;
+	socklen_t addr_len;
+	int one = 1;
+
+	assert(ctx);
+	ctx->fd = -1;
+	ctx->conn_fd = -1;
+
+	if (cert) {
+		if (!cabundle) {
+			IPA_LOGP(SHTTP, LERROR, "a CA bundle is required to verify the client certificate of the eIM!\n");
+			goto error;
+		}
+		ctx->ssl_ctx = SSL_CTX_new(TLS_server_method());
+		if (!ctx->ssl_ctx)
+			goto error;
+		SSL_CTX_set_min_proto_version(ctx->ssl_ctx, TLS1_2_VERSION);
+		if (SSL_CTX_use_certificate_chain_file(ctx->ssl_ctx, cert) != 1 ||
+		    SSL_CTX_use_PrivateKey_file(ctx->ssl_ctx, cert, SSL_FILETYPE_PEM) != 1) {
+			IPA_LOGP(SHTTP, LERROR, "cannot load server certificate and key from %s: %s\n", cert,
+				 ssl_err_str());
+			goto error;
+		}
+		if (SSL_CTX_load_verify_locations(ctx->ssl_ctx, cabundle, NULL) != 1) {
+			IPA_LOGP(SHTTP, LERROR, "cannot load CA bundle %s: %s\n", cabundle, ssl_err_str());
+			goto error;
+		}
+		SSL_CTX_set_verify(ctx->ssl_ctx, SSL_VERIFY_PEER | SSL_VERIFY_FAIL_IF_NO_PEER_CERT, NULL);
+	}
+
+	if (!bind_addr)
+		bind_addr = HTTP_SRV_DEFAULT_ADDR;
+	if (inet_pton(AF_INET6, bind_addr, &addr6.sin6_addr) == 1) {
+		addr6.sin6_family = AF_INET6;
+		addr6.sin6_port = htons(port);
+		addr = (struct sockaddr *)&addr6;
+		addr_len = sizeof(addr6);
+	} else if (inet_pton(AF_INET, bind_addr, &addr4.sin_addr) == 1) {
+		addr4.sin_family = AF_INET;
+		addr4.sin_port = htons(port);
+		addr = (struct sockaddr *)&addr4;
+		addr_len = sizeof(addr4);
+	} else {
+		IPA_LOGP(SHTTP, LERROR, "invalid address to listen on: %s\n", bind_addr);
+		goto error;
+	}
+
+	/* (An IPv6 socket that listens on all addresses also accepts IPv4 connections) */
+	ctx->fd = socket(addr->sa_family, SOCK_STREAM, 0);
+	if (ctx->fd < 0)
+		goto error;
+	setsockopt(ctx->fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+	if (bind(ctx->fd, addr, addr_len) < 0 || listen(ctx->fd, 1) < 0) {
+		IPA_LOGP(SHTTP, LERROR, "cannot listen on %s port %u: %s\n", bind_addr, port, strerror(errno));
+		goto error;
+	}
+
+	IPA_LOGP(SHTTP, LINFO, "HTTP%s server listening on %s port %u.\n", cert ? "S" : "", bind_addr, port);
+	return ctx;
+error:
+	IPA_LOGP(SHTTP, LERROR, "cannot initialize HTTP server!\n");
+	ipa_http_srv_free(ctx);
+	return NULL;
+}
+
+static void conn_close(struct http_srv_ctx *ctx)
+{
+	if (ctx->ssl) {
+		SSL_shutdown(ctx->ssl);
+		SSL_free(ctx->ssl);
+		ctx->ssl = NULL;
+	}
+	if (ctx->conn_fd >= 0) {
+		close(ctx->conn_fd);
+		ctx->conn_fd = -1;
+	}
+}
+
+static ssize_t conn_read(struct http_srv_ctx *ctx, uint8_t *buf, size_t len)
+{
+	if (ctx->ssl)
+		return SSL_read(ctx->ssl, buf, len);
+	return recv(ctx->conn_fd, buf, len, 0);
+}
+
+static int conn_write(struct http_srv_ctx *ctx, const uint8_t *buf, size_t len)
+{
+	ssize_t rc;
+
+	while (len) {
+		if (ctx->ssl)
+			rc = SSL_write(ctx->ssl, buf, len);
+		else
+			rc = send(ctx->conn_fd, buf, len, MSG_NOSIGNAL);
+		if (rc <= 0)
+			return -EIO;
+		buf += rc;
+		len -= rc;
+	}
+
+	return 0;
+}
+
+static int send_status(struct http_srv_ctx *ctx, const char *status)
+{
+	char hdr[256];
+
+	snprintf(hdr, sizeof(hdr), "HTTP/1.1 %s\r\nContent-Length: 0\r\nConnection: close\r\n\r\n", status);
+	return conn_write(ctx, (uint8_t *) hdr, strlen(hdr));
+}
+
+/* Read and check the request, the request body is returned */
+static int read_request(struct http_srv_ctx *ctx, struct ipa_buf **req)
+{
+	char hdr[HTTP_SRV_MAX_HDR_LEN + 1];
+	size_t hdr_len = 0;
+	char *hdr_end = NULL;
+	char *line;
+	char *saveptr;
+	char path[256];
+	long content_length = -1;
+	struct ipa_buf *body;
+	size_t body_len;
+	ssize_t rc;
+
+	/* Read the header (the first part of the body may be read along with it) */
+	while (!hdr_end) {
+		if (hdr_len >= HTTP_SRV_MAX_HDR_LEN)
+			return send_status(ctx, "431 Request Header Fields Too Large");
+		rc = conn_read(ctx, (uint8_t *) hdr + hdr_len, HTTP_SRV_MAX_HDR_LEN - hdr_len);
+		if (rc <= 0)
+			return -EIO;
+		hdr_len += rc;
+		hdr[hdr_len] = '\0';
+		hdr_end = strstr(hdr, "\r\n\r\n");
+	}
+	*hdr_end = '\0';
+	body_len = hdr_len - (hdr_end + 4 - hdr);
+
+	/* Only POST requests to the ESipa resource are accepted */
+	line = strtok_r(hdr, "\r\n", &saveptr);
+	if (!line || sscanf(line, "POST %255s HTTP/1.%*c", path) != 1) {
+		IPA_LOGP(SHTTP, LERROR, "rejecting malformed or unsupported HTTP request\n");
+		return send_status(ctx, "405 Method Not Allowed");
+	}
+	if (strcmp(path, HTTP_SRV_PATH) != 0) {
+		IPA_LOGP(SHTTP, LERROR, "rejecting HTTP request for unknown resource %s\n", path);
+		return send_status(ctx, "404 Not Found");
+	}
+	while ((line = strtok_r(NULL, "\r\n", &saveptr))) {
+		if (strncasecmp(line, "Content-Length:", 15) == 0)
+			content_length = strtol(line + 15, NULL, 10);
+		else if (strncasecmp(line, "Transfer-Encoding:", 18) == 0)
+			return send_status(ctx, "411 Length Required");
+	}
+	if (content_length < 0 || content_length > HTTP_SRV_MAX_BODY_LEN || body_len > (size_t)content_length) {
+		IPA_LOGP(SHTTP, LERROR, "rejecting HTTP request with missing or invalid Content-Length\n");
+		return send_status(ctx, "411 Length Required");
+	}
+
+	/* Read the body */
+	body = ipa_buf_alloc(content_length);
+	assert(body);
+	memcpy(body->data, hdr_end + 4, body_len);
+	body->len = body_len;
+	while (body->len < (size_t)content_length) {
+		rc = conn_read(ctx, body->data + body->len, content_length - body->len);
+		if (rc <= 0) {
+			ipa_buf_free(body);
+			return -EIO;
+		}
+		body->len += rc;
+	}
+
+	*req = body;
+	return 1;
+}
+
+/*! Wait for a request and receive it. The connection is kept open, so that the response can be sent using
+ *  ipa_http_srv_send. (Invalid requests are rejected without involving the API user.)
+ *  \param[inout] srv_ctx HTTP server context.
+ *  \param[out] req pointer to a newly allocated buffer with the request body.
+ *  \param[in] timeout_ms time to wait for a connection in milliseconds, -1 to wait forever.
+ *  \returns 1 when a request has been received, 0 when no (valid) request was received, negative on failure. */
+int ipa_http_srv_recv(void *srv_ctx, struct ipa_buf **req, int timeout_ms)
+{
+	struct http_srv_ctx *ctx = srv_ctx;
+	struct pollfd pfd = { .fd = ctx->fd, .events = POLLIN };
+	struct timeval timeout = { .tv_sec = HTTP_SRV_TIMEOUT };
+	int rc;
+
+	*req = NULL;
+	conn_close(ctx);
+
+	rc = poll(&pfd, 1, timeout_ms);
+	if (rc < 0)
+		return errno == EINTR ? 0 : -EIO;
+	else if (rc == 0)
+		return 0;
+
+	ctx->conn_fd = accept(ctx->fd, NULL, NULL);
+	if (ctx->conn_fd < 0)
+		return 0;
+
+	/* A client that does not deliver its request in time must not block us */
+	setsockopt(ctx->conn_fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+	setsockopt(ctx->conn_fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+	if (ctx->ssl_ctx) {
+		ctx->ssl = SSL_new(ctx->ssl_ctx);
+		assert(ctx->ssl);
+		SSL_set_fd(ctx->ssl, ctx->conn_fd);
+		if (SSL_accept(ctx->ssl) != 1) {
+			IPA_LOGP(SHTTP, LERROR, "TLS handshake with client failed: %s\n", ssl_err_str());
+			SSL_free(ctx->ssl);
+			ctx->ssl = NULL;
+			conn_close(ctx);
+			return 0;
+		}
+	}
+
+	rc = read_request(ctx, req);
+	if (rc != 1) {
+		conn_close(ctx);
+		return 0;
+	}
+
+	IPA_LOGP(SHTTP, LINFO, "HTTP request received (%zu bytes)\n", (*req)->len);
+	return 1;
+}
+
+/*! Send the response to the request that was received last and close the connection.
+ *  \param[inout] srv_ctx HTTP server context.
+ *  \param[in] res buffer with the response body, NULL to respond with an error.
+ *  \returns 0 on success, negative on failure. */
+int ipa_http_srv_send(void *srv_ctx, const struct ipa_buf *res)
+{
+	struct http_srv_ctx *ctx = srv_ctx;
+	char hdr[256];
+	int rc;
+
+	if (ctx->conn_fd < 0)
+		return -EINVAL;
+
+	if (res) {
+		/* See also SGP.32, section 6.1.1 */
+		snprintf(hdr, sizeof(hdr),
+			 "HTTP/1.1 200 OK\r\nX-Admin-Protocol: %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\n"
+			 "Connection: close\r\n\r\n", IPA_HTTP_X_ADMIN_PROTOCOL, IPA_HTTP_CONTENT_TYPE, res->len);
+		rc = conn_write(ctx, (uint8_t *) hdr, strlen(hdr));
+		if (rc == 0)
+			rc = conn_write(ctx, res->data, res->len);
+	} else {
+		rc = send_status(ctx, "500 Internal Server Error");
+	}
+
+	conn_close(ctx);
+	if (rc < 0)
+		IPA_LOGP(SHTTP, LERROR, "cannot send HTTP response\n");
+	return rc;
+}
+
+/*! Free HTTP server.
+ *  \param[inout] srv_ctx HTTP server context. */
+void ipa_http_srv_free(void *srv_ctx)
+{
+	struct http_srv_ctx *ctx = srv_ctx;
+
+	if (!ctx)
+		return;
+
+	conn_close(ctx);
+	if (ctx->fd >= 0)
+		close(ctx->fd);
+	SSL_CTX_free(ctx->ssl_ctx);
+	IPA_FREE(ctx);
+}
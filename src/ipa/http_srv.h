@@ -0,0 +1,11 @@
+#pragma once
+
+/* Lightweight HTTP(S) server (http_srv.c), used by the sample daemon (main.c) to receive injected eIM packages */
+
+#include <stdint.h>
+struct ipa_buf;
+
+void *ipa_http_srv_init(const char *bind_addr, uint16_t port, const char *cert, const char *cabundle);
+int ipa_http_srv_recv(void *srv_ctx, struct ipa_buf **req, int timeout_ms);
+int ipa_http_srv_send(void *srv_ctx, const struct ipa_buf *res);
+void ipa_http_srv_free(void *srv_ctx);
@@ -484,7 +484,15 @@ OCTET_STRING_decode_ber(const asn_codec_ctx_t *opt_codec_ctx,
 				ctx->left--;
 				ADVANCE(1);
 			}
-			APPEND(buf_ptr, ctx->left);
+			if(td->op == &asn_OP_OCTET_STRING && !st->buf
+			&& asn_arena_ref(buf_ptr, ctx->left)) {
+				/* Reference the decoder input instead of
+				 * copying it (see asn_arena_begin_ref()) */
+				st->buf = (uint8_t *)(uintptr_t)buf_ptr;
+				st->size = ctx->left;
+			} else {
+				APPEND(buf_ptr, ctx->left);
+			}
 			ADVANCE(ctx->left);
 			ctx->left = 0;
 
@@ -0,0 +1,382 @@
+/*
+ * Author: Philipp Maier <pmaier@sysmocom.de> / sysmocom - s.f.m.c. GmbH
+ *
+ * Arena (bump) allocator for the memory allocator hooks in asn_internal.h
+ */
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <onomondo/ipa/mem.h>
+#include <asn_arena.h>
+
+/* Memory is taken from blocks of this size, larger allocations get a block
+ * of their own */
+#define	ASN_ARENA_BLOCK_SIZE	2048
+
+/* Strings from the decoder input are only referenced from this size on, the
+ * many small strings are still copied and remain nul-terminated */
+#define	ASN_ARENA_REF_MIN	128
+
+/* Alignment of each allocation, each allocation is preceded by a header
+ * of the same size that stores the size of the allocation (see realloc) */
+#define	ASN_ARENA_ALIGN	(sizeof(double) > sizeof(void *) ? sizeof(double) : sizeof(void *))
+#define	ASN_ARENA_ROUND(n)	(((n) + ASN_ARENA_ALIGN - 1) & ~(ASN_ARENA_ALIGN - 1))
+
+/* Arena memory is found by its address (see arena_owner()): The address
+ * space is divided into pages and each block is entered into a (global)
+ * index under each page it overlaps. Nothing is read from memory that does
+ * not belong to an arena, so any pointer can be looked up. */
+#define	ASN_ARENA_PAGE_SHIFT	11
+#define	ASN_ARENA_INDEX_SIZE	64
+
+/* The active arena is per thread (like the decoding) */
+#ifndef	IPA_THREAD_LOCAL
+#define	IPA_THREAD_LOCAL	__thread
+#endif
+
+struct asn_arena_page {
+	struct asn_arena_page *next;	/* Next entry in the same bucket */
+	uintptr_t page;
+	struct asn_arena_block *block;
+};
+
+struct asn_arena_block {
+	struct asn_arena_block *next;
+	struct asn_arena *arena;
+	size_t size;	/* Usable size */
+	size_t used;
+	struct asn_arena_page *pages;	/* Index entries (behind the data) */
+	size_t pages_count;
+};
+
+#define	ASN_ARENA_BLOCK_DATA(block) \
+	((uint8_t *)(block) + ASN_ARENA_ROUND(sizeof(struct asn_arena_block)))
+
+/* Number of pages a block of the given size may overlap */
+#define	ASN_ARENA_BLOCK_PAGES(size)	(((size) >> ASN_ARENA_PAGE_SHIFT) + 2)
+
+struct asn_arena {
+	struct asn_arena *next;	/* List of live arenas */
+	const void *root;	/* First allocation (decoded structure) */
+	struct asn_arena_block *blocks;	/* Current block first */
+	void *last;	/* Most recent allocation (may grow in place) */
+	struct asn_arena_block *last_block;
+	const uint8_t *ref;	/* Decoder input that may be referenced */
+	size_t ref_size;
+};
+
+static IPA_THREAD_LOCAL struct asn_arena *active_arena;
+
+/* A decoded structure may be modified or freed by another thread than the
+ * one that decoded it, so the live arenas and the page index are global and
+ * protected by a lock */
+static pthread_mutex_t arena_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct asn_arena *live_arenas;
+static struct asn_arena_page *page_index[ASN_ARENA_INDEX_SIZE];
+static unsigned int ref_arenas;	/* Live arenas with a reference */
+
+static void
+index_add(struct asn_arena_block *block) {
+	uintptr_t first = (uintptr_t)ASN_ARENA_BLOCK_DATA(block) >> ASN_ARENA_PAGE_SHIFT;
+	uintptr_t last = ((uintptr_t)ASN_ARENA_BLOCK_DATA(block) + block->size - 1) >> ASN_ARENA_PAGE_SHIFT;
+	struct asn_arena_page **bucket;
+	size_t i;
+
+	block->pages_count = last - first + 1;
+	pthread_mutex_lock(&arena_lock);
+	for(i = 0; i < block->pages_count; i++) {
+		bucket = &page_index[(first + i) % ASN_ARENA_INDEX_SIZE];
+		block->pages[i].page = first + i;
+		block->pages[i].block = block;
+		block->pages[i].next = *bucket;
+		*bucket = &block->pages[i];
+	}
+	pthread_mutex_unlock(&arena_lock);
+}
+
+/* Must be called with arena_lock held */
+static void
+index_del(struct asn_arena_block *block) {
+	struct asn_arena_page **pp;
+	size_t i;
+
+	for(i = 0; i < block->pages_count; i++) {
+		pp = &page_index[block->pages[i].page % ASN_ARENA_INDEX_SIZE];
+		while(*pp != &block->pages[i])
+			pp = &(*pp)->next;
+		*pp = block->pages[i].next;
+	}
+}
+
+static size_t
+alloc_size(const void *ptr) {
+	return *(const size_t *)((const uint8_t *)ptr - ASN_ARENA_ALIGN);
+}
+
+static void *
+arena_alloc(struct asn_arena *arena, size_t size) {
+	struct asn_arena_block *block = arena->blocks;
+	size_t need = ASN_ARENA_ALIGN + ASN_ARENA_ROUND(size);
+	uint8_t *ptr;
+
+	if(!block || block->size - block->used < need) {
+		size_t block_size = need > ASN_ARENA_BLOCK_SIZE ? need : ASN_ARENA_BLOCK_SIZE;
+		block = IPA_ALLOC_N(ASN_ARENA_ROUND(sizeof(*block)) + block_size
+				    + ASN_ARENA_BLOCK_PAGES(block_size) * sizeof(struct asn_arena_page));
+		if(!block)
+			return NULL;
+		block->arena = arena;
+		block->size = block_size;
+		block->used = 0;
+		block->pages = (struct asn_arena_page *)(ASN_ARENA_BLOCK_DATA(block) + block_size);
+		index_add(block);
+		/* A dedicated block for a large allocation is put behind the
+		 * current block, so that the remaining space is still used */
+		if(arena->blocks && need > ASN_ARENA_BLOCK_SIZE) {
+			block->next = arena->blocks->next;
+			arena->blocks->next = block;
+		} else {
+			block->next = arena->blocks;
+			arena->blocks = block;
+		}
+	}
+
+	ptr = ASN_ARENA_BLOCK_DATA(block) + block->used + ASN_ARENA_ALIGN;
+	block->used += need;
+	*(size_t *)(ptr - ASN_ARENA_ALIGN) = size;
+
+	if(!arena->root)
+		arena->root = ptr;
+	arena->last = ptr;
+	arena->last_block = block;
+	return ptr;
+}
+
+static int
+arena_refs(const struct asn_arena *arena, const void *ptr) {
+	const uint8_t *p = ptr;
+
+	return arena->ref && p >= arena->ref && p < arena->ref + arena->ref_size;
+}
+
+/* Find the arena the memory at ptr was taken from (or that references the
+ * memory at ptr) */
+static struct asn_arena *
+arena_owner(const void *ptr) {
+	uintptr_t page = (uintptr_t)ptr >> ASN_ARENA_PAGE_SHIFT;
+	struct asn_arena_page *entry;
+	struct asn_arena *arena = NULL;
+	const uint8_t *p = ptr;
+
+	pthread_mutex_lock(&arena_lock);
+	if(!live_arenas)
+		goto out;
+
+	for(entry = page_index[page % ASN_ARENA_INDEX_SIZE]; entry; entry = entry->next) {
+		if(entry->page == page
+		   && p >= ASN_ARENA_BLOCK_DATA(entry->block)
+		   && p < ASN_ARENA_BLOCK_DATA(entry->block) + entry->block->used) {
+			arena = entry->block->arena;
+			goto out;
+		}
+	}
+
+	/* There are only few arenas that reference a decoder input */
+	for(arena = live_arenas; ref_arenas && arena; arena = arena->next) {
+		if(arena_refs(arena, ptr))
+			goto out;
+	}
+	arena = NULL;
+
+out:
+	pthread_mutex_unlock(&arena_lock);
+	return arena;
+}
+
+static void
+arena_free(struct asn_arena *arena) {
+	struct asn_arena_block *block;
+	struct asn_arena **pp;
+
+	if(active_arena == arena)
+		active_arena = NULL;
+
+	pthread_mutex_lock(&arena_lock);
+	for(pp = &live_arenas; *pp; pp = &(*pp)->next) {
+		if(*pp == arena) {
+			*pp = arena->next;
+			break;
+		}
+	}
+	if(arena->ref)
+		ref_arenas--;
+	for(block = arena->blocks; block; block = block->next)
+		index_del(block);
+	pthread_mutex_unlock(&arena_lock);
+
+	while(arena->blocks) {
+		block = arena->blocks;
+		arena->blocks = block->next;
+		IPA_FREE(block);
+	}
+	IPA_FREE(arena);
+}
+
+struct asn_arena *
+asn_arena_begin(void) {
+	struct asn_arena *arena;
+
+	if(active_arena)
+		return NULL;
+
+	arena = IPA_ALLOC_N(sizeof(*arena));
+	if(!arena)
+		return NULL;
+	memset(arena, 0, sizeof(*arena));
+	pthread_mutex_lock(&arena_lock);
+	arena->next = live_arenas;
+	live_arenas = arena;
+	pthread_mutex_unlock(&arena_lock);
+	active_arena = arena;
+
+	return arena;
+}
+
+struct asn_arena *
+asn_arena_begin_ref(const void *buf, size_t size) {
+	struct asn_arena *arena = asn_arena_begin();
+
+	if(arena) {
+		pthread_mutex_lock(&arena_lock);
+		arena->ref = buf;
+		arena->ref_size = size;
+		ref_arenas++;
+		pthread_mutex_unlock(&arena_lock);
+	}
+
+	return arena;
+}
+
+int
+asn_arena_ref(const void *ptr, size_t size) {
+	const uint8_t *p = ptr;
+
+	if(!active_arena || !active_arena->ref || size < ASN_ARENA_REF_MIN)
+		return 0;
+
+	return p >= active_arena->ref && size <= active_arena->ref_size
+		&& (size_t)(p - active_arena->ref) <= active_arena->ref_size - size;
+}
+
+void
+asn_arena_end(struct asn_arena *arena) {
+	if(!arena)
+		return;
+
+	if(active_arena == arena)
+		active_arena = NULL;
+
+	/* Nothing was decoded, so nobody will ever release the arena */
+	if(!arena->root)
+		arena_free(arena);
+}
+
+int
+asn_arena_release(const void *struct_ptr) {
+	struct asn_arena *arena;
+
+	if(!struct_ptr)
+		return 0;
+
+	arena = arena_owner(struct_ptr);
+	if(!arena || arena->root != struct_ptr)
+		return 0;
+
+	arena_free(arena);
+	return 1;
+}
+
+void *
+asn_arena_malloc(size_t size) {
+	if(active_arena)
+		return arena_alloc(active_arena, size);
+	return IPA_ALLOC_N(size);
+}
+
+void *
+asn_arena_calloc(size_t nmemb, size_t size) {
+	void *ptr;
+
+	if(!active_arena)
+		return IPA_CALLOC(nmemb, size);
+
+	if(size && nmemb > SIZE_MAX / size)
+		return NULL;
+	ptr = arena_alloc(active_arena, nmemb * size);
+	if(ptr)
+		memset(ptr, 0, nmemb * size);
+	return ptr;
+}
+
+void *
+asn_arena_realloc(void *oldptr, size_t size) {
+	struct asn_arena *arena;
+	struct asn_arena_block *block;
+	size_t old_size;
+	size_t grow;
+	void *ptr;
+
+	if(!oldptr)
+		return asn_arena_malloc(size);
+
+	/* Memory from an arena stays in its arena, also when the arena is not
+	 * active anymore (e.g. when an element is added to a decoded list) */
+	arena = arena_owner(oldptr);
+	if(!arena)
+		return IPA_REALLOC(oldptr, size);
+
+	/* A referenced string has no size header, it is copied into the arena
+	 * (as far as the referenced memory goes) */
+	if(arena_refs(arena, oldptr)) {
+		old_size = arena->ref + arena->ref_size - (const uint8_t *)oldptr;
+		ptr = arena_alloc(arena, size);
+		if(ptr)
+			memcpy(ptr, oldptr, size < old_size ? size : old_size);
+		return ptr;
+	}
+
+	old_size = alloc_size(oldptr);
+	if(size <= old_size) {
+		*(size_t *)((uint8_t *)oldptr - ASN_ARENA_ALIGN) = size;
+		return oldptr;
+	}
+
+	/* The most recent allocation can grow in place (typical for lists
+	 * and strings while they are decoded) */
+	block = arena->last_block;
+	if(oldptr == arena->last
+	   && (uint8_t *)oldptr + ASN_ARENA_ROUND(old_size) == ASN_ARENA_BLOCK_DATA(block) + block->used) {
+		grow = ASN_ARENA_ROUND(size) - ASN_ARENA_ROUND(old_size);
+		if(block->size - block->used >= grow) {
+			block->used += grow;
+			*(size_t *)((uint8_t *)oldptr - ASN_ARENA_ALIGN) = size;
+			return oldptr;
+		}
+	}
+
+	ptr = arena_alloc(arena, size);
+	if(ptr)
+		memcpy(ptr, oldptr, old_size);
+	return ptr;
+}
+
+void
+asn_arena_free(void *ptr) {
+	if(!ptr)
+		return;
+
+	/* Memory from an arena is only released with the arena as a whole */
+	if(arena_owner(ptr))
+		return;
+	IPA_FREE(ptr);
+}
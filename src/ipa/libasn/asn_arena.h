@@ -0,0 +1,61 @@
+/*
+ * Author: Philipp Maier <pmaier@sysmocom.de> / sysmocom - s.f.m.c. GmbH
+ *
+ * Arena (bump) allocator for the memory allocator hooks in asn_internal.h
+ */
+#ifndef	ASN_ARENA_H
+#define	ASN_ARENA_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct asn_arena;
+
+/*
+ * While an arena is active, all memory the ASN.1 support code allocates is
+ * taken from the arena. This is intended to be used around ber_decode(): the
+ * first allocation of the decoder is the decoded structure itself, which
+ * becomes the root of the arena. ASN_STRUCT_FREE() on the root releases the
+ * arena as a whole, without walking the structure. Freeing (parts of) the
+ * structure otherwise is a no-op. A REALLOC() of arena memory (e.g. adding an
+ * element to a decoded list) stays in the arena, but a fresh MALLOC() (e.g.
+ * OCTET_STRING_fromBuf() on a decoded string) takes heap memory, which the
+ * caller has to free before the arena is released. Only one arena can be
+ * active at a time (per thread), asn_arena_begin() returns NULL when an arena
+ * is already active. A decoded structure may be modified and released by any
+ * thread (but not by two threads at the same time).
+ */
+struct asn_arena *asn_arena_begin(void);
+void asn_arena_end(struct asn_arena *arena);
+
+/*
+ * Same as asn_arena_begin(), but large primitive OCTET STRINGs (see
+ * ASN_ARENA_REF_MIN in asn_arena.c) that are decoded from buf are not
+ * copied, they reference buf instead (and are therefore not nul-terminated).
+ * The caller must keep buf unchanged until the decoded structure is
+ * released.
+ */
+struct asn_arena *asn_arena_begin_ref(const void *buf, size_t size);
+
+/* Check whether the string at ptr may be referenced instead of being copied
+ * into the active arena (see asn_arena_begin_ref()). */
+int asn_arena_ref(const void *ptr, size_t size);
+
+/* Release the arena whose root is struct_ptr, returns 1 when an arena was
+ * released, 0 when struct_ptr is not the root of an arena. */
+int asn_arena_release(const void *struct_ptr);
+
+/* Allocator hooks, see asn_internal.h */
+void *asn_arena_malloc(size_t size);
+void *asn_arena_calloc(size_t nmemb, size_t size);
+void *asn_arena_realloc(void *oldptr, size_t size);
+void asn_arena_free(void *ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* ASN_ARENA_H */
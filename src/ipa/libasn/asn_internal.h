@@ -24,11 +24,11 @@ extern "C" {
 #define	ASN1C_ENVIRONMENT_VERSION	923	/* Compile-time version */
 int get_asn1c_environment_version(void);	/* Run-time version */
 
-#include <onomondo/ipa/mem.h>
-#define	CALLOC(nmemb, size)	IPA_CALLOC(nmemb, size)
-#define	MALLOC(size)		IPA_ALLOC_N(size)
-#define	REALLOC(oldptr, size)	IPA_REALLOC(oldptr, size)
-#define	FREEMEM(ptr)		IPA_FREE(ptr)
+#include <asn_arena.h>
+#define	CALLOC(nmemb, size)	asn_arena_calloc(nmemb, size)
+#define	MALLOC(size)		asn_arena_malloc(size)
+#define	REALLOC(oldptr, size)	asn_arena_realloc(oldptr, size)
+#define	FREEMEM(ptr)		asn_arena_free(ptr)
 
 #define	asn_debug_indent	0
 #define ASN_DEBUG_INDENT_ADD(i) do{}while(0)
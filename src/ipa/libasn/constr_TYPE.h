@@ -68,9 +68,13 @@ typedef void (asn_struct_free_f)(
 
 /*
  * Free the structure including freeing the memory pointed to by ptr itself.
+ * (A structure that was decoded into an arena is released with its arena.)
  */
-#define ASN_STRUCT_FREE(asn_DEF, ptr) \
-    (asn_DEF).op->free_struct(&(asn_DEF), (ptr), ASFM_FREE_EVERYTHING)
+int asn_arena_release(const void *struct_ptr);
+#define ASN_STRUCT_FREE(asn_DEF, ptr)                                        \
+    (asn_arena_release(ptr)                                                  \
+         ? (void)0                                                           \
+         : (asn_DEF).op->free_struct(&(asn_DEF), (ptr), ASFM_FREE_EVERYTHING))
 
 /*
  * Free the memory used by the members of the structure without freeing the
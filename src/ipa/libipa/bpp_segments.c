@@ -6,37 +6,57 @@
 #include <stdint.h>
 #include <string.h>
 #include <errno.h>
+#include <assert.h>
 #include <onomondo/ipa/log.h>
 #include <asn_application.h>
 #include "utils.h"
 #include "es10x.h"
+#include "length.h"
 #include "bpp_segments.h"
 
-/* See also GSMA SGP.22, section  2.5.5 (bullet point 1) */
-static struct ipa_buf *enc_init_sec_chan_req(const struct BoundProfilePackage *bpp,
-					     const struct InitialiseSecureChannelRequest *init_sec_chan_req)
+/* Encode the tag and length fields of a TLV (hdr_td), optionally followed by a complete TLV (td), into a buffer of the
+ * exact size. The value part of the first TLV is not encoded into memory. */
+static struct ipa_buf *enc_hdr_and_tlv(const asn_TYPE_descriptor_t *hdr_td, const void *hdr_ptr,
+				       const asn_TYPE_descriptor_t *td, const void *ptr)
 {
-	struct ipa_buf *init_sec_chan_req_encoded = NULL;
-	asn_enc_rval_t rc;
-
-	/* "Tag and length fields of the BoundProfilePackage TLV..." */
-	rc = der_encode(&asn_DEF_BoundProfilePackage, bpp, ipa_asn1c_consume_bytes_cb, &init_sec_chan_req_encoded);
-	if (rc.encoded <= 0) {
-		IPA_LOGP(SIPA, LDEBUG, "cannot re-encode BoundProfilePackage!\n");
-		IPA_FREE(init_sec_chan_req_encoded);
+	uint8_t hdr_data[IPA_LEN_ASN1_HDR_MAX] = { 0 };
+	struct ipa_buf hdr;
+	struct ipa_buf *encoded;
+	ssize_t tlv_len = 0;
+
+	ipa_buf_assign(&hdr, hdr_data, sizeof(hdr_data));
+	hdr.len = 0;
+	if (ipa_asn1c_encode_hdr_to(&hdr, hdr_td, hdr_ptr) < 0)
+		return NULL;
+
+	if (td) {
+		tlv_len = ipa_asn1c_encoded_len(td, ptr);
+		if (tlv_len < 0)
+			return NULL;
+	}
+
+	encoded = ipa_buf_alloc(hdr.len + tlv_len);
+	assert(encoded);
+	ipa_buf_cpy(encoded, hdr.data, hdr.len);
+	if (td && ipa_asn1c_encode_to(encoded, td, ptr) != tlv_len) {
+		IPA_FREE(encoded);
 		return NULL;
 	}
 
-	/* Pinch-off the value part of the TLV */
-	init_sec_chan_req_encoded->len = ipa_parse_btlv_hdr(NULL, NULL, init_sec_chan_req_encoded);
+	return encoded;
+}
 
-	/* "...plus the initialiseSecureChannelRequest TLV */
-	rc = der_encode(&asn_DEF_InitialiseSecureChannelRequest, init_sec_chan_req, ipa_asn1c_consume_bytes_cb,
-			&init_sec_chan_req_encoded);
+/* See also GSMA SGP.22, section  2.5.5 (bullet point 1) */
+static struct ipa_buf *enc_init_sec_chan_req(const struct BoundProfilePackage *bpp,
+					     const struct InitialiseSecureChannelRequest *init_sec_chan_req)
+{
+	struct ipa_buf *init_sec_chan_req_encoded;
 
-	if (rc.encoded <= 0) {
+	/* "Tag and length fields of the BoundProfilePackage TLV plus the initialiseSecureChannelRequest TLV" */
+	init_sec_chan_req_encoded = enc_hdr_and_tlv(&asn_DEF_BoundProfilePackage, bpp,
+						    &asn_DEF_InitialiseSecureChannelRequest, init_sec_chan_req);
+	if (!init_sec_chan_req_encoded) {
 		IPA_LOGP(SIPA, LERROR, "cannot encode segment for InitialiseSecureChannelRequest!\n");
-		IPA_FREE(init_sec_chan_req_encoded);
 		return NULL;
 	}
 
@@ -49,25 +69,10 @@ static struct ipa_buf *enc_init_sec_chan_req(const struct BoundProfilePackage *b
 /* See also GSMA SGP.22, section  2.5.5 (bullet point 2) */
 static struct ipa_buf *enc_first_seq_of_87(const struct BoundProfilePackage_FirstSequenceOf87 *first_seq_of_87)
 {
-	struct ipa_buf *first_seq_of_87_encoded = NULL;
-	asn_enc_rval_t rc;
-
-	/* "Tag and length fields of the FirstSequenceOf87 TLV" */
-	rc = der_encode(&asn_DEF_BoundProfilePackage_FirstSequenceOf87, first_seq_of_87, ipa_asn1c_consume_bytes_cb,
-			&first_seq_of_87_encoded);
-	if (rc.encoded <= 0) {
-		IPA_LOGP(SIPA, LERROR, "cannot encode segment for FirstSequenceOf87 (tlv header)!\n");
-		IPA_FREE(first_seq_of_87_encoded);
-		return NULL;
-	}
+	struct ipa_buf *first_seq_of_87_encoded;
 
-	/* Pinch-off the value part of the TLV */
-	first_seq_of_87_encoded->len = ipa_parse_btlv_hdr(NULL, NULL, first_seq_of_87_encoded);
-
-	/* plus the first '87' TLV */
 	if (first_seq_of_87->list.count < 1) {
 		IPA_LOGP(SIPA, LERROR, "cannot encode segment for FirstSequenceOf87 (empty sequence)!\n");
-		IPA_FREE(first_seq_of_87_encoded);
 		return NULL;
 	}
 	if (first_seq_of_87->list.count > 1) {
@@ -75,11 +80,11 @@ static struct ipa_buf *enc_first_seq_of_87(const struct BoundProfilePackage_Firs
 		IPA_LOGP(SIPA, LDEBUG, "ignoring excess items in the FirstSequenceOf87!\n");
 	}
 
-	rc = der_encode(&asn_DEF_BoundProfilePackage_87tlv, first_seq_of_87->list.array[0], ipa_asn1c_consume_bytes_cb,
-			&first_seq_of_87_encoded);
-	if (rc.encoded <= 0) {
-		IPA_LOGP(SIPA, LERROR, "cannot encode segment for FirstSequenceOf87 (first 87 TLV)!\n");
-		IPA_FREE(first_seq_of_87_encoded);
+	/* "Tag and length fields of the FirstSequenceOf87 TLV plus the first '87' TLV" */
+	first_seq_of_87_encoded = enc_hdr_and_tlv(&asn_DEF_BoundProfilePackage_FirstSequenceOf87, first_seq_of_87,
+						  &asn_DEF_BoundProfilePackage_87tlv, first_seq_of_87->list.array[0]);
+	if (!first_seq_of_87_encoded) {
+		IPA_LOGP(SIPA, LERROR, "cannot encode segment for FirstSequenceOf87!\n");
 		return NULL;
 	}
 
@@ -92,21 +97,15 @@ static struct ipa_buf *enc_first_seq_of_87(const struct BoundProfilePackage_Firs
 /* See also GSMA SGP.22, section  2.5.5 (bullet point 3) */
 static struct ipa_buf *enc_tag_and_len_of_sequenceOf88(const struct BoundProfilePackage_SequenceOf88 *seq_of_88)
 {
-	struct ipa_buf *seq_of_88_encoded = NULL;
-	asn_enc_rval_t rc;
+	struct ipa_buf *seq_of_88_encoded;
 
-	/* "Tag and length fields of the first sequenceOf87 TLV" */
-	rc = der_encode(&asn_DEF_BoundProfilePackage_SequenceOf88, seq_of_88, ipa_asn1c_consume_bytes_cb,
-			&seq_of_88_encoded);
-	if (rc.encoded <= 0) {
+	/* "Tag and length fields of the sequenceOf88 TLV" */
+	seq_of_88_encoded = enc_hdr_and_tlv(&asn_DEF_BoundProfilePackage_SequenceOf88, seq_of_88, NULL, NULL);
+	if (!seq_of_88_encoded) {
 		IPA_LOGP(SIPA, LERROR, "cannot encode segment for tag and length field of SequenceOf88!\n");
-		IPA_FREE(seq_of_88_encoded);
 		return NULL;
 	}
 
-	/* Pinch-off the value part as we were only asked for tag and length fields */
-	seq_of_88_encoded->len = ipa_parse_btlv_hdr(NULL, NULL, seq_of_88_encoded);
-
 	IPA_LOGP(SIPA, LDEBUG, "encoded tag and length field of SequenceOf88 segment: %s\n",
 		 ipa_buf_hexdump(seq_of_88_encoded));
 	return seq_of_88_encoded;
@@ -115,14 +114,12 @@ static struct ipa_buf *enc_tag_and_len_of_sequenceOf88(const struct BoundProfile
 /* See also GSMA SGP.22, section  2.5.5 (bullet point 4) */
 static struct ipa_buf *enc_each_of_sequenceOf88(const BoundProfilePackage_88tlv_t * one_88tlv, unsigned int index)
 {
-	struct ipa_buf *one_88tlv_encoded = NULL;
-	asn_enc_rval_t rc;
+	struct ipa_buf *one_88tlv_encoded;
 
 	/* "Each of the '88' TLVs" (= one per segment) */
-	rc = der_encode(&asn_DEF_BoundProfilePackage_88tlv, one_88tlv, ipa_asn1c_consume_bytes_cb, &one_88tlv_encoded);
-	if (rc.encoded <= 0) {
+	one_88tlv_encoded = ipa_asn1c_encode(&asn_DEF_BoundProfilePackage_88tlv, one_88tlv);
+	if (!one_88tlv_encoded) {
 		IPA_LOGP(SIPA, LERROR, "cannot encode segment for '88' TLV %u!\n", index);
-		IPA_FREE(one_88tlv_encoded);
 		return NULL;
 	}
 
@@ -135,25 +132,10 @@ static struct ipa_buf *enc_each_of_sequenceOf88(const BoundProfilePackage_88tlv_
 /* See also GSMA SGP.22, section  2.5.5 (bullet point 5) */
 static struct ipa_buf *enc_second_seq_of_87(const struct BoundProfilePackage_SecondSequenceOf87 *second_seq_of_87)
 {
-	struct ipa_buf *second_seq_of_87_encoded = NULL;
-	asn_enc_rval_t rc;
-
-	/* "Tag and length fields of the SecondSequenceOf87 TLV" */
-	rc = der_encode(&asn_DEF_BoundProfilePackage_SecondSequenceOf87, second_seq_of_87, ipa_asn1c_consume_bytes_cb,
-			&second_seq_of_87_encoded);
-	if (rc.encoded <= 0) {
-		IPA_LOGP(SIPA, LERROR, "cannot encode segment for SecondSequenceOf87 (tlv header)!\n");
-		IPA_FREE(second_seq_of_87_encoded);
-		return NULL;
-	}
+	struct ipa_buf *second_seq_of_87_encoded;
 
-	/* Pinch-off the value part of the TLV */
-	second_seq_of_87_encoded->len = ipa_parse_btlv_hdr(NULL, NULL, second_seq_of_87_encoded);
-
-	/* plus the first '87' TLV */
 	if (second_seq_of_87->list.count < 1) {
 		IPA_LOGP(SIPA, LERROR, "cannot encode segment for SecondSequenceOf87 (empty sequence)!\n");
-		IPA_FREE(second_seq_of_87_encoded);
 		return NULL;
 	}
 	if (second_seq_of_87->list.count > 1) {
@@ -161,11 +143,11 @@ static struct ipa_buf *enc_second_seq_of_87(const struct BoundProfilePackage_Sec
 		IPA_LOGP(SIPA, LDEBUG, "ignoring excess items in the SecondSequenceOf87!\n");
 	}
 
-	rc = der_encode(&asn_DEF_BoundProfilePackage_87tlv, second_seq_of_87->list.array[0], ipa_asn1c_consume_bytes_cb,
-			&second_seq_of_87_encoded);
-	if (rc.encoded <= 0) {
-		IPA_LOGP(SIPA, LERROR, "cannot encode segment for SecondSequenceOf87 (first 87 TLV)!\n");
-		IPA_FREE(second_seq_of_87_encoded);
+	/* "Tag and length fields of the SecondSequenceOf87 TLV plus the first '87' TLV" */
+	second_seq_of_87_encoded = enc_hdr_and_tlv(&asn_DEF_BoundProfilePackage_SecondSequenceOf87, second_seq_of_87,
+						   &asn_DEF_BoundProfilePackage_87tlv, second_seq_of_87->list.array[0]);
+	if (!second_seq_of_87_encoded) {
+		IPA_LOGP(SIPA, LERROR, "cannot encode segment for SecondSequenceOf87!\n");
 		return NULL;
 	}
 
@@ -178,21 +160,15 @@ static struct ipa_buf *enc_second_seq_of_87(const struct BoundProfilePackage_Sec
 /* See also GSMA SGP.22, section  2.5.5 (bullet point 6) */
 static struct ipa_buf *enc_tag_and_len_of_sequenceOf86(const struct BoundProfilePackage_SequenceOf86 *seq_of_86)
 {
-	struct ipa_buf *seq_of_86_encoded = NULL;
-	asn_enc_rval_t rc;
+	struct ipa_buf *seq_of_86_encoded;
 
-	/* "Tag and length fields of the first sequenceOf87 TLV" */
-	rc = der_encode(&asn_DEF_BoundProfilePackage_SequenceOf86, seq_of_86, ipa_asn1c_consume_bytes_cb,
-			&seq_of_86_encoded);
-	if (rc.encoded <= 0) {
+	/* "Tag and length fields of the sequenceOf86 TLV" */
+	seq_of_86_encoded = enc_hdr_and_tlv(&asn_DEF_BoundProfilePackage_SequenceOf86, seq_of_86, NULL, NULL);
+	if (!seq_of_86_encoded) {
 		IPA_LOGP(SIPA, LERROR, "cannot encode segment for tag and length field of SequenceOf86!\n");
-		IPA_FREE(seq_of_86_encoded);
 		return NULL;
 	}
 
-	/* Pinch-off the value part as we were only asked for tag and length fields */
-	seq_of_86_encoded->len = ipa_parse_btlv_hdr(NULL, NULL, seq_of_86_encoded);
-
 	IPA_LOGP(SIPA, LDEBUG, "encoded tag and length field of SequenceOf86 segment: %s\n",
 		 ipa_buf_hexdump(seq_of_86_encoded));
 
@@ -202,14 +178,12 @@ static struct ipa_buf *enc_tag_and_len_of_sequenceOf86(const struct BoundProfile
 /* See also GSMA SGP.22, section  2.5.5 (bullet point 7) */
 static struct ipa_buf *enc_each_of_sequenceOf86(const BoundProfilePackage_86tlv_t * one_86tlv, unsigned int index)
 {
-	struct ipa_buf *one_86tlv_encoded = NULL;
-	asn_enc_rval_t rc;
+	struct ipa_buf *one_86tlv_encoded;
 
-	/* "Each of the '88' TLVs" (= one per segment) */
-	rc = der_encode(&asn_DEF_BoundProfilePackage_86tlv, one_86tlv, ipa_asn1c_consume_bytes_cb, &one_86tlv_encoded);
-	if (rc.encoded <= 0) {
+	/* "Each of the '86' TLVs" (= one per segment) */
+	one_86tlv_encoded = ipa_asn1c_encode(&asn_DEF_BoundProfilePackage_86tlv, one_86tlv);
+	if (!one_86tlv_encoded) {
 		IPA_LOGP(SIPA, LERROR, "cannot encode segment for '86' TLV %u!\n", index);
-		IPA_FREE(one_86tlv_encoded);
 		return NULL;
 	}
 
@@ -298,3 +272,524 @@ void ipa_bpp_segments_free(struct ipa_bpp_segments *segments)
 
 	IPA_FREE(segments);
 }
+
+/* The ES8+ segments (see above) are contiguous ranges of the encoded BoundProfilePackage, this makes it possible to
+ * cut the segments directly from the encoded ESipa message while it is received, without decoding the message as a
+ * whole. Only the bytes of the segment that is currently received are kept in memory. */
+
+enum bpp_stream_state {
+	BPP_STREAM_ENVELOPE,
+	BPP_STREAM_INIT_SEC_CHAN_REQ,
+	BPP_STREAM_FIRST_SEQ_OF_87,
+	BPP_STREAM_SEQ_OF_88,
+	BPP_STREAM_EACH_OF_88,
+	BPP_STREAM_SECOND_SEQ_OF_87,
+	BPP_STREAM_SEQ_OF_86,
+	BPP_STREAM_EACH_OF_86,
+	BPP_STREAM_DONE,
+};
+
+struct ipa_bpp_segments_stream {
+	enum bpp_stream_state state;
+
+	/* Bytes that have been received, but not yet passed on as segment (or the ESipa message envelope) */
+	struct ipa_buf *buf;
+
+	/* Number of bytes at the beginning of buf that were already parsed */
+	size_t parsed;
+
+	/* Number of bytes to discard (excess '87' TLVs, see also enc_first_seq_of_87) */
+	size_t skip;
+
+	/* Number of bytes left in the SequenceOf88 or SequenceOf86 that is currently received */
+	size_t seq_remain;
+
+	/* transactionId the ESipa message must contain (optional, see ipa_bpp_segments_stream_expect_transaction_id) */
+	struct ipa_buf *transaction_id;
+
+	size_t count;
+	ipa_bpp_segment_cb segment_cb;
+	void *priv;
+};
+
+/* Parse tag and length of a BER-TLV, returns the length of the header, 0 when more data is required or -EINVAL when
+ * the header is not valid (indefinite length is not permitted, tags longer than two bytes are not used in a BPP). */
+static int parse_tlv_hdr(uint16_t *tag, size_t *len, const uint8_t *data, size_t data_len)
+{
+	size_t hdr_len = 0;
+	size_t len_len;
+
+	if (data_len < 1)
+		return 0;
+	*tag = data[hdr_len++];
+	if ((*tag & 0x1f) == 0x1f) {
+		if (data_len < 2)
+			return 0;
+		if (data[1] & 0x80)
+			return -EINVAL;
+		*tag = (*tag << 8) | data[hdr_len++];
+	}
+
+	if (data_len < hdr_len + 1)
+		return 0;
+	if (!(data[hdr_len] & 0x80)) {
+		*len = data[hdr_len++];
+		return hdr_len;
+	}
+
+	len_len = data[hdr_len++] & 0x7f;
+	if (len_len < 1 || len_len > 4)
+		return -EINVAL;
+	if (data_len < hdr_len + len_len)
+		return 0;
+	*len = 0;
+	for (; len_len > 0; len_len--)
+		*len = (*len << 8) | data[hdr_len++];
+
+	return hdr_len;
+}
+
+/* Make sure that a segment (or any other TLV that has to be buffered completely) does not exceed the largest legal
+ * ES8+ segment, so that the stream buffer cannot grow without limit. The length field is checked on its own first, it
+ * may be up to 4 bytes long, so adding the header length to it could overflow. */
+static int check_segment_len(uint16_t tag, size_t hdr_len, size_t len)
+{
+	if (len > IPA_LEN_BPP_SEGMENT_MAX || hdr_len + len > IPA_LEN_BPP_SEGMENT_MAX) {
+		IPA_LOGP(SIPA, LERROR, "cannot parse BoundProfilePackage stream, '%02X' TLV too large (%zu bytes)!\n", tag,
+			 len);
+		return -EINVAL;
+	}
+	return 0;
+}
+
+/* Pass the parsed bytes on as one segment */
+static int stream_emit(struct ipa_bpp_segments_stream *stream)
+{
+	int rc;
+
+	IPA_LOGP(SIPA, LDEBUG, "streaming ES8+ segment %zu (%zu bytes)\n", stream->count, stream->parsed);
+	rc = stream->segment_cb(stream->buf->data, stream->parsed, stream->priv);
+
+	memmove(stream->buf->data, stream->buf->data + stream->parsed, stream->buf->len - stream->parsed);
+	stream->buf->len -= stream->parsed;
+	stream->parsed = 0;
+	stream->count++;
+
+	return rc < 0 ? rc : 1;
+}
+
+/* Parse the next element, returns 1 when progress was made, 0 when more data is required, negative on error */
+static int stream_step(struct ipa_bpp_segments_stream *stream)
+{
+	uint8_t *data = stream->buf->data + stream->parsed;
+	size_t data_len = stream->buf->len - stream->parsed;
+	uint16_t tag;
+	size_t len;
+	uint16_t inner_tag;
+	size_t inner_len;
+	int hdr_len;
+	int inner_hdr_len;
+
+	switch (stream->state) {
+	case BPP_STREAM_EACH_OF_88:
+	case BPP_STREAM_EACH_OF_86:
+		if (stream->seq_remain == 0) {
+			stream->state =
+			    stream->state == BPP_STREAM_EACH_OF_88 ? BPP_STREAM_SECOND_SEQ_OF_87 : BPP_STREAM_DONE;
+			return 1;
+		}
+		break;
+	case BPP_STREAM_DONE:
+		/* Whatever follows the BoundProfilePackage is of no interest */
+		stream->buf->len = 0;
+		return 0;
+	default:
+		break;
+	}
+
+	hdr_len = parse_tlv_hdr(&tag, &len, data, data_len);
+	if (hdr_len <= 0)
+		goto hdr_error;
+
+	switch (stream->state) {
+	case BPP_STREAM_ENVELOPE:
+		if (tag == 0xBF36) {
+			/* The ESipa message envelope is not needed anymore, the tag and length fields of the
+			 * BoundProfilePackage TLV are the beginning of the first segment. */
+			memmove(stream->buf->data, data, data_len);
+			stream->buf->len = data_len;
+			stream->parsed = hdr_len;
+			stream->state = BPP_STREAM_INIT_SEC_CHAN_REQ;
+			return 1;
+		}
+
+		/* Descend into constructed TLVs, step over primitive TLVs (e.g. transactionId) */
+		if ((tag > 0xff ? tag >> 8 : tag) & 0x20) {
+			stream->parsed += hdr_len;
+			return 1;
+		}
+		if (check_segment_len(tag, hdr_len, len) < 0)
+			return -EINVAL;
+		if (data_len < hdr_len + len)
+			return 0;
+
+		/* The transactionId precedes the BoundProfilePackage, so it is checked before the first segment is
+		 * passed on (see also GetBoundProfilePackageOkEsipa) */
+		if (tag == 0x80 && stream->transaction_id
+		    && (len != stream->transaction_id->len
+			|| memcmp(data + hdr_len, stream->transaction_id->data, len) != 0)) {
+			IPA_LOGP(SIPA, LERROR, "eIM responded with unexpected transaction ID (expected: %s, got: %s)\n",
+				 ipa_buf_hexdump(stream->transaction_id), ipa_hexdump(data + hdr_len, len));
+			return -EINVAL;
+		}
+
+		stream->parsed += hdr_len + len;
+		return 1;
+	case BPP_STREAM_INIT_SEC_CHAN_REQ:
+		if (tag != 0xBF23)
+			goto tag_error;
+		if (check_segment_len(tag, hdr_len, len) < 0)
+			return -EINVAL;
+		if (data_len < hdr_len + len)
+			return 0;
+		stream->parsed += hdr_len + len;
+		stream->state = BPP_STREAM_FIRST_SEQ_OF_87;
+		return stream_emit(stream);
+	case BPP_STREAM_SECOND_SEQ_OF_87:
+		/* Optional */
+		if (tag == 0xA3) {
+			stream->state = BPP_STREAM_SEQ_OF_86;
+			return 1;
+		}
+		/* fall through */
+	case BPP_STREAM_FIRST_SEQ_OF_87:
+		if (tag != (stream->state == BPP_STREAM_FIRST_SEQ_OF_87 ? 0xA0 : 0xA2))
+			goto tag_error;
+
+		/* Tag and length fields of the sequence plus the first '87' TLV */
+		inner_hdr_len = parse_tlv_hdr(&inner_tag, &inner_len, data + hdr_len, data_len - hdr_len);
+		if (inner_hdr_len <= 0) {
+			hdr_len = inner_hdr_len;
+			goto hdr_error;
+		}
+		if (inner_tag != 0x87)
+			goto tag_error;
+		if (check_segment_len(inner_tag, hdr_len + inner_hdr_len, inner_len) < 0)
+			return -EINVAL;
+		if (inner_hdr_len + inner_len > len) {
+			IPA_LOGP(SIPA, LERROR, "'87' TLV exceeds its sequence!\n");
+			return -EINVAL;
+		}
+		if (data_len < hdr_len + inner_hdr_len + inner_len)
+			return 0;
+		stream->parsed += hdr_len + inner_hdr_len + inner_len;
+
+		/* The spec explicitly states "first '87' TLV", excess items are discarded */
+		stream->skip = len - (inner_hdr_len + inner_len);
+		if (stream->skip)
+			IPA_LOGP(SIPA, LDEBUG, "ignoring excess items in sequence of '87' TLVs!\n");
+
+		stream->state = stream->state == BPP_STREAM_FIRST_SEQ_OF_87 ? BPP_STREAM_SEQ_OF_88 : BPP_STREAM_SEQ_OF_86;
+		return stream_emit(stream);
+	case BPP_STREAM_SEQ_OF_88:
+	case BPP_STREAM_SEQ_OF_86:
+		if (tag != (stream->state == BPP_STREAM_SEQ_OF_88 ? 0xA1 : 0xA3))
+			goto tag_error;
+		stream->parsed += hdr_len;
+		stream->seq_remain = len;
+		stream->state = stream->state == BPP_STREAM_SEQ_OF_88 ? BPP_STREAM_EACH_OF_88 : BPP_STREAM_EACH_OF_86;
+		return stream_emit(stream);
+	case BPP_STREAM_EACH_OF_88:
+	case BPP_STREAM_EACH_OF_86:
+		if (tag != (stream->state == BPP_STREAM_EACH_OF_88 ? 0x88 : 0x86))
+			goto tag_error;
+		if (check_segment_len(tag, hdr_len, len) < 0)
+			return -EINVAL;
+		if (hdr_len + len > stream->seq_remain) {
+			IPA_LOGP(SIPA, LERROR, "'%02X' TLV exceeds its sequence!\n", tag);
+			return -EINVAL;
+		}
+		if (data_len < hdr_len + len)
+			return 0;
+		stream->parsed += hdr_len + len;
+		stream->seq_remain -= hdr_len + len;
+		return stream_emit(stream);
+	default:
+		assert(false);
+	}
+
+hdr_error:
+	if (hdr_len < 0)
+		IPA_LOGP(SIPA, LERROR, "cannot parse BoundProfilePackage stream, invalid TLV header!\n");
+	return hdr_len;
+tag_error:
+	IPA_LOGP(SIPA, LERROR, "cannot parse BoundProfilePackage stream, unexpected tag %04X!\n", tag);
+	return -EINVAL;
+}
+
+/*! Allocate a stream parser that splits an encoded BoundProfilePackage into ES8+ segments while it is received.
+ *  \param[in] segment_cb callback function that receives the segments.
+ *  \param[in] priv private data pointer that is passed to the callback function.
+ *  \returns pointer to newly allocated stream parser. */
+struct ipa_bpp_segments_stream *ipa_bpp_segments_stream_alloc(ipa_bpp_segment_cb segment_cb, void *priv)
+{
+	struct ipa_bpp_segments_stream *stream = IPA_ALLOC_ZERO(struct ipa_bpp_segments_stream);
+
+	assert(stream);
+	stream->buf = ipa_buf_alloc(IPA_LEN_BPP_STREAM_BUF);
+	assert(stream->buf);
+	stream->segment_cb = segment_cb;
+	stream->priv = priv;
+
+	return stream;
+}
+
+/*! Set the transactionId that the received ESipa message must contain. When the message contains a different
+ *  transactionId, the stream is rejected before any segment is passed to the callback function.
+ *  \param[inout] stream pointer to stream parser.
+ *  \param[in] transaction_id pointer to the expected transactionId.
+ *  \param[in] len length of the expected transactionId. */
+void ipa_bpp_segments_stream_expect_transaction_id(struct ipa_bpp_segments_stream *stream,
+						   const uint8_t *transaction_id, size_t len)
+{
+	IPA_FREE(stream->transaction_id);
+	stream->transaction_id = ipa_buf_alloc_and_cpy(transaction_id, len);
+	assert(stream->transaction_id);
+}
+
+/*! Feed a chunk of an encoded ESipa message that contains a BoundProfilePackage into the stream parser. The chunk
+ *  may have any length, each ES8+ segment is passed to the callback function as soon as it is complete.
+ *  \param[inout] stream pointer to stream parser.
+ *  \param[in] data pointer to the received chunk.
+ *  \param[in] len length of the received chunk.
+ *  \returns 0 on success, negative on failure (also when the callback function fails). */
+int ipa_bpp_segments_stream_feed(struct ipa_bpp_segments_stream *stream, const uint8_t *data, size_t len)
+{
+	size_t skip;
+	int rc;
+
+	/* Discard excess items without buffering them */
+	skip = stream->skip < len ? stream->skip : len;
+	stream->skip -= skip;
+	data += skip;
+	len -= skip;
+
+	if (stream->buf->len + len > stream->buf->data_len) {
+		stream->buf = ipa_buf_realloc(stream->buf, stream->buf->len + len);
+		assert(stream->buf);
+	}
+	memcpy(stream->buf->data + stream->buf->len, data, len);
+	stream->buf->len += len;
+
+	do {
+		rc = stream_step(stream);
+
+		/* Excess items may also be contained in the chunk that was just received */
+		if (rc > 0 && stream->skip) {
+			skip = stream->skip < stream->buf->len ? stream->skip : stream->buf->len;
+			memmove(stream->buf->data, stream->buf->data + skip, stream->buf->len - skip);
+			stream->buf->len -= skip;
+			stream->skip -= skip;
+		}
+	} while (rc > 0);
+
+	return rc;
+}
+
+/*! Check whether the stream parser has received a complete BoundProfilePackage.
+ *  \param[in] stream pointer to stream parser.
+ *  \returns true when all ES8+ segments have been passed to the callback function. */
+bool ipa_bpp_segments_stream_complete(const struct ipa_bpp_segments_stream *stream)
+{
+	return stream->state == BPP_STREAM_DONE;
+}
+
+/*! Get the received message in case it did not contain a BoundProfilePackage (e.g. an error response).
+ *  \param[in] stream pointer to stream parser.
+ *  \returns buffer with the received message, NULL when a BoundProfilePackage was found. */
+const struct ipa_buf *ipa_bpp_segments_stream_envelope(const struct ipa_bpp_segments_stream *stream)
+{
+	if (stream->state != BPP_STREAM_ENVELOPE)
+		return NULL;
+	return stream->buf;
+}
+
+/*! Get the number of ES8+ segments that were passed to the callback function so far.
+ *  \param[in] stream pointer to stream parser.
+ *  \returns number of segments. */
+size_t ipa_bpp_segments_stream_count(const struct ipa_bpp_segments_stream *stream)
+{
+	return stream->count;
+}
+
+/*! Free a stream parser.
+ *  \param[in] stream pointer to stream parser. */
+void ipa_bpp_segments_stream_free(struct ipa_bpp_segments_stream *stream)
+{
+	if (!stream)
+		return;
+	IPA_FREE(stream->transaction_id);
+	IPA_FREE(stream->buf);
+	IPA_FREE(stream);
+}
+
+/* When the encoded BoundProfilePackage is available as a whole, the ES8+ segments do not have to be re-encoded from
+ * the decoded BoundProfilePackage. The segments are referenced as byte ranges of the encoded BoundProfilePackage
+ * instead, no data is copied. */
+
+static void slice_add(struct ipa_bpp_slices *slices, size_t offset, size_t len)
+{
+	if (slices->count >= slices->slice_alloc) {
+		slices->slice_alloc = slices->slice_alloc ? slices->slice_alloc * 2 : 16;
+		slices->slice = IPA_REALLOC(slices->slice, sizeof(*slices->slice) * slices->slice_alloc);
+		assert(slices->slice);
+	}
+
+	IPA_LOGP(SIPA, LDEBUG, "slicing ES8+ segment %zu (offset %zu, %zu bytes)\n", slices->count, offset, len);
+	slices->slice[slices->count].offset = offset;
+	slices->slice[slices->count].len = len;
+	slices->count++;
+}
+
+/* Parse the header of the TLV at pos and make sure that the TLV does not exceed end, returns the length of the
+ * header or -EINVAL when the TLV is not valid or has an unexpected tag. */
+static int slice_tlv(const uint8_t *data, size_t pos, size_t end, uint16_t expected_tag, size_t *len)
+{
+	uint16_t tag;
+	int hdr_len;
+
+	hdr_len = parse_tlv_hdr(&tag, len, data + pos, end - pos);
+	if (hdr_len <= 0 || *len > end - pos - hdr_len) {
+		IPA_LOGP(SIPA, LERROR, "cannot slice BoundProfilePackage, invalid or truncated TLV at offset %zu!\n",
+			 pos);
+		return -EINVAL;
+	}
+	if (tag != expected_tag) {
+		IPA_LOGP(SIPA, LERROR, "cannot slice BoundProfilePackage, unexpected tag %04X at offset %zu!\n", tag,
+			 pos);
+		return -EINVAL;
+	}
+
+	return hdr_len;
+}
+
+/* Tag and length fields of a sequence of '87' TLVs plus the first '87' TLV (see bullet points 2 and 5) */
+static int slice_seq_of_87(struct ipa_bpp_slices *slices, const uint8_t *data, size_t *pos, size_t end,
+			   uint16_t tag)
+{
+	size_t len;
+	size_t inner_len;
+	int hdr_len;
+	int inner_hdr_len;
+
+	hdr_len = slice_tlv(data, *pos, end, tag, &len);
+	if (hdr_len < 0)
+		return hdr_len;
+	inner_hdr_len = slice_tlv(data, *pos + hdr_len, *pos + hdr_len + len, 0x87, &inner_len);
+	if (inner_hdr_len < 0)
+		return inner_hdr_len;
+
+	/* The spec explicitly states "first '87' TLV", excess items are not part of the segment */
+	if (inner_hdr_len + inner_len < len)
+		IPA_LOGP(SIPA, LDEBUG, "ignoring excess items in sequence of '87' TLVs!\n");
+
+	slice_add(slices, *pos, hdr_len + inner_hdr_len + inner_len);
+	*pos += hdr_len + len;
+	return 0;
+}
+
+/* Tag and length fields of a sequence of '88' or '86' TLVs plus each of the TLVs (see bullet points 3, 4, 6 and 7) */
+static int slice_seq(struct ipa_bpp_slices *slices, const uint8_t *data, size_t *pos, size_t end, uint16_t tag,
+		     uint16_t item_tag)
+{
+	size_t len;
+	size_t seq_end;
+	int hdr_len;
+
+	hdr_len = slice_tlv(data, *pos, end, tag, &len);
+	if (hdr_len < 0)
+		return hdr_len;
+	slice_add(slices, *pos, hdr_len);
+	*pos += hdr_len;
+
+	for (seq_end = *pos + len; *pos < seq_end; *pos += hdr_len + len) {
+		hdr_len = slice_tlv(data, *pos, seq_end, item_tag, &len);
+		if (hdr_len < 0)
+			return hdr_len;
+		slice_add(slices, *pos, hdr_len + len);
+	}
+
+	return 0;
+}
+
+/*! Split an encoded BoundProfilePackage into ES8+ segments without copying or re-encoding it.
+ *  \param[in] data pointer to the encoded BoundProfilePackage, may also be an encoded ESipa message that contains
+ *                  the BoundProfilePackage (must stay valid as long as the slices are used).
+ *  \param[in] len length of the encoded data.
+ *  \returns pointer to newly allocated slices, NULL on failure. */
+struct ipa_bpp_slices *ipa_bpp_segments_slice(const uint8_t *data, size_t len)
+{
+	struct ipa_bpp_slices *slices = IPA_ALLOC_ZERO(struct ipa_bpp_slices);
+	uint16_t tag;
+	size_t tlv_len;
+	size_t pos = 0;
+	size_t end;
+	int hdr_len;
+	int inner_hdr_len;
+
+	slices->data = data;
+
+	/* Find the BoundProfilePackage, descend into constructed TLVs and step over primitive TLVs of the ESipa
+	 * message envelope (same as BPP_STREAM_ENVELOPE above) */
+	while (1) {
+		hdr_len = parse_tlv_hdr(&tag, &tlv_len, data + pos, len - pos);
+		if (hdr_len <= 0 || tlv_len > len - pos - hdr_len) {
+			IPA_LOGP(SIPA, LERROR,
+				 "cannot slice BoundProfilePackage, no complete BoundProfilePackage found!\n");
+			goto error;
+		}
+		if (tag == 0xBF36)
+			break;
+		if ((tag > 0xff ? tag >> 8 : tag) & 0x20)
+			pos += hdr_len;
+		else
+			pos += hdr_len + tlv_len;
+	}
+	end = pos + hdr_len + tlv_len;
+
+	/* Tag and length fields of the BoundProfilePackage TLV plus the initialiseSecureChannelRequest TLV */
+	inner_hdr_len = slice_tlv(data, pos + hdr_len, end, 0xBF23, &tlv_len);
+	if (inner_hdr_len < 0)
+		goto error;
+	slice_add(slices, pos, hdr_len + inner_hdr_len + tlv_len);
+	pos += hdr_len + inner_hdr_len + tlv_len;
+
+	if (slice_seq_of_87(slices, data, &pos, end, 0xA0) < 0)
+		goto error;
+	if (slice_seq(slices, data, &pos, end, 0xA1, 0x88) < 0)
+		goto error;
+
+	/* Optional */
+	if (pos < end && data[pos] == 0xA2) {
+		if (slice_seq_of_87(slices, data, &pos, end, 0xA2) < 0)
+			goto error;
+	}
+
+	if (slice_seq(slices, data, &pos, end, 0xA3, 0x86) < 0)
+		goto error;
+
+	return slices;
+error:
+	ipa_bpp_slices_free(slices);
+	return NULL;
+}
+
+/*! Free slices of a BoundProfilePackage (the encoded BoundProfilePackage itself is not freed).
+ *  \param[in] slices pointer to slices. */
+void ipa_bpp_slices_free(struct ipa_bpp_slices *slices)
+{
+	if (!slices)
+		return;
+	IPA_FREE(slices->slice);
+	IPA_FREE(slices);
+}
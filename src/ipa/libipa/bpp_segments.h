@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdint.h>
+#include <stdbool.h>
 #include <onomondo/ipa/utils.h>
 #include <BoundProfilePackage.h>
 
@@ -10,3 +12,38 @@ struct ipa_bpp_segments {
 
 struct ipa_bpp_segments *ipa_bpp_segments_encode(const struct BoundProfilePackage *bpp);
 void ipa_bpp_segments_free(struct ipa_bpp_segments *segments);
+
+/*! One ES8+ segment, referenced as byte range of the encoded BoundProfilePackage (see ipa_bpp_segments_slice) */
+struct ipa_bpp_slice {
+	size_t offset;
+	size_t len;
+};
+
+struct ipa_bpp_slices {
+	/*! Encoded data the slices refer to (not owned) */
+	const uint8_t *data;
+	struct ipa_bpp_slice *slice;
+	size_t count;
+	size_t slice_alloc;
+};
+
+struct ipa_bpp_slices *ipa_bpp_segments_slice(const uint8_t *data, size_t len);
+void ipa_bpp_slices_free(struct ipa_bpp_slices *slices);
+
+/*! Callback that receives the ES8+ segments of a BoundProfilePackage one by one (see ipa_bpp_segments_stream_feed).
+ *  \param[in] data pointer to the encoded segment.
+ *  \param[in] len length of the encoded segment.
+ *  \param[in] priv private data pointer that was passed to ipa_bpp_segments_stream_alloc.
+ *  \returns 0 on success, negative to abort. */
+typedef int (*ipa_bpp_segment_cb)(const uint8_t *data, size_t len, void *priv);
+
+struct ipa_bpp_segments_stream;
+
+struct ipa_bpp_segments_stream *ipa_bpp_segments_stream_alloc(ipa_bpp_segment_cb segment_cb, void *priv);
+void ipa_bpp_segments_stream_expect_transaction_id(struct ipa_bpp_segments_stream *stream,
+						   const uint8_t *transaction_id, size_t len);
+int ipa_bpp_segments_stream_feed(struct ipa_bpp_segments_stream *stream, const uint8_t *data, size_t len);
+bool ipa_bpp_segments_stream_complete(const struct ipa_bpp_segments_stream *stream);
+const struct ipa_buf *ipa_bpp_segments_stream_envelope(const struct ipa_bpp_segments_stream *stream);
+size_t ipa_bpp_segments_stream_count(const struct ipa_bpp_segments_stream *stream);
+void ipa_bpp_segments_stream_free(struct ipa_bpp_segments_stream *stream);
@@ -4,7 +4,7 @@
 #include <onomondo/ipa/ipad.h>
 #include <onomondo/ipa/utils.h>
 
-#define IPA_NVSTATE_VERSION 3
+#define IPA_NVSTATE_VERSION 5
 
 /* Non volatile state: All struct members in this struct are automatically backed up to a non volatile memory location.
  * (see below). However, this only covers statically allocated struct members. When struct members contain a pointer
@@ -29,6 +29,20 @@ struct ipa_nvstate {
 		} auto_enable;
 	} iot_euicc_emu;
 
+	/*! cached eUICC identity to speed up ipa_init (see also ipa_config.euicc_warm_start) */
+	struct {
+		/*! set when ATR and EID were both cached successfully */
+		bool valid;
+		uint8_t atr[IPA_LEN_ATR];
+		uint8_t atr_len;
+		uint8_t eid[IPA_LEN_EID];
+	} warm_start;
+
+	/*! TLS session of the last connection towards the eIM, used to resume the TLS session after a restart
+	 *  (serialized by the HTTP client, see also ipa_http_export_session). The field is part of the nvstate layout
+	 *  regardless of the build, it just stays empty when the HTTP client cannot export TLS sessions. */
+	struct ipa_buf *tls_session;
+
 } __attribute__((packed));
 
 /*! Context for one IPAd instance. */
@@ -42,6 +56,25 @@ struct ipa_context {
 	/*! sub-context of the smartcard connection towards the eUICC, */
 	void *scard_ctx;
 
+	/*! parameters of the APDU transport towards the eUICC (negotiated when ipa_init is called) */
+	struct {
+		/*! use extended length APDUs to transfer ES10x requests and responses. */
+		bool ext_apdu;
+		/*! send requests that expect response data as case 4 APDUs (T=1 only, no GET RESPONSE needed). */
+		bool case4;
+		/*! preallocated frames to build request APDU headers/trailers in place and to receive response APDUs. */
+		struct ipa_buf *tx_frame;
+		struct ipa_buf *rx_frame;
+		/*! number of times the response buffer had to be reallocated during the last ES10x call. */
+		unsigned int res_reallocs;
+		/*! nesting depth of ipa_euicc_begin_transaction/ipa_euicc_end_transaction calls. */
+		unsigned int transaction_depth;
+		/*! true when the smartcard backend granted exclusive access to the eUICC. */
+		bool transaction_held;
+		/*! true when the eUICC presented the ATR that is cached in the nvstate (warm start). */
+		bool warm_start;
+	} euicc;
+
 	/*! cached eID (read from eUICC when ipa_init is called) */
 	uint8_t eid[IPA_LEN_EID];
 
@@ -66,10 +99,40 @@ struct ipa_context {
 	/*! cached eIM address (read from eUICC when ipa_init is called) */
 	char *eim_fqdn;
 
+	/*! cached eIM URL (computed from eim_fqdn on first use, see ipa_esipa_get_eim_url) */
+	char *eim_url;
+
 	/*! cached state of generic eUICC package download and execute procedure
 	 *  (used from proc_euicc_pkg_dwnld_exec.c, proc_eim_pkg_retr.c and ipad.c) */
 	struct ipa_proc_eucc_pkg_dwnld_exec_res *proc_eucc_pkg_dwnld_exec_res;
 
+	/*! eIM package that is waiting for its execution. This is either an eIM package whose execution was interrupted
+	 *  by an ESipa request that is going to be retried (the execution is repeated when the retry is due) or an eIM
+	 *  package that the eIM has injected (see proc_eim_pkg_inj.c). The execution takes place in the next poll
+	 *  cycle (used from proc_eim_pkg_retr.c) */
+	struct ipa_esipa_get_eim_pkg_res *eim_pkg_pending;
+
+	/*! state of the ESipa retry scheduler (see esipa.c) */
+	struct {
+		/*! name of the ESipa function that is going to be retried (NULL when no retry is scheduled) */
+		const char *function_name;
+		/*! number of retries that were scheduled since the last successful request */
+		unsigned int count;
+		/*! point in time (monotonic clock, milliseconds) at which the ESipa function may be retried */
+		uint64_t deadline;
+		/*! state of the random number generator that is used to compute the jitter */
+		unsigned int seed;
+	} esipa_retry;
+
+	/*! eUICC data that the eIM has already received, so that it can be left out of the compact ESipa messages
+	 *  (see also ipa_config.esipa_minimize_bytes) */
+	struct {
+		/*! euiccInfo1 was delivered (IpaEuiccDataRequest) */
+		bool euicc_info_1;
+		/*! eUICC and EUM certificates were delivered (IpaEuiccDataRequest or AuthenticateClient) */
+		bool certs;
+	} eim_knows;
+
 	/*! Non volatile storage: Everything stored in this struct is loaded by the API user from a non volatile memory
 	 *  location on startup (ipa_new_ctx) and stored to a non volatile location on exit (ipa_free_ctx). */
 	struct ipa_nvstate nvstate;
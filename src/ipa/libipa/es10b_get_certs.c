@@ -24,11 +24,12 @@ static const struct num_str_map error_code_strings[] = {
 	{ 0, NULL }
 };
 
-static int dec_get_certs_res(struct ipa_es10b_get_certs_res *res, const struct ipa_buf *es10b_res)
+static int dec_get_certs_res(struct ipa_context *ctx, struct ipa_es10b_get_certs_res *res,
+			     const struct ipa_buf *es10b_req)
 {
 	struct GetCertsResponse *asn = NULL;
 
-	asn = ipa_es10x_res_dec(&asn_DEF_GetCertsResponse, es10b_res, "GetCerts");
+	asn = ipa_es10x_transceive_res_dec(ctx, &asn_DEF_GetCertsResponse, es10b_req, "GetCerts");
 	if (!asn)
 		return -EINVAL;
 
@@ -59,7 +60,6 @@ static int dec_get_certs_res(struct ipa_es10b_get_certs_res *res, const struct i
 struct ipa_es10b_get_certs_res *ipa_es10b_get_certs(struct ipa_context *ctx, const struct ipa_es10b_get_certs_req *req)
 {
 	struct ipa_buf *es10b_req = NULL;
-	struct ipa_buf *es10b_res = NULL;
 	struct ipa_es10b_get_certs_res *res = IPA_ALLOC_ZERO(struct ipa_es10b_get_certs_res);
 	int rc;
 
@@ -69,22 +69,15 @@ struct ipa_es10b_get_certs_res *ipa_es10b_get_certs(struct ipa_context *ctx, con
 		goto error;
 	}
 
-	es10b_res = ipa_euicc_transceive_es10x(ctx, es10b_req);
-	if (!es10b_res) {
-		IPA_LOGP_ES10X("GetCerts", LERROR, "no ES10b response\n");
-		goto error;
-	}
-
-	rc = dec_get_certs_res(res, es10b_res);
+	/* The response contains two certificates, which is quite large, so we decode it while it is received */
+	rc = dec_get_certs_res(ctx, res, es10b_req);
 	if (rc < 0)
 		goto error;
 
 	IPA_FREE(es10b_req);
-	IPA_FREE(es10b_res);
 	return res;
 error:
 	IPA_FREE(es10b_req);
-	IPA_FREE(es10b_res);
 	ipa_es10b_get_certs_res_free(res);
 	return NULL;
 }
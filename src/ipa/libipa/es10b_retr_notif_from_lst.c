@@ -83,11 +83,13 @@ static const struct num_str_map error_code_strings_sgp32[] = {
 	{ 0, NULL }
 };
 
-static int dec_retr_notif_from_lst_res(struct ipa_es10b_retr_notif_from_lst_res *res, const struct ipa_buf *es10b_res)
+static int dec_retr_notif_from_lst_res(struct ipa_context *ctx, struct ipa_es10b_retr_notif_from_lst_res *res,
+				       const struct ipa_buf *es10b_req)
 {
 	struct RetrieveNotificationsListResponse *asn = NULL;
 
-	asn = ipa_es10x_res_dec(&asn_DEF_RetrieveNotificationsListResponse, es10b_res, "RetrieveNotificationsList");
+	asn = ipa_es10x_transceive_res_dec(ctx, &asn_DEF_RetrieveNotificationsListResponse, es10b_req,
+					   "RetrieveNotificationsList");
 	if (!asn)
 		return -EINVAL;
 
@@ -116,13 +118,13 @@ static int dec_retr_notif_from_lst_res(struct ipa_es10b_retr_notif_from_lst_res
 	return 0;
 }
 
-static int dec_retr_notif_from_lst_res_sgp32(struct ipa_es10b_retr_notif_from_lst_res *res,
-					     const struct ipa_buf *es10b_res)
+static int dec_retr_notif_from_lst_res_sgp32(struct ipa_context *ctx, struct ipa_es10b_retr_notif_from_lst_res *res,
+					     const struct ipa_buf *es10b_req)
 {
 	struct SGP32_RetrieveNotificationsListResponse *asn = NULL;
 
-	asn =
-	    ipa_es10x_res_dec(&asn_DEF_SGP32_RetrieveNotificationsListResponse, es10b_res, "RetrieveNotificationsList");
+	asn = ipa_es10x_transceive_res_dec(ctx, &asn_DEF_SGP32_RetrieveNotificationsListResponse, es10b_req,
+					   "RetrieveNotificationsList");
 	if (!asn)
 		return -EINVAL;
 
@@ -258,7 +260,6 @@ struct ipa_es10b_retr_notif_from_lst_res *ipa_es10b_retr_notif_from_lst(struct i
 									*req)
 {
 	struct ipa_buf *es10b_req = NULL;
-	struct ipa_buf *es10b_res = NULL;
 	struct ipa_es10b_retr_notif_from_lst_res *res = IPA_ALLOC_ZERO(struct ipa_es10b_retr_notif_from_lst_res);
 	int rc;
 
@@ -271,28 +272,21 @@ struct ipa_es10b_retr_notif_from_lst_res *ipa_es10b_retr_notif_from_lst(struct i
 		goto error;
 	}
 
-	es10b_res = ipa_euicc_transceive_es10x(ctx, es10b_req);
-	if (!es10b_res) {
-		IPA_LOGP_ES10X("RetrieveNotificationsList", LERROR, "no ES10b response\n");
-		goto error;
-	}
-
+	/* The notification list may become quite large, so we decode it while it is received */
 	if (ctx->cfg->iot_euicc_emu_enabled) {
 		IPA_LOGP_ES10X("RetrieveNotificationsList", LINFO,
 			       "IoT eUICC emulation active, will derive notificationList from (SGP.22) RetrieveNotificationsListResponse.\n");
-		rc = dec_retr_notif_from_lst_res(res, es10b_res);
+		rc = dec_retr_notif_from_lst_res(ctx, res, es10b_req);
 	} else {
-		rc = dec_retr_notif_from_lst_res_sgp32(res, es10b_res);
+		rc = dec_retr_notif_from_lst_res_sgp32(ctx, res, es10b_req);
 	}
 	if (rc < 0)
 		goto error;
 
 	IPA_FREE(es10b_req);
-	IPA_FREE(es10b_res);
 	return res;
 error:
 	IPA_FREE(es10b_req);
-	IPA_FREE(es10b_res);
 	ipa_es10b_retr_notif_from_lst_res_free(res);
 	return NULL;
 }
@@ -71,11 +71,12 @@ static struct SGP32_ProfileInfoListResponse *convert_res_to_sgp32(struct Profile
 	return sgp32_res;
 }
 
-static int dec_get_prfle_info_res(struct ipa_es10c_get_prfle_info_res *res, const struct ipa_buf *es10c_res)
+static int dec_get_prfle_info_res(struct ipa_context *ctx, struct ipa_es10c_get_prfle_info_res *res,
+				  const struct ipa_buf *es10c_req)
 {
 	struct ProfileInfoListResponse *asn = NULL;
 
-	asn = ipa_es10x_res_dec(&asn_DEF_ProfileInfoListResponse, es10c_res, "GetProfilesInfo");
+	asn = ipa_es10x_transceive_res_dec(ctx, &asn_DEF_ProfileInfoListResponse, es10c_req, "GetProfilesInfo");
 	if (!asn)
 		return -EINVAL;
 
@@ -99,11 +100,12 @@ static int dec_get_prfle_info_res(struct ipa_es10c_get_prfle_info_res *res, cons
 	return 0;
 }
 
-static int dec_get_prfle_info_res_sgp32(struct ipa_es10c_get_prfle_info_res *res, const struct ipa_buf *es10c_res)
+static int dec_get_prfle_info_res_sgp32(struct ipa_context *ctx, struct ipa_es10c_get_prfle_info_res *res,
+					const struct ipa_buf *es10c_req)
 {
 	struct SGP32_ProfileInfoListResponse *asn = NULL;
 
-	asn = ipa_es10x_res_dec(&asn_DEF_SGP32_ProfileInfoListResponse, es10c_res, "GetProfilesInfo");
+	asn = ipa_es10x_transceive_res_dec(ctx, &asn_DEF_SGP32_ProfileInfoListResponse, es10c_req, "GetProfilesInfo");
 	if (!asn)
 		return -EINVAL;
 
@@ -155,7 +157,6 @@ struct ipa_es10c_get_prfle_info_res *ipa_es10c_get_prfle_info(struct ipa_context
 							      const struct ipa_es10c_get_prfle_info_req *req)
 {
 	struct ipa_buf *es10c_req = NULL;
-	struct ipa_buf *es10c_res = NULL;
 	struct ipa_es10c_get_prfle_info_res *res = IPA_ALLOC_ZERO(struct ipa_es10c_get_prfle_info_res);
 	int rc;
 	const struct ipa_es10c_get_prfle_info_req req_all = { 0 };
@@ -169,18 +170,13 @@ struct ipa_es10c_get_prfle_info_res *ipa_es10c_get_prfle_info(struct ipa_context
 		goto error;
 	}
 
-	es10c_res = ipa_euicc_transceive_es10x(ctx, es10c_req);
-	if (!es10c_res) {
-		IPA_LOGP_ES10X("GetProfilesInfo", LERROR, "no Es10c response\n");
-		goto error;
-	}
-
+	/* The profile info list may become quite large, so we decode it while it is received */
 	if (ctx->cfg->iot_euicc_emu_enabled) {
 		IPA_LOGP_ES10X("GetProfilesInfo", LINFO,
 			       "IoT eUICC emulation active, will derive SGP32_ProfileInfoListResponse from (SGP.22) ProfileInfoListResponse.\n");
-		rc = dec_get_prfle_info_res(res, es10c_res);
+		rc = dec_get_prfle_info_res(ctx, res, es10c_req);
 	} else {
-		rc = dec_get_prfle_info_res_sgp32(res, es10c_res);
+		rc = dec_get_prfle_info_res_sgp32(ctx, res, es10c_req);
 	}
 	if (rc < 0)
 		goto error;
@@ -188,11 +184,9 @@ struct ipa_es10c_get_prfle_info_res *ipa_es10c_get_prfle_info(struct ipa_context
 	find_currently_active_prfle(res);
 
 	IPA_FREE(es10c_req);
-	IPA_FREE(es10c_res);
 	return res;
 error:
 	IPA_FREE(es10c_req);
-	IPA_FREE(es10c_res);
 	ipa_es10c_get_prfle_info_res_free(res);
 	return NULL;
 }
@@ -9,9 +9,11 @@
 #include <onomondo/ipa/ipad.h>
 #include <onomondo/ipa/log.h>
 #include <asn_application.h>
+#include <asn_arena.h>
 #include "es10x.h"
 #include "context.h"
 #include "utils.h"
+#include "euicc.h"
 
 /*! Decode an ASN.1 encoded eUICC response.
  *  \param[in] td pointer to asn_TYPE_descriptor.
@@ -23,13 +25,17 @@ void *ipa_es10x_res_dec(const struct asn_TYPE_descriptor_s *td, const struct ipa
 {
 	asn_dec_rval_t rc;
 	void *es10x_res_decoded = NULL;
+	struct asn_arena *arena;
 
 	assert(es10x_res_encoded);
 
 	IPA_LOGP_ES10X(function_name, LDEBUG, "ES10x message received from eUICC:\n");
 	ipa_buf_hexdump_multiline(es10x_res_encoded, 64, 1, SES10X, LDEBUG);
 
+	/* Decode into an arena, the decoded response is then released as a whole by ASN_STRUCT_FREE */
+	arena = asn_arena_begin();
 	rc = ber_decode(0, td, (void **)&es10x_res_decoded, es10x_res_encoded->data, es10x_res_encoded->len);
+	asn_arena_end(arena);
 	if (rc.code != RC_OK) {
 		if (rc.code == RC_FAIL) {
 			IPA_LOGP_ES10X(function_name, LERROR,
@@ -54,6 +60,113 @@ void *ipa_es10x_res_dec(const struct asn_TYPE_descriptor_s *td, const struct ipa
 	return es10x_res_decoded;
 }
 
+/* State of a streaming decoder for an ASN.1 encoded eUICC response */
+struct es10x_stream_dec {
+	const struct asn_TYPE_descriptor_s *td;
+	const char *function_name;
+	void *decoded;
+	/* received bytes that were not yet consumed by the decoder */
+	struct ipa_buf *carry;
+	size_t carry_peak;
+	asn_dec_rval_t rc;
+};
+
+/* Feed a block of response data into the decoder (see also ipa_es10x_transceive_res_dec) */
+static int es10x_stream_dec_cb(const struct ipa_buf *block, void *priv)
+{
+	struct es10x_stream_dec *dec = priv;
+	size_t required;
+
+	IPA_LOGP_ES10X(dec->function_name, LDEBUG, "ES10x message block received from eUICC:\n");
+	ipa_buf_hexdump_multiline(block, 64, 1, SES10X, LDEBUG);
+
+	if (dec->rc.code == RC_OK) {
+		IPA_LOGP_ES10X(dec->function_name, LERROR,
+			       "eUICC response contains excess data after the end of the message!\n");
+		return -EINVAL;
+	}
+
+	/* Append the block to the data that the decoder has not consumed yet. */
+	required = dec->carry->len + block->len;
+	if (required > dec->carry->data_len) {
+		dec->carry = ipa_buf_realloc(dec->carry, required > dec->carry->data_len * 2 ?
+					     required : dec->carry->data_len * 2);
+		assert(dec->carry);
+	}
+	memcpy(dec->carry->data + dec->carry->len, block->data, block->len);
+	dec->carry->len += block->len;
+	if (dec->carry->len > dec->carry_peak)
+		dec->carry_peak = dec->carry->len;
+
+	/* The decoder keeps its state in the partially decoded struct, so we can resume decoding with the next
+	 * block. Bytes that the decoder did not consume yet (e.g. an incomplete primitive) are carried over. */
+	dec->rc = ber_decode(0, dec->td, &dec->decoded, dec->carry->data, dec->carry->len);
+	memmove(dec->carry->data, dec->carry->data + dec->rc.consumed, dec->carry->len - dec->rc.consumed);
+	dec->carry->len -= dec->rc.consumed;
+
+	if (dec->rc.code == RC_FAIL) {
+		IPA_LOGP_ES10X(dec->function_name, LERROR, "cannot decode eUICC response! (invalid ASN.1 encoded data)\n");
+		return -EINVAL;
+	}
+
+	/* The message may end within the block, the remainder of the block must not contain any further data. */
+	if (dec->rc.code == RC_OK && dec->carry->len) {
+		IPA_LOGP_ES10X(dec->function_name, LERROR,
+			       "eUICC response contains excess data after the end of the message! (%zu bytes)\n",
+			       dec->carry->len);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/*! Transceive an ES10x request and decode the ASN.1 encoded eUICC response while it is received. (The response is
+ *  not collected in a buffer first, this saves memory in case the response is large.)
+ *  \param[inout] ctx pointer to ipa_context.
+ *  \param[in] td pointer to asn_TYPE_descriptor of the response.
+ *  \param[in] es10x_req pointer to ipa_buf that contains the encoded request.
+ *  \param[in] function_name name of the ES10x function (for log messages).
+ *  \returns pointer newly allocated ASN.1 struct that contains the decoded message, NULL on error. */
+void *ipa_es10x_transceive_res_dec(struct ipa_context *ctx, const struct asn_TYPE_descriptor_s *td,
+				   const struct ipa_buf *es10x_req, const char *function_name)
+{
+	struct es10x_stream_dec dec = { 0 };
+	int rc;
+
+	dec.td = td;
+	dec.function_name = function_name;
+	dec.carry = ipa_buf_alloc(IPA_LEN_EUICC_BUF);
+	assert(dec.carry);
+	dec.rc.code = RC_WMORE;
+
+	rc = ipa_euicc_transceive_es10x_cb(ctx, es10x_req, es10x_stream_dec_cb, &dec);
+	if (rc < 0) {
+		IPA_LOGP_ES10X(function_name, LERROR, "no (valid) ES10x response\n");
+		goto error;
+	}
+
+	if (dec.rc.code != RC_OK) {
+		IPA_LOGP_ES10X(function_name, LERROR, "cannot decode eUICC response! (message seems to be truncated)\n");
+		goto error;
+	}
+
+	IPA_LOGP_ES10X(function_name, LDEBUG, "response decoded while receiving (peak undecoded data: %zu bytes)\n",
+		       dec.carry_peak);
+	IPA_LOGP(SES10X, LDEBUG, " decoded ASN.1:\n");
+	ipa_asn1c_dump(td, dec.decoded, 1, SES10X, LDEBUG);
+
+	IPA_FREE(dec.carry);
+	return dec.decoded;
+error:
+	if (dec.decoded) {
+		IPA_LOGP_ES10X(function_name, LDEBUG, "the following (incomplete) data was decoded:\n");
+		ipa_asn1c_dump(td, dec.decoded, 1, SES10X, LERROR);
+	}
+	ASN_STRUCT_FREE(*td, dec.decoded);
+	IPA_FREE(dec.carry);
+	return NULL;
+}
+
 /*! Encode an ASN.1 struct that contains an eUICC request.
  *  \param[in] td pointer to asn_TYPE_descriptor.
  *  \param[in] es10x_req_decoded pointer to ASN.1 struct that contains the eUICC request.
@@ -62,17 +175,14 @@ void *ipa_es10x_res_dec(const struct asn_TYPE_descriptor_s *td, const struct ipa
 struct ipa_buf *ipa_es10x_req_enc(const struct asn_TYPE_descriptor_s *td, const void *es10x_req_decoded,
 				  const char *function_name)
 {
-	struct ipa_buf *es10x_req_encoded = NULL;
-	asn_enc_rval_t rc;
+	struct ipa_buf *es10x_req_encoded;
 
 	IPA_LOGP_ES10X(function_name, LDEBUG, "ES10x message that will be sent to eUICC:\n");
 	ipa_asn1c_dump(td, es10x_req_decoded, 1, SES10X, LDEBUG);
 
-	rc = der_encode(td, es10x_req_decoded, ipa_asn1c_consume_bytes_cb, &es10x_req_encoded);
-
-	if (rc.encoded <= 0) {
+	es10x_req_encoded = ipa_asn1c_encode(td, es10x_req_decoded);
+	if (!es10x_req_encoded) {
 		IPA_LOGP_ES10X(function_name, LERROR, "cannot encode eUICC request!\n");
-		IPA_FREE(es10x_req_encoded);
 		return NULL;
 	}
 
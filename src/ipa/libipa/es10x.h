@@ -3,6 +3,7 @@
 #include <onomondo/ipa/utils.h>
 #include <onomondo/ipa/log.h>
 struct asn_TYPE_descriptor_s;
+struct ipa_context;
 
 #define IPA_LOGP_ES10X(func, level, fmt, args...) \
 	IPA_LOGP(SES10X, level, "%s: " fmt, func, ## args)
@@ -11,6 +12,8 @@ struct asn_TYPE_descriptor_s;
 
 void *ipa_es10x_res_dec(const struct asn_TYPE_descriptor_s *td, const struct ipa_buf *es10x_res_encoded,
 			const char *function_name);
+void *ipa_es10x_transceive_res_dec(struct ipa_context *ctx, const struct asn_TYPE_descriptor_s *td,
+				   const struct ipa_buf *es10x_req, const char *function_name);
 struct ipa_buf *ipa_es10x_req_enc(const struct asn_TYPE_descriptor_s *td, const void *es10x_req_decoded,
 				  const char *function_name);
 
@@ -6,10 +6,13 @@
 #include <stdint.h>
 #include <string.h>
 #include <assert.h>
-#include <unistd.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <time.h>
 #include <onomondo/ipa/ipad.h>
 #include <onomondo/ipa/log.h>
 #include <onomondo/ipa/http.h>
+#include <asn_arena.h>
 #include "esipa.h"
 #include "context.h"
 #include "utils.h"
@@ -17,50 +20,54 @@
 
 #define PREFIX_HTTP "http://"
 #define PREFIX_HTTPS "https://"
+#define PREFIX_COAP "coap://"
+#define PREFIX_COAPS "coaps://"
 #define SUFFIX "/gsma/rsp2/asn1"
 
+/* Delay before the first retry of a failed ESipa request, the delay doubles with each retry (milliseconds) */
+#define ESIPA_RETRY_BASE_DELAY 1000
+#define ESIPA_RETRY_MAX_DELAY 60000
+
 /*! Read the configured eIM URL (FQDN).
  *  \param[in] ctx pointer to ipa_context.
- *  \returns pointer to eIM URL (statically allocated, do not free). */
+ *  \returns pointer to eIM URL (cached in ipa_context, do not free). */
 char *ipa_esipa_get_eim_url(struct ipa_context *ctx)
 {
-	static char eim_url[IPA_ESIPA_URL_MAXLEN];
-	size_t url_len = 0;
+	const char *prefix;
+	size_t url_len;
 
-	memset(eim_url, 0, sizeof(eim_url));
+	/* The URL is computed only once and then cached until the eIM FQDN changes (see eim_init) */
+	if (ctx->eim_url)
+		return ctx->eim_url;
 
-	/* Make sure we have a reasonable minimum of space available */
-	assert(sizeof(eim_url) > 255);
+	if (!ctx->eim_fqdn)
+		return NULL;
 
-	if (ctx->cfg->eim_disable_ssl)
-		strcpy(eim_url, PREFIX_HTTP);
+	if (ctx->cfg->eim_coap)
+		prefix = ctx->cfg->eim_disable_ssl ? PREFIX_COAP : PREFIX_COAPS;
+	else if (ctx->cfg->eim_disable_ssl)
+		prefix = PREFIX_HTTP;
 	else
-		strcpy(eim_url, PREFIX_HTTPS);
+		prefix = PREFIX_HTTPS;
 
-	/* Be sure we don't accidentally overrun the buffer */
-	url_len = strlen(eim_url);
-	if (!ctx->eim_fqdn)
-		return NULL;
-	url_len += strlen(ctx->eim_fqdn);
-	url_len += strlen(SUFFIX);
-	assert(url_len < sizeof(eim_url));
+	url_len = strlen(prefix) + strlen(ctx->eim_fqdn) + strlen(SUFFIX);
+	assert(url_len < IPA_ESIPA_URL_MAXLEN);
 
-	strcat(eim_url, ctx->eim_fqdn);
-	strcat(eim_url, SUFFIX);
+	ctx->eim_url = IPA_ALLOC_N(url_len + 1);
+	assert(ctx->eim_url);
+	strcpy(ctx->eim_url, prefix);
+	strcat(ctx->eim_url, ctx->eim_fqdn);
+	strcat(ctx->eim_url, SUFFIX);
 
-	return eim_url;
+	return ctx->eim_url;
 }
 
-/*! Decode an ASN.1 encoded eIM to IPA message.
- *  \param[in] msg_to_ipa_encoded pointer to ipa_buf that contains the encoded message.
- *  \param[in] function_name name of the ESipa function (for log messages).
- *  \param[in] expected_res_type type of the expected eIM response (for plausibility check).
- *  \returns pointer newly allocated ASN.1 struct that contains the decoded message, NULL on error. */
-struct EsipaMessageFromEimToIpa *ipa_esipa_msg_to_ipa_dec(const struct ipa_buf *msg_to_ipa_encoded,
-							  const char *function_name,
-							  enum EsipaMessageFromEimToIpa_PR expected_res_type)
+static struct EsipaMessageFromEimToIpa *msg_to_ipa_dec(const struct ipa_buf *msg_to_ipa_encoded,
+						       const char *function_name,
+						       enum EsipaMessageFromEimToIpa_PR expected_res_type, bool ref)
 {
 	struct EsipaMessageFromEimToIpa *msg_to_ipa = NULL;
+	struct asn_arena *arena;
 	asn_dec_rval_t rc;
 
 	assert(msg_to_ipa_encoded);
@@ -73,8 +80,15 @@ struct EsipaMessageFromEimToIpa *ipa_esipa_msg_to_ipa_dec(const struct ipa_buf *
 	IPA_LOGP_ESIPA(function_name, LDEBUG, "ESipa message received from eIM:\n");
 	ipa_buf_hexdump_multiline(msg_to_ipa_encoded, 64, 1, SESIPA, LDEBUG);
 
+	/* Decode into an arena, the decoded message is then released as a whole by ASN_STRUCT_FREE (see also
+	 * IPA_ESIPA_RES_FREE) */
+	if (ref)
+		arena = asn_arena_begin_ref(msg_to_ipa_encoded->data, msg_to_ipa_encoded->len);
+	else
+		arena = asn_arena_begin();
 	rc = ber_decode(0, &asn_DEF_EsipaMessageFromEimToIpa,
 			(void **)&msg_to_ipa, msg_to_ipa_encoded->data, msg_to_ipa_encoded->len);
+	asn_arena_end(arena);
 
 	if (rc.code != RC_OK) {
 		if (rc.code == RC_FAIL) {
@@ -106,14 +120,39 @@ struct EsipaMessageFromEimToIpa *ipa_esipa_msg_to_ipa_dec(const struct ipa_buf *
 	return msg_to_ipa;
 }
 
+/*! Decode an ASN.1 encoded eIM to IPA message.
+ *  \param[in] msg_to_ipa_encoded pointer to ipa_buf that contains the encoded message.
+ *  \param[in] function_name name of the ESipa function (for log messages).
+ *  \param[in] expected_res_type type of the expected eIM response (for plausibility check).
+ *  \returns pointer newly allocated ASN.1 struct that contains the decoded message, NULL on error. */
+struct EsipaMessageFromEimToIpa *ipa_esipa_msg_to_ipa_dec(const struct ipa_buf *msg_to_ipa_encoded,
+							  const char *function_name,
+							  enum EsipaMessageFromEimToIpa_PR expected_res_type)
+{
+	return msg_to_ipa_dec(msg_to_ipa_encoded, function_name, expected_res_type, false);
+}
+
+/*! Decode an ASN.1 encoded eIM to IPA message without copying large OCTET STRINGs (e.g. the segments of a
+ *  BoundProfilePackage), they reference the encoded message instead. The encoded message must not be changed or freed
+ *  before the decoded message is freed.
+ *  \param[in] msg_to_ipa_encoded pointer to ipa_buf that contains the encoded message.
+ *  \param[in] function_name name of the ESipa function (for log messages).
+ *  \param[in] expected_res_type type of the expected eIM response (for plausibility check).
+ *  \returns pointer newly allocated ASN.1 struct that contains the decoded message, NULL on error. */
+struct EsipaMessageFromEimToIpa *ipa_esipa_msg_to_ipa_dec_ref(const struct ipa_buf *msg_to_ipa_encoded,
+							      const char *function_name,
+							      enum EsipaMessageFromEimToIpa_PR expected_res_type)
+{
+	return msg_to_ipa_dec(msg_to_ipa_encoded, function_name, expected_res_type, true);
+}
+
 /*! Encode an ASN.1 struct that contains an IPA to eIM message.
  *  \param[in] msg_to_eim pointer to ASN.1 struct that contains the IPA to eIM message.
  *  \param[in] function_name name of the ESipa function (for log messages).
  *  \returns pointer newly allocated ipa_buf that contains the encoded message, NULL on error. */
 struct ipa_buf *ipa_esipa_msg_to_eim_enc(const struct EsipaMessageFromIpaToEim *msg_to_eim, const char *function_name)
 {
-	struct ipa_buf *buf_encoded = NULL;
-	asn_enc_rval_t rc;
+	struct ipa_buf *buf_encoded;
 
 	assert(msg_to_eim);
 	assert(msg_to_eim != EsipaMessageFromIpaToEim_PR_NOTHING);
@@ -121,10 +160,9 @@ struct ipa_buf *ipa_esipa_msg_to_eim_enc(const struct EsipaMessageFromIpaToEim *
 	IPA_LOGP_ESIPA(function_name, LDEBUG, "ESipa message that will be sent to eIM:\n");
 	ipa_asn1c_dump(&asn_DEF_EsipaMessageFromIpaToEim, msg_to_eim, 1, SESIPA, LDEBUG);
 
-	rc = der_encode(&asn_DEF_EsipaMessageFromIpaToEim, msg_to_eim, ipa_asn1c_consume_bytes_cb, &buf_encoded);
-	if (rc.encoded <= 0) {
-		IPA_LOGP_ESIPA(function_name, LERROR, "cannot encode eIM request! rc = %d\n", rc.encoded);
-		IPA_FREE(buf_encoded);
+	buf_encoded = ipa_asn1c_encode(&asn_DEF_EsipaMessageFromIpaToEim, msg_to_eim);
+	if (!buf_encoded) {
+		IPA_LOGP_ESIPA(function_name, LERROR, "cannot encode eIM request!\n");
 		return NULL;
 	}
 
@@ -134,56 +172,299 @@ struct ipa_buf *ipa_esipa_msg_to_eim_enc(const struct EsipaMessageFromIpaToEim *
 	return buf_encoded;
 }
 
-/*! Perform a request towards the eIM.
+/* Initialize the HTTP client on first use, so that ipa_init does not have to pay for it */
+static int http_init(struct ipa_context *ctx, const char *function_name)
+{
+	if (ctx->http_ctx)
+		return 0;
+
+	ctx->http_ctx = ipa_http_init(ctx->cfg->eim_cabundle, ctx->cfg->eim_disable_ssl_verif);
+	if (!ctx->http_ctx) {
+		IPA_LOGP_ESIPA(function_name, LERROR, "eIM request failed, unable to initialize HTTP client!\n");
+		return -EINVAL;
+	}
+
+	/* Resume the TLS session from the last run (if there is any) */
+	if (ctx->nvstate.tls_session)
+		ipa_http_import_session(ctx->http_ctx, ctx->nvstate.tls_session);
+
+	return 0;
+}
+
+/* Current time (monotonic clock) in milliseconds */
+static uint64_t now_ms(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/*! Compute the delay before a failed ESipa function is retried. The delay grows exponentially with the number of
+ *  consecutive failures, up to a maximum. A random jitter of up to half the delay is applied so that a group of IPAds
+ *  that lost the link to the eIM at the same time does not retry in lockstep.
+ *  \param[in] count number of retries that were already scheduled since the last successful request.
+ *  \param[inout] seed state of the random number generator (see rand_r).
+ *  \returns delay in milliseconds. */
+unsigned int ipa_esipa_retry_backoff(unsigned int count, unsigned int *seed)
+{
+	uint64_t delay;
+
+	if (count >= 32)
+		delay = ESIPA_RETRY_MAX_DELAY;
+	else
+		delay = (uint64_t)ESIPA_RETRY_BASE_DELAY << count;
+	if (delay > ESIPA_RETRY_MAX_DELAY)
+		delay = ESIPA_RETRY_MAX_DELAY;
+
+	return delay / 2 + rand_r(seed) % (delay / 2 + 1);
+}
+
+/* Schedule a retry of a failed ESipa function, the delay grows with each consecutive failure (regardless of the ESipa
+ * function, see ipa_esipa_retry_backoff). */
+static void retry_schedule(struct ipa_context *ctx, const char *function_name)
+{
+	unsigned int delay;
+
+	if (!ctx->esipa_retry.seed)
+		ctx->esipa_retry.seed = (unsigned int)now_ms() ^ (unsigned int)(uintptr_t)ctx;
+
+	delay = ipa_esipa_retry_backoff(ctx->esipa_retry.count, &ctx->esipa_retry.seed);
+
+	ctx->esipa_retry.function_name = function_name;
+	ctx->esipa_retry.count++;
+	ctx->esipa_retry.deadline = now_ms() + delay;
+
+	IPA_LOGP_ESIPA(function_name, LERROR, "eIM request failed, will retry in %u ms (retry %u of %u)...!\n",
+		       delay, ctx->esipa_retry.count, ctx->cfg->esipa_req_retries);
+}
+
+static void retry_reset(struct ipa_context *ctx)
+{
+	ctx->esipa_retry.function_name = NULL;
+	ctx->esipa_retry.count = 0;
+	ctx->esipa_retry.deadline = 0;
+}
+
+/*! Drop a scheduled retry. This is necessary when the procedure that issued the failed ESipa request has given up,
+ *  otherwise the retry would never be served and ipa_poll would keep returning IPA_POLL_RETRY.
+ *  \param[inout] ctx pointer to ipa_context. */
+void ipa_esipa_retry_cancel(struct ipa_context *ctx)
+{
+	if (!ctx->esipa_retry.function_name)
+		return;
+
+	IPA_LOGP_ESIPA(ctx->esipa_retry.function_name, LINFO,
+		       "retry dropped, the procedure that issued the request has ended\n");
+	retry_reset(ctx);
+}
+
+/*! Check whether a failed ESipa function is going to be retried.
  *  \param[in] ctx pointer to ipa_context.
- *  \param[in] esipa_req ipa_buf with encoded request data
- *  \param[in] function_name name of the ESipa function (for log messages).
- *  \returns pointer newly allocated ipa_buf that contains the encoded response from the eIM, NULL on error. */
-struct ipa_buf *ipa_esipa_req(struct ipa_context *ctx, const struct ipa_buf *esipa_req, const char *function_name)
+ *  \returns true when a retry is scheduled. */
+bool ipa_esipa_retry_pending(const struct ipa_context *ctx)
+{
+	return ctx->esipa_retry.function_name != NULL;
+}
+
+/*! Get the time that is left until a scheduled retry is due.
+ *  \param[in] ctx pointer to ipa_context.
+ *  \returns time in milliseconds, 0 when no retry is scheduled or when the retry is already due. */
+unsigned int ipa_esipa_retry_delay(const struct ipa_context *ctx)
+{
+	uint64_t now;
+
+	if (!ctx->esipa_retry.function_name)
+		return 0;
+	now = now_ms();
+	if (now >= ctx->esipa_retry.deadline)
+		return 0;
+	return ctx->esipa_retry.deadline - now;
+}
+
+/* Get the time that is left until a scheduled retry of the given ESipa function is due. Only the function that has
+ * failed is held back, other functions (e.g. CancelSession after a failed profile download) are still sent. */
+static unsigned int retry_delay(const struct ipa_context *ctx, const char *function_name)
+{
+	if (!ctx->esipa_retry.function_name || strcmp(ctx->esipa_retry.function_name, function_name) != 0)
+		return 0;
+	return ipa_esipa_retry_delay(ctx);
+}
+
+/* Check whether a retry of another ESipa function than the given one is scheduled */
+static bool retry_pending_other(const struct ipa_context *ctx, const char *function_name)
+{
+	return ctx->esipa_retry.function_name && strcmp(ctx->esipa_retry.function_name, function_name) != 0;
+}
+
+/* Perform a request towards the eIM with the regular timeout (timeout = 0) or with an individual timeout */
+static struct ipa_buf *perform_req(struct ipa_context *ctx, const struct ipa_buf *esipa_req, const char *function_name,
+				   unsigned int timeout)
 {
 	struct ipa_buf *esipa_res;
-	unsigned int i;
-	unsigned int wait_time;
+	unsigned int delay;
 
 	if (!esipa_req) {
 		IPA_LOGP_ESIPA(function_name, LERROR, "eIM request failed due to missing encoded request data!\n");
 		return NULL;
 	}
 
-	for (i = 0; i < ctx->cfg->esipa_req_retries + 1; i++) {
-		IPA_LOGP_ESIPA(function_name, LDEBUG, "sending %zu bytes to eIM (buffer size: %zu bytes)\n",
-			       esipa_req->len, esipa_req->data_len);
+	delay = retry_delay(ctx, function_name);
+	if (delay) {
+		IPA_LOGP_ESIPA(function_name, LERROR, "eIM request deferred, retry of %s is due in %u ms!\n",
+			       ctx->esipa_retry.function_name, delay);
+		return NULL;
+	}
+
+	if (http_init(ctx, function_name) < 0)
+		goto error;
+
+	IPA_LOGP_ESIPA(function_name, LDEBUG, "sending %zu bytes to eIM (buffer size: %zu bytes)\n",
+		       esipa_req->len, esipa_req->data_len);
+	if (timeout)
+		esipa_res = ipa_http_req_timeout(ctx->http_ctx, esipa_req, ipa_esipa_get_eim_url(ctx), timeout);
+	else
 		esipa_res = ipa_http_req(ctx->http_ctx, esipa_req, ipa_esipa_get_eim_url(ctx));
-		if (!esipa_res && ctx->cfg->esipa_req_retries == 0) {
-			IPA_LOGP_ESIPA(function_name, LERROR, "eIM request failed!\n");
-			goto error;
-		} else if (!esipa_res && i >= ctx->cfg->esipa_req_retries) {
-			IPA_LOGP_ESIPA(function_name, LERROR,
-				       "eIM request failed, giving up after retrying %u times!\n", i);
-			goto error;
-		} else if (!esipa_res) {
-			wait_time = (i + 1) * (i + 1);
-			IPA_LOGP_ESIPA(function_name, LERROR, "eIM request failed, will retry in %u seconds...!\n",
-				       wait_time);
-			sleep(wait_time);
-		} else {
-			/* Successful request */
-			IPA_LOGP_ESIPA(function_name, LDEBUG, "received %zu bytes from eIM (buffer size: %zu bytes)\n",
-				       esipa_res->len, esipa_res->data_len);
-			break;
+	if (esipa_res) {
+		/* A retry that is scheduled for another ESipa function stays in place, the procedure that issued it
+		 * still has to be resumed */
+		if (!retry_pending_other(ctx, function_name)) {
+			if (ctx->esipa_retry.function_name)
+				IPA_LOGP_ESIPA(function_name, LINFO, "eIM request succeeded after %u retries\n",
+					       ctx->esipa_retry.count);
+			retry_reset(ctx);
 		}
+		IPA_LOGP_ESIPA(function_name, LDEBUG, "received %zu bytes from eIM (buffer size: %zu bytes)\n",
+			       esipa_res->len, esipa_res->data_len);
+		return esipa_res;
+	}
+
+	if (ctx->cfg->esipa_req_retries == 0) {
+		IPA_LOGP_ESIPA(function_name, LERROR, "eIM request failed!\n");
+		goto error;
+	} else if (retry_pending_other(ctx, function_name)) {
+		/* Only one ESipa function can be scheduled for a retry at a time */
+		IPA_LOGP_ESIPA(function_name, LERROR, "eIM request failed, retry of %s is still pending!\n",
+			       ctx->esipa_retry.function_name);
+		ctx->check_http = true;
+		return NULL;
+	} else if (ctx->esipa_retry.count >= ctx->cfg->esipa_req_retries) {
+		IPA_LOGP_ESIPA(function_name, LERROR, "eIM request failed, giving up after retrying %u times!\n",
+			       ctx->esipa_retry.count);
+		goto error;
 	}
 
-	return esipa_res;
+	retry_schedule(ctx, function_name);
+	return NULL;
 error:
+	retry_reset(ctx);
 	ctx->check_http = true;
-	IPA_FREE(esipa_res);
 	return NULL;
 }
 
+/*! Perform a request towards the eIM. A failed request is not repeated immediately, instead a retry is scheduled
+ *  (see retry_schedule) and NULL is returned. Until the retry is due, further requests of the same ESipa function fail
+ *  immediately, so that the procedure that issued the request can return quickly. The API user is informed by ipa_poll, which returns
+ *  IPA_POLL_RETRY.
+ *  \param[in] ctx pointer to ipa_context.
+ *  \param[in] esipa_req ipa_buf with encoded request data
+ *  \param[in] function_name name of the ESipa function (for log messages).
+ *  \returns pointer newly allocated ipa_buf that contains the encoded response from the eIM, NULL on error. */
+struct ipa_buf *ipa_esipa_req(struct ipa_context *ctx, const struct ipa_buf *esipa_req, const char *function_name)
+{
+	return perform_req(ctx, esipa_req, function_name, 0);
+}
+
+/*! Perform a long poll request towards the eIM, the eIM may hold the request until the timeout expires. An expired
+ *  timeout is not a failure, an empty response is returned instead (see also ipa_http_req_timeout). Failed requests
+ *  are retried in the same way as with ipa_esipa_req.
+ *  \param[in] ctx pointer to ipa_context.
+ *  \param[in] esipa_req ipa_buf with encoded request data
+ *  \param[in] function_name name of the ESipa function (for log messages).
+ *  \param[in] timeout time (seconds) the eIM may hold the request.
+ *  \returns pointer newly allocated ipa_buf that contains the encoded response from the eIM (empty when the eIM did not
+ *           respond within the timeout), NULL on error. */
+struct ipa_buf *ipa_esipa_req_long_poll(struct ipa_context *ctx, const struct ipa_buf *esipa_req,
+					const char *function_name, unsigned int timeout)
+{
+	return perform_req(ctx, esipa_req, function_name, timeout);
+}
+
+/*! Perform a request towards the eIM and pass the response to a callback function as it arrives (see also
+ *  ipa_http_req_stream). Since the callback function may already have processed parts of the response, a failed
+ *  request is not retried.
+ *  \param[in] ctx pointer to ipa_context.
+ *  \param[in] esipa_req ipa_buf with encoded request data
+ *  \param[in] function_name name of the ESipa function (for log messages).
+ *  \param[in] res_cb callback function that receives the encoded response from the eIM.
+ *  \param[in] priv private data pointer that is passed to the callback function.
+ *  \returns 0 on success, negative on failure. */
+int ipa_esipa_req_stream(struct ipa_context *ctx, const struct ipa_buf *esipa_req, const char *function_name,
+			 ipa_http_res_cb res_cb, void *priv)
+{
+	int rc;
+
+	if (!esipa_req) {
+		IPA_LOGP_ESIPA(function_name, LERROR, "eIM request failed due to missing encoded request data!\n");
+		return -EINVAL;
+	}
+
+	if (retry_delay(ctx, function_name)) {
+		IPA_LOGP_ESIPA(function_name, LERROR, "eIM request deferred, retry of %s is due in %u ms!\n",
+			       ctx->esipa_retry.function_name, retry_delay(ctx, function_name));
+		return -EAGAIN;
+	}
+
+	rc = http_init(ctx, function_name);
+	if (rc < 0)
+		goto error;
+
+	IPA_LOGP_ESIPA(function_name, LDEBUG, "sending %zu bytes to eIM (buffer size: %zu bytes), streaming response\n",
+		       esipa_req->len, esipa_req->data_len);
+	rc = ipa_http_req_stream(ctx->http_ctx, esipa_req, ipa_esipa_get_eim_url(ctx), res_cb, priv);
+	if (rc < 0) {
+		IPA_LOGP_ESIPA(function_name, LERROR, "eIM request failed!\n");
+		goto error;
+	}
+
+	return 0;
+error:
+	ctx->check_http = true;
+	return rc;
+}
+
+/*! Free a response that was returned by ipa_esipa_req (the buffer is handed back to the HTTP client for reuse).
+ *  \param[in] ctx pointer to ipa_context.
+ *  \param[in] esipa_res response to free. */
+void ipa_esipa_res_free(struct ipa_context *ctx, struct ipa_buf *esipa_res)
+{
+	if (!esipa_res)
+		return;
+	if (ctx->http_ctx)
+		ipa_http_recycle(ctx->http_ctx, esipa_res);
+	else
+		IPA_FREE(esipa_res);
+}
+
+/*! Forget which eUICC data the eIM has already received (see also ipa_config.esipa_minimize_bytes). This is called when
+ *  the eIM responds with an error, so that the next requests carry the complete data again (in case the eIM has lost
+ *  track of the eUICC or cannot handle the compact formats after all).
+ *  \param[inout] ctx pointer to ipa_context.
+ *  \param[in] function_name name of the ESipa function that failed (for log messages). */
+void ipa_esipa_eim_knows_reset(struct ipa_context *ctx, const char *function_name)
+{
+	if (ctx->eim_knows.euicc_info_1 || ctx->eim_knows.certs)
+		IPA_LOGP_ESIPA(function_name, LINFO,
+			       "eIM responded with an error, euiccInfo1 and certificates will be sent again\n");
+	ctx->eim_knows.euicc_info_1 = false;
+	ctx->eim_knows.certs = false;
+}
+
 /*! Close any underlying transport protocol connection towards the eIM
  *  \param[in] ctx pointer to ipa_context. */
 void ipa_esipa_close(struct ipa_context *ctx)
 {
+	if (!ctx->http_ctx)
+		return;
 	ipa_http_close(ctx->http_ctx);
 }
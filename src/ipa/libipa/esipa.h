@@ -1,5 +1,6 @@
 #pragma once
 
+#include <onomondo/ipa/http.h>
 #include <EsipaMessageFromEimToIpa.h>
 #include <EsipaMessageFromIpaToEim.h>
 #include <SGP32-RetrieveNotificationsListResponse.h>
@@ -15,8 +16,21 @@ char *ipa_esipa_get_eim_url(struct ipa_context *ctx);
 struct EsipaMessageFromEimToIpa *ipa_esipa_msg_to_ipa_dec(const struct ipa_buf *msg_to_ipa_encoded,
 							  const char *function_name,
 							  enum EsipaMessageFromEimToIpa_PR epected_res_type);
+struct EsipaMessageFromEimToIpa *ipa_esipa_msg_to_ipa_dec_ref(const struct ipa_buf *msg_to_ipa_encoded,
+							      const char *function_name,
+							      enum EsipaMessageFromEimToIpa_PR epected_res_type);
 struct ipa_buf *ipa_esipa_msg_to_eim_enc(const struct EsipaMessageFromIpaToEim *msg_to_eim, const char *function_name);
 struct ipa_buf *ipa_esipa_req(struct ipa_context *ctx, const struct ipa_buf *esipa_req, const char *function_name);
+struct ipa_buf *ipa_esipa_req_long_poll(struct ipa_context *ctx, const struct ipa_buf *esipa_req,
+					const char *function_name, unsigned int timeout);
+int ipa_esipa_req_stream(struct ipa_context *ctx, const struct ipa_buf *esipa_req, const char *function_name,
+			 ipa_http_res_cb res_cb, void *priv);
+void ipa_esipa_res_free(struct ipa_context *ctx, struct ipa_buf *esipa_res);
+unsigned int ipa_esipa_retry_backoff(unsigned int count, unsigned int *seed);
+void ipa_esipa_retry_cancel(struct ipa_context *ctx);
+bool ipa_esipa_retry_pending(const struct ipa_context *ctx);
+unsigned int ipa_esipa_retry_delay(const struct ipa_context *ctx);
+void ipa_esipa_eim_knows_reset(struct ipa_context *ctx, const char *function_name);
 void ipa_esipa_close(struct ipa_context *ctx);
 
 /*! A helper macro to free the basic contents of an ESIPA response. This macro is intended to be used from within the
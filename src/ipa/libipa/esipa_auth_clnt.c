@@ -5,6 +5,7 @@
  */
 
 #include <stdint.h>
+#include <string.h>
 #include <errno.h>
 #include <onomondo/ipa/http.h>
 #include <onomondo/ipa/log.h>
@@ -29,13 +30,44 @@ static const struct num_str_map error_code_strings[] = {
 	{ 0, NULL }
 };
 
-static struct ipa_buf *enc_auth_clnt_req(const struct ipa_esipa_auth_clnt_req *req)
+/* Convert AuthenticateResponseOk into its compact format (see also SGP.32, section 5.14.3). The eIM reconstructs
+ * euiccSigned1 from the values it has sent (transactionId, serverAddress, serverChallenge) and from the euiccInfo2 it
+ * knows. Only extCardResource and ctxParams1 (generated by the IPA, see proc_cmn_mtl_auth.c) are transferred. */
+static void compact_auth_resp_ok(struct CompactAuthenticateResponseOk *compact_auth_resp_ok,
+				 const struct AuthenticateResponseOk *auth_resp_ok, bool omit_certs)
+{
+	compact_auth_resp_ok->signedData.present = CompactAuthenticateResponseOk__signedData_PR_compactEuiccSigned1;
+	compact_auth_resp_ok->signedData.choice.compactEuiccSigned1.extCardResource =
+	    auth_resp_ok->euiccSigned1.euiccInfo2.extCardResource;
+	compact_auth_resp_ok->signedData.choice.compactEuiccSigned1.ctxParams1 =
+	    (struct CtxParams1 *)&auth_resp_ok->euiccSigned1.ctxParams1;
+	compact_auth_resp_ok->euiccSignature1 = auth_resp_ok->euiccSignature1;
+	if (omit_certs)
+		return;
+	compact_auth_resp_ok->euiccCertificate = (struct Certificate *)&auth_resp_ok->euiccCertificate;
+	compact_auth_resp_ok->eumCertificate = (struct Certificate *)&auth_resp_ok->eumCertificate;
+}
+
+static struct ipa_buf *enc_auth_clnt_req(const struct ipa_context *ctx, const struct ipa_esipa_auth_clnt_req *req)
 {
 	struct EsipaMessageFromIpaToEim msg_to_eim = { 0 };
+	struct SGP32_AuthenticateServerResponse *auth_serv_res;
 
 	msg_to_eim.present = EsipaMessageFromIpaToEim_PR_authenticateClientRequestEsipa;
 	msg_to_eim.choice.authenticateClientRequestEsipa = req->req;
 
+	auth_serv_res = &msg_to_eim.choice.authenticateClientRequestEsipa.authenticateServerResponse;
+	if (ctx->cfg->esipa_minimize_bytes &&
+	    auth_serv_res->present == SGP32_AuthenticateServerResponse_PR_authenticateResponseOk) {
+		if (ctx->eim_knows.certs)
+			IPA_LOGP_ESIPA("AuthenticateClient", LINFO, "eIM already knows the certificates, leaving them out\n");
+		auth_serv_res->present = SGP32_AuthenticateServerResponse_PR_compactAuthenticateResponseOk;
+		memset(&auth_serv_res->choice, 0, sizeof(auth_serv_res->choice));
+		compact_auth_resp_ok(&auth_serv_res->choice.compactAuthenticateResponseOk,
+				     &req->req.authenticateServerResponse.choice.authenticateResponseOk,
+				     ctx->eim_knows.certs);
+	}
+
 	/* Encode */
 	return ipa_esipa_msg_to_eim_enc(&msg_to_eim, "AuthenticateClient");
 }
@@ -99,7 +131,7 @@ struct ipa_esipa_auth_clnt_res *ipa_esipa_auth_clnt(struct ipa_context *ctx, con
 
 	IPA_LOGP_ESIPA("AuthenticateClient", LINFO, "Requesting client authentication\n");
 
-	esipa_req = enc_auth_clnt_req(req);
+	esipa_req = enc_auth_clnt_req(ctx, req);
 	if (!esipa_req) {
 		IPA_LOGP_ESIPA("AuthenticateClient", LERROR, "failed to encode the AuthenticateClient request!\n");
 		goto error;
@@ -116,14 +148,21 @@ struct ipa_esipa_auth_clnt_res *ipa_esipa_auth_clnt(struct ipa_context *ctx, con
 
 	IPA_LOGP_ESIPA("AuthenticateClient", LINFO, "Decode the AuthenticateClient response\n");
 	res = dec_auth_clnt_res(esipa_res, req);
+	if (res && res->auth_clnt_err)
+		ipa_esipa_eim_knows_reset(ctx, "AuthenticateClient");
 	if (!res) {
 		IPA_LOGP_ESIPA("AuthenticateClient", LERROR, "failed to decode the AuthenticateClient response!\n");
 		goto error;
 	}
 
+	/* The eIM has verified the certificates successfully, there is no need to send them again */
+	if (res->auth_clnt_err == 0 &&
+	    req->req.authenticateServerResponse.present == SGP32_AuthenticateServerResponse_PR_authenticateResponseOk)
+		ctx->eim_knows.certs = true;
+
 error:
 	IPA_FREE(esipa_req);
-	IPA_FREE(esipa_res);
+	ipa_esipa_res_free(ctx, esipa_res);
 	return res;
 }
 
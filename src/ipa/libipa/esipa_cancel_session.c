@@ -25,14 +25,26 @@ static const struct num_str_map error_code_strings[] = {
 	{ 0, NULL }
 };
 
-static struct ipa_buf *enc_cancel_session_req(const struct ipa_esipa_cancel_session_req *req)
+static struct ipa_buf *enc_cancel_session_req(const struct ipa_context *ctx,
+					       const struct ipa_esipa_cancel_session_req *req)
 {
 	struct EsipaMessageFromIpaToEim msg_to_eim = { 0 };
+	struct CompactCancelSessionResponseOk *compact_cancel_session_ok;
 
 	msg_to_eim.present = EsipaMessageFromIpaToEim_PR_cancelSessionRequestEsipa;
 	msg_to_eim.choice.cancelSessionRequestEsipa.transactionId = *req->transaction_id;
 
-	if (req->cancel_session_ok) {
+	if (req->cancel_session_ok && ctx->cfg->esipa_minimize_bytes) {
+		/* Compact format, the eIM knows transactionId and smdpOid already (see also SGP.32, section 5.14.8) */
+		msg_to_eim.choice.cancelSessionRequestEsipa.cancelSessionResponse.present =
+		    SGP32_CancelSessionResponse_PR_compactCancelSessionResponseOk;
+		compact_cancel_session_ok =
+		    &msg_to_eim.choice.cancelSessionRequestEsipa.cancelSessionResponse.choice.compactCancelSessionResponseOk;
+		compact_cancel_session_ok->compactEuiccCancelSessionSigned.reason =
+		    &req->cancel_session_ok->euiccCancelSessionSigned.reason;
+		compact_cancel_session_ok->euiccCancelSessionSignature =
+		    req->cancel_session_ok->euiccCancelSessionSignature;
+	} else if (req->cancel_session_ok) {
 		msg_to_eim.choice.cancelSessionRequestEsipa.cancelSessionResponse.present =
 		    SGP32_CancelSessionResponse_PR_cancelSessionResponseOk;
 		msg_to_eim.choice.cancelSessionRequestEsipa.cancelSessionResponse.choice.cancelSessionResponseOk =
@@ -94,7 +106,7 @@ struct ipa_esipa_cancel_session_res *ipa_esipa_cancel_session(struct ipa_context
 
 	IPA_LOGP_ESIPA("CancelSession", LINFO, "Requesting cancellation of session\n");
 
-	esipa_req = enc_cancel_session_req(req);
+	esipa_req = enc_cancel_session_req(ctx, req);
 	if (!esipa_req)
 		goto error;
 
@@ -103,12 +115,14 @@ struct ipa_esipa_cancel_session_res *ipa_esipa_cancel_session(struct ipa_context
 		goto error;
 
 	res = dec_cancel_session_res(esipa_res);
+	if (res && res->cancel_session_err)
+		ipa_esipa_eim_knows_reset(ctx, "CancelSession");
 	if (!res)
 		goto error;
 
 error:
 	IPA_FREE(esipa_req);
-	IPA_FREE(esipa_res);
+	ipa_esipa_res_free(ctx, esipa_res);
 	return res;
 }
 
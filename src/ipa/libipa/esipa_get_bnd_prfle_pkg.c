@@ -40,20 +40,50 @@ static const struct num_str_map error_code_strings[] = {
 	{ 0, NULL }
 };
 
-static struct ipa_buf *enc_get_bnd_prfle_pkg_req(const struct ipa_esipa_get_bnd_prfle_pkg_req *req)
+/* The transactionId that was sent to the eIM with the request */
+static const TransactionId_t *req_transaction_id(const struct ipa_esipa_get_bnd_prfle_pkg_req *req)
+{
+	switch (req->prep_dwnld_res->present) {
+	case PrepareDownloadResponse_PR_downloadResponseOk:
+		return &req->prep_dwnld_res->choice.downloadResponseOk.euiccSigned2.transactionId;
+	case PrepareDownloadResponse_PR_downloadResponseError:
+		return &req->prep_dwnld_res->choice.downloadResponseError.transactionId;
+	default:
+		return NULL;
+	}
+}
+
+static struct ipa_buf *enc_get_bnd_prfle_pkg_req(const struct ipa_context *ctx,
+						  const struct ipa_esipa_get_bnd_prfle_pkg_req *req)
 {
 	struct EsipaMessageFromIpaToEim msg_to_eim = { 0 };
+	struct CompactPrepareDownloadResponseOk *compact_dwnld_res_ok;
 
 	msg_to_eim.present = EsipaMessageFromIpaToEim_PR_getBoundProfilePackageRequestEsipa;
 
 	switch (req->prep_dwnld_res->present) {
 	case PrepareDownloadResponse_PR_downloadResponseOk:
+		msg_to_eim.choice.getBoundProfilePackageRequestEsipa.transactionId =
+		    req->prep_dwnld_res->choice.downloadResponseOk.euiccSigned2.transactionId;
+		if (ctx->cfg->esipa_minimize_bytes) {
+			/* Compact format, the transactionId is only sent once (see also SGP.32, section 5.14.2) */
+			msg_to_eim.choice.getBoundProfilePackageRequestEsipa.prepareDownloadResponse.present =
+			    SGP32_PrepareDownloadResponse_PR_compactDownloadResponseOk;
+			compact_dwnld_res_ok =
+			    &msg_to_eim.choice.getBoundProfilePackageRequestEsipa.prepareDownloadResponse.choice.
+			    compactDownloadResponseOk;
+			compact_dwnld_res_ok->compactEuiccSigned2.euiccOtpk =
+			    (OCTET_STRING_t *)&req->prep_dwnld_res->choice.downloadResponseOk.euiccSigned2.euiccOtpk;
+			compact_dwnld_res_ok->compactEuiccSigned2.hashCc =
+			    req->prep_dwnld_res->choice.downloadResponseOk.euiccSigned2.hashCc;
+			compact_dwnld_res_ok->euiccSignature2 =
+			    req->prep_dwnld_res->choice.downloadResponseOk.euiccSignature2;
+			break;
+		}
 		msg_to_eim.choice.getBoundProfilePackageRequestEsipa.prepareDownloadResponse.present =
 		    SGP32_PrepareDownloadResponse_PR_downloadResponseOk;
 		msg_to_eim.choice.getBoundProfilePackageRequestEsipa.prepareDownloadResponse.choice.downloadResponseOk =
 		    req->prep_dwnld_res->choice.downloadResponseOk;
-		msg_to_eim.choice.getBoundProfilePackageRequestEsipa.transactionId =
-		    req->prep_dwnld_res->choice.downloadResponseOk.euiccSigned2.transactionId;
 		break;
 	case PrepareDownloadResponse_PR_downloadResponseError:
 		msg_to_eim.choice.getBoundProfilePackageRequestEsipa.prepareDownloadResponse.present =
@@ -73,14 +103,20 @@ static struct ipa_buf *enc_get_bnd_prfle_pkg_req(const struct ipa_esipa_get_bnd_
 	return ipa_esipa_msg_to_eim_enc(&msg_to_eim, "GetBoundProfilePackage");
 }
 
-static struct ipa_esipa_get_bnd_prfle_pkg_res *dec_get_bnd_prfle_pkg_res(const struct ipa_buf *msg_to_ipa_encoded)
+static struct ipa_esipa_get_bnd_prfle_pkg_res *dec_get_bnd_prfle_pkg_res(const struct ipa_buf *msg_to_ipa_encoded,
+									   const struct ipa_esipa_get_bnd_prfle_pkg_req *req,
+									   bool ref)
 {
 	struct EsipaMessageFromEimToIpa *msg_to_ipa = NULL;
 	struct ipa_esipa_get_bnd_prfle_pkg_res *res = NULL;
+	const TransactionId_t *transaction_id;
 
-	msg_to_ipa =
-	    ipa_esipa_msg_to_ipa_dec(msg_to_ipa_encoded, "GetBoundProfilePackage",
-				     EsipaMessageFromEimToIpa_PR_getBoundProfilePackageResponseEsipa);
+	if (ref)
+		msg_to_ipa = ipa_esipa_msg_to_ipa_dec_ref(msg_to_ipa_encoded, "GetBoundProfilePackage",
+							  EsipaMessageFromEimToIpa_PR_getBoundProfilePackageResponseEsipa);
+	else
+		msg_to_ipa = ipa_esipa_msg_to_ipa_dec(msg_to_ipa_encoded, "GetBoundProfilePackage",
+						      EsipaMessageFromEimToIpa_PR_getBoundProfilePackageResponseEsipa);
 	if (!msg_to_ipa)
 		return NULL;
 
@@ -92,6 +128,18 @@ static struct ipa_esipa_get_bnd_prfle_pkg_res *dec_get_bnd_prfle_pkg_res(const s
 		IPA_LOGP_ESIPA("GetBoundProfilePackage", LINFO, "GetBoundProfilePackageResponseEsipa_PR_getBoundProfilePackageOkEsipa\n");
 		res->get_bnd_prfle_pkg_ok =
 		    &msg_to_ipa->choice.getBoundProfilePackageResponseEsipa.choice.getBoundProfilePackageOkEsipa;
+
+		/* The transactionId is optional in the response, but when present, it must match */
+		transaction_id = req_transaction_id(req);
+		if (res->get_bnd_prfle_pkg_ok->transactionId
+		    && !IPA_ASN_STR_CMP(res->get_bnd_prfle_pkg_ok->transactionId, transaction_id)) {
+			IPA_LOGP_ESIPA("GetBoundProfilePackage", LERROR,
+				       "eIM responded with unexpected transaction ID (expected: %s, got: %s)\n",
+				       ipa_hexdump(transaction_id->buf, transaction_id->size),
+				       ipa_hexdump(res->get_bnd_prfle_pkg_ok->transactionId->buf,
+						   res->get_bnd_prfle_pkg_ok->transactionId->size));
+			res->get_bnd_prfle_pkg_err = -1;
+		}
 		break;
 	case GetBoundProfilePackageResponseEsipa_PR_getBoundProfilePackageErrorEsipa:
 		IPA_LOGP_ESIPA("GetBoundProfilePackage", LERROR, "GetBoundProfilePackageResponseEsipa_PR_getBoundProfilePackageErrorEsipa\n");
@@ -122,7 +170,7 @@ struct ipa_esipa_get_bnd_prfle_pkg_res *ipa_esipa_get_bnd_prfle_pkg(struct ipa_c
 	struct ipa_esipa_get_bnd_prfle_pkg_res *res = NULL;
 
 	IPA_LOGP_ESIPA("GetBoundProfilePackage", LINFO, "Preparing encoded profile package request\n");
-	esipa_req = enc_get_bnd_prfle_pkg_req(req);
+	esipa_req = enc_get_bnd_prfle_pkg_req(ctx, req);
 	if (!esipa_req)
 		goto error;
 
@@ -132,13 +180,86 @@ struct ipa_esipa_get_bnd_prfle_pkg_res *ipa_esipa_get_bnd_prfle_pkg(struct ipa_c
 		goto error;
 
 	IPA_LOGP_ESIPA("GetBoundProfilePackage", LINFO, "Decoding profile package received from eIM\n");
-	res = dec_get_bnd_prfle_pkg_res(esipa_res);
+	res = dec_get_bnd_prfle_pkg_res(esipa_res, req, true);
+	if (res && res->get_bnd_prfle_pkg_err)
+		ipa_esipa_eim_knows_reset(ctx, "GetBoundProfilePackage");
 	if (!res)
 		goto error;
 
+	/* Keep the encoded response, the decoded response references it and the BoundProfilePackage is passed on to
+	 * the eUICC as it was received */
+	res->msg_to_ipa_encoded = esipa_res;
+	esipa_res = NULL;
+
+error:
+	IPA_FREE(esipa_req);
+	ipa_esipa_res_free(ctx, esipa_res);
+	return res;
+}
+
+static int feed_bpp_stream_cb(const uint8_t *data, size_t len, void *priv)
+{
+	return ipa_bpp_segments_stream_feed(priv, data, len);
+}
+
+/*! Function: (ESipa) GetBoundProfilePackage, streaming variant. The BoundProfilePackage is split into ES8+ segments
+ *  while it is received and each segment is passed to a callback function as soon as it is complete, so that the
+ *  segments can be loaded into the eUICC while the download is still ongoing.
+ *  \param[inout] ctx pointer to ipa_context.
+ *  \param[in] req pointer to struct that holds the function parameters.
+ *  \param[in] segment_cb callback function that receives the ES8+ segments.
+ *  \param[in] priv private data pointer that is passed to the callback function.
+ *  \returns pointer newly allocated struct with function result, NULL on error. */
+struct ipa_esipa_get_bnd_prfle_pkg_res *ipa_esipa_get_bnd_prfle_pkg_stream(struct ipa_context *ctx,
+									   const struct ipa_esipa_get_bnd_prfle_pkg_req *req,
+									   ipa_bpp_segment_cb segment_cb, void *priv)
+{
+	struct ipa_buf *esipa_req = NULL;
+	struct ipa_bpp_segments_stream *stream = NULL;
+	const struct ipa_buf *esipa_res;
+	const TransactionId_t *transaction_id;
+	struct ipa_esipa_get_bnd_prfle_pkg_res *res = NULL;
+
+	IPA_LOGP_ESIPA("GetBoundProfilePackage", LINFO, "Preparing encoded profile package request\n");
+	esipa_req = enc_get_bnd_prfle_pkg_req(ctx, req);
+	if (!esipa_req)
+		goto error;
+
+	IPA_LOGP_ESIPA("GetBoundProfilePackage", LINFO, "Requesting profile package from eIM (streaming)\n");
+	stream = ipa_bpp_segments_stream_alloc(segment_cb, priv);
+	if (!stream)
+		goto error;
+
+	/* The segments are passed on while they are received, so the transactionId must be checked by the stream
+	 * parser before the first segment is passed on (see also dec_get_bnd_prfle_pkg_res) */
+	transaction_id = req_transaction_id(req);
+	ipa_bpp_segments_stream_expect_transaction_id(stream, transaction_id->buf, transaction_id->size);
+
+	if (ipa_esipa_req_stream(ctx, esipa_req, "GetBoundProfilePackage", feed_bpp_stream_cb, stream) < 0)
+		goto error;
+
+	if (ipa_bpp_segments_stream_complete(stream)) {
+		IPA_LOGP_ESIPA("GetBoundProfilePackage", LINFO, "profile package received, %zu segments streamed\n",
+			       ipa_bpp_segments_stream_count(stream));
+		res = IPA_ALLOC_ZERO(struct ipa_esipa_get_bnd_prfle_pkg_res);
+		res->bpp_streamed = true;
+	} else {
+		/* The response did not contain a BoundProfilePackage, so it was kept as a whole (most likely an
+		 * error) */
+		esipa_res = ipa_bpp_segments_stream_envelope(stream);
+		if (!esipa_res) {
+			IPA_LOGP_ESIPA("GetBoundProfilePackage", LERROR, "profile package incomplete!\n");
+			goto error;
+		}
+		IPA_LOGP_ESIPA("GetBoundProfilePackage", LINFO, "Decoding response received from eIM\n");
+		res = dec_get_bnd_prfle_pkg_res(esipa_res, req, false);
+		if (res && res->get_bnd_prfle_pkg_err)
+			ipa_esipa_eim_knows_reset(ctx, "GetBoundProfilePackage");
+	}
+
 error:
 	IPA_FREE(esipa_req);
-	IPA_FREE(esipa_res);
+	ipa_bpp_segments_stream_free(stream);
 	return res;
 }
 
@@ -146,5 +267,14 @@ error:
  *  \param[in] res pointer to function result. */
 void ipa_esipa_get_bnd_prfle_pkg_res_free(struct ipa_esipa_get_bnd_prfle_pkg_res *res)
 {
-	IPA_ESIPA_RES_FREE(res);
+	struct ipa_buf *msg_to_ipa_encoded;
+
+	if (!res)
+		return;
+
+	/* The decoded response references the encoded response, so it is freed first */
+	msg_to_ipa_encoded = res->msg_to_ipa_encoded;
+	ASN_STRUCT_FREE(asn_DEF_EsipaMessageFromEimToIpa, res->msg_to_ipa);
+	IPA_FREE(res);
+	IPA_FREE(msg_to_ipa_encoded);
 }
@@ -3,6 +3,7 @@
 #include <PrepareDownloadResponse.h>
 #include <EsipaMessageFromEimToIpa.h>
 #include <GetBoundProfilePackageOkEsipa.h>
+#include "bpp_segments.h"
 struct ipa_context;
 
 struct ipa_esipa_get_bnd_prfle_pkg_req {
@@ -13,8 +14,19 @@ struct ipa_esipa_get_bnd_prfle_pkg_res {
 	struct EsipaMessageFromEimToIpa *msg_to_ipa;
 	struct GetBoundProfilePackageOkEsipa *get_bnd_prfle_pkg_ok;
 	long get_bnd_prfle_pkg_err;
+
+	/*! The encoded response, msg_to_ipa references it and the ES8+ segments are sliced from it (see
+	 *  ipa_bpp_segments_slice) */
+	struct ipa_buf *msg_to_ipa_encoded;
+
+	/*! The BoundProfilePackage was not stored but passed on segment by segment as it was received (see
+	 *  ipa_esipa_get_bnd_prfle_pkg_stream) */
+	bool bpp_streamed;
 };
 
 struct ipa_esipa_get_bnd_prfle_pkg_res *ipa_esipa_get_bnd_prfle_pkg(struct ipa_context *ctx,
 								    const struct ipa_esipa_get_bnd_prfle_pkg_req *req);
+struct ipa_esipa_get_bnd_prfle_pkg_res *ipa_esipa_get_bnd_prfle_pkg_stream(struct ipa_context *ctx,
+									   const struct ipa_esipa_get_bnd_prfle_pkg_req *req,
+									   ipa_bpp_segment_cb segment_cb, void *priv);
 void ipa_esipa_get_bnd_prfle_pkg_res_free(struct ipa_esipa_get_bnd_prfle_pkg_res *res);
@@ -88,17 +88,29 @@ struct ipa_esipa_get_eim_pkg_res *ipa_esipa_get_eim_pkg(struct ipa_context *ctx,
 	if (!esipa_req)
 		goto error;
 
-	esipa_res = ipa_esipa_req(ctx, esipa_req, "GetEimPackage");
+	if (ctx->cfg->eim_long_poll_timeout)
+		esipa_res = ipa_esipa_req_long_poll(ctx, esipa_req, "GetEimPackage", ctx->cfg->eim_long_poll_timeout);
+	else
+		esipa_res = ipa_esipa_req(ctx, esipa_req, "GetEimPackage");
 	if (!esipa_res)
 		goto error;
 
+	/* The long poll has ended without an eIM package (the eIM did not respond in time or responded without
+	 * content) */
+	if (ctx->cfg->eim_long_poll_timeout && esipa_res->len == 0) {
+		IPA_LOGP_ESIPA("GetEimPackage", LINFO, "long poll ended without eIM package\n");
+		res = IPA_ALLOC_ZERO(struct ipa_esipa_get_eim_pkg_res);
+		res->long_poll_timeout = true;
+		goto error;
+	}
+
 	res = dec_get_eim_pkg_req(esipa_res);
 	if (!res)
 		goto error;
 
 error:
 	IPA_FREE(esipa_req);
-	IPA_FREE(esipa_res);
+	ipa_esipa_res_free(ctx, esipa_res);
 	return res;
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <EsipaMessageFromEimToIpa.h>
 #include <EuiccPackageRequest.h>
 #include <IpaEuiccDataRequest.h>
@@ -13,6 +14,7 @@ struct ipa_esipa_get_eim_pkg_res {
 	struct IpaEuiccDataRequest *ipa_euicc_data_request;
 	struct ProfileDownloadTriggerRequest *dwnld_trigger_request;
 	long eim_pkg_err;
+	bool long_poll_timeout;
 };
 
 struct ipa_esipa_get_eim_pkg_res *ipa_esipa_get_eim_pkg(struct ipa_context *ctx, const uint8_t *eid);
@@ -5,6 +5,7 @@
  */
 
 #include <stdint.h>
+#include <string.h>
 #include <errno.h>
 #include <onomondo/ipa/http.h>
 #include <onomondo/ipa/log.h>
@@ -17,10 +18,90 @@
 #include "esipa.h"
 #include "esipa_handle_notif.h"
 
-static struct ipa_buf *enc_handle_notif_req(const struct ipa_esipa_handle_notif_req *req)
+/* simaResponse that represents a successful installation, it is left out of the compact format */
+static const uint8_t sima_response_ok[] = { 0x30, 0x07, 0xA0, 0x05, 0x30, 0x03, 0x80, 0x01, 0x00 };
+
+/* Convert ProfileInstallationResult into its compact format (see also SGP.32, section 5.14.7). The eIM reconstructs
+ * notificationMetadata and smdpOid from its own records, so only the values that it cannot know are transferred. */
+static bool compact_prfle_inst_res(struct CompactProfileInstallationResult *compact_prfle_inst_res,
+				   BOOLEAN_t *iccid_present, const struct ProfileInstallationResultData *prfle_inst_res_data,
+				   const EuiccSignPIR_t *euicc_sign_pir)
+{
+	struct CompactProfileInstallationResultData *compact_data =
+	    &compact_prfle_inst_res->compactProfileInstallationResultData;
+	const struct SuccessResult *success_result;
+
+	switch (prfle_inst_res_data->finalResult.present) {
+	case ProfileInstallationResultData__finalResult_PR_successResult:
+		/* Only byte 14 and 15 of the ISD-P AID are transferred */
+		success_result = &prfle_inst_res_data->finalResult.choice.successResult;
+		if (success_result->aid.size != IPA_LEN_ISDP_AID)
+			return false;
+		compact_data->compactFinalResult.present =
+		    CompactProfileInstallationResultData__compactFinalResult_PR_compactSuccessResult;
+		compact_data->compactFinalResult.choice.compactSuccessResult.compactAid.buf = success_result->aid.buf + 13;
+		compact_data->compactFinalResult.choice.compactSuccessResult.compactAid.size = 2;
+		if (success_result->simaResponse.size != sizeof(sima_response_ok) ||
+		    memcmp(success_result->simaResponse.buf, sima_response_ok, sizeof(sima_response_ok)) != 0)
+			compact_data->compactFinalResult.choice.compactSuccessResult.simaResponse =
+			    (OCTET_STRING_t *)&success_result->simaResponse;
+		break;
+	case ProfileInstallationResultData__finalResult_PR_errorResult:
+		compact_data->compactFinalResult.present =
+		    CompactProfileInstallationResultData__compactFinalResult_PR_errorResult;
+		compact_data->compactFinalResult.choice.errorResult = prfle_inst_res_data->finalResult.choice.errorResult;
+		break;
+	default:
+		return false;
+	}
+
+	compact_data->transactionId = prfle_inst_res_data->transactionId;
+	compact_data->seqNumber = prfle_inst_res_data->notificationMetadata.seqNumber;
+	if (!prfle_inst_res_data->notificationMetadata.iccid) {
+		*iccid_present = false;
+		compact_data->iccidPresent = iccid_present;
+	}
+	compact_prfle_inst_res->euiccSignPIR = *euicc_sign_pir;
+
+	return true;
+}
+
+/* Convert a pending notification into its compact format. (The compact format of otherSignedNotification omits the
+ * certificates, the eIM knows them from the eUICC data or from a previous authentication.) */
+static void compact_pending_notif(struct SGP32_PendingNotification *pending_notif, BOOLEAN_t *iccid_present)
+{
+	struct SGP32_PendingNotification compact_notif = { 0 };
+
+	switch (pending_notif->present) {
+	case SGP32_PendingNotification_PR_profileInstallationResult:
+		if (!compact_prfle_inst_res(&compact_notif.choice.compactProfileInstallationResult, iccid_present,
+					    &pending_notif->choice.profileInstallationResult.profileInstallationResultData,
+					    &pending_notif->choice.profileInstallationResult.euiccSignPIR)) {
+			IPA_LOGP_ESIPA("HandleNotification", LINFO,
+				       "cannot convert profile installation result, using full format\n");
+			return;
+		}
+		compact_notif.present = SGP32_PendingNotification_PR_compactProfileInstallationResult;
+		break;
+	case SGP32_PendingNotification_PR_otherSignedNotification:
+		compact_notif.present = SGP32_PendingNotification_PR_compactOtherSignedNotification;
+		compact_notif.choice.compactOtherSignedNotification.tbsOtherNotification =
+		    pending_notif->choice.otherSignedNotification.tbsOtherNotification;
+		compact_notif.choice.compactOtherSignedNotification.euiccNotificationSignature =
+		    pending_notif->choice.otherSignedNotification.euiccNotificationSignature;
+		break;
+	default:
+		return;
+	}
+
+	*pending_notif = compact_notif;
+}
+
+static struct ipa_buf *enc_handle_notif_req(const struct ipa_context *ctx, const struct ipa_esipa_handle_notif_req *req)
 {
 	struct EsipaMessageFromIpaToEim msg_to_eim = { 0 };
 	struct SGP32_ProfileInstallationResult *prfle_inst_res;
+	BOOLEAN_t iccid_present;
 
 	msg_to_eim.present = EsipaMessageFromIpaToEim_PR_handleNotificationEsipa;
 	msg_to_eim.choice.handleNotificationEsipa.present = HandleNotificationEsipa_PR_pendingNotification;
@@ -41,6 +122,10 @@ static struct ipa_buf *enc_handle_notif_req(const struct ipa_esipa_handle_notif_
 		return NULL;
 	}
 
+	if (ctx->cfg->esipa_minimize_bytes)
+		compact_pending_notif(&msg_to_eim.choice.handleNotificationEsipa.choice.pendingNotification,
+				      &iccid_present);
+
 	/* Encode */
 	return ipa_esipa_msg_to_eim_enc(&msg_to_eim, "HandleNotification");
 }
@@ -71,7 +156,7 @@ int ipa_esipa_handle_notif(struct ipa_context *ctx, const struct ipa_esipa_handl
 
 	IPA_LOGP_ESIPA("HandleNotification", LINFO, "Sending notification to eIM\n");
 
-	esipa_req = enc_handle_notif_req(req);
+	esipa_req = enc_handle_notif_req(ctx, req);
 	if (!esipa_req)
 		goto error;
 
@@ -86,6 +171,6 @@ int ipa_esipa_handle_notif(struct ipa_context *ctx, const struct ipa_esipa_handl
 	rc = 0;
 error:
 	IPA_FREE(esipa_req);
-	IPA_FREE(esipa_res);
+	ipa_esipa_res_free(ctx, esipa_res);
 	return rc;
 }
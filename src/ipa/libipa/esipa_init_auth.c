@@ -31,7 +31,7 @@ static const struct num_str_map error_code_strings[] = {
 	{ 0, NULL }
 };
 
-static struct ipa_buf *enc_init_auth_req(const struct ipa_esipa_init_auth_req *req)
+static struct ipa_buf *enc_init_auth_req(const struct ipa_context *ctx, const struct ipa_esipa_init_auth_req *req)
 {
 	struct EsipaMessageFromIpaToEim msg_to_eim = { 0 };
 	struct OCTET_STRING smdp_address = { 0 };
@@ -48,8 +48,11 @@ static struct ipa_buf *enc_init_auth_req(const struct ipa_esipa_init_auth_req *r
 		IPA_ASSIGN_STR_TO_ASN(smdp_address, req->smdp_addr);
 	}
 
-	/* eUICC info */
-	msg_to_eim.choice.initiateAuthenticationRequestEsipa.euiccInfo1 = (EUICCInfo1_t *) req->euicc_info_1;
+	/* eUICC info (optional, may be left out when the eIM already knows it) */
+	if (ctx->cfg->esipa_minimize_bytes && ctx->eim_knows.euicc_info_1)
+		IPA_LOGP_ESIPA("InitiateAuthentication", LINFO, "eIM already knows euiccInfo1, leaving it out\n");
+	else
+		msg_to_eim.choice.initiateAuthenticationRequestEsipa.euiccInfo1 = (EUICCInfo1_t *) req->euicc_info_1;
 
 	/* Encode */
 	return ipa_esipa_msg_to_eim_enc(&msg_to_eim, "InitiateAuthentication");
@@ -103,7 +106,7 @@ struct ipa_esipa_init_auth_res *ipa_esipa_init_auth(struct ipa_context *ctx, con
 	IPA_LOGP_ESIPA("InitiateAuthentication", LINFO, "Requesting authentication with eUICC challenge: %s\n",
 		       ipa_hexdump(req->euicc_challenge, IPA_LEN_EUICC_CHLG));
 
-	esipa_req = enc_init_auth_req(req);
+	esipa_req = enc_init_auth_req(ctx, req);
 	if (!esipa_req)
 		goto error;
 
@@ -112,6 +115,8 @@ struct ipa_esipa_init_auth_res *ipa_esipa_init_auth(struct ipa_context *ctx, con
 		goto error;
 
 	res = dec_init_auth_res(esipa_res);
+	if (res && res->init_auth_err)
+		ipa_esipa_eim_knows_reset(ctx, "InitiateAuthentication");
 	if (!res)
 		goto error;
 
@@ -138,7 +143,7 @@ struct ipa_esipa_init_auth_res *ipa_esipa_init_auth(struct ipa_context *ctx, con
 	}
 error:
 	IPA_FREE(esipa_req);
-	IPA_FREE(esipa_res);
+	ipa_esipa_res_free(ctx, esipa_res);
 	return res;
 }
 
@@ -0,0 +1,87 @@
+/*
+ * Author: Philipp Maier <pmaier@sysmocom.de> / sysmocom - s.f.m.c. GmbH
+ * See also: GSMA SGP.32, section 5.14.4: Function (ESipa): TransferEimPackage
+ *
+ */
+
+#include <stdint.h>
+#include <onomondo/ipa/log.h>
+#include <onomondo/ipa/ipad.h>
+#include <EsipaMessageFromIpaToEim.h>
+#include <TransferEimPackageRequest.h>
+#include <TransferEimPackageResponse.h>
+#include "utils.h"
+#include "context.h"
+#include "esipa.h"
+#include "esipa_get_eim_pkg.h"
+#include "esipa_transfer_eim_pkg.h"
+
+static const struct num_str_map error_code_strings[] = {
+	{ TransferEimPackageResponse__eimPackageError_invalidPackageFormat, "invalidPackageFormat" },
+	{ TransferEimPackageResponse__eimPackageError_unknownPackage, "unknownPackage" },
+	{ TransferEimPackageResponse__eimPackageError_undefinedError, "undefinedError" },
+	{ 0, NULL }
+};
+
+/*! Decode TransferEimPackageRequest (the eIM is the originator of this function).
+ *  \param[in] esipa_req buffer with the ESipa message that the eIM has sent.
+ *  \returns pointer newly allocated struct with the eIM package (same format as GetEimPackage), NULL on error. */
+struct ipa_esipa_get_eim_pkg_res *ipa_esipa_transfer_eim_pkg_req_dec(const struct ipa_buf *esipa_req)
+{
+	struct EsipaMessageFromEimToIpa *msg_to_ipa = NULL;
+	struct ipa_esipa_get_eim_pkg_res *res = NULL;
+	struct TransferEimPackageRequest *transfer_eim_pkg_req;
+
+	msg_to_ipa = ipa_esipa_msg_to_ipa_dec(esipa_req, "TransferEimPackage",
+					      EsipaMessageFromEimToIpa_PR_transferEimPackageRequest);
+	if (!msg_to_ipa)
+		return NULL;
+
+	/* The eIM package is passed on in the same form as a package that was retrieved using GetEimPackage, so that
+	 * it can be executed in the same way. */
+	res = IPA_ALLOC_ZERO(struct ipa_esipa_get_eim_pkg_res);
+	res->msg_to_ipa = msg_to_ipa;
+	transfer_eim_pkg_req = &msg_to_ipa->choice.transferEimPackageRequest;
+
+	switch (transfer_eim_pkg_req->present) {
+	case TransferEimPackageRequest_PR_euiccPackageRequest:
+		res->euicc_package_request = &transfer_eim_pkg_req->choice.euiccPackageRequest;
+		break;
+	case TransferEimPackageRequest_PR_ipaEuiccDataRequest:
+		res->ipa_euicc_data_request = &transfer_eim_pkg_req->choice.ipaEuiccDataRequest;
+		break;
+	case TransferEimPackageRequest_PR_profileDownloadTriggerRequest:
+		res->dwnld_trigger_request = &transfer_eim_pkg_req->choice.profileDownloadTriggerRequest;
+		break;
+	default:
+		/* eimAcknowledgements are only expected in response to ProvideEimPackageResult */
+		IPA_LOGP_ESIPA("TransferEimPackage", LERROR, "unsupported eIM package content!\n");
+		res->eim_pkg_err = TransferEimPackageResponse__eimPackageError_unknownPackage;
+		break;
+	}
+
+	return res;
+}
+
+/*! Encode TransferEimPackageResponse. The eIM package is executed after the response has been sent, so the response
+ *  only confirms the reception of the eIM package. The result of the execution is delivered to the eIM later (using
+ *  ProvideEimPackageResult, as with eIM packages that are retrieved using GetEimPackage).
+ *  \param[in] eim_pkg_err error code (eimPackageError), 0 when the eIM package was accepted.
+ *  \returns buffer with the encoded ESipa message, NULL on error. */
+struct ipa_buf *ipa_esipa_transfer_eim_pkg_res_enc(long eim_pkg_err)
+{
+	struct EsipaMessageFromIpaToEim msg_to_eim = { 0 };
+	struct TransferEimPackageResponse *transfer_eim_pkg_res = &msg_to_eim.choice.transferEimPackageResponse;
+
+	msg_to_eim.present = EsipaMessageFromIpaToEim_PR_transferEimPackageResponse;
+	if (eim_pkg_err) {
+		IPA_LOGP_ESIPA("TransferEimPackage", LERROR, "rejecting eIM package with error code %ld=%s!\n",
+			       eim_pkg_err, ipa_str_from_num(error_code_strings, eim_pkg_err, "(unknown)"));
+		transfer_eim_pkg_res->present = TransferEimPackageResponse_PR_eimPackageError;
+		transfer_eim_pkg_res->choice.eimPackageError = eim_pkg_err;
+	} else {
+		transfer_eim_pkg_res->present = TransferEimPackageResponse_PR_eimPackageReceived;
+	}
+
+	return ipa_esipa_msg_to_eim_enc(&msg_to_eim, "TransferEimPackage");
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <stdint.h>
+struct ipa_buf;
+struct ipa_esipa_get_eim_pkg_res;
+
+struct ipa_esipa_get_eim_pkg_res *ipa_esipa_transfer_eim_pkg_req_dec(const struct ipa_buf *esipa_req);
+struct ipa_buf *ipa_esipa_transfer_eim_pkg_res_enc(long eim_pkg_err);
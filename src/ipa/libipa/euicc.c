@@ -13,6 +13,7 @@
 #include <onomondo/ipa/log.h>
 #include <onomondo/ipa/ipad.h>
 #include "context.h"
+#include "utils.h"
 #include "euicc.h"
 
 #define STORE_DATA_CLA 0x80
@@ -32,63 +33,133 @@
 #define MAX_BLOCKSIZE_TX 255
 #define MAX_BLOCKSIZE_RX 256
 
+/* Block sizes for extended length APDUs, see also ISO/IEC 7816-4, section 5.1 */
+#define MAX_BLOCKSIZE_TX_EXT 65535
+#define MAX_BLOCKSIZE_RX_EXT 65536
+
+/* Header (CLA, INS, P1, P2, Lc) and trailer (Le) of a request APDU, extended length encoding */
+#define MAX_APDU_HDR 7
+#define MAX_APDU_TRL 2
+#define MAX_APDU_OVERHEAD (MAX_APDU_HDR + MAX_APDU_TRL)
+
+#define SW_WRONG_LENGTH 0x6700
+
 struct req_apdu {
 	uint8_t cla;
 	uint8_t ins;
 	uint8_t p1;
 	uint8_t p2;
-	uint8_t lc;
-	uint16_t le;
-	uint8_t data[255];
+	uint16_t lc;
+	uint32_t le;
+	const uint8_t *data;
 };
 
 struct res_apdu {
-	uint16_t le;
-	uint8_t data[255];
+	uint32_t le;
+	const uint8_t *data;
 	uint16_t sw;
 };
 
-/* Format the given req_apdu struct into an IPA_BUF that contains the APDU
- * bytes to send. */
-static struct ipa_buf *format_req_apdu(const struct req_apdu *req_apdu)
+/* Check whether the given req_apdu requires an extended length encoding */
+static bool req_apdu_is_ext(const struct req_apdu *req_apdu)
 {
-	struct ipa_buf *buf_req = ipa_buf_alloc(5 + req_apdu->lc);
-	assert(buf_req);
+	return req_apdu->lc > MAX_BLOCKSIZE_TX || req_apdu->le > MAX_BLOCKSIZE_RX;
+}
 
-	buf_req->data[0] = req_apdu->cla;
-	buf_req->data[1] = req_apdu->ins;
-	buf_req->data[2] = req_apdu->p1;
-	buf_req->data[3] = req_apdu->p2;
+/* Index of the elements in the IO vector that is used to transceive a request APDU */
+enum req_apdu_iov {
+	REQ_APDU_IOV_HDR,
+	REQ_APDU_IOV_DATA,
+	REQ_APDU_IOV_TRL,
+	_NUM_REQ_APDU_IOV
+};
 
-	if (req_apdu->lc > 0 && req_apdu->le == 0) {
+/* Format the given req_apdu struct into an IO vector that consists of the
+ * header (CLA, INS, P1, P2, Lc), the data and the trailer (Le). The header
+ * and the trailer are built in the (preallocated) frame buffer, the data
+ * element points directly to the data of the req_apdu struct, so no copy of
+ * the data is made. In case Lc or Le exceed the limits of a short APDU, the
+ * APDU is encoded as extended length APDU (see also ISO/IEC 7816-4, section
+ * 5.1). */
+static void format_req_apdu(struct ipa_buf *iov, struct ipa_buf *frame, const struct req_apdu *req_apdu)
+{
+	bool ext = req_apdu_is_ext(req_apdu);
+	uint8_t *hdr = frame->data;
+	uint8_t *trl = frame->data + MAX_APDU_HDR;
+	size_t hdr_len;
+	size_t trl_len = 0;
+
+	assert(frame->data_len >= MAX_APDU_OVERHEAD);
+
+	hdr[0] = req_apdu->cla;
+	hdr[1] = req_apdu->ins;
+	hdr[2] = req_apdu->p1;
+	hdr[3] = req_apdu->p2;
+
+	if (req_apdu->lc > 0 && req_apdu->le == 0 && ext) {
+		/* Send data (no response data expected), extended Lc field */
+		hdr[4] = 0x00;
+		hdr[5] = (req_apdu->lc >> 8) & 0xff;
+		hdr[6] = req_apdu->lc & 0xff;
+		hdr_len = 7;
+	} else if (req_apdu->lc > 0 && req_apdu->le == 0) {
 		/* Send data (no response data expected) */
-		buf_req->data[4] = req_apdu->lc;
-		memcpy(buf_req->data + 5, req_apdu->data, req_apdu->lc);
-		buf_req->len = 5 + req_apdu->lc;
+		hdr[4] = req_apdu->lc;
+		hdr_len = 5;
+	} else if (req_apdu->lc == 0 && req_apdu->le > 0 && ext) {
+		/* Receive data (no data to send), extended Le field, a value of 65536 is encoded as '0000' */
+		hdr[4] = 0x00;
+		hdr[5] = (req_apdu->le >> 8) & 0xff;
+		hdr[6] = req_apdu->le & 0xff;
+		hdr_len = 7;
 	} else if (req_apdu->lc == 0 && req_apdu->le > 0) {
 		/* Receive data (no data to send) */
 		if (req_apdu->le < 256)
-			buf_req->data[4] = req_apdu->le;
+			hdr[4] = req_apdu->le;
 		else
 			/* See also ETSI TS 102 221, section 10.1.6 */
-			buf_req->data[4] = 0;
-		buf_req->len = 5;
+			hdr[4] = 0;
+		hdr_len = 5;
 	} else if (req_apdu->lc == 0 && req_apdu->le == 0) {
 		/* No data to send and no receive data expected */
-		buf_req->data[4] = 0;
-		buf_req->len = 5;
+		hdr[4] = 0;
+		hdr_len = 5;
+	} else if (ext) {
+		/* Send data and receive data (case 4), extended Lc and Le fields, a value of 65536 is encoded as '0000'.
+		 * The T=0 protocol does not support receiving and sending data at the same time. The caller must ensure
+		 * that this case is only used with T=1! */
+		hdr[4] = 0x00;
+		hdr[5] = (req_apdu->lc >> 8) & 0xff;
+		hdr[6] = req_apdu->lc & 0xff;
+		hdr_len = 7;
+		trl[0] = (req_apdu->le >> 8) & 0xff;
+		trl[1] = req_apdu->le & 0xff;
+		trl_len = 2;
 	} else {
-		/* The T=0 protocol does not support receiving and sending data
-		 * at the same time. The caller must ensure that the APDU
-		 * struct is filled in with reasonable values! */
-		assert(NULL);
+		/* Send data and receive data (case 4), see comment above */
+		hdr[4] = req_apdu->lc;
+		hdr_len = 5;
+		if (req_apdu->le < 256)
+			trl[0] = req_apdu->le;
+		else
+			trl[0] = 0;
+		trl_len = 1;
 	}
 
-	return buf_req;
+	iov[REQ_APDU_IOV_HDR].data = hdr;
+	iov[REQ_APDU_IOV_HDR].data_len = hdr_len;
+	iov[REQ_APDU_IOV_HDR].len = hdr_len;
+	iov[REQ_APDU_IOV_DATA].data = (uint8_t *) req_apdu->data;
+	iov[REQ_APDU_IOV_DATA].data_len = req_apdu->lc;
+	iov[REQ_APDU_IOV_DATA].len = req_apdu->lc;
+	iov[REQ_APDU_IOV_TRL].data = trl;
+	iov[REQ_APDU_IOV_TRL].data_len = trl_len;
+	iov[REQ_APDU_IOV_TRL].len = trl_len;
 }
 
 /* Take the received APDU bytes in res_encoded and parse them into an APDU
- * struct (res_apdu) */
+ * struct (res_apdu). The data member of res_apdu will point into
+ * res_encoded, so res_encoded must not be freed while res_apdu is in use. */
 static int parse_res_apdu(struct res_apdu *res_apdu, const struct ipa_buf *res_encoded)
 {
 	memset(res_apdu, 0, sizeof(*res_apdu));
@@ -99,7 +170,7 @@ static int parse_res_apdu(struct res_apdu *res_apdu, const struct ipa_buf *res_e
 
 	res_apdu->le = res_encoded->len - 2;
 	if (res_apdu->le)
-		memcpy(res_apdu->data, res_encoded->data, res_apdu->le);
+		res_apdu->data = res_encoded->data;
 
 	res_apdu->sw = res_encoded->data[res_apdu->le] << 8;
 	res_apdu->sw |= res_encoded->data[res_apdu->le + 1];
@@ -107,83 +178,212 @@ static int parse_res_apdu(struct res_apdu *res_apdu, const struct ipa_buf *res_e
 	return 0;
 }
 
-static int send_es10x_block(struct ipa_context *ctx, uint16_t *sw,
-			    const struct ipa_buf *es10x_req, size_t offset, uint8_t block_nr)
+/* Transceive an APDU using the TX/RX frames of the context. (No heap memory is
+ * allocated here and the request data is passed to the smartcard backend
+ * without copying it.) The data member of res_apdu will point into the RX
+ * frame, so the response data must be used before the next APDU is
+ * transceived. Returns -EIO on communication errors and -EINVAL on invalid
+ * responses. */
+static int transceive_apdu(struct ipa_context *ctx, struct res_apdu *res_apdu, const struct req_apdu *req_apdu)
+{
+	struct ipa_buf iov[_NUM_REQ_APDU_IOV];
+	int rc;
+
+	format_req_apdu(iov, ctx->euicc.tx_frame, req_apdu);
+
+	rc = ipa_scard_transceive_v(ctx->scard_ctx, ctx->euicc.rx_frame, iov, _NUM_REQ_APDU_IOV);
+	if (rc < 0)
+		return -EIO;
+
+	rc = parse_res_apdu(res_apdu, ctx->euicc.rx_frame);
+	if (rc < 0)
+		return -EINVAL;
+
+	return 0;
+}
+
+/* Switch back to short APDUs (in case the eUICC rejects an extended length APDU with a status word, transport
+ * errors are not a reason to fall back since they do not tell us anything about the capabilities of the eUICC) */
+static void fallback_short_apdu(struct ipa_context *ctx, const char *reason)
+{
+	IPA_LOGP(SEUICC, LERROR, "extended length APDU failed (%s), falling back to short APDUs\n", reason);
+	ctx->euicc.ext_apdu = false;
+}
+
+/* Make sure that the ES10x response buffer is large enough to store the given response APDU data. When the first
+ * block of the response is received, the outer BER length tells us the final size of the response, so that we can
+ * allocate the required memory at once (the announced length is not trusted beyond IPA_LEN_EUICC_BUF_RESERVE_MAX). In
+ * case no valid BER header is found, the announced length is too large or the response turns out to be larger than
+ * announced, the buffer grows geometrically. */
+static void reserve_es10x_res(struct ipa_context *ctx, struct ipa_buf **es10x_res, const struct ipa_buf *block)
+{
+	struct ipa_buf *es10x_res_ptr = *es10x_res;
+	struct ipa_buf hdr = *block;
+	size_t required = es10x_res_ptr->len + block->len;
+	size_t realloc_size = 0;
+	size_t hdr_len;
+	size_t value_len;
+
+	if (es10x_res_ptr->len == 0 && block->len) {
+		hdr_len = ipa_parse_btlv_hdr(&value_len, NULL, &hdr);
+		if (hdr_len <= block->len && value_len <= IPA_LEN_EUICC_BUF_RESERVE_MAX - hdr_len
+		    && hdr_len + value_len > es10x_res_ptr->data_len && hdr_len + value_len >= required)
+			realloc_size = hdr_len + value_len;
+	}
+
+	if (!realloc_size && required > es10x_res_ptr->data_len) {
+		realloc_size = es10x_res_ptr->data_len * 2;
+		if (realloc_size < required)
+			realloc_size = required;
+	}
+
+	if (!realloc_size)
+		return;
+
+	IPA_LOGP(SEUICC, LDEBUG,
+		 "eUICC response buffer too small, reallocating more memory (have: %zu bytes, required: %zu bytes, will allocate: %zu bytes)\n",
+		 es10x_res_ptr->data_len, required, realloc_size);
+
+	es10x_res_ptr = ipa_buf_realloc(es10x_res_ptr, realloc_size);
+	assert(es10x_res_ptr);
+	ctx->euicc.res_reallocs++;
+	*es10x_res = es10x_res_ptr;
+}
+
+/* Private data of append_es10x_res_cb */
+struct es10x_res_buf {
+	struct ipa_context *ctx;
+	struct ipa_buf *es10x_res;
+};
+
+/* Append a block of response data to the ES10x response buffer (see also ipa_euicc_transceive_es10x) */
+static int append_es10x_res_cb(const struct ipa_buf *block, void *priv)
+{
+	struct es10x_res_buf *res_buf = priv;
+
+	reserve_es10x_res(res_buf->ctx, &res_buf->es10x_res, block);
+	memcpy(res_buf->es10x_res->data + res_buf->es10x_res->len, block->data, block->len);
+	res_buf->es10x_res->len += block->len;
+
+	return 0;
+}
+
+/* Consumer of the response data of an ES10x function */
+struct es10x_res_sink {
+	ipa_euicc_res_cb res_cb;
+	void *res_cb_priv;
+	/*! number of response bytes passed to res_cb so far */
+	size_t len;
+};
+
+/* Pass the data of a received response APDU on to the consumer */
+static int sink_es10x_res(struct es10x_res_sink *sink, const struct res_apdu *res_apdu)
+{
+	struct ipa_buf block = { (uint8_t *) res_apdu->data, res_apdu->le, res_apdu->le };
+	int rc;
+
+	if (!res_apdu->le)
+		return 0;
+
+	rc = sink->res_cb(&block, sink->res_cb_priv);
+	sink->len += res_apdu->le;
+	if (rc < 0) {
+		IPA_LOGP(SEUICC, LERROR, "ES10x response data rejected by consumer, offset=%zu\n", sink->len);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static int send_es10x_block(struct ipa_context *ctx, uint16_t *sw, struct es10x_res_sink *sink,
+			    const struct ipa_buf *es10x_req, size_t offset, size_t block_nr)
 {
 	size_t len_req;
+	size_t max_blocksize = ctx->euicc.ext_apdu ? MAX_BLOCKSIZE_TX_EXT : MAX_BLOCKSIZE_TX;
 	int rc;
 	struct req_apdu req_apdu = { 0 };
 	struct res_apdu res_apdu = { 0 };
-	struct ipa_buf *buf_req = NULL;
-	struct ipa_buf *buf_res = NULL;
 	uint8_t channel = ctx->cfg->euicc_channel;
 
-	buf_res = ipa_buf_alloc(MAX_BLOCKSIZE_TX + 2);
-	assert(buf_res);
-
 	len_req = es10x_req->len - offset;
 
 	/* fill in request APDU for STORE DATA
 	 * (see also GSMA SGP.22, section 5.7.2) */
 	req_apdu.cla = STORE_DATA_CLA | channel;
 	req_apdu.ins = STORE_DATA_INS;
-	if (len_req > MAX_BLOCKSIZE_TX)
+	if (len_req > max_blocksize)
 		req_apdu.p1 = STORE_DATA_P1_MORE_BLOCKS;
 	else
 		req_apdu.p1 = STORE_DATA_P1_LAST_BLOCK;
+
+	/* The block number is a one byte value, so we cannot transfer more than 256 blocks (see also GlobalPlatform
+	 * Card Specification, section 11.11.2.2) */
+	if (block_nr > 0xff) {
+		IPA_LOGP(SEUICC, LERROR, "ES10x request too large, cannot send more than 256 blocks, offset=%zu\n",
+			 offset);
+		return -EINVAL;
+	}
 	req_apdu.p2 = block_nr;
-	if (len_req > MAX_BLOCKSIZE_TX)
-		req_apdu.lc = MAX_BLOCKSIZE_TX;
+	if (len_req > max_blocksize)
+		req_apdu.lc = max_blocksize;
 	else
-		req_apdu.lc = (uint8_t) len_req;
-	memcpy(req_apdu.data, es10x_req->data + offset, req_apdu.lc);
+		req_apdu.lc = (uint16_t) len_req;
+	req_apdu.data = es10x_req->data + offset;
+
+	/* When T=1 is used, we send the last block as case 4 APDU, so that the eUICC can return the response data
+	 * directly, without the need for an additional GET RESPONSE. */
+	if (ctx->euicc.case4 && req_apdu.p1 == STORE_DATA_P1_LAST_BLOCK)
+		req_apdu.le = ctx->euicc.ext_apdu ? MAX_BLOCKSIZE_RX_EXT : MAX_BLOCKSIZE_RX;
 
 	/* transceive block */
-	buf_req = format_req_apdu(&req_apdu);
-	rc = ipa_scard_transceive(ctx->scard_ctx, buf_res, buf_req);
-	if (rc < 0) {
-		IPA_LOGP(SEUICC, LERROR, "unable to send ES10x block %u, offset=%zu\n", block_nr, offset);
+	rc = transceive_apdu(ctx, &res_apdu, &req_apdu);
+	if (rc == -EIO) {
+		IPA_LOGP(SEUICC, LERROR, "unable to send ES10x block %zu, offset=%zu\n", block_nr, offset);
 		ctx->check_scard = true;
-		goto exit;
-	}
-
-	/* parse response */
-	rc = parse_res_apdu(&res_apdu, buf_res);
-	if (rc < 0) {
+		return rc;
+	} else if (rc < 0) {
 		IPA_LOGP(SEUICC, LERROR,
-			 "invalid response while sending ES10x block %u, offset=%zu\n", block_nr, offset);
-		goto exit;
+			 "invalid response while sending ES10x block %zu, offset=%zu\n", block_nr, offset);
+		return rc;
 	}
 	*sw = res_apdu.sw;
 
-	IPA_LOGP(SEUICC, LINFO, "successfully sent ES10x block %u, offset=%zu, sw=%04x\n", block_nr, offset, *sw);
+	if (*sw == SW_WRONG_LENGTH && req_apdu_is_ext(&req_apdu)) {
+		fallback_short_apdu(ctx, "wrong length");
+		return -EAGAIN;
+	}
+
+	/* Response data may only be present when the last block was sent as case 4 APDU */
+	if (res_apdu.le && req_apdu.le) {
+		rc = sink_es10x_res(sink, &res_apdu);
+		if (rc < 0)
+			return rc;
+		IPA_LOGP(SEUICC, LINFO, "received %u bytes of response data with ES10x block %zu\n", res_apdu.le,
+			 block_nr);
+	} else if (res_apdu.le) {
+		IPA_LOGP(SEUICC, LERROR, "unexpected response data while sending ES10x block %zu, offset=%zu\n",
+			 block_nr, offset);
+		return -EINVAL;
+	}
+
+	IPA_LOGP(SEUICC, LINFO, "successfully sent ES10x block %zu, offset=%zu, sw=%04x\n", block_nr, offset, *sw);
 
 	/* Return how many data we have sent. */
-	rc = req_apdu.lc;
-exit:
-	IPA_FREE(buf_req);
-	IPA_FREE(buf_res);
-	return rc;
+	return req_apdu.lc;
 }
 
 static int recv_es10x_block(struct ipa_context *ctx, uint16_t *sw,
-			    struct ipa_buf **es10x_res, uint16_t block_len, uint8_t block_nr)
+			    struct es10x_res_sink *sink, uint32_t block_len, size_t block_nr)
 {
 	int rc;
 	struct req_apdu req_apdu = { 0 };
 	struct res_apdu res_apdu = { 0 };
-	struct ipa_buf *buf_req = NULL;
-	struct ipa_buf *buf_res = NULL;
 	uint8_t channel = ctx->cfg->euicc_channel;
-	struct ipa_buf *es10x_res_ptr = *es10x_res;
-	size_t realloc_size;
+	bool ext = ctx->euicc.ext_apdu;
 
 	/* We only support channel 0-3 */
 	assert(channel <= 3);
 
-	buf_res = ipa_buf_alloc(MAX_BLOCKSIZE_RX + 2);
-	assert(buf_res);
-
 	/* In case the expected block length exceeds our buffer limit, we must
 	 * clip. This is no problem since it is always up to the caller to
 	 * check by the return code how many bytes were actually transmitted.
@@ -192,6 +392,11 @@ static int recv_es10x_block(struct ipa_context *ctx, uint16_t *sw,
 	if (block_len > MAX_BLOCKSIZE_RX)
 		block_len = MAX_BLOCKSIZE_RX;
 
+	/* When extended length APDUs are used, the length hint in the 61xx status word is no longer meaningful. We
+	 * just ask for as many bytes as we can receive and let the eUICC decide how much to send. */
+	if (ext)
+		block_len = MAX_BLOCKSIZE_RX_EXT;
+
 	/* fill in request APDU for GET RESPONSE
 	 * (see also ISO/IEC 7816-4, 7.6.1) */
 	req_apdu.cla = GET_RESPONSE_CLA | channel;
@@ -202,69 +407,53 @@ static int recv_es10x_block(struct ipa_context *ctx, uint16_t *sw,
 	req_apdu.le = block_len;
 
 	/* receive block */
-	buf_req = format_req_apdu(&req_apdu);
-	rc = ipa_scard_transceive(ctx->scard_ctx, buf_res, buf_req);
-	if (rc < 0) {
-		IPA_LOGP(SEUICC, LERROR, "unable to receive ES10x block %u, offset=%zu\n", block_nr,
-			 es10x_res_ptr->len);
+	rc = transceive_apdu(ctx, &res_apdu, &req_apdu);
+	if (rc == -EIO) {
+		IPA_LOGP(SEUICC, LERROR, "unable to receive ES10x block %zu, offset=%zu\n", block_nr,
+			 sink->len);
 		ctx->check_scard = true;
-		rc = -EIO;
-		goto exit;
-	}
-
-	/* parse response */
-	rc = parse_res_apdu(&res_apdu, buf_res);
-	if (rc < 0) {
+		return rc;
+	} else if (rc < 0) {
 		IPA_LOGP(SEUICC, LERROR,
-			 "invalid response while receiving ES10x block %u, offset=%zu\n", block_nr, es10x_res_ptr->len);
-		rc = -EINVAL;
-		goto exit;
+			 "invalid response while receiving ES10x block %zu, offset=%zu\n", block_nr, sink->len);
+		return rc;
 	}
-	if (res_apdu.le != block_len) {
-		IPA_LOGP(SEUICC, LERROR,
-			 "unexpected block length (expected:%u, got:%u) while sending ES10x block %u, offset=%zu\n",
-			 block_len, res_apdu.le, block_nr, es10x_res_ptr->len);
-		rc = -EINVAL;
-		goto exit;
+	if (ext && res_apdu.sw == SW_WRONG_LENGTH) {
+		fallback_short_apdu(ctx, "wrong length");
+		return -EAGAIN;
 	}
-	if (es10x_res_ptr->len + res_apdu.le > es10x_res_ptr->data_len) {
-		realloc_size = ((es10x_res_ptr->len + res_apdu.le) / IPA_LEN_EUICC_BUF + 1) * IPA_LEN_EUICC_BUF;
-
-		IPA_LOGP(SEUICC, LDEBUG,
-			 "eUICC response buffer exhausted, reallocating more memory (have: %zu bytes, required: %zu bytes, will allocate: %zu bytes)\n",
-			 es10x_res_ptr->data_len, es10x_res_ptr->len + res_apdu.le, realloc_size);
-
-		/* Reallocate the buffer with enough space for one additional block of size MAX_BLOCKSIZE_RX */
-		es10x_res_ptr = ipa_buf_realloc(es10x_res_ptr, realloc_size);
-		assert(es10x_res_ptr);
+	if ((!ext && res_apdu.le != block_len) || (ext && res_apdu.le > block_len)) {
+		IPA_LOGP(SEUICC, LERROR,
+			 "unexpected block length (expected:%u, got:%u) while sending ES10x block %zu, offset=%zu\n",
+			 block_len, res_apdu.le, block_nr, sink->len);
+		return -EINVAL;
 	}
 
-	memcpy(es10x_res_ptr->data + es10x_res_ptr->len, res_apdu.data, res_apdu.le);
-	es10x_res_ptr->len += res_apdu.le;
+	rc = sink_es10x_res(sink, &res_apdu);
+	if (rc < 0)
+		return rc;
 	*sw = res_apdu.sw;
 
 	IPA_LOGP(SEUICC, LINFO,
-		 "successfully received ES10x block %u, offset=%zu, sw=%04x\n", block_nr, es10x_res_ptr->len, *sw);
+		 "successfully received ES10x block %zu, offset=%zu, sw=%04x\n", block_nr, sink->len, *sw);
 
 	/* Return how many data we have received. */
-	rc = res_apdu.le;
-exit:
-	IPA_FREE(buf_req);
-	IPA_FREE(buf_res);
-	*es10x_res = es10x_res_ptr;
-	return rc;
+	return res_apdu.le;
 }
 
-static int euicc_transceive_es10x(struct ipa_context *ctx, struct ipa_buf **es10x_res, const struct ipa_buf *es10x_req)
+static int euicc_transceive_es10x(struct ipa_context *ctx, struct es10x_res_sink *sink, const struct ipa_buf *es10x_req)
 {
 	uint16_t sw;
-	uint16_t block_len = 0;
-	uint8_t block_nr = 0;
+	uint32_t block_len = 0;
+	size_t block_nr = 0;
 	size_t offset = 0;
 	int rc;
 
 	while (1) {
-		rc = send_es10x_block(ctx, &sw, es10x_req, offset, block_nr);
+		rc = send_es10x_block(ctx, &sw, sink, es10x_req, offset, block_nr);
+		if (rc == -EAGAIN)
+			/* Extended length APDU failed, try again with short APDUs */
+			continue;
 		if (rc < 0)
 			return -EIO;
 		offset += rc;
@@ -281,18 +470,12 @@ static int euicc_transceive_es10x(struct ipa_context *ctx, struct ipa_buf **es10
 			IPA_LOGP(SEUICC, LERROR, "ES10x transmission aborted early by eUICC, sw=%04x\n", sw);
 			break;
 		}
-
-		/* We can only transmit a maximum amount of 255 blocks in one
-		 * STORE DATA cycle. */
-		if (block_nr == 255) {
-			IPA_LOGP(SEUICC, LERROR,
-				 "ES10x request exceeds maximum transmission length (%zu)!\n", es10x_req->len);
-			return -EINVAL;
-		}
 	}
 
 	/* When the transfer of the ES10x request is done, we expect the eUICC
-	 * to answer with a response. */
+	 * to answer with a response. (In case the last block was sent as case 4
+	 * APDU, the response data, or at least the first part of it, has already
+	 * been received.) */
 	if (sw == 0x9000) {
 		IPA_LOGP(SEUICC, LINFO, "ES10x transmission successful, sw=%04x\n", sw);
 		return 0;
@@ -306,7 +489,11 @@ static int euicc_transceive_es10x(struct ipa_context *ctx, struct ipa_buf **es10
 			else
 				block_len = sw & 0xff;
 
-			rc = recv_es10x_block(ctx, &sw, es10x_res, block_len, block_nr);
+			rc = recv_es10x_block(ctx, &sw, sink, block_len, block_nr);
+			if (rc == -EAGAIN)
+				/* Extended length APDU failed, try again with short APDUs (sw still holds the
+				 * length hint from the previous block) */
+				continue;
 			if (rc < 0)
 				return -EIO;
 			block_nr++;
@@ -329,29 +516,90 @@ static int euicc_transceive_es10x(struct ipa_context *ctx, struct ipa_buf **es10
 	return 0;
 }
 
+/*! Begin a transaction to get exclusive access to the eUICC. Transactions may be nested, so that a transaction can
+ *  span a complete procedure, while the ES10x functions inside the procedure still begin/end their own transaction.
+ *  \param[inout] ctx pointer to ipa_context. */
+void ipa_euicc_begin_transaction(struct ipa_context *ctx)
+{
+	int rc;
+
+	if (ctx->euicc.transaction_depth++ > 0)
+		return;
+
+	/* In case the smartcard backend is not able to grant exclusive access, we just continue without. */
+	rc = ipa_scard_begin_transaction(ctx->scard_ctx);
+	if (rc < 0)
+		IPA_LOGP(SEUICC, LERROR, "cannot get exclusive access to eUICC, continuing without transaction\n");
+	ctx->euicc.transaction_held = (rc == 0);
+}
+
+/*! End a transaction (see also ipa_euicc_begin_transaction).
+ *  \param[inout] ctx pointer to ipa_context. */
+void ipa_euicc_end_transaction(struct ipa_context *ctx)
+{
+	assert(ctx->euicc.transaction_depth > 0);
+
+	if (--ctx->euicc.transaction_depth > 0)
+		return;
+
+	if (ctx->euicc.transaction_held)
+		ipa_scard_end_transaction(ctx->scard_ctx);
+	ctx->euicc.transaction_held = false;
+}
+
 /*! Transceive eUICC/es10x APDU.
  *  \param[inout] ctx pointer to ipa_context.
  *  \param[in] es10x_req buffer with eUICC/es10x request.
  *  \returns IPA_BUF with ES10x response on success, NULL on failure. */
 struct ipa_buf *ipa_euicc_transceive_es10x(struct ipa_context *ctx, const struct ipa_buf *es10x_req)
 {
-	struct ipa_buf *es10x_res = ipa_buf_alloc(IPA_LEN_EUICC_BUF);
+	struct es10x_res_buf res_buf = { ctx, ipa_buf_alloc(IPA_LEN_EUICC_BUF) };
+	struct es10x_res_sink sink = { append_es10x_res_cb, &res_buf, 0 };
 	int rc;
 
 	IPA_LOGP(SEUICC, LDEBUG, "sending %zu bytes to eUICC (buffer size: %zu bytes)\n", es10x_req->len,
 		 es10x_req->data_len);
 
-	rc = euicc_transceive_es10x(ctx, &es10x_res, es10x_req);
+	ctx->euicc.res_reallocs = 0;
+	ipa_euicc_begin_transaction(ctx);
+	rc = euicc_transceive_es10x(ctx, &sink, es10x_req);
+	ipa_euicc_end_transaction(ctx);
 
 	if (rc < 0) {
-		IPA_FREE(es10x_res);
+		IPA_FREE(res_buf.es10x_res);
 		return NULL;
 	}
 
-	IPA_LOGP(SEUICC, LDEBUG, "received %zu bytes from eUICC (buffer size: %zu bytes)\n", es10x_res->len,
-		 es10x_res->data_len);
+	IPA_LOGP(SEUICC, LDEBUG, "received %zu bytes from eUICC (buffer size: %zu bytes, reallocations: %u)\n",
+		 res_buf.es10x_res->len, res_buf.es10x_res->data_len, ctx->euicc.res_reallocs);
 
-	return es10x_res;
+	return res_buf.es10x_res;
+}
+
+/*! Transceive eUICC/es10x APDU and pass the response data on to a callback as it arrives.
+ *  \param[inout] ctx pointer to ipa_context.
+ *  \param[in] es10x_req buffer with eUICC/es10x request.
+ *  \param[in] res_cb callback that is called for each block of response data (return negative to abort).
+ *  \param[in] res_cb_priv private data that is passed to res_cb.
+ *  \returns 0 on success, negative on failure. */
+int ipa_euicc_transceive_es10x_cb(struct ipa_context *ctx, const struct ipa_buf *es10x_req, ipa_euicc_res_cb res_cb,
+				  void *res_cb_priv)
+{
+	struct es10x_res_sink sink = { res_cb, res_cb_priv, 0 };
+	int rc;
+
+	IPA_LOGP(SEUICC, LDEBUG, "sending %zu bytes to eUICC (buffer size: %zu bytes)\n", es10x_req->len,
+		 es10x_req->data_len);
+
+	ipa_euicc_begin_transaction(ctx);
+	rc = euicc_transceive_es10x(ctx, &sink, es10x_req);
+	ipa_euicc_end_transaction(ctx);
+	if (rc < 0)
+		return rc;
+
+	IPA_LOGP(SEUICC, LDEBUG, "received %zu bytes from eUICC\n", sink.len);
+
+	return 0;
 }
 
 /* Send terminal capablilities, see also 3gpp TS 102.221 V16.2.0, section 11.1.19.2.4 */
@@ -361,11 +609,6 @@ static int send_termcap(struct ipa_context *ctx)
 	int rc;
 	struct req_apdu req_apdu = { 0 };
 	struct res_apdu res_apdu = { 0 };
-	struct ipa_buf *buf_req = NULL;
-	struct ipa_buf *buf_res = NULL;
-
-	buf_res = ipa_buf_alloc(MAX_BLOCKSIZE_RX + 2);
-	assert(buf_res);
 
 	/* send TERMINAL CAPABILITIES */
 	req_apdu.cla = 0x80;
@@ -373,35 +616,25 @@ static int send_termcap(struct ipa_context *ctx)
 	req_apdu.p1 = 0x00;
 	req_apdu.p2 = 0x00;
 	req_apdu.lc = sizeof(termcap);
-	memcpy(req_apdu.data, termcap, sizeof(termcap));
-	buf_req = format_req_apdu(&req_apdu);
+	req_apdu.data = termcap;
 
-	rc = ipa_scard_transceive(ctx->scard_ctx, buf_res, buf_req);
-	if (rc < 0) {
+	rc = transceive_apdu(ctx, &res_apdu, &req_apdu);
+	if (rc == -EIO) {
 		IPA_LOGP(SEUICC, LERROR, "unable to send TERMINAL CAPABILITIES due to communication error\n");
 		ctx->check_scard = true;
-		rc = -EIO;
-		goto exit;
-	}
-
-	rc = parse_res_apdu(&res_apdu, buf_res);
-	if (rc < 0) {
+		return rc;
+	} else if (rc < 0) {
 		IPA_LOGP(SEUICC, LERROR, "invalid response while sending TERMINAL CAPABILITIES\n");
-		rc = -EINVAL;
-		goto exit;
+		return rc;
 	}
 
 	if ((res_apdu.sw & 0xFF00) != 0x9000) {
 		IPA_LOGP(SEUICC, LERROR, "failed to send TERMINAL CAPABILITIES, sw=%04x\n", res_apdu.sw);
-		rc = -EINVAL;
-		goto exit;
+		return -EINVAL;
 	}
 
 	IPA_LOGP(SEUICC, LINFO, "TERMINAL CAPABILITIES sent\n");
-exit:
-	IPA_FREE(buf_req);
-	IPA_FREE(buf_res);
-	return rc;
+	return 0;
 }
 
 static int select_isd_r(struct ipa_context *ctx)
@@ -412,53 +645,38 @@ static int select_isd_r(struct ipa_context *ctx)
 	int rc;
 	struct req_apdu req_apdu = { 0 };
 	struct res_apdu res_apdu = { 0 };
-	struct ipa_buf *buf_req = NULL;
-	struct ipa_buf *buf_res = NULL;
 	uint8_t channel = ctx->cfg->euicc_channel;
 
 	/* We only support channel 0-3 */
 	assert(channel <= 3);
 
-	buf_res = ipa_buf_alloc(MAX_BLOCKSIZE_RX + 2);
-	assert(buf_res);
-
 	/* SELECT ADF.ISD-R */
 	req_apdu.cla = SELECT_CLA | channel;
 	req_apdu.ins = SELECT_INS;
 	req_apdu.p1 = 0x04;
 	req_apdu.p2 = 0x04;
-	req_apdu.lc = 16;
-	req_apdu.le = 0;
-	memcpy(req_apdu.data, aid_isd_r, sizeof(aid_isd_r));
-	buf_req = format_req_apdu(&req_apdu);
+	req_apdu.lc = sizeof(aid_isd_r);
+	/* With T=1 the FCP is returned directly, with T=0 the eUICC will indicate its presence with 61xx */
+	req_apdu.le = ctx->euicc.case4 ? MAX_BLOCKSIZE_RX : 0;
+	req_apdu.data = aid_isd_r;
 
-	rc = ipa_scard_transceive(ctx->scard_ctx, buf_res, buf_req);
-	if (rc < 0) {
+	rc = transceive_apdu(ctx, &res_apdu, &req_apdu);
+	if (rc == -EIO) {
 		IPA_LOGP(SEUICC, LERROR, "unable select ISD-R due to communication error\n");
 		ctx->check_scard = true;
-		rc = -EIO;
-		goto exit;
-	}
-
-	rc = parse_res_apdu(&res_apdu, buf_res);
-	if (rc < 0) {
+		return rc;
+	} else if (rc < 0) {
 		IPA_LOGP(SEUICC, LERROR, "invalid response while selecting ISD-R\n");
-		rc = -EINVAL;
-		goto exit;
+		return rc;
 	}
 
-	if ((res_apdu.sw & 0xFF00) != 0x6100) {
+	if ((res_apdu.sw & 0xFF00) != 0x6100 && !(ctx->euicc.case4 && res_apdu.sw == 0x9000)) {
 		IPA_LOGP(SEUICC, LERROR, "failed to select ISD-R, sw=%04x\n", res_apdu.sw);
-		rc = -EINVAL;
-		goto exit;
+		return -EINVAL;
 	}
 
 	IPA_LOGP(SEUICC, LINFO, "ISD-R selected\n");
-exit:
-	IPA_FREE(buf_req);
-	IPA_FREE(buf_res);
-	return rc;
-
+	return 0;
 }
 
 static int manage_channel(struct ipa_context *ctx, bool close)
@@ -466,8 +684,6 @@ static int manage_channel(struct ipa_context *ctx, bool close)
 	int rc;
 	struct req_apdu req_apdu = { 0 };
 	struct res_apdu res_apdu = { 0 };
-	struct ipa_buf *buf_req = NULL;
-	struct ipa_buf *buf_res = NULL;
 	uint8_t channel = ctx->cfg->euicc_channel;
 
 	/* We only support channel 0-3 */
@@ -479,9 +695,6 @@ static int manage_channel(struct ipa_context *ctx, bool close)
 		return 0;
 	}
 
-	buf_res = ipa_buf_alloc(MAX_BLOCKSIZE_RX + 2);
-	assert(buf_res);
-
 	/* MANAGE CHANNEL */
 	req_apdu.cla = MANAGE_CHANNEL_CLA;
 	req_apdu.ins = MANAGE_CHANNEL_INS;
@@ -492,37 +705,166 @@ static int manage_channel(struct ipa_context *ctx, bool close)
 	req_apdu.p2 = channel;
 	req_apdu.lc = 0;
 	req_apdu.le = 0;
-	buf_req = format_req_apdu(&req_apdu);
 
-	rc = ipa_scard_transceive(ctx->scard_ctx, buf_res, buf_req);
-	if (rc < 0) {
+	rc = transceive_apdu(ctx, &res_apdu, &req_apdu);
+	if (rc == -EIO) {
 		IPA_LOGP(SEUICC, LERROR, "unable %s logical channel %u due to communication error with eUICC\n",
 			 close ? "close" : "open", channel);
 		ctx->check_scard = true;
-		rc = -EIO;
-		goto exit;
-	}
-
-	rc = parse_res_apdu(&res_apdu, buf_res);
-	if (rc < 0) {
+		return rc;
+	} else if (rc < 0) {
 		IPA_LOGP(SEUICC, LERROR, "invalid response from eUICC, cannot %s logical channel %u\n",
 			 close ? "close" : "open", channel);
-		rc = -EINVAL;
-		goto exit;
+		return rc;
 	}
 
 	if ((res_apdu.sw) != 0x9000) {
 		IPA_LOGP(SEUICC, LERROR, "failed to %s logical channel %u, sw=%04x\n", close ? "close" : "open",
 			 channel, res_apdu.sw);
-		rc = -EINVAL;
-		goto exit;
+		return -EINVAL;
 	}
 
 	IPA_LOGP(SEUICC, LINFO, "logical channel %u %s\n", channel, close ? "closed" : "opened");
-exit:
-	IPA_FREE(buf_req);
-	IPA_FREE(buf_res);
-	return rc;
+	return 0;
+}
+
+/* Check the historical bytes of the ATR for the card capabilities (compact-TLV, tag '7') and find out whether the
+ * card supports extended Lc and Le fields (see also ISO/IEC 7816-4, section 8.1.1.2.7 and ISO/IEC 7816-3,
+ * section 8.2). The card capabilities may also be stored in EF.ATR instead, this file is not read, so such cards are
+ * used with short APDUs. */
+static bool atr_ext_apdu_supported(const struct ipa_buf *atr)
+{
+	size_t i = 1;
+	size_t hist_len;
+	size_t hist_end;
+	uint8_t y;
+	uint8_t tag;
+	uint8_t len;
+
+	/* TS and T0 */
+	if (atr->len < 2)
+		return false;
+	hist_len = atr->data[1] & 0x0f;
+	y = atr->data[1] & 0xf0;
+
+	/* Skip the interface bytes (TAi, TBi, TCi, TDi) */
+	while (y) {
+		if (y & 0x10)
+			i++;
+		if (y & 0x20)
+			i++;
+		if (y & 0x40)
+			i++;
+		if (y & 0x80) {
+			i++;
+			if (i >= atr->len)
+				return false;
+			y = atr->data[i] & 0xf0;
+		} else
+			y = 0;
+	}
+	i++;
+
+	/* Check category indicator, we only support the compact-TLV formats ('80' and '00', in the latter case the
+	 * last three historical bytes contain a mandatory status indicator) */
+	if (hist_len < 1 || i + hist_len > atr->len)
+		return false;
+	hist_end = i + hist_len;
+	if (atr->data[i] == 0x00)
+		hist_end -= 3;
+	else if (atr->data[i] != 0x80)
+		return false;
+	i++;
+
+	while (i < hist_end) {
+		tag = atr->data[i] >> 4;
+		len = atr->data[i] & 0x0f;
+		i++;
+		if (i + len > hist_end)
+			return false;
+
+		/* Card capabilities, third software function table, b7: "Extended Lc and Le fields" */
+		if (tag == 0x7 && len >= 3)
+			return (atr->data[i + 2] & 0x40) == 0x40;
+		i += len;
+	}
+
+	return false;
+}
+
+/* Find out whether we can use extended length APDUs */
+static void negotiate_ext_apdu(struct ipa_context *ctx, const struct ipa_buf *atr)
+{
+	ctx->euicc.ext_apdu = false;
+
+	if (ctx->cfg->euicc_disable_ext_apdu) {
+		IPA_LOGP(SEUICC, LINFO, "extended length APDUs disabled by configuration, using short APDUs\n");
+		return;
+	}
+
+	if (!atr) {
+		IPA_LOGP(SEUICC, LERROR, "unable to read ATR, using short APDUs\n");
+		return;
+	}
+
+	if (atr_ext_apdu_supported(atr)) {
+		IPA_LOGP(SEUICC, LINFO, "eUICC supports extended length APDUs\n");
+		ctx->euicc.ext_apdu = true;
+	} else
+		IPA_LOGP(SEUICC, LINFO, "eUICC does not support extended length APDUs, using short APDUs\n");
+}
+
+/* Find out whether we can use case 4 APDUs (only possible with T=1) */
+static void negotiate_case4(struct ipa_context *ctx)
+{
+	ctx->euicc.case4 = false;
+
+	if (ipa_scard_protocol(ctx->scard_ctx) == 1) {
+		IPA_LOGP(SEUICC, LINFO, "transmission protocol is T=1, using case 4 APDUs\n");
+		ctx->euicc.case4 = true;
+	} else
+		IPA_LOGP(SEUICC, LINFO, "transmission protocol is T=0, using GET RESPONSE to retrieve response data\n");
+}
+
+/* Allocate the TX/RX frames that are used to transceive all APDUs (the TX frame only holds APDU header and trailer,
+ * the size of the RX frame depends on whether extended length APDUs are used or not) */
+static void alloc_frames(struct ipa_context *ctx)
+{
+	size_t tx_len = MAX_APDU_OVERHEAD;
+	size_t rx_len = (ctx->euicc.ext_apdu ? MAX_BLOCKSIZE_RX_EXT : MAX_BLOCKSIZE_RX) + 2;
+
+	ipa_buf_free(ctx->euicc.tx_frame);
+	ipa_buf_free(ctx->euicc.rx_frame);
+	ctx->euicc.tx_frame = ipa_buf_alloc(tx_len);
+	ctx->euicc.rx_frame = ipa_buf_alloc(rx_len);
+	assert(ctx->euicc.tx_frame);
+	assert(ctx->euicc.rx_frame);
+}
+
+/* Check whether the eUICC still presents the ATR that was cached in the nvstate during the last (cold) start. */
+static bool atr_matches_cache(struct ipa_context *ctx, const struct ipa_buf *atr)
+{
+	struct ipa_nvstate *nvstate = &ctx->nvstate;
+
+	if (!ctx->cfg->euicc_warm_start || !nvstate->warm_start.valid || !atr)
+		return false;
+	if (atr->len != nvstate->warm_start.atr_len)
+		return false;
+	if (memcmp(atr->data, nvstate->warm_start.atr, atr->len))
+		return false;
+	return true;
+}
+
+/* Remember the ATR in the nvstate, the cache becomes valid once the EID is stored as well (see ipad.c) */
+static void atr_to_cache(struct ipa_context *ctx, const struct ipa_buf *atr)
+{
+	struct ipa_nvstate *nvstate = &ctx->nvstate;
+
+	nvstate->warm_start.valid = false;
+	if (!atr || atr->len > sizeof(nvstate->warm_start.atr))
+		return;
+	memcpy(nvstate->warm_start.atr, atr->data, atr->len);
+	nvstate->warm_start.atr_len = atr->len;
 }
 
 /*! open the communication channel between eUICC and IPAd.
@@ -530,11 +872,41 @@ exit:
  *  \returns 0 on success, negative on error. */
 int ipa_euicc_init_es10x(struct ipa_context *ctx)
 {
+	IPA_BUF_STATIC(atr_buf, IPA_LEN_ATR);
+	struct ipa_buf *atr = &atr_buf;
 	int rc;
 
-	rc = send_termcap(ctx);
-	if (rc < 0)
-		return rc;
+	if (ipa_scard_atr(ctx->scard_ctx, atr) < 0)
+		atr = NULL;
+
+	negotiate_ext_apdu(ctx, atr);
+	negotiate_case4(ctx);
+	alloc_frames(ctx);
+
+	/* When the eUICC presents the same ATR as during the last start, we assume that we are talking to the same
+	 * eUICC, which already knows our terminal capabilities. */
+	ctx->euicc.warm_start = atr_matches_cache(ctx, atr);
+	if (ctx->euicc.warm_start) {
+		IPA_LOGP(SEUICC, LINFO, "ATR unchanged, warm start (skipping TERMINAL CAPABILITIES)\n");
+
+		/* The logical channel may still be open from the last start, in this case ISD-R is still selected
+		 * and selecting it again is sufficient to confirm that the channel is usable. */
+		if (ctx->cfg->euicc_keep_channel && ctx->cfg->euicc_channel != 0) {
+			if (select_isd_r(ctx) == 0) {
+				IPA_LOGP(SEUICC, LINFO, "reusing logical channel %u\n", ctx->cfg->euicc_channel);
+				return 0;
+			}
+			if (ctx->check_scard)
+				return -EIO;
+			IPA_LOGP(SEUICC, LINFO, "logical channel %u not usable anymore, opening it again\n",
+				 ctx->cfg->euicc_channel);
+		}
+	} else {
+		atr_to_cache(ctx, atr);
+		rc = send_termcap(ctx);
+		if (rc < 0)
+			return rc;
+	}
 
 	rc = manage_channel(ctx, false);
 	if (rc < 0)
@@ -549,5 +921,23 @@ int ipa_euicc_init_es10x(struct ipa_context *ctx)
  *  \returns 0 on success, negative on error. */
 int ipa_euicc_close_es10x(struct ipa_context *ctx)
 {
-	return manage_channel(ctx, true);
+	int rc;
+
+	/* Channel was never opened */
+	if (!ctx->euicc.tx_frame)
+		return 0;
+
+	/* Leave the channel open, so that it can be reused on the next start (see also ipa_euicc_init_es10x) */
+	if (ctx->cfg->euicc_keep_channel) {
+		IPA_LOGP(SEUICC, LINFO, "keeping logical channel %u open\n", ctx->cfg->euicc_channel);
+		rc = 0;
+	} else
+		rc = manage_channel(ctx, true);
+
+	ipa_buf_free(ctx->euicc.tx_frame);
+	ipa_buf_free(ctx->euicc.rx_frame);
+	ctx->euicc.tx_frame = NULL;
+	ctx->euicc.rx_frame = NULL;
+
+	return rc;
 }
@@ -2,6 +2,16 @@
 
 struct ipa_buf;
 
+/*! Callback to consume ES10x response data block by block.
+ *  \param[in] block buffer with the received block of response data (only valid during the call).
+ *  \param[in] priv private data (as passed to ipa_euicc_transceive_es10x_cb).
+ *  \returns 0 on success, negative to abort the transfer. */
+typedef int (*ipa_euicc_res_cb)(const struct ipa_buf *block, void *priv);
+
 struct ipa_buf *ipa_euicc_transceive_es10x(struct ipa_context *ctx, const struct ipa_buf *es10x_req);
+int ipa_euicc_transceive_es10x_cb(struct ipa_context *ctx, const struct ipa_buf *es10x_req, ipa_euicc_res_cb res_cb,
+				  void *res_cb_priv);
+void ipa_euicc_begin_transaction(struct ipa_context *ctx);
+void ipa_euicc_end_transaction(struct ipa_context *ctx);
 int ipa_euicc_init_es10x(struct ipa_context *ctx);
 int ipa_euicc_close_es10x(struct ipa_context *ctx);
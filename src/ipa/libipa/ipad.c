@@ -6,6 +6,7 @@
 #include <stdio.h>
 #include <assert.h>
 #include <string.h>
+#include <time.h>
 #include <onomondo/ipa/mem.h>
 #include <onomondo/ipa/http.h>
 #include <onomondo/ipa/scard.h>
@@ -18,12 +19,14 @@
 #include "esipa.h"
 #include "es10c_get_eid.h"
 #include "proc_eim_pkg_retr.h"
+#include "proc_eim_pkg_inj.h"
 #include "es10b_get_eim_cfg_data.h"
 #include "es10b_add_init_eim.h"
 #include "es10b_euicc_mem_rst.h"
 #include "es10b_load_euicc_pkg.h"
 #include "proc_euicc_pkg_dwnld_exec.h"
 #include "proc_notif_delivery.h"
+#include "esipa_get_eim_pkg.h"
 
 /* Counters to monitor heap memory usage, see also: onomondo/ipa/mem.h */
 #ifdef MEM_EMIT_DEBUG
@@ -37,6 +40,7 @@ static void nvstate_free_contents(struct ipa_nvstate *nvstate)
 	IPA_FREE(nvstate->iot_euicc_emu.eim_cfg_ber);
 	IPA_FREE(nvstate->iot_euicc_emu.auto_enable.smdp_oid);
 	IPA_FREE(nvstate->iot_euicc_emu.auto_enable.smdp_address);
+	IPA_FREE(nvstate->tls_session);
 }
 
 static void nvstate_reset(struct ipa_nvstate *nvstate)
@@ -76,6 +80,7 @@ static struct ipa_buf *nvstate_serialize(struct ipa_nvstate *nvstate)
 	nvstate_bin = nvstate_serialize_ipa_buf(nvstate_bin, nvstate->iot_euicc_emu.eim_cfg_ber);
 	nvstate_bin = nvstate_serialize_ipa_buf(nvstate_bin, nvstate->iot_euicc_emu.auto_enable.smdp_oid);
 	nvstate_bin = nvstate_serialize_ipa_buf(nvstate_bin, nvstate->iot_euicc_emu.auto_enable.smdp_address);
+	nvstate_bin = nvstate_serialize_ipa_buf(nvstate_bin, nvstate->tls_session);
 	return nvstate_bin;
 }
 
@@ -125,6 +130,7 @@ static void nvstate_deserialize(struct ipa_nvstate *nvstate, struct ipa_buf *nvs
 	nvstate->iot_euicc_emu.eim_cfg_ber = nvstate_deserialize_ipa_buf(&nvstate_data, &nvstate_data_len);
 	nvstate->iot_euicc_emu.auto_enable.smdp_oid = nvstate_deserialize_ipa_buf(&nvstate_data, &nvstate_data_len);
 	nvstate->iot_euicc_emu.auto_enable.smdp_address = nvstate_deserialize_ipa_buf(&nvstate_data, &nvstate_data_len);
+	nvstate->tls_session = nvstate_deserialize_ipa_buf(&nvstate_data, &nvstate_data_len);
 }
 
 /*! Read eIM configuration from eUICC and pick a suitable eIM.
@@ -152,9 +158,12 @@ int eim_init(struct ipa_context *ctx)
 	if (!ctx->eim_id)
 		goto error;
 
-	if (eim_cfg_data_item->eimFqdn)
+	if (eim_cfg_data_item->eimFqdn) {
+		IPA_FREE(ctx->eim_fqdn);
+		IPA_FREE(ctx->eim_url);
+		ctx->eim_url = NULL;
 		ctx->eim_fqdn = IPA_STR_FROM_ASN(eim_cfg_data_item->eimFqdn);
-	else
+	} else
 		goto error;
 
 	ipa_es10b_get_eim_cfg_data_free(eim_cfg_data);
@@ -186,11 +195,13 @@ struct ipa_context *ipa_new_ctx(struct ipa_config *cfg, struct ipa_buf *nvstate)
  *  \returns 0 success, -EINVAL on failure. */
 int ipa_init(struct ipa_context *ctx)
 {
+	struct timespec start;
+	struct timespec end;
 	int rc;
 
-	ctx->http_ctx = ipa_http_init(ctx->cfg->eim_cabundle, ctx->cfg->eim_disable_ssl_verif);
-	if (!ctx->http_ctx)
-		return -EINVAL;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	/* The HTTP client is initialized on demand when the first ESipa request is made (see esipa.c) */
 
 	ctx->scard_ctx = ipa_scard_init(ctx->cfg->reader_num);
 	if (!ctx->scard_ctx)
@@ -200,9 +211,21 @@ int ipa_init(struct ipa_context *ctx)
 	if (rc < 0)
 		return -EINVAL;
 
-	rc = ipa_es10c_get_eid(ctx, ctx->eid);
-	if (rc < 0)
-		return -EINVAL;
+	if (ctx->euicc.warm_start) {
+		memcpy(ctx->eid, ctx->nvstate.warm_start.eid, sizeof(ctx->eid));
+		IPA_LOGP(SIPA, LINFO, "using cached EID: %s\n", ipa_hexdump(ctx->eid, sizeof(ctx->eid)));
+	} else {
+		rc = ipa_es10c_get_eid(ctx, ctx->eid);
+		if (rc < 0)
+			return -EINVAL;
+		memcpy(ctx->nvstate.warm_start.eid, ctx->eid, sizeof(ctx->nvstate.warm_start.eid));
+		ctx->nvstate.warm_start.valid = ctx->nvstate.warm_start.atr_len != 0;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	IPA_LOGP(SIPA, LINFO, "IPAd initialized in %ld ms (%s start)\n",
+		 (long)((end.tv_sec - start.tv_sec) * 1000 + (end.tv_nsec - start.tv_nsec) / 1000000),
+		 ctx->euicc.warm_start ? "warm" : "cold");
 
 	return 0;
 }
@@ -269,10 +292,7 @@ static int check_canaries(struct ipa_context *ctx)
 	return -EINVAL;
 }
 
-/*! poll the IPAd (may be called in regular intervals or on purpose).
- *  \param[inout] ctx pointer to ipa_context.
- *  \returns positive on success, negative on error (see also enum ipa_poll_rc). */
-int ipa_poll(struct ipa_context *ctx)
+static int poll_cycle(struct ipa_context *ctx)
 {
 	int rc;
 
@@ -308,6 +328,9 @@ int ipa_poll(struct ipa_context *ctx)
 		if (rc == -GetEimPackageResponse__eimPackageError_noEimPackageAvailable)
 			/* When no more eIM packages are available it makes sense to relax the poll interval. */
 			return IPA_POLL_AGAIN_LATER;
+		else if (rc == -ETIMEDOUT)
+			/* The long poll has ended without an eIM package, the next long poll should start right away. */
+			return IPA_POLL_LONG_POLL_TIMEOUT;
 		else if (rc < 0)
 			/* ipa_proc_eim_pkg_retr indicates an error that can not be recovered from. */
 			return check_canaries(ctx);
@@ -324,6 +347,46 @@ int ipa_poll(struct ipa_context *ctx)
 	}
 }
 
+/*! poll the IPAd (may be called in regular intervals or on purpose).
+ *  \param[inout] ctx pointer to ipa_context.
+ *  \returns positive on success, negative on error (see also enum ipa_poll_rc). */
+int ipa_poll(struct ipa_context *ctx)
+{
+	int rc;
+
+	/* A failed ESipa function is going to be retried, but the retry is not due yet */
+	if (ipa_esipa_retry_delay(ctx))
+		return IPA_POLL_RETRY;
+
+	rc = poll_cycle(ctx);
+
+	/* An ESipa function has failed during this poll cycle, it is resumed when ipa_poll is called again after the
+	 * retry is due. */
+	if (ipa_esipa_retry_pending(ctx))
+		return IPA_POLL_RETRY;
+	return rc;
+}
+
+/*! inject an eIM package (push), as an alternative to the eIM package retrieval (poll) that ipa_poll performs.
+ *  The eIM package is executed when ipa_poll is called next, so the caller should call ipa_poll immediately after
+ *  the response has been sent back to the eIM.
+ *  \param[inout] ctx pointer to ipa_context.
+ *  \param[in] eim_pkg buffer with the BER encoded ESipa message (TransferEimPackageRequest) that the eIM has sent.
+ *  \returns buffer with the BER encoded ESipa message (TransferEimPackageResponse) that has to be sent back to the eIM,
+ *           NULL on error. */
+struct ipa_buf *ipa_inject_eim_pkg(struct ipa_context *ctx, const struct ipa_buf *eim_pkg)
+{
+	return ipa_proc_eim_pkg_inj(ctx, eim_pkg);
+}
+
+/*! get the time after which ipa_poll shall be called again (see also IPA_POLL_RETRY).
+ *  \param[inout] ctx pointer to ipa_context.
+ *  \returns time in milliseconds, 0 when ipa_poll may be called immediately. */
+unsigned int ipa_poll_delay(struct ipa_context *ctx)
+{
+	return ipa_esipa_retry_delay(ctx);
+}
+
 /*! close connection towards the eIM.
  *  \param[inout] ctx pointer to ipa_context. */
 void ipa_close(struct ipa_context *ctx)
@@ -336,10 +399,20 @@ void ipa_close(struct ipa_context *ctx)
 struct ipa_buf *ipa_free_ctx(struct ipa_context *ctx)
 {
 	struct ipa_buf *nvstate;
+	struct ipa_buf *tls_session;
 
 	if (!ctx)
 		return NULL;
 
+	/* Keep the TLS session of the last connection towards the eIM, so that it can be resumed after a restart */
+	if (ctx->http_ctx) {
+		tls_session = ipa_http_export_session(ctx->http_ctx);
+		if (tls_session) {
+			IPA_FREE(ctx->nvstate.tls_session);
+			ctx->nvstate.tls_session = tls_session;
+		}
+	}
+
 	nvstate = nvstate_serialize(&ctx->nvstate);
 
 	IPA_FREE(ctx->iot_euicc_emu.rollback_iccid);
@@ -348,7 +421,9 @@ struct ipa_buf *ipa_free_ctx(struct ipa_context *ctx)
 	ipa_buf_free(ctx->iot_euicc_emu.auto_enable.profile_aid);
 	IPA_FREE(ctx->eim_id);
 	IPA_FREE(ctx->eim_fqdn);
+	IPA_FREE(ctx->eim_url);
 	ipa_proc_eucc_pkg_dwnld_exec_res_free(ctx->proc_eucc_pkg_dwnld_exec_res);
+	ipa_esipa_get_eim_pkg_free(ctx->eim_pkg_pending);
 
 	if (ctx->scard_ctx)
 		ipa_euicc_close_es10x(ctx);
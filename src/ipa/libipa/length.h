@@ -3,12 +3,29 @@
 #define IPA_LEN_EUICC_CHLG 16	/* bytes */
 #define IPA_LEN_SERV_CHLG 16	/* bytes */
 #define IPA_LEN_EID 16		/* bytes */
+#define IPA_LEN_ISDP_AID 16	/* bytes */
+#define IPA_LEN_ATR 33		/* bytes, maximum length of an ATR, see also ISO/IEC 7816-3, section 8.2.1 */
 
 /* This is the initial buffer size. The ASN.1 encoder will automatically re-alloc more memory if needed. */
 #define IPA_LEN_ASN1_ENCODER_BUF 5120	/* bytes */
 
+/* Maximum length of the tag and length fields of a TLV (two tag bytes and up to five length bytes) */
+#define IPA_LEN_ASN1_HDR_MAX 8	/* bytes */
+
 /* This is the initial buffer size. The eUICC interface will automatically re-alloc more memory if needed. */
 #define IPA_LEN_EUICC_BUF 256 /* bytes */
 
+/* Upper limit for allocating the eUICC response buffer at once from the BER length that the eUICC announces. Larger
+ * responses are still accepted, but the buffer grows geometrically as the data actually arrives. */
+#define IPA_LEN_EUICC_BUF_RESERVE_MAX 65536 /* bytes */
+
 /* This is the initial buffer size. The ASN.1 printer will automatically re-alloc more memory if needed. */
 #define IPA_LEN_ASN1_PRINTER_BUF 10240	/* bytes */
+
+/* This is the initial buffer size. The BoundProfilePackage stream parser will automatically re-alloc more memory if
+ * needed (it has to hold one ES8+ segment plus the chunk that is currently received). */
+#define IPA_LEN_BPP_STREAM_BUF 1024	/* bytes */
+
+/* Largest ES8+ segment (complete TLV) that the BoundProfilePackage stream parser accepts. The '86' TLVs carry at most
+ * 1024 bytes of profile data plus MAC, the other segments are smaller. The limit leaves some headroom. */
+#define IPA_LEN_BPP_SEGMENT_MAX 2048	/* bytes */
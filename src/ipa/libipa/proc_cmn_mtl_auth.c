@@ -14,6 +14,7 @@
 #include <onomondo/ipa/utils.h>
 #include <onomondo/ipa/log.h>
 #include <UTF8String.h>
+#include <SubjectKeyIdentifier.h>
 #include "context.h"
 #include "utils.h"
 #include "es10b_get_euicc_info.h"
@@ -38,8 +39,9 @@ static int restrict_euicc_info(struct ipa_es10b_euicc_info *euicc_info, const st
 		if (asn->euiccCiPKIdListForVerification.list.array[i - 1]->size != allowed_ca->len
 		    || memcmp(asn->euiccCiPKIdListForVerification.list.array[i - 1]->buf, allowed_ca->data,
 			      allowed_ca->len)) {
-			IPA_FREE(asn->euiccCiPKIdListForVerification.list.array[i - 1]->buf);
-			IPA_FREE(asn->euiccCiPKIdListForVerification.list.array[i - 1]);
+			/* (The list may have been decoded into an arena, see ipa_es10x_res_dec) */
+			ASN_STRUCT_FREE(asn_DEF_SubjectKeyIdentifier,
+					asn->euiccCiPKIdListForVerification.list.array[i - 1]);
 			asn_sequence_del(&asn->euiccCiPKIdListForVerification, i - 1, 0);
 		}
 	}
@@ -119,7 +121,7 @@ static void gen_ctx_params_1(struct CtxParams1 *ctx_params_1, const uint8_t *tac
 
 	/* Use the AC_TOKEN as MatchingId (see also GSMA SGP.22, section 4.1) */
 	if (ac_token) {
-		static UTF8String_t matchingId;
+		static IPA_THREAD_LOCAL UTF8String_t matchingId;
 		IPA_ASSIGN_STR_TO_ASN(matchingId, ac_token);
 		ctx_params_1->choice.ctxParamsForCommonAuthentication.matchingId = &matchingId;
 	}
@@ -0,0 +1,44 @@
+/*
+ * Author: Philipp Maier <pmaier@sysmocom.de> / sysmocom - s.f.m.c. GmbH
+ * See also: GSMA SGP.32, section 3.1.1.2: eIM Package Injection
+ *
+ */
+
+#include <stdio.h>
+#include <onomondo/ipa/utils.h>
+#include <onomondo/ipa/log.h>
+#include <onomondo/ipa/ipad.h>
+#include <TransferEimPackageResponse.h>
+#include "context.h"
+#include "esipa_get_eim_pkg.h"
+#include "esipa_transfer_eim_pkg.h"
+#include "proc_eim_pkg_inj.h"
+
+/*! Perform eIM Package Injection Procedure. The eIM package is not executed immediately, it is queued and executed
+ *  in the next poll cycle (see also ipa_proc_eim_pkg_retr), so that the eIM gets its response without delay.
+ *  \param[inout] ctx pointer to ipa_context.
+ *  \param[in] esipa_req buffer with the ESipa message (TransferEimPackageRequest) that the eIM has sent.
+ *  \returns buffer with the ESipa message (TransferEimPackageResponse) that has to be sent back to the eIM. */
+struct ipa_buf *ipa_proc_eim_pkg_inj(struct ipa_context *ctx, const struct ipa_buf *esipa_req)
+{
+	struct ipa_esipa_get_eim_pkg_res *transfer_eim_pkg_req;
+	long eim_pkg_err = 0;
+
+	transfer_eim_pkg_req = ipa_esipa_transfer_eim_pkg_req_dec(esipa_req);
+	if (!transfer_eim_pkg_req) {
+		eim_pkg_err = TransferEimPackageResponse__eimPackageError_invalidPackageFormat;
+	} else if (transfer_eim_pkg_req->eim_pkg_err) {
+		eim_pkg_err = transfer_eim_pkg_req->eim_pkg_err;
+	} else if (ctx->eim_pkg_pending || ctx->proc_eucc_pkg_dwnld_exec_res) {
+		/* Only one eIM package can be executed at a time, the eIM may retry later. */
+		IPA_LOGP(SIPA, LERROR, "cannot accept eIM package, the execution of another eIM package is ongoing!\n");
+		eim_pkg_err = TransferEimPackageResponse__eimPackageError_undefinedError;
+	} else {
+		ctx->eim_pkg_pending = transfer_eim_pkg_req;
+		transfer_eim_pkg_req = NULL;
+		IPA_LOGP(SIPA, LINFO, "eIM Package Injection succeeded, eIM package is executed on next poll cycle!\n");
+	}
+
+	ipa_esipa_get_eim_pkg_free(transfer_eim_pkg_req);
+	return ipa_esipa_transfer_eim_pkg_res_enc(eim_pkg_err);
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+struct ipa_context;
+struct ipa_buf;
+
+struct ipa_buf *ipa_proc_eim_pkg_inj(struct ipa_context *ctx, const struct ipa_buf *esipa_req);
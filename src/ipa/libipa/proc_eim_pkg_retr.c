@@ -68,8 +68,10 @@ int eim_pkg_exec(struct ipa_context *ctx, const struct ipa_esipa_get_eim_pkg_res
 
 		ctx->proc_eucc_pkg_dwnld_exec_res =
 		    ipa_proc_eucc_pkg_dwnld_exec(ctx, get_eim_pkg_res->euicc_package_request);
-		if (!ctx->proc_eucc_pkg_dwnld_exec_res)
+		if (!ctx->proc_eucc_pkg_dwnld_exec_res) {
+			rc = -EINVAL;
 			goto error;
+		}
 
 		/* In case the result of ipa_proc_eucc_pkg_dwnld_exec indicates that calling of
 		 * ipa_proc_eucc_pkg_dwnld_exec_onset is not required, we throw away proc_eucc_pkg_dwnld_exec_res
@@ -142,14 +144,28 @@ int ipa_proc_eim_pkg_retr(struct ipa_context *ctx)
 	struct ipa_esipa_get_eim_pkg_res *get_eim_pkg_res = NULL;
 	int rc;
 
-	/* Ensure that we start with a fresh connection */
-	ipa_esipa_close(ctx);
+	/* Ensure that we start with a fresh connection (unless the connection should be kept alive across poll cycles,
+	 * in this case the HTTP client will reuse the connection as long as the eIM keeps it open) */
+	if (!ctx->cfg->eim_keep_alive)
+		ipa_esipa_close(ctx);
+
+	/* Resume the execution of an eIM package that was interrupted by a failed ESipa request (see below) or execute
+	 * an eIM package that the eIM has injected (see also ipa_proc_eim_pkg_inj) */
+	if (ctx->eim_pkg_pending) {
+		IPA_LOGP(SIPA, LINFO, "executing pending eIM Package...\n");
+		get_eim_pkg_res = ctx->eim_pkg_pending;
+		ctx->eim_pkg_pending = NULL;
+		goto exec;
+	}
 
 	/* Poll eIM */
 	get_eim_pkg_res = ipa_esipa_get_eim_pkg(ctx, ctx->eid);
 	if (!get_eim_pkg_res) {
 		rc = -EINVAL;
 		goto error;
+	} else if (get_eim_pkg_res->long_poll_timeout) {
+		rc = -ETIMEDOUT;
+		goto error;
 	} else if (get_eim_pkg_res->eim_pkg_err == GetEimPackageResponse__eimPackageError_noEimPackageAvailable) {
 		rc = -GetEimPackageResponse__eimPackageError_noEimPackageAvailable;
 		goto error;
@@ -159,13 +175,28 @@ int ipa_proc_eim_pkg_retr(struct ipa_context *ctx)
 	}
 
 	IPA_LOGP(SIPA, LINFO, "eIM Package Retrieval succeeded!\n");
+exec:
 	rc = eim_pkg_exec(ctx, get_eim_pkg_res);
-	ipa_esipa_get_eim_pkg_free(get_eim_pkg_res);
-	ipa_esipa_close(ctx);
+	if (rc == -EAGAIN) {
+		/* The execution was interrupted by an ESipa request that is going to be retried. The eIM package is
+		 * kept, so that its execution can be repeated when ipa_poll is called again. */
+		ctx->eim_pkg_pending = get_eim_pkg_res;
+	} else {
+		ipa_esipa_get_eim_pkg_free(get_eim_pkg_res);
+
+		/* The execution has ended (e.g. a failed profile download was canceled), so the eIM package is not
+		 * executed again. A retry that one of its ESipa requests has left behind would never be served, unless
+		 * an eUICC package execution is resumed by ipa_poll (see ipa_proc_eucc_pkg_dwnld_exec_onset). */
+		if (!ctx->proc_eucc_pkg_dwnld_exec_res)
+			ipa_esipa_retry_cancel(ctx);
+	}
+	if (!ctx->cfg->eim_keep_alive)
+		ipa_esipa_close(ctx);
 	return rc;
 error:
 	ipa_esipa_get_eim_pkg_free(get_eim_pkg_res);
 	IPA_LOGP(SIPA, LINFO, "eIM Package Retrieval failed!\n");
-	ipa_esipa_close(ctx);
+	if (!ctx->cfg->eim_keep_alive)
+		ipa_esipa_close(ctx);
 	return rc;
 }
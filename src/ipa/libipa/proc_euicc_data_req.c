@@ -26,16 +26,17 @@
 #include "es10b_get_eim_cfg_data.h"
 #include "es10b_get_certs.h"
 #include "es10b_retr_notif_from_lst.h"
+#include "esipa.h"
 #include "esipa_prvde_eim_pkg_rslt.h"
 #include "proc_euicc_data_req.h"
 
 /* See also SGP.32, section 4.1 */
-static struct IpaCapabilities *make_ipa_capabilties(void)
+static struct IpaCapabilities *make_ipa_capabilties(const struct ipa_context *ctx)
 {
-	static struct IpaCapabilities ipa_capabilties = { 0 };
-	static uint8_t ipa_ipaFeatures_buf[6];
-	static struct BIT_STRING_s ipa_supported_protocols = { 0 };
-	static uint8_t ipa_supported_protocols_buf[5];
+	static IPA_THREAD_LOCAL struct IpaCapabilities ipa_capabilties = { 0 };
+	static IPA_THREAD_LOCAL uint8_t ipa_ipaFeatures_buf[6];
+	static IPA_THREAD_LOCAL struct BIT_STRING_s ipa_supported_protocols = { 0 };
+	static IPA_THREAD_LOCAL uint8_t ipa_supported_protocols_buf[5];
 
 	memset(ipa_ipaFeatures_buf, 0, sizeof(ipa_ipaFeatures_buf));
 	ipa_capabilties.ipaFeatures.size = sizeof(ipa_ipaFeatures_buf);
@@ -54,9 +55,9 @@ static struct IpaCapabilities *make_ipa_capabilties(void)
 	/* We do not yet support the ProfileMetadata verification, see TODO in proc_indirect_prfle_dwnld.c */
 	ipa_capabilties.ipaFeatures.buf[IpaCapabilities__ipaFeatures_eimProfileMetadataVerification] = 0;
 
-	/* This is a mode that uses more compact ESipa message to save some bytes/traffic. This feature is also not
-	 * supported. */
-	ipa_capabilties.ipaFeatures.buf[IpaCapabilities__ipaFeatures_minimizeEsipaBytes] = 0;
+	/* This is a mode that uses more compact ESipa message to save some bytes/traffic. This feature is optional, see
+	 * also esipa_minimize_bytes in ipad.h */
+	ipa_capabilties.ipaFeatures.buf[IpaCapabilities__ipaFeatures_minimizeEsipaBytes] = ctx->cfg->esipa_minimize_bytes;
 
 	ipa_capabilties.ipaSupportedProtocols = &ipa_supported_protocols;
 
@@ -64,8 +65,8 @@ static struct IpaCapabilities *make_ipa_capabilties(void)
 	ipa_supported_protocols.size = sizeof(ipa_supported_protocols_buf);
 	ipa_supported_protocols.buf = ipa_supported_protocols_buf;
 	ipa_supported_protocols.buf[IpaCapabilities__ipaSupportedProtocols_ipaRetrieveHttps] = 1;
-	ipa_supported_protocols.buf[IpaCapabilities__ipaSupportedProtocols_ipaRetrieveCoaps] = 0;
-	ipa_supported_protocols.buf[IpaCapabilities__ipaSupportedProtocols_ipaInjectHttps] = 0;
+	ipa_supported_protocols.buf[IpaCapabilities__ipaSupportedProtocols_ipaRetrieveCoaps] = ctx->cfg->eim_coap;
+	ipa_supported_protocols.buf[IpaCapabilities__ipaSupportedProtocols_ipaInjectHttps] = ctx->cfg->eim_inject;
 	ipa_supported_protocols.buf[IpaCapabilities__ipaSupportedProtocols_ipaInjectCoaps] = 0;
 	ipa_supported_protocols.buf[IpaCapabilities__ipaSupportedProtocols_ipaProprietary] = 0;
 
@@ -75,7 +76,7 @@ static struct IpaCapabilities *make_ipa_capabilties(void)
 /* See also SGP.22, section 4.2 */
 static struct DeviceInfo *make_device_info(struct ipa_context *ctx)
 {
-	static struct DeviceInfo device_info = { 0 };
+	static IPA_THREAD_LOCAL struct DeviceInfo device_info = { 0 };
 
 	IPA_ASSIGN_BUF_TO_ASN(device_info.tac, ctx->cfg->tac, IPA_LEN_TAC);
 	/* TODO: Optionally it would also be possible to submint the IMEI here, The question is: Do we need that? */
@@ -104,6 +105,7 @@ int ipa_proc_euicc_data_req(struct ipa_context *ctx, const struct ipa_proc_euicc
 	struct ipa_es10b_retr_notif_from_lst_res *retr_notif_from_lst_res = NULL;
 	struct ipa_esipa_prvde_eim_pkg_rslt_req prvde_eim_pkg_rslt_req = { 0 };
 	struct ipa_esipa_prvde_eim_pkg_rslt_res *prvde_eim_pkg_rslt_res = NULL;
+	int rc = -EINVAL;
 
 	/* Final response */
 	struct IpaEuiccDataResponse ipa_euicc_data_response = { 0 };
@@ -178,7 +180,7 @@ int ipa_proc_euicc_data_req(struct ipa_context *ctx, const struct ipa_proc_euicc
 
 	if (ipa_tag_in_taglist(0x88, tag_list)) {
 		IPA_LOGP(SIPA, LINFO, "eIM asks for IPA Capabilities\n");
-		ipa_euicc_data_response.choice.ipaEuiccData.ipaCapabilities = make_ipa_capabilties();
+		ipa_euicc_data_response.choice.ipaEuiccData.ipaCapabilities = make_ipa_capabilties(ctx);
 	} else {
 		ipa_euicc_data_response.choice.ipaEuiccData.ipaCapabilities = NULL;
 	}
@@ -202,14 +204,27 @@ int ipa_proc_euicc_data_req(struct ipa_context *ctx, const struct ipa_proc_euicc
 	ipa_euicc_data_response.present = IpaEuiccDataResponse_PR_ipaEuiccData;
 	prvde_eim_pkg_rslt_req.ipa_euicc_data_resp = &ipa_euicc_data_response;
 	prvde_eim_pkg_rslt_res = ipa_esipa_prvde_eim_pkg_rslt(ctx, &prvde_eim_pkg_rslt_req);
-	if (!prvde_eim_pkg_rslt_res)
+	if (!prvde_eim_pkg_rslt_res) {
+		/* The ESipa request is going to be retried, the eIM package is executed again when the retry is due
+		 * (this procedure only reads data from the eUICC, so it can be repeated safely) */
+		if (ipa_esipa_retry_pending(ctx))
+			rc = -EAGAIN;
 		goto error;
+	}
 
-	if (ipa_euicc_data_response.present == IpaEuiccDataResponse_PR_ipaEuiccDataError)
+	if (ipa_euicc_data_response.present == IpaEuiccDataResponse_PR_ipaEuiccDataError) {
 		IPA_LOGP(SIPA, LINFO, "IPA get EUICC data failed, eIM is informed about the failure!\n");
-	else
+	} else {
 		IPA_LOGP(SIPA, LINFO, "IPA get EUICC data succeeded!\n");
 
+		/* Remember what the eIM has received, so that we can leave it out of compact ESipa messages */
+		if (ipa_euicc_data_response.choice.ipaEuiccData.euiccInfo1)
+			ctx->eim_knows.euicc_info_1 = true;
+		if (ipa_euicc_data_response.choice.ipaEuiccData.euiccCertificate &&
+		    ipa_euicc_data_response.choice.ipaEuiccData.eumCertificate)
+			ctx->eim_knows.certs = true;
+	}
+
 	IPA_FREE(tag_list);
 	ipa_es10a_get_euicc_cfg_addr_free(euicc_cfg_addr);
 	ipa_es10b_get_euicc_info_free(euicc_info_1);
@@ -229,5 +244,5 @@ error:
 	ipa_es10b_retr_notif_from_lst_res_free(retr_notif_from_lst_res);
 	ipa_esipa_prvde_eim_pkg_rslt_free(prvde_eim_pkg_rslt_res);
 	IPA_LOGP(SIPA, LINFO, "IPA get EUICC data failed!\n");
-	return -EINVAL;
+	return rc;
 }
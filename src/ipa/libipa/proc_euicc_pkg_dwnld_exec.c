@@ -13,6 +13,7 @@
 #include <onomondo/ipa/log.h>
 #include "context.h"
 #include "utils.h"
+#include "esipa.h"
 #include "esipa_get_eim_pkg.h"
 #include "es10b_load_euicc_pkg.h"
 #include "es10b_retr_notif_from_lst.h"
@@ -86,7 +87,11 @@ int ipa_proc_eucc_pkg_dwnld_exec_onset(struct ipa_context *ctx, struct ipa_proc_
 	prvde_eim_pkg_rslt_req.sgp32_notification_list = retr_notif_from_lst_res->sgp32_res;
 	prvde_eim_pkg_rslt_res = ipa_esipa_prvde_eim_pkg_rslt(ctx, &prvde_eim_pkg_rslt_req);
 
-	if (!prvde_eim_pkg_rslt_res) {
+	if (!prvde_eim_pkg_rslt_res && ipa_esipa_retry_pending(ctx)) {
+		/* The ESipa request is going to be retried, ipa_poll will resume here when the retry is due */
+		res->call_onset = true;
+		goto error;
+	} else if (!prvde_eim_pkg_rslt_res) {
 		/* In case we fail to communicate the EuiccPackageResult back to the eIM we may try to perform a
 		 * profile rollback. However, this maneuver only makes sense when the profile has actually changed.
 		 * The profile rollback can only be tried once and the eIM also must have allowed the profile rollback
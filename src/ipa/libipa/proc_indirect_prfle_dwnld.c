@@ -17,6 +17,7 @@
 #include "esipa_auth_clnt.h"
 #include "proc_cmn_mtl_auth.h"
 #include "proc_prfle_dwnld.h"
+#include "esipa.h"
 #include "esipa_get_bnd_prfle_pkg.h"
 #include "proc_cmn_cancel_sess.h"
 #include "proc_prfle_inst.h"
@@ -35,6 +36,9 @@ int ipa_proc_indirect_prfle_dwnlod(struct ipa_context *ctx, const struct ipa_pro
 	struct ipa_proc_cmn_cancel_sess_pars cmn_cancel_sess_pars = { 0 };
 	struct ipa_proc_prfle_dwnlod_pars prfle_dwnlod_pars = { 0 };
 	struct ipa_proc_prfle_inst_pars prfle_inst_pars = { 0 };
+	struct ipa_proc_prfle_inst *prfle_inst = NULL;
+	int inst_rc;
+	int rc = 0;
 
 	/* This procedure is called when the IPAd receives an eIM package with a download trigger request
 	 * (which contains the activation code) */
@@ -54,38 +58,58 @@ int ipa_proc_indirect_prfle_dwnlod(struct ipa_context *ctx, const struct ipa_pro
 	auth_clnt_res = ipa_proc_cmn_mtl_auth(ctx, &cmn_mtl_auth_pars);
 	if (!auth_clnt_res) {
 		IPA_LOGP(SIPA, LERROR, "cannot continue, mutual authentication failed!\n");
+		/* When an ESipa request is going to be retried, the procedure is repeated from the start when the
+		 * retry is due (no session has been established yet, so there is nothing to cancel) */
+		if (ipa_esipa_retry_pending(ctx))
+			rc = -EAGAIN;
 		goto error;
 	}
 
 	/* TODO: Check if ProfileMetadata contains Profile Policy Rulses (PPRs) and apply the PPRs as configured on the
 	 * eUICC. (This is an optional feature, which we currently do not support, see also proc_euicc_data_req.c) */
 
+	/* At this point we must ask the user for consent before we proceed with the profile installation. In case the
+	 * user does not consent, we must abort by calling the common cancel session procedure. (The consent is
+	 * requested before the download since the installation may already begin during the download, see below) */
+	if (ctx->cfg->prfle_inst_consent_cb
+	    && !ctx->cfg->prfle_inst_consent_cb(activation_code->sm_dp_plus_address, activation_code->ac_token)) {
+		IPA_LOGP(SIPA, LERROR, "no end user consent for profile installation -- canceling session!\n");
+		cmn_cancel_sess_pars.reason = CancelSessionReason_endUserRejection;
+		cmn_cancel_sess_pars.transaction_id = *auth_clnt_res->transaction_id;
+		ipa_proc_cmn_cancel_sess(ctx, &cmn_cancel_sess_pars);
+		goto error;
+	}
+
+	/* When the BoundProfilePackage is streamed, the Sub-procedure Profile Installation is started now and each
+	 * segment is loaded into the eUICC as soon as it has been downloaded. */
+	if (ctx->cfg->esipa_bpp_stream) {
+		prfle_inst = ipa_proc_prfle_inst_start(ctx);
+		prfle_dwnlod_pars.segment_cb = ipa_proc_prfle_inst_load;
+		prfle_dwnlod_pars.segment_cb_priv = prfle_inst;
+	}
+
 	/* TODO: remove this part as it is not required (see also github issue #5) */
 	/* Execute sub procedure: Sub-procedure Profile Download and Installation – Download Confirmation */
 	prfle_dwnlod_pars.auth_clnt_ok_dpe = auth_clnt_res->auth_clnt_ok_dpe;
 	get_bnd_prfle_pkg_res = ipa_proc_prfle_dwnlod(ctx, &prfle_dwnlod_pars);
 	if (!get_bnd_prfle_pkg_res) {
 		IPA_LOGP(SIPA, LERROR, "sub procedure profile download has failed -- canceling session!\n");
+		if (prfle_inst)
+			ipa_proc_prfle_inst_finish(prfle_inst);
 		cmn_cancel_sess_pars.reason = CancelSessionReason_loadBppExecutionError;
 		cmn_cancel_sess_pars.transaction_id = *auth_clnt_res->transaction_id;
 		ipa_proc_cmn_cancel_sess(ctx, &cmn_cancel_sess_pars);
 		goto error;
 	}
 
-	/* At this point we must ask the user for consent before we proceed with the profile installation. In case the
-	 * user does not consent, we must abort by calling the common cancel session procedure. */
-	if (ctx->cfg->prfle_inst_consent_cb
-	    && !ctx->cfg->prfle_inst_consent_cb(activation_code->sm_dp_plus_address, activation_code->ac_token)) {
-		IPA_LOGP(SIPA, LERROR, "no end user consent for profile installation -- canceling session!\n");
-		cmn_cancel_sess_pars.reason = CancelSessionReason_endUserRejection;
-		cmn_cancel_sess_pars.transaction_id = *auth_clnt_res->transaction_id;
-		ipa_proc_cmn_cancel_sess(ctx, &cmn_cancel_sess_pars);
-		goto error;
-	}
-
 	/* Execute sub procedure: Sub-procedure Profile Installation (See also section 3.1.3.3 of SGP.22) */
-	prfle_inst_pars.bound_profile_package = &get_bnd_prfle_pkg_res->get_bnd_prfle_pkg_ok->boundProfilePackage;
-	if (ipa_proc_prfle_inst(ctx, &prfle_inst_pars) < 0) {
+	if (prfle_inst) {
+		inst_rc = ipa_proc_prfle_inst_finish(prfle_inst);
+	} else {
+		prfle_inst_pars.bpp_encoded = get_bnd_prfle_pkg_res->msg_to_ipa_encoded;
+		inst_rc = ipa_proc_prfle_inst(ctx, &prfle_inst_pars);
+	}
+	if (inst_rc < 0) {
 		IPA_LOGP(SIPA, LERROR, "sub procedure profile installation has failed -- canceling session!\n");
 		cmn_cancel_sess_pars.reason = CancelSessionReason_loadBppExecutionError;
 		cmn_cancel_sess_pars.transaction_id = *auth_clnt_res->transaction_id;
@@ -96,5 +120,5 @@ error:
 	ipa_activation_code_free(activation_code);
 	ipa_esipa_auth_clnt_res_free(auth_clnt_res);
 	ipa_esipa_get_bnd_prfle_pkg_res_free(get_bnd_prfle_pkg_res);
-	return 0;
+	return rc;
 }
@@ -46,12 +46,16 @@ struct ipa_esipa_get_bnd_prfle_pkg_res *ipa_proc_prfle_dwnlod(struct ipa_context
 	 * result as a whole to the eIM. In case of failure it is the responsibility of the eIM to look at error
 	 * codes and to react accordingly. */
 	get_bnd_prfle_pkg_req.prep_dwnld_res = prep_dwnld_res->res;
-	get_bnd_prfle_pkg_res = ipa_esipa_get_bnd_prfle_pkg(ctx, &get_bnd_prfle_pkg_req);
+	if (pars->segment_cb)
+		get_bnd_prfle_pkg_res = ipa_esipa_get_bnd_prfle_pkg_stream(ctx, &get_bnd_prfle_pkg_req,
+									   pars->segment_cb, pars->segment_cb_priv);
+	else
+		get_bnd_prfle_pkg_res = ipa_esipa_get_bnd_prfle_pkg(ctx, &get_bnd_prfle_pkg_req);
 	if (!get_bnd_prfle_pkg_res)
 		goto error;
 	else if (get_bnd_prfle_pkg_res->get_bnd_prfle_pkg_err)
 		goto error;
-	else if (!get_bnd_prfle_pkg_res->get_bnd_prfle_pkg_ok)
+	else if (!get_bnd_prfle_pkg_res->get_bnd_prfle_pkg_ok && !get_bnd_prfle_pkg_res->bpp_streamed)
 		goto error;
 
 	/* In case of error it is the responsibility of the caller to call the Common Cancel Session procedure.
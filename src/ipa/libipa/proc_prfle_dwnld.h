@@ -1,12 +1,18 @@
 #pragma once
 
 #include <AuthenticateClientOkDPEsipa.h>
+#include "bpp_segments.h"
 
 struct ipa_context;
 struct ipa_esipa_get_bnd_prfle_pkg_res;
 
 struct ipa_proc_prfle_dwnlod_pars {
 	const AuthenticateClientOkDPEsipa_t *auth_clnt_ok_dpe;
+
+	/* When a segment callback is set, the BoundProfilePackage is not returned but passed to the callback segment
+	 * by segment while it is downloaded (optional) */
+	ipa_bpp_segment_cb segment_cb;
+	void *segment_cb_priv;
 };
 
 struct ipa_esipa_get_bnd_prfle_pkg_res *ipa_proc_prfle_dwnlod(struct ipa_context *ctx,
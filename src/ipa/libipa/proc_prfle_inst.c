@@ -14,6 +14,7 @@
 #include "context.h"
 #include "utils.h"
 #include "es10x.h"
+#include "euicc.h"
 #include "es10b_load_bnd_prfle_pkg.h"
 #include "esipa_handle_notif.h"
 #include "es10b_rm_notif_from_lst.h"
@@ -51,62 +52,138 @@ static int handle_load_bnd_prfle_pkg_res(struct ipa_context *ctx, struct ipa_es1
 	return 1;
 }
 
-/*! Perform Sub-procedure Profile Installation.
+struct ipa_proc_prfle_inst {
+	struct ipa_context *ctx;
+	bool transaction;
+
+	/* The eUICC has responded with a ProfileInstallationResult (and the notification was sent) */
+	bool result;
+	long seq_number;
+
+	/* The eUICC has responded with a ProfileInstallationResult before all segments were transferred */
+	bool aborted;
+	bool failed;
+};
+
+/*! Start Sub-procedure Profile Installation. The segments of the BoundProfilePackage are then transferred one by one
+ *  using ipa_proc_prfle_inst_load and the procedure is completed with ipa_proc_prfle_inst_finish. This allows to
+ *  load the segments while the BoundProfilePackage is still being downloaded.
  *  \param[inout] ctx pointer to ipa_context.
- *  \param[in] pars pointer to struct that holds the procedure parameters.
+ *  \returns pointer to newly allocated procedure state. */
+struct ipa_proc_prfle_inst *ipa_proc_prfle_inst_start(struct ipa_context *ctx)
+{
+	struct ipa_proc_prfle_inst *inst = IPA_ALLOC_ZERO(struct ipa_proc_prfle_inst);
+
+	inst->ctx = ctx;
+	inst->seq_number = -1;
+	return inst;
+}
+
+/*! Transfer one ES8+ segment of the BoundProfilePackage to the eUICC (see also ipa_proc_prfle_inst_start).
+ *  \param[in] data pointer to the encoded segment.
+ *  \param[in] len length of the encoded segment.
+ *  \param[inout] priv pointer to procedure state (struct ipa_proc_prfle_inst).
  *  \returns 0 on success, negative on failure. */
-int ipa_proc_prfle_inst(struct ipa_context *ctx, const struct ipa_proc_prfle_inst_pars *pars)
+int ipa_proc_prfle_inst_load(const uint8_t *data, size_t len, void *priv)
 {
-	struct ipa_es10b_load_bnd_prfle_pkg_res *load_bnd_prfle_pkg_res = NULL;
-	struct ipa_bpp_segments *segments = NULL;
-	unsigned int i;
+	struct ipa_proc_prfle_inst *inst = priv;
+	struct ipa_es10b_load_bnd_prfle_pkg_res *load_bnd_prfle_pkg_res;
+	long seq_number;
 	int rc;
-	long seq_number = -1;
-	bool sucess = true;
 
-	/* Step #3-#5 Split BPP into ES8+ segments and send the segments to eUICC */
-	segments = ipa_bpp_segments_encode(pars->bound_profile_package);
-	if (!segments)
-		goto error;
-	for (i = 0; i < segments->count; i++) {
-		IPA_LOGP(SIPA, LDEBUG, "transferring ES8+ segments...\n");
-		load_bnd_prfle_pkg_res =
-		    ipa_es10b_load_bnd_prfle_pkg(ctx, segments->segment[i]->data, segments->segment[i]->len);
-		if (!load_bnd_prfle_pkg_res) {
-			IPA_LOGP(SIPA, LERROR, "failed to transfer ES8+ segments!\n");
-			goto error;
-		}
-		rc = handle_load_bnd_prfle_pkg_res(ctx, load_bnd_prfle_pkg_res, &seq_number);
-		if (rc < 0) {
-			goto error;
-		} else if (rc == 0 && i == segments->count - 1) {
-			IPA_LOGP(SIPA, LERROR, "eUICC didn't respond with ProfileInstallationResult!\n");
-			goto error;
-		} else if (rc == 1 && i != segments->count - 1) {
+	/* The eUICC already ended the installation, the remaining segments are not transferred */
+	if (inst->result) {
+		if (!inst->aborted)
 			IPA_LOGP(SIPA, LERROR, "profile installation aborted by eUICC, notfication sent!\n");
-			sucess = false;
-			break;
-		}
+		inst->aborted = true;
+		return 0;
 	}
 
-	/* Step #11 (ES10b.RemoveNotificationFromList) */
-	if (seq_number >= 0) {
-		if (ipa_es10b_rm_notif_from_lst(ctx, seq_number) < 0)
-			goto error;
-	} else {
-		/* We do not have a valid sequence number, either the loop above did not run at least once (0 segments)
-		 * or something else went wrong. */
+	/* Keep exclusive access to the eUICC while the segments are transferred, so that no other application can
+	 * interleave its APDUs */
+	if (!inst->transaction) {
+		ipa_euicc_begin_transaction(inst->ctx);
+		inst->transaction = true;
+	}
+
+	IPA_LOGP(SIPA, LDEBUG, "transferring ES8+ segments...\n");
+	load_bnd_prfle_pkg_res = ipa_es10b_load_bnd_prfle_pkg(inst->ctx, data, len);
+	if (!load_bnd_prfle_pkg_res) {
+		IPA_LOGP(SIPA, LERROR, "failed to transfer ES8+ segments!\n");
+		inst->failed = true;
+		return -EIO;
+	}
+	rc = handle_load_bnd_prfle_pkg_res(inst->ctx, load_bnd_prfle_pkg_res, &seq_number);
+	if (rc < 0) {
+		inst->failed = true;
+		return rc;
+	} else if (rc == 1) {
+		inst->result = true;
+		inst->seq_number = seq_number;
+	}
+
+	return 0;
+}
+
+/*! Complete Sub-procedure Profile Installation (see also ipa_proc_prfle_inst_start).
+ *  \param[in] inst pointer to procedure state (will be freed).
+ *  \returns 0 on success, negative on failure. */
+int ipa_proc_prfle_inst_finish(struct ipa_proc_prfle_inst *inst)
+{
+	struct ipa_context *ctx = inst->ctx;
+
+	if (inst->transaction)
+		ipa_euicc_end_transaction(ctx);
+
+	if (inst->failed)
+		goto error;
+	if (!inst->result) {
+		/* Either no segments were transferred at all or the eUICC did not respond after the last segment */
+		IPA_LOGP(SIPA, LERROR, "eUICC didn't respond with ProfileInstallationResult!\n");
 		goto error;
 	}
 
-	ipa_bpp_segments_free(segments);
-	if (sucess)
-		IPA_LOGP(SIPA, LINFO, "profile installation succeeded!\n");
-	else
+	/* Step #11 (ES10b.RemoveNotificationFromList) */
+	if (ipa_es10b_rm_notif_from_lst(ctx, inst->seq_number) < 0)
+		goto error;
+
+	if (inst->aborted)
 		IPA_LOGP(SIPA, LINFO, "profile installation aborted!\n");
+	else
+		IPA_LOGP(SIPA, LINFO, "profile installation succeeded!\n");
+	IPA_FREE(inst);
 	return 0;
 error:
-	ipa_bpp_segments_free(segments);
+	IPA_FREE(inst);
 	IPA_LOGP(SIPA, LERROR, "profile installation failed!\n");
 	return -EINVAL;
 }
+
+/*! Perform Sub-procedure Profile Installation.
+ *  \param[inout] ctx pointer to ipa_context.
+ *  \param[in] pars pointer to struct that holds the procedure parameters.
+ *  \returns 0 on success, negative on failure. */
+int ipa_proc_prfle_inst(struct ipa_context *ctx, const struct ipa_proc_prfle_inst_pars *pars)
+{
+	struct ipa_proc_prfle_inst *inst;
+	struct ipa_bpp_slices *slices = NULL;
+	unsigned int i;
+	int rc;
+
+	/* Step #3-#5 Split BPP into ES8+ segments and send the segments to eUICC */
+	slices = ipa_bpp_segments_slice(pars->bpp_encoded->data, pars->bpp_encoded->len);
+	if (!slices) {
+		IPA_LOGP(SIPA, LERROR, "profile installation failed!\n");
+		return -EINVAL;
+	}
+
+	inst = ipa_proc_prfle_inst_start(ctx);
+	for (i = 0; i < slices->count; i++) {
+		if (ipa_proc_prfle_inst_load(slices->data + slices->slice[i].offset, slices->slice[i].len, inst) < 0)
+			break;
+	}
+	rc = ipa_proc_prfle_inst_finish(inst);
+
+	ipa_bpp_slices_free(slices);
+	return rc;
+}
@@ -1,11 +1,19 @@
 #pragma once
 
-#include <BoundProfilePackage.h>
+#include <stdint.h>
+#include <stddef.h>
 
 struct ipa_context;
+struct ipa_buf;
 
 struct ipa_proc_prfle_inst_pars {
-	const struct BoundProfilePackage *bound_profile_package;
+	/* Encoded BoundProfilePackage, may also be embedded in an encoded ESipa message */
+	const struct ipa_buf *bpp_encoded;
 };
 
+struct ipa_proc_prfle_inst;
+
+struct ipa_proc_prfle_inst *ipa_proc_prfle_inst_start(struct ipa_context *ctx);
+int ipa_proc_prfle_inst_load(const uint8_t *data, size_t len, void *priv);
+int ipa_proc_prfle_inst_finish(struct ipa_proc_prfle_inst *inst);
 int ipa_proc_prfle_inst(struct ipa_context *ctx, const struct ipa_proc_prfle_inst_pars *pars);
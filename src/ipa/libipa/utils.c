@@ -9,9 +9,21 @@
 #include <stdbool.h>
 #include <ctype.h>
 #include <errno.h>
+#include <assert.h>
 #include <onomondo/ipa/utils.h>
+#include <onomondo/ipa/mem.h>
 #include <onomondo/ipa/log.h>
 #include <asn_application.h>
+#include <constr_SEQUENCE.h>
+#include <constr_SET.h>
+#include <constr_CHOICE.h>
+#include <constr_SET_OF.h>
+#include <asn_SET_OF.h>
+#include <OCTET_STRING.h>
+#include <asn_codecs_prim.h>
+#include <NativeInteger.h>
+#include <BOOLEAN.h>
+#include <NULL.h>
 #include "utils.h"
 #include "length.h"
 
@@ -39,8 +51,8 @@ const char *ipa_str_from_num(const struct num_str_map *map, long num, const char
 #define IPA_HEXDUMP_BUFSIZE 256
 char *ipa_hexdump(const uint8_t *data, size_t len)
 {
-	static char out[IPA_HEXDUMP_MAX][IPA_HEXDUMP_BUFSIZE];
-	static uint8_t idx = 0;
+	static IPA_THREAD_LOCAL char out[IPA_HEXDUMP_MAX][IPA_HEXDUMP_BUFSIZE];
+	static IPA_THREAD_LOCAL uint8_t idx = 0;
 	char *out_ptr;
 	size_t i;
 
@@ -293,7 +305,7 @@ bool ipa_tag_in_taglist(uint16_t tag, const struct ipa_buf *tag_list)
 static size_t parse_btlv_hdr(size_t *len, uint16_t *tag, uint8_t *data, size_t data_len)
 {
 	uint8_t tag_len = 1;
-	uint16_t value_len = 0;
+	size_t value_len = 0;
 	uint8_t len_bytes;
 	size_t skip_len = 0;
 	unsigned int i;
@@ -455,27 +467,131 @@ size_t ipa_binary_from_hexstr(uint8_t *binary, size_t binary_len, const char *he
 	return binary_count;
 }
 
-/*! Duplicate/Copy an existing decoded ASN.1 struct.
+struct asn1c_enc_buf {
+	struct ipa_buf *buf;
+	/* Drop everything that does not fit into buf (instead of failing) */
+	bool truncate;
+	bool overflow;
+};
+
+static int asn1c_enc_buf_cb(const void *buffer, size_t size, void *priv)
+{
+	struct asn1c_enc_buf *enc_buf = priv;
+	size_t room = enc_buf->buf->data_len - enc_buf->buf->len;
+
+	if (size > room) {
+		enc_buf->overflow = true;
+		if (!enc_buf->truncate)
+			return -1;
+		size = room;
+	}
+
+	ipa_buf_cpy(enc_buf->buf, buffer, size);
+	return 0;
+}
+
+/*! Determine the length of the DER encoded representation of an ASN.1 struct (without encoding it).
  *  \param[in] td pointer to asn_TYPE_descriptor.
- *  \param[in] struct_ptr pointer to decoded ASN.1 struct to be duplicated.
- *  \returns pointer duplicated ASN.1 struct, NULL on error. */
-void *ipa_asn1c_dup(const struct asn_TYPE_descriptor_s *td, const void *struct_ptr)
+ *  \param[in] struct_ptr pointer to ASN.1 struct.
+ *  \returns length of the encoded struct, -EINVAL when the struct cannot be encoded. */
+ssize_t ipa_asn1c_encoded_len(const struct asn_TYPE_descriptor_s *td, const void *struct_ptr)
 {
-	struct ipa_buf *buf_encoded = NULL;
-	asn_enc_rval_t rc_enc;
-	asn_dec_rval_t rc_dec;
+	asn_enc_rval_t rc;
 
-	void *struct_ptr_dup = NULL;
+	rc = der_encode(td, struct_ptr, NULL, NULL);
+	if (rc.encoded <= 0)
+		return -EINVAL;
+	return rc.encoded;
+}
 
-	if (!struct_ptr)
+/*! DER encode an ASN.1 struct and append the result to a caller provided buffer.
+ *  \param[inout] buf ipa_buf to which the encoded struct is appended (see also ipa_asn1c_encoded_len).
+ *  \param[in] td pointer to asn_TYPE_descriptor.
+ *  \param[in] struct_ptr pointer to ASN.1 struct to encode.
+ *  \returns number of bytes appended, -ENOMEM when buf is too small, -EINVAL when the struct cannot be encoded (buf
+ *	     is not changed in both cases). */
+ssize_t ipa_asn1c_encode_to(struct ipa_buf *buf, const struct asn_TYPE_descriptor_s *td, const void *struct_ptr)
+{
+	struct asn1c_enc_buf enc_buf = { .buf = buf };
+	size_t len = buf->len;
+	asn_enc_rval_t rc;
+
+	rc = der_encode(td, struct_ptr, asn1c_enc_buf_cb, &enc_buf);
+	if (rc.encoded <= 0) {
+		buf->len = len;
+		return enc_buf.overflow ? -ENOMEM : -EINVAL;
+	}
+
+	return rc.encoded;
+}
+
+/*! DER encode the tag and length fields of an ASN.1 struct (the value part is omitted) and append them to a caller
+ *  provided buffer.
+ *  \param[inout] buf ipa_buf to which the tag and length fields are appended.
+ *  \param[in] td pointer to asn_TYPE_descriptor.
+ *  \param[in] struct_ptr pointer to ASN.1 struct to encode.
+ *  \returns number of bytes appended, -ENOMEM when buf is too small, -EINVAL when the struct cannot be encoded. */
+ssize_t ipa_asn1c_encode_hdr_to(struct ipa_buf *buf, const struct asn_TYPE_descriptor_s *td, const void *struct_ptr)
+{
+	uint8_t hdr_data[IPA_LEN_ASN1_HDR_MAX] = { 0 };
+	struct ipa_buf hdr;
+	struct asn1c_enc_buf enc_buf = { .buf = &hdr, .truncate = true };
+	asn_enc_rval_t rc;
+	size_t hdr_len;
+
+	/* The encoder output is cut off after the first few bytes, so no memory is needed for the value part */
+	ipa_buf_assign(&hdr, hdr_data, sizeof(hdr_data));
+	hdr.len = 0;
+	rc = der_encode(td, struct_ptr, asn1c_enc_buf_cb, &enc_buf);
+	if (rc.encoded <= 0)
+		return -EINVAL;
+
+	hdr_len = parse_btlv_hdr(NULL, NULL, hdr.data, hdr.len);
+	if (hdr_len > hdr.len)
+		return -EINVAL;
+	if (buf->data_len - buf->len < hdr_len)
+		return -ENOMEM;
+
+	ipa_buf_cpy(buf, hdr.data, hdr_len);
+	return hdr_len;
+}
+
+/*! DER encode an ASN.1 struct into a newly allocated buffer of the exact size. (Other than with
+ *  ipa_asn1c_consume_bytes_cb, the length is determined first, so the output is written only once.)
+ *  \param[in] td pointer to asn_TYPE_descriptor.
+ *  \param[in] struct_ptr pointer to ASN.1 struct to encode.
+ *  \returns pointer to newly allocated ipa_buf that contains the encoded struct, NULL on error. */
+struct ipa_buf *ipa_asn1c_encode(const struct asn_TYPE_descriptor_s *td, const void *struct_ptr)
+{
+	struct ipa_buf *buf;
+	ssize_t len;
+
+	len = ipa_asn1c_encoded_len(td, struct_ptr);
+	if (len < 0)
 		return NULL;
 
-	rc_enc = der_encode(td, struct_ptr, ipa_asn1c_consume_bytes_cb, &buf_encoded);
-	if (rc_enc.encoded <= 0) {
-		IPA_FREE(buf_encoded);
+	buf = ipa_buf_alloc(len);
+	assert(buf);
+	if (ipa_asn1c_encode_to(buf, td, struct_ptr) != len) {
+		IPA_FREE(buf);
 		return NULL;
 	}
 
+	return buf;
+}
+
+/* Duplicate an ASN.1 struct by encoding and decoding it (fallback for types that asn1c_copy does not know) */
+static void *asn1c_dup_codec(const struct asn_TYPE_descriptor_s *td, const void *struct_ptr)
+{
+	struct ipa_buf *buf_encoded;
+	asn_dec_rval_t rc_dec;
+
+	void *struct_ptr_dup = NULL;
+
+	buf_encoded = ipa_asn1c_encode(td, struct_ptr);
+	if (!buf_encoded)
+		return NULL;
+
 	rc_dec = ber_decode(0, td, (void **)&struct_ptr_dup, buf_encoded->data, buf_encoded->len);
 	if (rc_dec.code != RC_OK) {
 		IPA_FREE(buf_encoded);
@@ -486,3 +602,161 @@ void *ipa_asn1c_dup(const struct asn_TYPE_descriptor_s *td, const void *struct_p
 	IPA_FREE(buf_encoded);
 	return struct_ptr_dup;
 }
+
+/* Size of the struct that represents an ASN.1 type, 0 if the representation is unknown. The representation is
+ * identified by the free function of the type (e.g. all string types are represented like an OCTET STRING). */
+static size_t asn1c_struct_size(const struct asn_TYPE_descriptor_s *td)
+{
+	asn_struct_free_f *free_struct = td->op->free_struct;
+
+	if (free_struct == SEQUENCE_free)
+		return ((const asn_SEQUENCE_specifics_t *)td->specifics)->struct_size;
+	else if (free_struct == SET_free)
+		return ((const asn_SET_specifics_t *)td->specifics)->struct_size;
+	else if (free_struct == CHOICE_free)
+		return ((const asn_CHOICE_specifics_t *)td->specifics)->struct_size;
+	else if (free_struct == SET_OF_free)
+		return ((const asn_SET_OF_specifics_t *)td->specifics)->struct_size;
+	else if (free_struct == OCTET_STRING_free)
+		return td->specifics ? ((const asn_OCTET_STRING_specifics_t *)td->specifics)->struct_size :
+		    asn_SPC_OCTET_STRING_specs.struct_size;
+	else if (free_struct == ASN__PRIMITIVE_TYPE_free)
+		return sizeof(ASN__PRIMITIVE_TYPE_t);
+	else if (free_struct == NativeInteger_free)
+		return sizeof(long);
+	else if (free_struct == BOOLEAN_free)
+		return sizeof(BOOLEAN_t);
+	else if (free_struct == NULL_free)
+		return sizeof(NULL_t);
+	return 0;
+}
+
+static int asn1c_copy(const struct asn_TYPE_descriptor_s *td, void *dst, const void *src);
+
+/* Copy a member of a constructed type (SEQUENCE, SET, CHOICE) */
+static int asn1c_copy_member(const asn_TYPE_member_t *elm, void *dst, const void *src)
+{
+	const void *memb_src = (const uint8_t *)src + elm->memb_offset;
+	void *memb_dst = (uint8_t *)dst + elm->memb_offset;
+	size_t size;
+
+	if (!(elm->flags & ATF_POINTER))
+		return asn1c_copy(elm->type, memb_dst, memb_src);
+
+	memb_src = *(void *const *)memb_src;
+	if (!memb_src)
+		return 0;
+	size = asn1c_struct_size(elm->type);
+	if (!size)
+		return -ENOTSUP;
+	*(void **)memb_dst = IPA_ALLOC_N(size);
+	assert(*(void **)memb_dst);
+	memset(*(void **)memb_dst, 0, size);
+	return asn1c_copy(elm->type, *(void **)memb_dst, memb_src);
+}
+
+/* Deep copy of an ASN.1 struct (src) into a zero-initialized struct of the same type (dst). When the copy fails,
+ * dst contains what was copied so far and can be freed using ASN_STRUCT_FREE. */
+static int asn1c_copy(const struct asn_TYPE_descriptor_s *td, void *dst, const void *src)
+{
+	asn_struct_free_f *free_struct = td->op->free_struct;
+	const asn_anonymous_set_ *list_src;
+	const ASN__PRIMITIVE_TYPE_t *prim_src;
+	ASN__PRIMITIVE_TYPE_t *prim_dst;
+	const asn_SET_specifics_t *set_specs;
+	void *item;
+	unsigned int present;
+	unsigned int i;
+	int rc;
+
+	if (free_struct == SEQUENCE_free || free_struct == SET_free) {
+		if (free_struct == SET_free) {
+			/* A SET also keeps track of the members that are present */
+			set_specs = td->specifics;
+			memcpy((uint8_t *)dst + set_specs->pres_offset, (const uint8_t *)src + set_specs->pres_offset,
+			       ((td->elements_count + 8 * sizeof(unsigned int) - 1) / (8 * sizeof(unsigned int))) *
+			       sizeof(unsigned int));
+		}
+		for (i = 0; i < td->elements_count; i++) {
+			rc = asn1c_copy_member(&td->elements[i], dst, src);
+			if (rc < 0)
+				return rc;
+		}
+		return 0;
+	} else if (free_struct == CHOICE_free) {
+		present = CHOICE_variant_get_presence(td, src);
+		if (present == 0 || present > td->elements_count)
+			return 0;
+		CHOICE_variant_set_presence(td, dst, present);
+		return asn1c_copy_member(&td->elements[present - 1], dst, src);
+	} else if (free_struct == SET_OF_free) {
+		/* SEQUENCE OF and SET OF, the items are always pointers */
+		list_src = _A_CSET_FROM_VOID(src);
+		for (i = 0; i < (unsigned int)list_src->count; i++) {
+			item = IPA_ALLOC_N(asn1c_struct_size(td->elements[0].type));
+			assert(item);
+			memset(item, 0, asn1c_struct_size(td->elements[0].type));
+			rc = asn1c_copy(td->elements[0].type, item, list_src->array[i]);
+			if (rc < 0 || asn_set_add(dst, item) < 0) {
+				ASN_STRUCT_FREE(*td->elements[0].type, item);
+				return rc < 0 ? rc : -ENOMEM;
+			}
+		}
+		return 0;
+	} else if (free_struct == OCTET_STRING_free || free_struct == ASN__PRIMITIVE_TYPE_free) {
+		/* All string types (also BIT STRING and ANY) begin with buf and size, like the primitive types (INTEGER,
+		 * OBJECT IDENTIFIER). Anything behind that (e.g. the unused bits of a BIT STRING) is copied as it is,
+		 * except for the decoder context. */
+		prim_src = src;
+		prim_dst = dst;
+		if (free_struct == OCTET_STRING_free) {
+			memcpy(dst, src, asn1c_struct_size(td));
+			memset((uint8_t *)dst + (td->specifics ?
+						((const asn_OCTET_STRING_specifics_t *)td->specifics)->ctx_offset :
+						asn_SPC_OCTET_STRING_specs.ctx_offset), 0, sizeof(asn_struct_ctx_t));
+		}
+		prim_dst->buf = NULL;
+		prim_dst->size = prim_src->size;
+		if (!prim_src->buf)
+			return 0;
+		/* (asn1c keeps the strings zero terminated) */
+		prim_dst->buf = IPA_ALLOC_N(prim_src->size + 1);
+		assert(prim_dst->buf);
+		memcpy(prim_dst->buf, prim_src->buf, prim_src->size);
+		prim_dst->buf[prim_src->size] = '\0';
+		return 0;
+	} else if (asn1c_struct_size(td)) {
+		/* Types that are represented by a plain integer (NativeInteger, NativeEnumerated, BOOLEAN, NULL) */
+		memcpy(dst, src, asn1c_struct_size(td));
+		return 0;
+	}
+
+	return -ENOTSUP;
+}
+
+/*! Duplicate/Copy an existing decoded ASN.1 struct.
+ *  \param[in] td pointer to asn_TYPE_descriptor.
+ *  \param[in] struct_ptr pointer to decoded ASN.1 struct to be duplicated.
+ *  \returns pointer duplicated ASN.1 struct, NULL on error. */
+void *ipa_asn1c_dup(const struct asn_TYPE_descriptor_s *td, const void *struct_ptr)
+{
+	void *struct_ptr_dup;
+	size_t size;
+
+	if (!struct_ptr)
+		return NULL;
+
+	/* The struct is copied member by member, as described by the type descriptor. Encoding and decoding is only
+	 * used for types whose representation is not known (see asn1c_struct_size). */
+	size = asn1c_struct_size(td);
+	if (size) {
+		struct_ptr_dup = IPA_ALLOC_N(size);
+		assert(struct_ptr_dup);
+		memset(struct_ptr_dup, 0, size);
+		if (asn1c_copy(td, struct_ptr_dup, struct_ptr) == 0)
+			return struct_ptr_dup;
+		ASN_STRUCT_FREE(*td, struct_ptr_dup);
+	}
+
+	return asn1c_dup_codec(td, struct_ptr);
+}
@@ -4,10 +4,17 @@
 #include <onomondo/ipa/log.h>
 #include <errno.h>
 #include <stddef.h>
+#include <sys/types.h>
 #include <stdbool.h>
 
 struct asn_TYPE_descriptor_s;
 
+/* \! Storage class for function local static buffers. Those buffers must not be shared between ipa_context instances
+ *    that are driven from different threads (see also multi instance mode in main.c). */
+#ifndef IPA_THREAD_LOCAL
+#define IPA_THREAD_LOCAL __thread
+#endif
+
 /*! A mapping between human-readable string and numeric value, when forming arrays of this struct, the last entry
  *  must have member str set to NULL. */
 struct num_str_map {
@@ -17,6 +24,10 @@ struct num_str_map {
 
 const char *ipa_str_from_num(const struct num_str_map *map, long num, const char *def);
 int ipa_asn1c_consume_bytes_cb(const void *buffer, size_t size, void *priv);
+ssize_t ipa_asn1c_encoded_len(const struct asn_TYPE_descriptor_s *td, const void *struct_ptr);
+ssize_t ipa_asn1c_encode_to(struct ipa_buf *buf, const struct asn_TYPE_descriptor_s *td, const void *struct_ptr);
+ssize_t ipa_asn1c_encode_hdr_to(struct ipa_buf *buf, const struct asn_TYPE_descriptor_s *td, const void *struct_ptr);
+struct ipa_buf *ipa_asn1c_encode(const struct asn_TYPE_descriptor_s *td, const void *struct_ptr);
 void ipa_asn1c_dump(const struct asn_TYPE_descriptor_s *td, const void *struct_ptr, uint8_t indent,
 		    enum log_subsys log_subsys, enum log_level log_level);
 int ipa_cmp_case_insensitive(const char *str1, const char *str2, size_t len);
@@ -11,9 +11,16 @@
 #include <limits.h>
 #include <signal.h>
 #include <unistd.h>
+#include <pthread.h>
+#include <time.h>
 #include <onomondo/ipa/utils.h>
 #include <onomondo/ipa/log.h>
 #include <onomondo/ipa/ipad.h>
+#include <onomondo/ipa/scard.h>
+#ifdef SCARD_TRACE
+#include <onomondo/ipa/scard_trace.h>
+#endif
+#include "http_srv.h"
 
 #define DEFAULT_READER_NUMBER 0
 #define DEFAULT_CHANNEL_NUMBER 1
@@ -53,8 +60,29 @@ static void print_help(void)
 	printf(" -C .................. CA (Certificate Authority) Bundle file\n");
 	printf(" -S .................. disable HTTPS\n");
 	printf(" -I .................. disable SSL certificate verification (insecure)\n");
+	printf(" -u .................. use CoAP over DTLS instead of HTTPS (CoAP over UDP when HTTPS is disabled)\n");
+	printf(" -k .................. keep the connection to the eIM open across poll cycles\n");
+	printf(" -l SECONDS .......... long poll the eIM (the eIM may hold the request for SECONDS)\n");
+	printf(" -i PORT ............. accept eIM packages injected by the eIM on PORT (instead of polling later)\n");
+	printf(" -J FILE ............. PEM file with certificate and key for -i (default: plain HTTP)\n");
+	printf(" -A FILE ............. CA bundle to verify the eIM client certificate for -i (required with -J)\n");
+	printf(" -j ADDR ............. address to listen on for -i (default: 127.0.0.1, use :: for all addresses)\n");
+	printf(" -b .................. stream the BoundProfilePackage into the eUICC while it is downloaded\n");
+	printf(" -B .................. minimize ESipa traffic (use compact ESipa message formats)\n");
 	printf(" -E .................. emulate IoT eUICC (compatibility mode to use consumer eUICCs)\n");
+	printf(" -X .................. disable extended length APDUs\n");
+	printf(" -W .................. warm start (cache ATR and EID, skip TERMINAL CAPABILITIES)\n");
+	printf(" -K .................. keep the logical channel open on exit (reused on warm start)\n");
+	printf(" -M .................. multi instance mode: run one IPAd instance per smartcard reader\n");
+	printf(" -w NUM .............. number of worker threads in multi instance mode (default: one per reader)\n");
 	printf(" -1 .................. force the IPAd to process only one eUICC package (debug, use with caution)\n");
+#ifdef SCARD_TRACE
+#ifndef SCARD_TRACE_REPLAY_ONLY
+	printf(" -T PATH ............. record APDU trace to file\n");
+#endif
+	printf(" -P PATH ............. replay APDU trace from file (no smartcard reader needed)\n");
+	printf(" -L .................. replay APDU trace in real-time (default: zero latency)\n");
+#endif
 }
 
 struct ipa_buf *load_ber_from_file(char *dir, char *file)
@@ -131,6 +159,298 @@ static void sig_usr1(int signum)
 	running = false;
 }
 
+/* Wait for the eIM to inject an eIM package (see also option -i) and pass it to the IPAd, returns 1 when an eIM
+ * package was received, 0 when the timeout expired (timeout_ms = 0: wait until stopped) and negative on error. */
+static int wait_for_injection(struct ipa_context *ctx, void *http_srv, unsigned int timeout_ms)
+{
+	struct ipa_buf *eim_pkg = NULL;
+	struct ipa_buf *res;
+	unsigned int waited = 0;
+	unsigned int interval;
+	int rc = 0;
+
+	/* Wait in short intervals, so that a stop request (SIGUSR1) is noticed */
+	while (running && rc == 0 && (timeout_ms == 0 || waited < timeout_ms)) {
+		interval = (timeout_ms == 0 || timeout_ms - waited > 1000) ? 1000 : timeout_ms - waited;
+		rc = ipa_http_srv_recv(http_srv, &eim_pkg, interval);
+		waited += interval;
+	}
+	if (rc <= 0)
+		return rc;
+
+	/* The eIM package is executed when ipa_poll is called next */
+	res = ipa_inject_eim_pkg(ctx, eim_pkg);
+	ipa_http_srv_send(http_srv, res);
+	IPA_FREE(res);
+	IPA_FREE(eim_pkg);
+	return 1;
+}
+
+/* Evaluate the return code of ipa_poll, returns 1 when polling should continue, 0 when polling ends normally and a
+ * negative value when polling ends due to an error. */
+static int handle_poll_rc(int rc, bool one_euicc_pkg_only)
+{
+	switch (rc) {
+	case IPA_POLL_AGAIN_WHEN_ONLINE:
+		/* ipa_poll asks us to wait with the next poll cycle until we have a stable IP connection. In this
+		 * example we assume that IP connectivity is always available. */
+		IPA_LOGP(SMAIN, LINFO, "poll cycle continues normally (profile change)\n");
+		return 1;
+	case IPA_POLL_AGAIN:
+		/* ipa_poll asks us to continue polling normally */
+		if (one_euicc_pkg_only) {
+			IPA_LOGP(SMAIN, LINFO, "forcefully stopping poll cycle upon user decision!\n");
+			return 0;
+		}
+		IPA_LOGP(SMAIN, LINFO, "poll cycle continues normally\n");
+		return 1;
+	case IPA_POLL_RETRY:
+		/* ipa_poll tells us that a request towards the eIM has failed and will be retried, we must wait for the
+		 * delay that ipa_poll_delay returns before we call ipa_poll again. */
+		IPA_LOGP(SMAIN, LINFO, "poll cycle continues after eIM request retry\n");
+		return 1;
+	case IPA_POLL_LONG_POLL_TIMEOUT:
+		/* ipa_poll tells us that the eIM had no eIM package for us during the long poll, we continue with the
+		 * next long poll immediately. */
+		IPA_LOGP(SMAIN, LINFO, "poll cycle continues with next long poll\n");
+		return 1;
+	case IPA_POLL_AGAIN_LATER:
+		/* ipa_poll tells us that we may poll less frequently, so just exit. */
+		IPA_LOGP(SMAIN, LERROR, "poll cycle ends normally\n");
+		return 0;
+	default:
+		/* We got a negative return code from ipa_poll. This means something does not work normally. In a
+		 * productive setup we would continue calling ipa_poll a few more times to see if the cause is a
+		 * temporary problem. After that we would free the context using ipa_free_ctx and start over. */
+		IPA_LOGP(SMAIN, LERROR, "poll cycle ends due to error (%d)\n", rc);
+		return -EINVAL;
+	}
+}
+
+/* In multi instance mode, one IPAd instance (ipa_context) is created for each smartcard reader. Each instance has
+ * its own configuration, smartcard/HTTP client (inside the ipa_context) and nvstate file. The instances are polled by
+ * a pool of worker threads. Instances that are ready to be polled wait in a FIFO queue, so that the ipa_poll calls
+ * are spread evenly among the instances and each instance is only polled by one worker at a time. */
+struct instance {
+	struct ipa_config cfg;
+	struct ipa_context *ctx;
+	char nvstate_path[PATH_MAX];
+	struct ipa_buf *nvstate_load;
+	int rc;
+
+	/* Point in time (CLOCK_REALTIME) before which the instance must not be polled (see IPA_POLL_RETRY) */
+	struct timespec due;
+	struct instance *next;
+};
+
+static struct {
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	struct instance *head;
+	struct instance *tail;
+	unsigned int active;
+	bool one_euicc_pkg_only;
+} sched = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+	.cond = PTHREAD_COND_INITIALIZER,
+};
+
+/* Put an instance at the end of the ready queue (caller must hold the lock) */
+static void sched_enqueue(struct instance *inst)
+{
+	inst->next = NULL;
+	if (sched.tail)
+		sched.tail->next = inst;
+	else
+		sched.head = inst;
+	sched.tail = inst;
+	pthread_cond_signal(&sched.cond);
+}
+
+static bool timespec_before(const struct timespec *a, const struct timespec *b)
+{
+	return a->tv_sec < b->tv_sec || (a->tv_sec == b->tv_sec && a->tv_nsec < b->tv_nsec);
+}
+
+/* Take the first instance that is due from the ready queue. When no instance is due, NULL is returned and next_due is
+ * set to the point in time when the next instance becomes due (caller must hold the lock) */
+static struct instance *sched_dequeue(struct timespec *next_due)
+{
+	struct instance *inst;
+	struct instance *prev = NULL;
+	struct timespec now;
+
+	clock_gettime(CLOCK_REALTIME, &now);
+	for (inst = sched.head; inst; prev = inst, inst = inst->next) {
+		if (!timespec_before(&now, &inst->due))
+			break;
+		if (!prev || timespec_before(&inst->due, next_due))
+			*next_due = inst->due;
+	}
+	if (!inst)
+		return NULL;
+
+	if (prev)
+		prev->next = inst->next;
+	else
+		sched.head = inst->next;
+	if (sched.tail == inst)
+		sched.tail = prev;
+	inst->next = NULL;
+	return inst;
+}
+
+/* Set the point in time before which an instance must not be polled again */
+static void sched_delay(struct instance *inst, unsigned int delay_ms)
+{
+	clock_gettime(CLOCK_REALTIME, &inst->due);
+	inst->due.tv_sec += delay_ms / 1000;
+	inst->due.tv_nsec += (long)(delay_ms % 1000) * 1000000;
+	if (inst->due.tv_nsec >= 1000000000) {
+		inst->due.tv_sec++;
+		inst->due.tv_nsec -= 1000000000;
+	}
+}
+
+static void *sched_worker(void *priv)
+{
+	struct instance *inst;
+	struct timespec next_due;
+	unsigned int delay;
+	int rc;
+
+	pthread_mutex_lock(&sched.lock);
+	while (1) {
+		/* Wait until an instance becomes ready. When the queue is empty, but instances are still active, another
+		 * worker is currently polling. This worker will wake us up again when it is done. */
+		while (running && sched.active && !sched.head)
+			pthread_cond_wait(&sched.cond, &sched.lock);
+		if (!running || !sched.active)
+			break;
+
+		/* Instances that wait for the retry of a failed eIM request stay in the queue, but are skipped until
+		 * they are due. The worker does not block on them, so the other instances are still served. */
+		inst = sched_dequeue(&next_due);
+		if (!inst) {
+			pthread_cond_timedwait(&sched.cond, &sched.lock, &next_due);
+			continue;
+		}
+		pthread_mutex_unlock(&sched.lock);
+
+		IPA_LOGP(SMAIN, LINFO, "-----------------------------8<----------------------------- (reader #%u)\n",
+			 inst->cfg.reader_num);
+		rc = handle_poll_rc(ipa_poll(inst->ctx), sched.one_euicc_pkg_only);
+		delay = ipa_poll_delay(inst->ctx);
+
+		pthread_mutex_lock(&sched.lock);
+		if (rc > 0) {
+			sched_delay(inst, delay);
+			sched_enqueue(inst);
+		} else {
+			IPA_LOGP(SMAIN, LINFO, "reader #%u: polling ended (%d)\n", inst->cfg.reader_num, rc);
+			inst->rc = rc;
+			sched.active--;
+		}
+	}
+
+	/* Make sure that workers that are still waiting notice that we are done */
+	pthread_cond_broadcast(&sched.cond);
+	pthread_mutex_unlock(&sched.lock);
+	return NULL;
+}
+
+static int run_multi_instance(const struct ipa_config *cfg, const char *nvstate_path, unsigned int num_workers)
+{
+	struct instance *instances = NULL;
+	pthread_t *workers = NULL;
+	struct ipa_buf *nvstate_save;
+	int num_readers;
+	unsigned int i;
+	unsigned int workers_started = 0;
+	int rc = 0;
+
+	num_readers = ipa_scard_num_readers();
+	if (num_readers <= 0) {
+		IPA_LOGP(SMAIN, LERROR, "no smartcard readers found!\n");
+		return -ENODEV;
+	}
+	IPA_LOGP(SMAIN, LINFO, "found %d smartcard readers\n", num_readers);
+
+	instances = IPA_ALLOC_N(num_readers * sizeof(*instances));
+	assert(instances);
+	memset(instances, 0, num_readers * sizeof(*instances));
+
+	/* Create and initialize all instances upfront. An instance that fails to initialize (e.g. empty reader) does not
+	 * prevent the other instances from running. */
+	for (i = 0; i < (unsigned int)num_readers; i++) {
+		struct instance *inst = &instances[i];
+
+		inst->cfg = *cfg;
+		inst->cfg.reader_num = i;
+		snprintf(inst->nvstate_path, sizeof(inst->nvstate_path), "%s.%u", nvstate_path, i);
+
+		IPA_LOGP(SMAIN, LINFO, "-----------------------------8<----------------------------- (reader #%u)\n", i);
+		inst->nvstate_load = load_nvstate_from_file(inst->nvstate_path);
+		inst->ctx = ipa_new_ctx(&inst->cfg, inst->nvstate_load);
+		if (!inst->ctx) {
+			IPA_LOGP(SMAIN, LERROR, "reader #%u: cannot create context!\n", i);
+			inst->rc = -EINVAL;
+			continue;
+		}
+		if (ipa_init(inst->ctx) < 0) {
+			IPA_LOGP(SMAIN, LERROR, "reader #%u: IPAd initialization failed!\n", i);
+			inst->rc = -EINVAL;
+			continue;
+		}
+		if (eim_init(inst->ctx) < 0) {
+			IPA_LOGP(SMAIN, LERROR, "reader #%u: eIM initialization failed!\n", i);
+			inst->rc = -EINVAL;
+			continue;
+		}
+
+		sched_enqueue(inst);
+		sched.active++;
+	}
+
+	if (!num_workers || num_workers > sched.active)
+		num_workers = sched.active;
+	IPA_LOGP(SMAIN, LINFO, "polling %u instances using %u worker threads\n", sched.active, num_workers);
+
+	if (num_workers) {
+		workers = IPA_ALLOC_N(num_workers * sizeof(*workers));
+		assert(workers);
+	}
+	for (i = 0; i < num_workers; i++) {
+		if (pthread_create(&workers[i], NULL, sched_worker, NULL) != 0) {
+			IPA_LOGP(SMAIN, LERROR, "cannot start worker thread!\n");
+			break;
+		}
+		workers_started++;
+	}
+
+	if (num_workers && !workers_started)
+		rc = -EINVAL;
+	for (i = 0; i < workers_started; i++)
+		pthread_join(workers[i], NULL);
+	IPA_FREE(workers);
+
+	IPA_LOGP(SMAIN, LINFO, "-----------------------------8<-----------------------------\n");
+	for (i = 0; i < (unsigned int)num_readers; i++) {
+		struct instance *inst = &instances[i];
+
+		if (inst->rc < 0)
+			rc = -EINVAL;
+		nvstate_save = ipa_free_ctx(inst->ctx);
+		if (nvstate_save)
+			save_nvstate_to_file(inst->nvstate_path, nvstate_save);
+		IPA_FREE(inst->nvstate_load);
+		IPA_FREE(nvstate_save);
+	}
+	IPA_FREE(instances);
+
+	return rc;
+}
+
 int main(int argc, char **argv)
 {
 	struct ipa_config cfg = { 0 };
@@ -143,6 +463,19 @@ int main(int argc, char **argv)
 	struct ipa_buf *nvstate_load = NULL;
 	struct ipa_buf *nvstate_save = NULL;
 	bool getopt_one_euicc_pkg_only = false;
+	bool getopt_multi_instance = false;
+	unsigned int getopt_multi_instance_workers = 0;
+	unsigned int delay;
+	unsigned int getopt_inject_port = 0;
+	char *getopt_inject_cert = NULL;
+	char *getopt_inject_cabundle = NULL;
+	char *getopt_inject_addr = NULL;
+	void *http_srv = NULL;
+#ifdef SCARD_TRACE
+	enum ipa_scard_trace_mode getopt_scard_trace_mode = IPA_SCARD_TRACE_OFF;
+	char *getopt_scard_trace_path = NULL;
+	bool getopt_scard_trace_realtime = false;
+#endif
 
 	signal(SIGUSR1, sig_usr1);
 
@@ -156,7 +489,7 @@ int main(int argc, char **argv)
 
 	/* Overwrite configuration values with user defined parameters */
 	while (1) {
-		opt = getopt(argc, argv, "ht:e:r:c:f:mn:C:SIEy:a1");
+		opt = getopt(argc, argv, "ht:e:r:c:f:mn:C:SIukl:i:J:A:j:bBEXWKy:a1Mw:T:P:L");
 		if (opt == -1)
 			break;
 
@@ -195,9 +528,46 @@ int main(int argc, char **argv)
 		case 'I':
 			cfg.eim_disable_ssl_verif = true;
 			break;
+		case 'u':
+			cfg.eim_coap = true;
+			break;
+		case 'k':
+			cfg.eim_keep_alive = true;
+			break;
+		case 'l':
+			cfg.eim_long_poll_timeout = atoi(optarg);
+			break;
+		case 'i':
+			getopt_inject_port = atoi(optarg);
+			cfg.eim_inject = true;
+			break;
+		case 'J':
+			getopt_inject_cert = optarg;
+			break;
+		case 'A':
+			getopt_inject_cabundle = optarg;
+			break;
+		case 'j':
+			getopt_inject_addr = optarg;
+			break;
+		case 'b':
+			cfg.esipa_bpp_stream = true;
+			break;
+		case 'B':
+			cfg.esipa_minimize_bytes = true;
+			break;
 		case 'E':
 			cfg.iot_euicc_emu_enabled = true;
 			break;
+		case 'X':
+			cfg.euicc_disable_ext_apdu = true;
+			break;
+		case 'W':
+			cfg.euicc_warm_start = true;
+			break;
+		case 'K':
+			cfg.euicc_keep_channel = true;
+			break;
 		case 'y':
 			cfg.esipa_req_retries = atoi(optarg);
 			break;
@@ -207,6 +577,25 @@ int main(int argc, char **argv)
 		case '1':
 			getopt_one_euicc_pkg_only = true;
 			break;
+		case 'M':
+			getopt_multi_instance = true;
+			break;
+		case 'w':
+			getopt_multi_instance_workers = atoi(optarg);
+			break;
+#ifdef SCARD_TRACE
+		case 'T':
+			getopt_scard_trace_mode = IPA_SCARD_TRACE_RECORD;
+			getopt_scard_trace_path = optarg;
+			break;
+		case 'P':
+			getopt_scard_trace_mode = IPA_SCARD_TRACE_REPLAY;
+			getopt_scard_trace_path = optarg;
+			break;
+		case 'L':
+			getopt_scard_trace_realtime = true;
+			break;
+#endif
 		default:
 			printf("unhandled option: %c!\n", opt);
 			break;
@@ -219,16 +608,45 @@ int main(int argc, char **argv)
 	printf(" preferred_eim_id = %s\n", cfg.preferred_eim_id ? cfg.preferred_eim_id : "(first configured eIM)");
 	printf(" reader_num = %d\n", cfg.reader_num);
 	printf(" euicc_channel = %d\n", cfg.euicc_channel);
+	printf(" euicc_disable_ext_apdu = %u\n", cfg.euicc_disable_ext_apdu);
+	printf(" euicc_warm_start = %u\n", cfg.euicc_warm_start);
+	printf(" euicc_keep_channel = %u\n", cfg.euicc_keep_channel);
 	if (cfg.eim_cabundle)
 		printf(" eim_cabundle = %s\n", cfg.eim_cabundle);
 	printf(" eim_disable_ssl = %d\n", cfg.eim_disable_ssl);
 	printf(" eim_disable_ssl_verif = %d\n", cfg.eim_disable_ssl_verif);
+	printf(" eim_coap = %d\n", cfg.eim_coap);
+	printf(" eim_keep_alive = %d\n", cfg.eim_keep_alive);
+	printf(" eim_long_poll_timeout = %u\n", cfg.eim_long_poll_timeout);
+	printf(" eim_inject = %d\n", cfg.eim_inject);
+	if (cfg.eim_inject)
+		printf(" inject_port = %u\n", getopt_inject_port);
+	if (getopt_inject_cert)
+		printf(" inject_cert = %s\n", getopt_inject_cert);
+	if (getopt_inject_cabundle)
+		printf(" inject_cabundle = %s\n", getopt_inject_cabundle);
+	if (getopt_inject_addr)
+		printf(" inject_addr = %s\n", getopt_inject_addr);
 	printf(" tac = %s\n", ipa_hexdump(cfg.tac, sizeof(cfg.tac)));
 	printf(" iot_euicc_emu_enabled = %u\n", cfg.iot_euicc_emu_enabled);
 	printf(" esipa_req_retries = %u\n", cfg.esipa_req_retries);
+	printf(" esipa_bpp_stream = %u\n", cfg.esipa_bpp_stream);
+	printf(" esipa_minimize_bytes = %u\n", cfg.esipa_minimize_bytes);
 	printf(" refresh_flag = %u\n", cfg.refresh_flag);
+	printf(" multi_instance = %u\n", getopt_multi_instance);
+	printf(" multi_instance_workers = %u\n", getopt_multi_instance_workers);
+#ifdef SCARD_TRACE
+	printf(" scard_trace_mode = %u\n", getopt_scard_trace_mode);
+	if (getopt_scard_trace_path)
+		printf(" scard_trace_path = %s\n", getopt_scard_trace_path);
+	printf(" scard_trace_realtime = %u\n", getopt_scard_trace_realtime);
+#endif
 	printf("\n");
 
+#ifdef SCARD_TRACE
+	ipa_scard_trace_cfg(getopt_scard_trace_mode, getopt_scard_trace_path, getopt_scard_trace_realtime);
+#endif
+
 	if (cfg.eim_cabundle) {
 		rc = access(cfg.eim_cabundle, R_OK);
 		if (rc < 0) {
@@ -238,6 +656,30 @@ int main(int argc, char **argv)
 		}
 	}
 
+	if (getopt_multi_instance) {
+		/* The multi instance mode is meant for polling only, provisioning or resetting a specific eUICC has to
+		 * be done in single instance mode. */
+		if (getopt_initial_eim_cfg_file || getopt_euicc_memory_reset) {
+			IPA_LOGP(SMAIN, LERROR, "options -f and -m cannot be used in multi instance mode!\n");
+			rc = -EINVAL;
+			goto leave;
+		}
+		if (cfg.eim_inject) {
+			IPA_LOGP(SMAIN, LERROR, "option -i cannot be used in multi instance mode!\n");
+			rc = -EINVAL;
+			goto leave;
+		}
+#ifdef SCARD_TRACE
+		if (getopt_scard_trace_mode == IPA_SCARD_TRACE_RECORD) {
+			IPA_LOGP(SMAIN, LERROR, "APDU trace recording cannot be used in multi instance mode!\n");
+			rc = -EINVAL;
+			goto leave;
+		}
+#endif
+		sched.one_euicc_pkg_only = getopt_one_euicc_pkg_only;
+		return run_multi_instance(&cfg, getopt_nvstate_path, getopt_multi_instance_workers);
+	}
+
 	/* Create a new IPA context */
 	nvstate_load = load_nvstate_from_file(getopt_nvstate_path);
 	ctx = ipa_new_ctx(&cfg, nvstate_load);
@@ -273,46 +715,53 @@ int main(int argc, char **argv)
 			goto leave;
 		}
 
+		if (cfg.eim_inject) {
+			/* A client that closes the connection early must not kill us while we send the response */
+			signal(SIGPIPE, SIG_IGN);
+			http_srv = ipa_http_srv_init(getopt_inject_addr, getopt_inject_port, getopt_inject_cert,
+						     getopt_inject_cabundle);
+			if (!http_srv) {
+				rc = -EINVAL;
+				goto leave;
+			}
+		}
+
 		while (running) {
 			IPA_LOGP(SMAIN, LINFO, "-----------------------------8<-----------------------------\n");
 			rc = ipa_poll(ctx);
-
-			switch (rc) {
-			case IPA_POLL_AGAIN_WHEN_ONLINE:
-				/* ipa_poll asks us to wait with the next poll cycle until we have a stable IP
-				 * connection. In this example we assume that IP connectivity is always available. */
-				IPA_LOGP(SMAIN, LINFO, "poll cycle continues normally (profile change)\n");
-				rc = 0;
-				break;
-			case IPA_POLL_AGAIN:
-				/* ipa_poll asks us to continue polling normally */
-				rc = 0;
-				if (getopt_one_euicc_pkg_only) {
-					IPA_LOGP(SMAIN, LINFO, "forcefully stopping poll cycle upon user decision!\n");
+			if (http_srv && rc == IPA_POLL_AGAIN_LATER) {
+				/* There are no more eIM packages to retrieve. Instead of polling again later, we wait for
+				 * the eIM to inject the next eIM package and continue polling once it has arrived. */
+				IPA_LOGP(SMAIN, LINFO, "waiting for the eIM to inject an eIM package\n");
+				rc = wait_for_injection(ctx, http_srv, 0);
+				if (rc < 0)
 					goto leave;
-				} else {
-					IPA_LOGP(SMAIN, LINFO, "poll cycle continues normally\n");
-					break;
-				}
-			case IPA_POLL_AGAIN_LATER:
-				/* ipa_poll tells us that we may poll less frequently, so just exit. */
-				IPA_LOGP(SMAIN, LERROR, "poll cycle ends normally\n");
-				rc = 0;
-				goto leave;
-			default:
-				/* We got a negative return code from ipa_poll. This means something does not work
-				 * normally. In a productive setup we would continue calling ipa_poll a few more times
-				 * to see if the cause is a temporary problem. After that we would free the context
-				 * using ipa_free_ctx and start over. */
-				IPA_LOGP(SMAIN, LERROR, "poll cycle ends due to error (%d)\n", rc);
-				rc = -EINVAL;
+				continue;
+			}
+			rc = handle_poll_rc(rc, getopt_one_euicc_pkg_only);
+			if (rc <= 0)
 				goto leave;
+
+			/* Wait until a failed eIM request is due to be retried. (A real application would not block
+			 * here, but continue with its other work and call ipa_poll again later) */
+			delay = ipa_poll_delay(ctx);
+			if (delay) {
+				IPA_LOGP(SMAIN, LINFO, "waiting %u ms before polling again\n", delay);
+				if (http_srv)
+					wait_for_injection(ctx, http_srv, delay);
+				else {
+					/* (usleep() is not required to accept more than one second) */
+					struct timespec ts = { .tv_sec = delay / 1000, .tv_nsec = (delay % 1000) * 1000000L };
+					nanosleep(&ts, NULL);
+				}
 			}
 		}
+		rc = 0;
 	}
 
 leave:
 	IPA_LOGP(SMAIN, LINFO, "-----------------------------8<-----------------------------\n");
+	ipa_http_srv_free(http_srv);
 	nvstate_save = ipa_free_ctx(ctx);
 	if (nvstate_save)
 		save_nvstate_to_file(getopt_nvstate_path, nvstate_save);
@@ -23,6 +23,8 @@ if (rv != SCARD_S_SUCCESS) { \
 	goto error; \
 }
 
+#define PCSC_PROTOCOLS (SCARD_PROTOCOL_T0 | SCARD_PROTOCOL_T1)
+
 struct scard_ctx {
 	bool initialized;
 	unsigned int reader_num;
@@ -31,8 +33,68 @@ struct scard_ctx {
 	SCARDHANDLE hCard;
 	SCARD_IO_REQUEST pioRecvPci;
 	const SCARD_IO_REQUEST *pioSendPci;
+
+	/* SCardTransmit expects the request APDU in one contiguous memory location, vectored requests are gathered
+	 * in this buffer. */
+	uint8_t tx_buf[MAX_BUFFER_SIZE_EXTENDED];
 };
 
+/* Select the protocol control information that matches the protocol that was negotiated with the card */
+static int set_send_pci(struct scard_ctx *ctx)
+{
+	switch (ctx->dwActiveProtocol) {
+	case SCARD_PROTOCOL_T0:
+		ctx->pioSendPci = SCARD_PCI_T0;
+		break;
+	case SCARD_PROTOCOL_T1:
+		ctx->pioSendPci = SCARD_PCI_T1;
+		break;
+	default:
+		IPA_LOGP(SSCARD, LERROR, "PCSC reader #%d negotiated unsupported protocol (0x%lX)\n", ctx->reader_num,
+			 ctx->dwActiveProtocol);
+		return -EINVAL;
+	}
+
+	IPA_LOGP(SSCARD, LINFO, "PCSC reader #%d using protocol T=%d\n", ctx->reader_num,
+		 ctx->dwActiveProtocol == SCARD_PROTOCOL_T1 ? 1 : 0);
+	return 0;
+}
+
+/*! Count the smartcard readers that are currently present in the system.
+ *  \returns number of smartcard readers, -EIO on failure. */
+int ipa_scard_num_readers(void)
+{
+	SCARDCONTEXT hContext;
+	LPSTR mszReaders = NULL;
+	DWORD dwReaders;
+	char *reader_name;
+	int num_readers = 0;
+	long rc;
+
+	rc = SCardEstablishContext(SCARD_SCOPE_SYSTEM, NULL, NULL, &hContext);
+	if (rc != SCARD_S_SUCCESS) {
+		IPA_LOGP(SSCARD, LERROR, "PCSC error: %s (SCardEstablishContext,0x%lX)\n", pcsc_stringify_error(rc), rc);
+		return -EIO;
+	}
+
+	dwReaders = SCARD_AUTOALLOCATE;
+	rc = SCardListReaders(hContext, NULL, (LPSTR) & mszReaders, &dwReaders);
+	if (rc == SCARD_S_SUCCESS) {
+		reader_name = mszReaders;
+		while (*reader_name != '\0') {
+			reader_name += strlen(reader_name) + 1;
+			num_readers++;
+		}
+		SCardFreeMemory(hContext, mszReaders);
+	} else if (rc != SCARD_E_NO_READERS_AVAILABLE) {
+		IPA_LOGP(SSCARD, LERROR, "PCSC error: %s (SCardListReaders,0x%lX)\n", pcsc_stringify_error(rc), rc);
+		num_readers = -EIO;
+	}
+
+	SCardReleaseContext(hContext);
+	return num_readers;
+}
+
 /*! Initialize smartcard reader (and card).
  *  \param[in] reader_num device number of the smartcard reader.
  *  \returns pointer to newly allocated smartcard reader context. */
@@ -69,9 +131,12 @@ void *ipa_scard_init(unsigned int reader_num)
 
 	/* Initialize card */
 	rc = SCardConnect(ctx->hContext, reader_name, SCARD_SHARE_SHARED,
-			  SCARD_PROTOCOL_T0, &ctx->hCard, &ctx->dwActiveProtocol);
+			  PCSC_PROTOCOLS, &ctx->hCard, &ctx->dwActiveProtocol);
 	PCSC_ERROR(reader_num, rc, "SCardConnect");
-	ctx->pioSendPci = SCARD_PCI_T0;
+	if (set_send_pci(ctx) < 0) {
+		SCardDisconnect(ctx->hCard, SCARD_UNPOWER_CARD);
+		goto error;
+	}
 
 	IPA_LOGP(SSCARD, LINFO, "PCSC reader #%d (%s) initialized.\n", reader_num, reader_name);
 	ctx->initialized = true;
@@ -86,26 +151,50 @@ error:
 	return NULL;
 }
 
-/*! Transceive smartcard APDU.
+/*! Transceive smartcard APDU (vectored request).
  *  \param[inout] scard_ctx smartcard reader context.
  *  \param[out] res buffer to store smartcard response.
- *  \param[out] req buffer with smartcard request.
+ *  \param[in] req_iov array of buffers that form the smartcard request when concatenated.
+ *  \param[in] req_iov_count number of buffers in req_iov.
  *  \returns 0 on success, -EIO on failure. */
-int ipa_scard_transceive(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req)
+int ipa_scard_transceive_v(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req_iov,
+			   unsigned int req_iov_count)
 {
 	struct scard_ctx *ctx = scard_ctx;
+	const uint8_t *req_data;
+	size_t req_len = 0;
+	unsigned int i;
 	LONG rc;
 	assert(ctx);
 
 	assert(res);
-	assert(req);
+	assert(req_iov);
+
+	/* Gather the request, in case the request consists of a single buffer, we can pass it on directly */
+	if (req_iov_count == 1) {
+		req_data = req_iov[0].data;
+		req_len = req_iov[0].len;
+	} else {
+		for (i = 0; i < req_iov_count; i++) {
+			if (req_len + req_iov[i].len > sizeof(ctx->tx_buf)) {
+				IPA_LOGP(SSCARD, LERROR, "PCSC reader #%d request exceeds maximum APDU length!\n",
+					 ctx->reader_num);
+				return -EINVAL;
+			}
+			if (req_iov[i].len)
+				memcpy(ctx->tx_buf + req_len, req_iov[i].data, req_iov[i].len);
+			req_len += req_iov[i].len;
+		}
+		req_data = ctx->tx_buf;
+	}
 
 	res->len = res->data_len;
 	IPA_LOGP(SSCARD, LDEBUG, "PCSC reader #%d TX: \n", ctx->reader_num);
-	ipa_buf_hexdump_multiline(req, 64, 1, SSCARD, LINFO);
+	ipa_hexdump_multiline(req_data, req_len, 64, 1, SSCARD, LINFO);
 
-	rc = SCardTransmit(ctx->hCard, ctx->pioSendPci, req->data, req->len, &ctx->pioRecvPci, res->data, (LPDWORD) &res->len);
-	PCSC_ERROR(ctx->reader_num, rc, "SCardEndTransaction");
+	rc = SCardTransmit(ctx->hCard, ctx->pioSendPci, req_data, req_len, &ctx->pioRecvPci, res->data,
+			   (LPDWORD) &res->len);
+	PCSC_ERROR(ctx->reader_num, rc, "SCardTransmit");
 
 	if (res->len) {
 		IPA_LOGP(SSCARD, LDEBUG, "PCSC reader #%d RX: \n", ctx->reader_num);
@@ -120,6 +209,53 @@ error:
 	return -EIO;
 }
 
+/*! Transceive smartcard APDU.
+ *  \param[inout] scard_ctx smartcard reader context.
+ *  \param[out] res buffer to store smartcard response.
+ *  \param[out] req buffer with smartcard request.
+ *  \returns 0 on success, -EIO on failure. */
+int ipa_scard_transceive(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req)
+{
+	assert(req);
+	return ipa_scard_transceive_v(scard_ctx, res, req, 1);
+}
+
+/*! Begin a transaction (get exclusive access to the smartcard until ipa_scard_end_transaction is called).
+ *  \param[inout] scard_ctx smartcard reader context.
+ *  \returns 0 on success, -EIO on failure. */
+int ipa_scard_begin_transaction(void *scard_ctx)
+{
+	struct scard_ctx *ctx = scard_ctx;
+	LONG rc;
+	assert(ctx);
+
+	rc = SCardBeginTransaction(ctx->hCard);
+	PCSC_ERROR(ctx->reader_num, rc, "SCardBeginTransaction");
+	IPA_LOGP(SSCARD, LDEBUG, "PCSC reader #%d transaction started\n", ctx->reader_num);
+	return 0;
+error:
+	IPA_LOGP(SSCARD, LERROR, "PCSC reader #%d cannot start transaction!\n", ctx->reader_num);
+	return -EIO;
+}
+
+/*! End a transaction (release the exclusive access to the smartcard).
+ *  \param[inout] scard_ctx smartcard reader context.
+ *  \returns 0 on success, -EIO on failure. */
+int ipa_scard_end_transaction(void *scard_ctx)
+{
+	struct scard_ctx *ctx = scard_ctx;
+	LONG rc;
+	assert(ctx);
+
+	rc = SCardEndTransaction(ctx->hCard, SCARD_LEAVE_CARD);
+	PCSC_ERROR(ctx->reader_num, rc, "SCardEndTransaction");
+	IPA_LOGP(SSCARD, LDEBUG, "PCSC reader #%d transaction ended\n", ctx->reader_num);
+	return 0;
+error:
+	IPA_LOGP(SSCARD, LERROR, "PCSC reader #%d cannot end transaction!\n", ctx->reader_num);
+	return -EIO;
+}
+
 /*! Reset smartcard.
  *  \param[inout] scard_ctx smartcard reader context.
  *  \returns 0 on success, -EIO on failure. */
@@ -129,9 +265,11 @@ int ipa_scard_reset(void *scard_ctx)
 	LONG rc;
 	assert(ctx);
 
-	rc = SCardReconnect(ctx->hCard, SCARD_SHARE_SHARED, SCARD_PROTOCOL_T0,
+	rc = SCardReconnect(ctx->hCard, SCARD_SHARE_SHARED, PCSC_PROTOCOLS,
 			    SCARD_RESET_CARD, &ctx->dwActiveProtocol);
 	PCSC_ERROR(ctx->reader_num, rc, "SCardReconnect");
+	if (set_send_pci(ctx) < 0)
+		goto error;
 	IPA_LOGP(SSCARD, LINFO, "PCSC reader #%d card reset\n", ctx->reader_num);
 	return 0;
 error:
@@ -165,6 +303,21 @@ error:
 	return -EIO;
 }
 
+/*! Query the transmission protocol that is used to communicate with the smartcard.
+ *  \param[inout] scard_ctx smartcard reader context.
+ *  \returns 0 for T=0, 1 for T=1, -EINVAL on failure. */
+int ipa_scard_protocol(void *scard_ctx)
+{
+	struct scard_ctx *ctx = scard_ctx;
+	assert(ctx);
+
+	if (ctx->pioSendPci == SCARD_PCI_T1)
+		return 1;
+	else if (ctx->pioSendPci == SCARD_PCI_T0)
+		return 0;
+	return -EINVAL;
+}
+
 /*! Free smartcard reader (and card).
  *  \param[inout] scard_ctx smartcard reader context.
  *  \returns 0 on success, -EIO on failure. */
@@ -0,0 +1,36 @@
+#pragma once
+
+/* When the APDU trace backend (scard_trace.c) is used, the PC/SC backend (scard.c) is compiled with its public
+ * functions renamed (see CMakeLists.txt), so that the trace backend can wrap it. */
+
+struct ipa_buf;
+
+#ifdef SCARD_TRACE_REPLAY_ONLY
+/* In a replay only build (SCARD_TRACE_PCSC=OFF), there is no PC/SC backend, all requests that would have to be
+ * passed through to a smartcard reader fail. */
+#include <stddef.h>
+#include <errno.h>
+
+static inline int ipa_scard_pcsc_num_readers(void) { return -EIO; }
+static inline void *ipa_scard_pcsc_init(unsigned int reader_num) { return NULL; }
+static inline int ipa_scard_pcsc_reset(void *scard_ctx) { return -EIO; }
+static inline int ipa_scard_pcsc_atr(void *scard_ctx, struct ipa_buf *atr) { return -EIO; }
+static inline int ipa_scard_pcsc_protocol(void *scard_ctx) { return -EINVAL; }
+static inline int ipa_scard_pcsc_transceive_v(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req_iov,
+					      unsigned int req_iov_count) { return -EIO; }
+static inline int ipa_scard_pcsc_begin_transaction(void *scard_ctx) { return -EIO; }
+static inline int ipa_scard_pcsc_end_transaction(void *scard_ctx) { return -EIO; }
+static inline int ipa_scard_pcsc_free(void *scard_ctx) { return 0; }
+#else
+int ipa_scard_pcsc_num_readers(void);
+void *ipa_scard_pcsc_init(unsigned int reader_num);
+int ipa_scard_pcsc_reset(void *scard_ctx);
+int ipa_scard_pcsc_atr(void *scard_ctx, struct ipa_buf *atr);
+int ipa_scard_pcsc_protocol(void *scard_ctx);
+int ipa_scard_pcsc_transceive(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req);
+int ipa_scard_pcsc_transceive_v(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req_iov,
+				unsigned int req_iov_count);
+int ipa_scard_pcsc_begin_transaction(void *scard_ctx);
+int ipa_scard_pcsc_end_transaction(void *scard_ctx);
+int ipa_scard_pcsc_free(void *scard_ctx);
+#endif
@@ -0,0 +1,537 @@
+/*
+ * Author: Philipp Maier <pmaier@sysmocom.de> / sysmocom - s.f.m.c. GmbH
+ *
+ * APDU trace smartcard backend: This backend implements the scard.h interface on top of the PC/SC backend
+ * (scard.c). In record mode, all APDUs are passed through to the PC/SC backend and recorded (with timestamps) to a
+ * trace file. In replay mode, the responses are served from a previously recorded trace file, no smartcard reader is
+ * needed. This allows to benchmark and to regression-test libipa without a physical eUICC.
+ *
+ * Trace file format (one record per line, timestamps in microseconds, relative to ipa_scard_init):
+ * <timestamp> ATR <hex>
+ * <timestamp> PROT <0|1>
+ * <timestamp> RESET
+ * <timestamp> TX <hex>
+ * <timestamp> RX <hex>
+ * <timestamp> ERR
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <errno.h>
+#include <assert.h>
+#include <string.h>
+#include <time.h>
+#include <onomondo/ipa/utils.h>
+#include <onomondo/ipa/scard.h>
+#include <onomondo/ipa/scard_trace.h>
+#include <onomondo/ipa/log.h>
+#include <onomondo/ipa/mem.h>
+#include "scard_pcsc.h"
+
+enum trace_rec_type {
+	TRACE_REC_ATR,
+	TRACE_REC_PROT,
+	TRACE_REC_RESET,
+	TRACE_REC_TX,
+	TRACE_REC_RX,
+	TRACE_REC_ERR,
+	_NUM_TRACE_REC
+};
+
+static const char *trace_rec_type_str[_NUM_TRACE_REC] = {
+	[TRACE_REC_ATR] = "ATR",
+	[TRACE_REC_PROT] = "PROT",
+	[TRACE_REC_RESET] = "RESET",
+	[TRACE_REC_TX] = "TX",
+	[TRACE_REC_RX] = "RX",
+	[TRACE_REC_ERR] = "ERR",
+};
+
+/* One record of a trace file (replay mode). The trace is loaded into memory completely before the replay starts, so
+ * that parsing the trace file does not distort the measurement. The memory for the records is deliberately
+ * allocated with plain malloc, so that it does not show up in the heap statistics of libipa (MEM_EMIT_DEBUG). */
+struct trace_rec {
+	enum trace_rec_type type;
+	uint64_t ts;
+	uint8_t *data;
+	size_t len;
+};
+
+struct scard_trace_ctx {
+	enum ipa_scard_trace_mode mode;
+	unsigned int reader_num;
+	struct timespec start;
+
+	/* record mode (and pass-through mode) */
+	void *pcsc_ctx;
+	FILE *file;
+
+	/* replay mode */
+	struct trace_rec *recs;
+	size_t recs_count;
+	size_t recs_pos;
+
+	/* ATR and protocol of the card (recorded or replayed) */
+	uint8_t atr[33];
+	size_t atr_len;
+	int protocol;
+};
+
+static struct {
+	enum ipa_scard_trace_mode mode;
+	const char *path;
+	bool realtime;
+} trace_cfg;
+
+/*! Configure the APDU trace smartcard backend (must be called before ipa_scard_init).
+ *  \param[in] mode operating mode (off, record or replay).
+ *  \param[in] path path to the trace file.
+ *  \param[in] realtime replay mode: delay the responses with the timing of the recording (zero latency otherwise). */
+void ipa_scard_trace_cfg(enum ipa_scard_trace_mode mode, const char *path, bool realtime)
+{
+	trace_cfg.mode = mode;
+	trace_cfg.path = path;
+	trace_cfg.realtime = realtime;
+}
+
+static uint64_t timestamp(struct scard_trace_ctx *ctx)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t) (now.tv_sec - ctx->start.tv_sec) * 1000000 + (now.tv_nsec - ctx->start.tv_nsec) / 1000;
+}
+
+static void write_rec(struct scard_trace_ctx *ctx, enum trace_rec_type type, const struct ipa_buf *iov,
+		      unsigned int iov_count)
+{
+	unsigned int i;
+	size_t k;
+
+	if (ctx->mode != IPA_SCARD_TRACE_RECORD)
+		return;
+
+	fprintf(ctx->file, "%llu %s", (unsigned long long)timestamp(ctx), trace_rec_type_str[type]);
+	if (iov_count)
+		fputc(' ', ctx->file);
+	for (i = 0; i < iov_count; i++) {
+		for (k = 0; k < iov[i].len; k++)
+			fprintf(ctx->file, "%02x", iov[i].data[k]);
+	}
+	fputc('\n', ctx->file);
+	fflush(ctx->file);
+}
+
+static int hex_nibble(char c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F')
+		return c - 'A' + 10;
+	return -1;
+}
+
+static int parse_rec(struct trace_rec *rec, const char *line)
+{
+	unsigned long long ts;
+	char type_str[8];
+	int offset;
+	unsigned int i;
+	size_t hex_len;
+	int hi, lo;
+
+	memset(rec, 0, sizeof(*rec));
+
+	if (sscanf(line, "%llu %7s%n", &ts, type_str, &offset) != 2)
+		return -EINVAL;
+	rec->ts = ts;
+
+	for (i = 0; i < _NUM_TRACE_REC; i++) {
+		if (strcmp(type_str, trace_rec_type_str[i]) == 0)
+			break;
+	}
+	if (i >= _NUM_TRACE_REC)
+		return -EINVAL;
+	rec->type = i;
+
+	line += offset;
+	while (*line == ' ')
+		line++;
+	hex_len = strcspn(line, "\r\n");
+	if (hex_len % 2)
+		return -EINVAL;
+
+	if (!hex_len)
+		return 0;
+	rec->data = malloc(hex_len / 2);
+	assert(rec->data);
+	for (rec->len = 0; rec->len < hex_len / 2; rec->len++) {
+		hi = hex_nibble(line[rec->len * 2]);
+		lo = hex_nibble(line[rec->len * 2 + 1]);
+		if (hi < 0 || lo < 0)
+			return -EINVAL;
+		rec->data[rec->len] = (hi << 4) | lo;
+	}
+
+	return 0;
+}
+
+static void free_recs(struct scard_trace_ctx *ctx)
+{
+	size_t i;
+
+	for (i = 0; i < ctx->recs_count; i++)
+		free(ctx->recs[i].data);
+	free(ctx->recs);
+	ctx->recs = NULL;
+	ctx->recs_count = 0;
+}
+
+static int load_trace(struct scard_trace_ctx *ctx, FILE *file)
+{
+	char *line = NULL;
+	size_t line_size = 0;
+	size_t recs_size = 0;
+	unsigned int line_nr = 0;
+	int rc = 0;
+
+	while (getline(&line, &line_size, file) > 0) {
+		line_nr++;
+		if (line[0] == '#' || line[0] == '\n')
+			continue;
+
+		if (ctx->recs_count >= recs_size) {
+			recs_size = recs_size ? recs_size * 2 : 256;
+			ctx->recs = realloc(ctx->recs, recs_size * sizeof(*ctx->recs));
+			assert(ctx->recs);
+		}
+
+		rc = parse_rec(&ctx->recs[ctx->recs_count], line);
+		ctx->recs_count++;
+		if (rc < 0) {
+			IPA_LOGP(SSCARD, LERROR, "APDU trace: invalid record in line %u\n", line_nr);
+			break;
+		}
+	}
+
+	free(line);
+	return rc;
+}
+
+/* Get the next record from the trace (replay mode), the record must match the expected type */
+static const struct trace_rec *next_rec(struct scard_trace_ctx *ctx, enum trace_rec_type type)
+{
+	const struct trace_rec *rec;
+
+	if (ctx->recs_pos >= ctx->recs_count) {
+		IPA_LOGP(SSCARD, LERROR, "APDU trace: end of trace reached, expected %s record!\n",
+			 trace_rec_type_str[type]);
+		return NULL;
+	}
+
+	rec = &ctx->recs[ctx->recs_pos];
+	if (rec->type != type) {
+		IPA_LOGP(SSCARD, LERROR, "APDU trace: unexpected %s record (#%zu), expected %s record!\n",
+			 trace_rec_type_str[rec->type], ctx->recs_pos, trace_rec_type_str[type]);
+		return NULL;
+	}
+
+	ctx->recs_pos++;
+	return rec;
+}
+
+/* Read ATR and protocol from the trace (replay mode) or from the card (record mode) */
+static int init_card_params(struct scard_trace_ctx *ctx)
+{
+	const struct trace_rec *rec;
+	IPA_BUF_STATIC(atr, sizeof(ctx->atr));
+	struct ipa_buf prot_buf;
+	uint8_t prot;
+	int rc;
+
+	if (ctx->mode == IPA_SCARD_TRACE_REPLAY) {
+		rec = next_rec(ctx, TRACE_REC_ATR);
+		if (!rec || rec->len > sizeof(ctx->atr))
+			return -EINVAL;
+		memcpy(ctx->atr, rec->data, rec->len);
+		ctx->atr_len = rec->len;
+
+		rec = next_rec(ctx, TRACE_REC_PROT);
+		if (!rec || rec->len != 1)
+			return -EINVAL;
+		ctx->protocol = rec->data[0];
+		return 0;
+	}
+
+	rc = ipa_scard_pcsc_atr(ctx->pcsc_ctx, &atr);
+	if (rc < 0)
+		return rc;
+	memcpy(ctx->atr, atr.data, atr.len);
+	ctx->atr_len = atr.len;
+	write_rec(ctx, TRACE_REC_ATR, &atr, 1);
+
+	ctx->protocol = ipa_scard_pcsc_protocol(ctx->pcsc_ctx);
+	prot = ctx->protocol;
+	prot_buf = (struct ipa_buf) { &prot, 1, 1 };
+	write_rec(ctx, TRACE_REC_PROT, &prot_buf, 1);
+
+	return 0;
+}
+
+/*! Count the smartcard readers that are currently present in the system.
+ *  \returns number of smartcard readers (always 1 in replay mode), -EIO on failure. */
+int ipa_scard_num_readers(void)
+{
+	if (trace_cfg.mode == IPA_SCARD_TRACE_REPLAY)
+		return 1;
+	return ipa_scard_pcsc_num_readers();
+}
+
+/*! Initialize smartcard reader (and card).
+ *  \param[in] reader_num device number of the smartcard reader.
+ *  \returns pointer to newly allocated smartcard reader context. */
+void *ipa_scard_init(unsigned int reader_num)
+{
+	struct scard_trace_ctx *ctx;
+	FILE *file;
+	int rc;
+
+	ctx = IPA_ALLOC_ZERO(struct scard_trace_ctx);
+	assert(ctx);
+	ctx->mode = trace_cfg.mode;
+	ctx->reader_num = reader_num;
+	clock_gettime(CLOCK_MONOTONIC, &ctx->start);
+
+#ifdef SCARD_TRACE_REPLAY_ONLY
+	if (ctx->mode != IPA_SCARD_TRACE_REPLAY) {
+		IPA_LOGP(SSCARD, LERROR, "APDU trace: built without PC/SC support, only replay mode is available!\n");
+		goto error;
+	}
+#endif
+
+	switch (ctx->mode) {
+	case IPA_SCARD_TRACE_REPLAY:
+		file = fopen(trace_cfg.path, "r");
+		if (!file) {
+			IPA_LOGP(SSCARD, LERROR, "APDU trace: cannot open trace file %s!\n", trace_cfg.path);
+			goto error;
+		}
+		rc = load_trace(ctx, file);
+		fclose(file);
+		if (rc < 0)
+			goto error;
+		IPA_LOGP(SSCARD, LINFO, "APDU trace: replaying %zu records from %s (%s)\n", ctx->recs_count,
+			 trace_cfg.path, trace_cfg.realtime ? "real-time" : "zero latency");
+		break;
+	case IPA_SCARD_TRACE_RECORD:
+		ctx->file = fopen(trace_cfg.path, "w");
+		if (!ctx->file) {
+			IPA_LOGP(SSCARD, LERROR, "APDU trace: cannot create trace file %s!\n", trace_cfg.path);
+			goto error;
+		}
+		fprintf(ctx->file, "# onomondo-ipa APDU trace, reader #%u\n", reader_num);
+		IPA_LOGP(SSCARD, LINFO, "APDU trace: recording to %s\n", trace_cfg.path);
+		/* fall through */
+	case IPA_SCARD_TRACE_OFF:
+		ctx->pcsc_ctx = ipa_scard_pcsc_init(reader_num);
+		if (!ctx->pcsc_ctx)
+			goto error;
+		break;
+	}
+
+	rc = init_card_params(ctx);
+	if (rc < 0)
+		goto error;
+
+	return ctx;
+error:
+	ipa_scard_free(ctx);
+	return NULL;
+}
+
+/*! Transceive smartcard APDU (vectored request).
+ *  \param[inout] scard_ctx smartcard reader context.
+ *  \param[out] res buffer to store smartcard response.
+ *  \param[in] req_iov array of buffers that form the smartcard request when concatenated.
+ *  \param[in] req_iov_count number of buffers in req_iov.
+ *  \returns 0 on success, -EIO on failure. */
+int ipa_scard_transceive_v(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req_iov,
+			   unsigned int req_iov_count)
+{
+	struct scard_trace_ctx *ctx = scard_ctx;
+	const struct trace_rec *rec_tx;
+	const struct trace_rec *rec_rx;
+	struct timespec delay;
+	size_t offset = 0;
+	unsigned int i;
+	int rc;
+	assert(ctx);
+
+	if (ctx->mode != IPA_SCARD_TRACE_REPLAY) {
+		write_rec(ctx, TRACE_REC_TX, req_iov, req_iov_count);
+		rc = ipa_scard_pcsc_transceive_v(ctx->pcsc_ctx, res, req_iov, req_iov_count);
+		if (rc < 0)
+			write_rec(ctx, TRACE_REC_ERR, NULL, 0);
+		else
+			write_rec(ctx, TRACE_REC_RX, res, 1);
+		return rc;
+	}
+
+	/* Make sure that the request matches the recorded request */
+	rec_tx = next_rec(ctx, TRACE_REC_TX);
+	if (!rec_tx)
+		return -EIO;
+	for (i = 0; i < req_iov_count; i++) {
+		if (offset + req_iov[i].len > rec_tx->len
+		    || memcmp(rec_tx->data + offset, req_iov[i].data, req_iov[i].len) != 0)
+			break;
+		offset += req_iov[i].len;
+	}
+	if (i < req_iov_count || offset != rec_tx->len) {
+		IPA_LOGP(SSCARD, LERROR, "APDU trace: request does not match recorded request (#%zu)!\n",
+			 ctx->recs_pos - 1);
+		return -EIO;
+	}
+
+	/* Serve the recorded response */
+	if (ctx->recs_pos < ctx->recs_count && ctx->recs[ctx->recs_pos].type == TRACE_REC_ERR) {
+		next_rec(ctx, TRACE_REC_ERR);
+		return -EIO;
+	}
+	rec_rx = next_rec(ctx, TRACE_REC_RX);
+	if (!rec_rx)
+		return -EIO;
+	if (rec_rx->len > res->data_len) {
+		IPA_LOGP(SSCARD, LERROR, "APDU trace: recorded response exceeds response buffer!\n");
+		return -EIO;
+	}
+
+	if (trace_cfg.realtime && rec_rx->ts > rec_tx->ts) {
+		delay.tv_sec = (rec_rx->ts - rec_tx->ts) / 1000000;
+		delay.tv_nsec = ((rec_rx->ts - rec_tx->ts) % 1000000) * 1000;
+		nanosleep(&delay, NULL);
+	}
+
+	memcpy(res->data, rec_rx->data, rec_rx->len);
+	res->len = rec_rx->len;
+	return 0;
+}
+
+/*! Transceive smartcard APDU.
+ *  \param[inout] scard_ctx smartcard reader context.
+ *  \param[out] res buffer to store smartcard response.
+ *  \param[out] req buffer with smartcard request.
+ *  \returns 0 on success, -EIO on failure. */
+int ipa_scard_transceive(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req)
+{
+	assert(req);
+	return ipa_scard_transceive_v(scard_ctx, res, req, 1);
+}
+
+/*! Begin a transaction (get exclusive access to the smartcard until ipa_scard_end_transaction is called).
+ *  \param[inout] scard_ctx smartcard reader context.
+ *  \returns 0 on success, -EIO on failure. */
+int ipa_scard_begin_transaction(void *scard_ctx)
+{
+	struct scard_trace_ctx *ctx = scard_ctx;
+	assert(ctx);
+
+	if (ctx->mode == IPA_SCARD_TRACE_REPLAY)
+		return 0;
+	return ipa_scard_pcsc_begin_transaction(ctx->pcsc_ctx);
+}
+
+/*! End a transaction (release the exclusive access to the smartcard).
+ *  \param[inout] scard_ctx smartcard reader context.
+ *  \returns 0 on success, -EIO on failure. */
+int ipa_scard_end_transaction(void *scard_ctx)
+{
+	struct scard_trace_ctx *ctx = scard_ctx;
+	assert(ctx);
+
+	if (ctx->mode == IPA_SCARD_TRACE_REPLAY)
+		return 0;
+	return ipa_scard_pcsc_end_transaction(ctx->pcsc_ctx);
+}
+
+/*! Reset smartcard.
+ *  \param[inout] scard_ctx smartcard reader context.
+ *  \returns 0 on success, -EIO on failure. */
+int ipa_scard_reset(void *scard_ctx)
+{
+	struct scard_trace_ctx *ctx = scard_ctx;
+	int rc;
+	assert(ctx);
+
+	if (ctx->mode == IPA_SCARD_TRACE_REPLAY) {
+		if (!next_rec(ctx, TRACE_REC_RESET))
+			return -EIO;
+	} else {
+		rc = ipa_scard_pcsc_reset(ctx->pcsc_ctx);
+		if (rc < 0)
+			return rc;
+		write_rec(ctx, TRACE_REC_RESET, NULL, 0);
+	}
+
+	/* The ATR and the protocol may change after a reset */
+	if (init_card_params(ctx) < 0)
+		return -EIO;
+	return 0;
+}
+
+/*! Read smartcard ATR.
+ *  \param[inout] scard_ctx smartcard reader context.
+ *  \param[out] res buffer to store the ATR.
+ *  \returns 0 on success, -EIO on failure. */
+int ipa_scard_atr(void *scard_ctx, struct ipa_buf *atr)
+{
+	struct scard_trace_ctx *ctx = scard_ctx;
+	assert(ctx);
+
+	if (ctx->atr_len > atr->data_len)
+		return -EIO;
+	memcpy(atr->data, ctx->atr, ctx->atr_len);
+	atr->len = ctx->atr_len;
+	return 0;
+}
+
+/*! Query the transmission protocol that is used to communicate with the smartcard.
+ *  \param[inout] scard_ctx smartcard reader context.
+ *  \returns 0 for T=0, 1 for T=1, -EINVAL on failure. */
+int ipa_scard_protocol(void *scard_ctx)
+{
+	struct scard_trace_ctx *ctx = scard_ctx;
+	assert(ctx);
+
+	return ctx->protocol;
+}
+
+/*! Free smartcard reader (and card).
+ *  \param[inout] scard_ctx smartcard reader context.
+ *  \returns 0 on success, -EIO on failure. */
+int ipa_scard_free(void *scard_ctx)
+{
+	struct scard_trace_ctx *ctx = scard_ctx;
+	int rc = 0;
+
+	if (!scard_ctx)
+		return 0;
+
+	if (ctx->mode == IPA_SCARD_TRACE_REPLAY && ctx->recs_pos < ctx->recs_count)
+		IPA_LOGP(SSCARD, LINFO, "APDU trace: %zu records were not replayed\n",
+			 ctx->recs_count - ctx->recs_pos);
+
+	if (ctx->pcsc_ctx)
+		rc = ipa_scard_pcsc_free(ctx->pcsc_ctx);
+	if (ctx->file)
+		fclose(ctx->file);
+	free_recs(ctx);
+
+	IPA_FREE(ctx);
+	return rc;
+}
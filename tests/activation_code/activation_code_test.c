@@ -4,6 +4,7 @@
  */
 
 #include <stdio.h>
+#include <onomondo/ipa/http.h>
 #include "src/ipa/libipa/activation_code.h"
 
 void parse_ac(char *ac)
@@ -54,11 +55,37 @@ struct ipa_buf *ipa_http_req(void *http_ctx, const struct ipa_buf *req, const ch
 	return NULL;
 }
 
+struct ipa_buf *ipa_http_req_timeout(void *http_ctx, const struct ipa_buf *req, const char *url, unsigned int timeout)
+{
+	return ipa_http_req(http_ctx, req, url);
+}
+
+int ipa_http_req_stream(void *http_ctx, const struct ipa_buf *req, const char *url, ipa_http_res_cb res_cb,
+			void *priv)
+{
+	return -1;
+}
+
+void ipa_http_recycle(void *http_ctx, struct ipa_buf *buf)
+{
+	return;
+}
+
 void ipa_http_close(void *http_ctx)
 {
 	return;
 }
 
+struct ipa_buf *ipa_http_export_session(void *http_ctx)
+{
+	return NULL;
+}
+
+int ipa_http_import_session(void *http_ctx, const struct ipa_buf *session)
+{
+	return 0;
+}
+
 void ipa_http_free(void *http_ctx)
 {
 	return;
@@ -79,11 +106,32 @@ int ipa_scard_atr(void *scard_ctx, struct ipa_buf *atr)
 	return 0;
 }
 
+int ipa_scard_protocol(void *scard_ctx)
+{
+	return 0;
+}
+
 int ipa_scard_transceive(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req)
 {
 	return 0;
 }
 
+int ipa_scard_transceive_v(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req_iov,
+			   unsigned int req_iov_count)
+{
+	return 0;
+}
+
+int ipa_scard_begin_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_end_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
 int ipa_scard_free(void *scard_ctx)
 {
 	return 0;
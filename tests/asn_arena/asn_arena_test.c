@@ -0,0 +1,336 @@
+/*
+ * Author: Philipp Maier <pmaier@sysmocom.de> / sysmocom - s.f.m.c. GmbH
+ *
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#include <pthread.h>
+#include <onomondo/ipa/utils.h>
+#include <onomondo/ipa/http.h>
+#include <asn_application.h>
+#include <asn_arena.h>
+#include <EsipaMessageFromEimToIpa.h>
+#include "src/ipa/libipa/utils.h"
+#include "src/ipa/libipa/context.h"
+#include "src/ipa/libipa/esipa.h"
+
+static struct ipa_buf *enc_bpp_msg(const char *test_vector_path)
+{
+	uint8_t bpp[20480];
+	FILE *bpp_file = NULL;
+	size_t bpp_len;
+	asn_dec_rval_t rc;
+	asn_enc_rval_t enc_rc;
+	struct BoundProfilePackage *bpp_dec = NULL;
+	struct EsipaMessageFromEimToIpa msg_to_ipa = { 0 };
+	struct ipa_buf *msg_encoded = NULL;
+
+	/* Load test BPP test vector from file and wrap it into an ESipa message (without using an arena) */
+	bpp_file = fopen(test_vector_path, "r");
+	assert(bpp_file);
+	bpp_len = fread(&bpp, sizeof(char), sizeof(bpp), bpp_file);
+	fclose(bpp_file);
+	rc = ber_decode(0, &asn_DEF_BoundProfilePackage, (void **)&bpp_dec, bpp, bpp_len);
+	assert(rc.code == RC_OK);
+
+	msg_to_ipa.present = EsipaMessageFromEimToIpa_PR_getBoundProfilePackageResponseEsipa;
+	msg_to_ipa.choice.getBoundProfilePackageResponseEsipa.present =
+	    GetBoundProfilePackageResponseEsipa_PR_getBoundProfilePackageOkEsipa;
+	msg_to_ipa.choice.getBoundProfilePackageResponseEsipa.choice.getBoundProfilePackageOkEsipa.boundProfilePackage =
+	    *bpp_dec;
+	enc_rc = der_encode(&asn_DEF_EsipaMessageFromEimToIpa, &msg_to_ipa, ipa_asn1c_consume_bytes_cb, &msg_encoded);
+	assert(enc_rc.encoded > 0);
+
+	ASN_STRUCT_FREE(asn_DEF_BoundProfilePackage, bpp_dec);
+	return msg_encoded;
+}
+
+void arena_decode_test(const struct ipa_buf *msg_encoded)
+{
+	struct EsipaMessageFromEimToIpa *msg_to_ipa;
+	struct BoundProfilePackage *bpp;
+	struct ipa_buf *msg_reencoded = NULL;
+	asn_enc_rval_t enc_rc;
+
+	printf("decode ESipa message with BoundProfilePackage (%zu bytes)\n", msg_encoded->len);
+	msg_to_ipa = ipa_esipa_msg_to_ipa_dec(msg_encoded, "test",
+					      EsipaMessageFromEimToIpa_PR_getBoundProfilePackageResponseEsipa);
+	assert(msg_to_ipa);
+	bpp = &msg_to_ipa->choice.getBoundProfilePackageResponseEsipa.choice.getBoundProfilePackageOkEsipa.
+	    boundProfilePackage;
+	printf(" '88' TLVs: %d, '86' TLVs: %d\n", bpp->sequenceOf88.list.count, bpp->sequenceOf86.list.count);
+
+	/* The message decoded into the arena must encode to the same bytes */
+	enc_rc = der_encode(&asn_DEF_EsipaMessageFromEimToIpa, msg_to_ipa, ipa_asn1c_consume_bytes_cb, &msg_reencoded);
+	assert(enc_rc.encoded > 0);
+	printf(" re-encoded: %zu bytes, equal: %u\n", msg_reencoded->len, msg_reencoded->len == msg_encoded->len
+	       && memcmp(msg_reencoded->data, msg_encoded->data, msg_encoded->len) == 0);
+	IPA_FREE(msg_reencoded);
+
+	/* Parts of the decoded message may be freed and elements may be added to decoded lists, the memory stays in
+	 * the arena */
+	ASN_STRUCT_FREE(asn_DEF_BoundProfilePackage_86tlv, bpp->sequenceOf86.list.array[0]);
+	asn_sequence_del(&bpp->sequenceOf86.list, 0, 0);
+	ASN_SEQUENCE_ADD(&bpp->sequenceOf86.list, bpp->sequenceOf86.list.array[0]);	/* (same element again) */
+	printf(" '86' TLVs after modification: %d\n", bpp->sequenceOf86.list.count);
+
+	/* Release the arena as a whole */
+	ASN_STRUCT_FREE(asn_DEF_EsipaMessageFromEimToIpa, msg_to_ipa);
+	printf(" released\n");
+}
+
+void arena_ref_test(const struct ipa_buf *msg_encoded)
+{
+	struct EsipaMessageFromEimToIpa *msg_to_ipa;
+	struct BoundProfilePackage *bpp;
+	struct ipa_buf *msg_reencoded = NULL;
+	asn_enc_rval_t enc_rc;
+	unsigned int referenced = 0;
+	int i;
+
+	printf("decode ESipa message with BoundProfilePackage, referencing the encoded message\n");
+	msg_to_ipa = ipa_esipa_msg_to_ipa_dec_ref(msg_encoded, "test",
+						  EsipaMessageFromEimToIpa_PR_getBoundProfilePackageResponseEsipa);
+	assert(msg_to_ipa);
+	bpp = &msg_to_ipa->choice.getBoundProfilePackageResponseEsipa.choice.getBoundProfilePackageOkEsipa.
+	    boundProfilePackage;
+
+	/* The '86' TLVs are not copied */
+	for (i = 0; i < bpp->sequenceOf86.list.count; i++) {
+		if (bpp->sequenceOf86.list.array[i]->buf >= msg_encoded->data &&
+		    bpp->sequenceOf86.list.array[i]->buf < msg_encoded->data + msg_encoded->len)
+			referenced++;
+	}
+	printf(" '86' TLVs: %d, referenced: %u\n", bpp->sequenceOf86.list.count, referenced);
+
+	enc_rc = der_encode(&asn_DEF_EsipaMessageFromEimToIpa, msg_to_ipa, ipa_asn1c_consume_bytes_cb, &msg_reencoded);
+	assert(enc_rc.encoded > 0);
+	printf(" re-encoded: %zu bytes, equal: %u\n", msg_reencoded->len, msg_reencoded->len == msg_encoded->len
+	       && memcmp(msg_reencoded->data, msg_encoded->data, msg_encoded->len) == 0);
+	IPA_FREE(msg_reencoded);
+
+	/* Referenced strings may be replaced and freed like any other part of the decoded message */
+	OCTET_STRING_fromBuf(bpp->sequenceOf86.list.array[0], "\x01\x02\x03", 3);
+	ASN_STRUCT_FREE(asn_DEF_BoundProfilePackage_86tlv, bpp->sequenceOf86.list.array[1]);
+	asn_sequence_del(&bpp->sequenceOf86.list, 1, 0);
+	printf(" '86' TLVs after modification: %d, first: %zu bytes\n", bpp->sequenceOf86.list.count,
+	       bpp->sequenceOf86.list.array[0]->size);
+
+	/* The replacement was allocated from the heap (no arena is active anymore), releasing the arena does not
+	 * free it */
+	OCTET_STRING_fromBuf(bpp->sequenceOf86.list.array[0], NULL, 0);
+
+	ASN_STRUCT_FREE(asn_DEF_EsipaMessageFromEimToIpa, msg_to_ipa);
+	printf(" released\n");
+}
+
+void arena_mixed_test(const struct ipa_buf *msg_encoded)
+{
+	struct EsipaMessageFromEimToIpa *msg_to_ipa;
+	struct EsipaMessageFromEimToIpa *msg_to_ipa_heap = NULL;
+	struct asn_arena *arena;
+	asn_dec_rval_t rc;
+
+	printf("decode the same message into an arena and into the heap\n");
+	msg_to_ipa = ipa_esipa_msg_to_ipa_dec(msg_encoded, "test",
+					      EsipaMessageFromEimToIpa_PR_getBoundProfilePackageResponseEsipa);
+	assert(msg_to_ipa);
+
+	/* Only one arena can be active at a time */
+	arena = asn_arena_begin();
+	assert(arena);
+	assert(asn_arena_begin() == NULL);
+	asn_arena_end(arena);
+
+	/* Memory that was not taken from an arena is freed normally while an arena is in use */
+	rc = ber_decode(0, &asn_DEF_EsipaMessageFromEimToIpa, (void **)&msg_to_ipa_heap, msg_encoded->data,
+			msg_encoded->len);
+	assert(rc.code == RC_OK);
+	ASN_STRUCT_FREE(asn_DEF_EsipaMessageFromEimToIpa, msg_to_ipa_heap);
+	printf(" heap decoded message freed\n");
+
+	ASN_STRUCT_FREE(asn_DEF_EsipaMessageFromEimToIpa, msg_to_ipa);
+	printf(" arena decoded message released\n");
+}
+
+void arena_error_test(const struct ipa_buf *msg_encoded)
+{
+	struct ipa_buf *msg_truncated = ipa_buf_alloc_data(msg_encoded->len / 2,
+								   (uint8_t *) msg_encoded->data);
+
+	/* A message that cannot be decoded must not leave an arena behind */
+	printf("decode truncated message\n");
+	assert(ipa_esipa_msg_to_ipa_dec(msg_truncated, "test",
+					EsipaMessageFromEimToIpa_PR_getBoundProfilePackageResponseEsipa) == NULL);
+	printf(" rejected\n");
+	IPA_FREE(msg_truncated);
+}
+
+static pthread_barrier_t thread_barrier;
+static const struct ipa_buf *thread_msg_encoded;
+static struct EsipaMessageFromEimToIpa *thread_decoded[2];
+
+static void *arena_thread(void *arg)
+{
+	unsigned int idx = (unsigned int)(intptr_t) arg;
+	struct EsipaMessageFromEimToIpa *msg_to_ipa = NULL;
+	struct BoundProfilePackage *bpp;
+	struct asn_arena *arena;
+	asn_dec_rval_t rc;
+	int count;
+
+	/* Decode without logging, so that the output of both threads does not interleave */
+	arena = asn_arena_begin();
+	assert(arena);
+	pthread_barrier_wait(&thread_barrier);
+	rc = ber_decode(0, &asn_DEF_EsipaMessageFromEimToIpa, (void **)&msg_to_ipa, thread_msg_encoded->data,
+			thread_msg_encoded->len);
+	asn_arena_end(arena);
+	assert(rc.code == RC_OK);
+	thread_decoded[idx] = msg_to_ipa;
+
+	/* Both threads hold a decoded message at the same time, each thread modifies and releases the message that
+	 * the other thread has decoded */
+	pthread_barrier_wait(&thread_barrier);
+	msg_to_ipa = thread_decoded[1 - idx];
+	bpp = &msg_to_ipa->choice.getBoundProfilePackageResponseEsipa.choice.getBoundProfilePackageOkEsipa.
+	    boundProfilePackage;
+	ASN_STRUCT_FREE(asn_DEF_BoundProfilePackage_86tlv, bpp->sequenceOf86.list.array[0]);
+	asn_sequence_del(&bpp->sequenceOf86.list, 0, 0);
+	count = bpp->sequenceOf86.list.count;
+	pthread_barrier_wait(&thread_barrier);
+
+	ASN_STRUCT_FREE(asn_DEF_EsipaMessageFromEimToIpa, msg_to_ipa);
+	return (void *)(intptr_t) count;
+}
+
+void arena_thread_test(const struct ipa_buf *msg_encoded)
+{
+	pthread_t threads[2];
+	void *count;
+	unsigned int i;
+
+	/* Each thread decodes into arenas of its own, the decoded messages are released by the other thread */
+	printf("decode in two threads concurrently, release in the other thread\n");
+	thread_msg_encoded = msg_encoded;
+	pthread_barrier_init(&thread_barrier, NULL, IPA_ARRAY_SIZE(threads));
+	for (i = 0; i < IPA_ARRAY_SIZE(threads); i++)
+		assert(pthread_create(&threads[i], NULL, arena_thread, (void *)(intptr_t) i) == 0);
+	for (i = 0; i < IPA_ARRAY_SIZE(threads); i++) {
+		assert(pthread_join(threads[i], &count) == 0);
+		printf(" thread %u: '86' TLVs after modification: %d, released message of thread %u\n", i,
+		       (int)(intptr_t) count, 1 - i);
+	}
+	pthread_barrier_destroy(&thread_barrier);
+}
+
+int main(int argc, char **argv)
+{
+	struct ipa_buf *msg_encoded;
+
+	assert(argc > 1);
+	msg_encoded = enc_bpp_msg(argv[1]);
+	arena_decode_test(msg_encoded);
+	arena_ref_test(msg_encoded);
+	arena_mixed_test(msg_encoded);
+	arena_error_test(msg_encoded);
+	arena_thread_test(msg_encoded);
+	IPA_FREE(msg_encoded);
+	return 0;
+}
+
+/* Stubs */
+void *ipa_http_init(const char *cabundle, bool no_verif)
+{
+	return NULL;
+}
+
+struct ipa_buf *ipa_http_req(void *http_ctx, const struct ipa_buf *req, const char *url)
+{
+	return NULL;
+}
+
+struct ipa_buf *ipa_http_req_timeout(void *http_ctx, const struct ipa_buf *req, const char *url, unsigned int timeout)
+{
+	return ipa_http_req(http_ctx, req, url);
+}
+
+int ipa_http_req_stream(void *http_ctx, const struct ipa_buf *req, const char *url, ipa_http_res_cb res_cb,
+			void *priv)
+{
+	return -1;
+}
+
+void ipa_http_recycle(void *http_ctx, struct ipa_buf *buf)
+{
+	return;
+}
+
+void ipa_http_close(void *http_ctx)
+{
+	return;
+}
+
+struct ipa_buf *ipa_http_export_session(void *http_ctx)
+{
+	return NULL;
+}
+
+int ipa_http_import_session(void *http_ctx, const struct ipa_buf *session)
+{
+	return 0;
+}
+
+void ipa_http_free(void *http_ctx)
+{
+	return;
+}
+
+void *ipa_scard_init(unsigned int reader_num)
+{
+	return NULL;
+}
+
+int ipa_scard_reset(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_atr(void *scard_ctx, struct ipa_buf *atr)
+{
+	return 0;
+}
+
+int ipa_scard_protocol(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_transceive(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req)
+{
+	return 0;
+}
+
+int ipa_scard_transceive_v(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req_iov,
+			   unsigned int req_iov_count)
+{
+	return 0;
+}
+
+int ipa_scard_begin_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_end_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_free(void *scard_ctx)
+{
+	return 0;
+}
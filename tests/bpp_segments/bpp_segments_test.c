@@ -5,8 +5,11 @@
 
 #include <stdio.h>
 #include <stdbool.h>
+#include <string.h>
 #include <onomondo/ipa/utils.h>
+#include <onomondo/ipa/http.h>
 #include <asn_application.h>
+#include <EsipaMessageFromEimToIpa.h>
 #include "src/ipa/libipa/utils.h"
 #include "src/ipa/libipa/es10x.h"
 #include "src/ipa/libipa/bpp_segments.h"
@@ -40,9 +43,238 @@ void ipa_bpp_segments_encode_test(char *test_vector_path)
 	ASN_STRUCT_FREE(asn_DEF_BoundProfilePackage, bpp_dec);
 }
 
+struct stream_test_ctx {
+	struct ipa_bpp_segments *segments;
+	size_t count;
+};
+
+static int stream_test_segment_cb(const uint8_t *data, size_t len, void *priv)
+{
+	struct stream_test_ctx *test_ctx = priv;
+
+	/* Each streamed segment must match the segment that ipa_bpp_segments_encode generates */
+	assert(test_ctx->count < test_ctx->segments->count);
+	assert(test_ctx->segments->segment[test_ctx->count]->len == len);
+	assert(memcmp(test_ctx->segments->segment[test_ctx->count]->data, data, len) == 0);
+	test_ctx->count++;
+
+	return 0;
+}
+
+static void feed_stream_test(struct ipa_bpp_segments *segments, const struct ipa_buf *msg, size_t chunk_len)
+{
+	struct stream_test_ctx test_ctx = { segments, 0 };
+	struct ipa_bpp_segments_stream *stream;
+	size_t offset;
+	size_t len;
+	int rc;
+
+	stream = ipa_bpp_segments_stream_alloc(stream_test_segment_cb, &test_ctx);
+	for (offset = 0; offset < msg->len; offset += len) {
+		len = msg->len - offset < chunk_len ? msg->len - offset : chunk_len;
+		rc = ipa_bpp_segments_stream_feed(stream, msg->data + offset, len);
+		assert(rc == 0);
+	}
+
+	printf("chunk size: %zu, streamed segments: %zu, complete: %u\n", chunk_len,
+	       ipa_bpp_segments_stream_count(stream), ipa_bpp_segments_stream_complete(stream));
+	assert(ipa_bpp_segments_stream_complete(stream));
+	assert(test_ctx.count == segments->count);
+	assert(!ipa_bpp_segments_stream_envelope(stream));
+
+	ipa_bpp_segments_stream_free(stream);
+}
+
+/* Feed the message into a stream parser that expects the given transactionId */
+static void transaction_id_stream_test(struct ipa_bpp_segments *segments, const struct ipa_buf *msg,
+				       const uint8_t *transaction_id, size_t transaction_id_len)
+{
+	struct stream_test_ctx test_ctx = { segments, 0 };
+	struct ipa_bpp_segments_stream *stream;
+	int rc;
+
+	stream = ipa_bpp_segments_stream_alloc(stream_test_segment_cb, &test_ctx);
+	ipa_bpp_segments_stream_expect_transaction_id(stream, transaction_id, transaction_id_len);
+	rc = ipa_bpp_segments_stream_feed(stream, msg->data, msg->len);
+	printf("expected transaction ID: %s, rc: %d, streamed segments: %zu, complete: %u\n",
+	       ipa_hexdump(transaction_id, transaction_id_len), rc, ipa_bpp_segments_stream_count(stream),
+	       ipa_bpp_segments_stream_complete(stream));
+	ipa_bpp_segments_stream_free(stream);
+}
+
+void ipa_bpp_segments_stream_test(char *test_vector_path)
+{
+	uint8_t bpp[20480];
+	FILE *bpp_file = NULL;
+	size_t bpp_len;
+	asn_dec_rval_t rc;
+	asn_enc_rval_t enc_rc;
+	struct BoundProfilePackage *bpp_dec = NULL;
+	struct ipa_bpp_segments *segments = NULL;
+	struct EsipaMessageFromEimToIpa msg_to_ipa = { 0 };
+	struct GetBoundProfilePackageOkEsipa *get_bnd_prfle_pkg_ok;
+	uint8_t transaction_id[] = { 0x01, 0x02, 0x03, 0x04 };
+	uint8_t other_transaction_id[] = { 0x01, 0x02, 0x03, 0x05 };
+	struct ipa_buf *msg_encoded = NULL;
+	struct ipa_bpp_segments_stream *stream;
+	const struct ipa_buf *envelope;
+	size_t chunk_lens[] = { 1, 2, 7, 100, 1024, 16384, 20480 };
+	uint8_t oversized[] = { 0xBF, 0x36, 0x83, 0x01, 0x00, 0x10, 0xBF, 0x23, 0x83, 0x01, 0x00, 0x00 };
+	uint8_t oversized_len[] = { 0xBF, 0x36, 0x83, 0x01, 0x00, 0x10, 0xBF, 0x23, 0x84, 0xFF, 0xFF, 0xFF, 0xFF };
+	unsigned int i;
+
+	/* Load test BPP test vector from file */
+	assert(test_vector_path);
+	bpp_file = fopen(test_vector_path, "r");
+	assert(bpp_file);
+	bpp_len = fread(&bpp, sizeof(char), sizeof(bpp), bpp_file);
+	fclose(bpp_file);
+
+	/* Decode BPP test vector and generate the segments as reference */
+	rc = ber_decode(0, &asn_DEF_BoundProfilePackage, (void **)&bpp_dec, bpp, bpp_len);
+	assert(rc.code == RC_OK);
+	segments = ipa_bpp_segments_encode(bpp_dec);
+	assert(segments);
+
+	/* Wrap the BPP into an ESipa message, as it would be received from the eIM */
+	msg_to_ipa.present = EsipaMessageFromEimToIpa_PR_getBoundProfilePackageResponseEsipa;
+	msg_to_ipa.choice.getBoundProfilePackageResponseEsipa.present =
+	    GetBoundProfilePackageResponseEsipa_PR_getBoundProfilePackageOkEsipa;
+	get_bnd_prfle_pkg_ok = &msg_to_ipa.choice.getBoundProfilePackageResponseEsipa.choice.getBoundProfilePackageOkEsipa;
+	get_bnd_prfle_pkg_ok->transactionId = IPA_ALLOC_ZERO(TransactionId_t);
+	get_bnd_prfle_pkg_ok->transactionId->buf = transaction_id;
+	get_bnd_prfle_pkg_ok->transactionId->size = sizeof(transaction_id);
+	get_bnd_prfle_pkg_ok->boundProfilePackage = *bpp_dec;
+	enc_rc = der_encode(&asn_DEF_EsipaMessageFromEimToIpa, &msg_to_ipa, ipa_asn1c_consume_bytes_cb, &msg_encoded);
+	assert(enc_rc.encoded > 0);
+	IPA_FREE(get_bnd_prfle_pkg_ok->transactionId);
+	printf("esipa message size: %zu\n", msg_encoded->len);
+
+	/* Feed the message in chunks of different size */
+	for (i = 0; i < sizeof(chunk_lens) / sizeof(chunk_lens[0]); i++)
+		feed_stream_test(segments, msg_encoded, chunk_lens[i]);
+
+	/* A message with an unexpected transactionId is rejected before the first segment is passed on */
+	transaction_id_stream_test(segments, msg_encoded, transaction_id, sizeof(transaction_id));
+	transaction_id_stream_test(segments, msg_encoded, other_transaction_id, sizeof(other_transaction_id));
+	IPA_FREE(msg_encoded);
+	msg_encoded = NULL;
+
+	/* A message that contains no BPP (error) is kept, so that the caller can decode it */
+	msg_to_ipa.choice.getBoundProfilePackageResponseEsipa.present =
+	    GetBoundProfilePackageResponseEsipa_PR_getBoundProfilePackageErrorEsipa;
+	msg_to_ipa.choice.getBoundProfilePackageResponseEsipa.choice.getBoundProfilePackageErrorEsipa =
+	    GetBoundProfilePackageResponseEsipa__getBoundProfilePackageErrorEsipa_invalidTransactionId;
+	enc_rc = der_encode(&asn_DEF_EsipaMessageFromEimToIpa, &msg_to_ipa, ipa_asn1c_consume_bytes_cb, &msg_encoded);
+	assert(enc_rc.encoded > 0);
+	stream = ipa_bpp_segments_stream_alloc(stream_test_segment_cb, NULL);
+	assert(ipa_bpp_segments_stream_feed(stream, msg_encoded->data, 2) == 0);
+	assert(ipa_bpp_segments_stream_feed(stream, msg_encoded->data + 2, msg_encoded->len - 2) == 0);
+	envelope = ipa_bpp_segments_stream_envelope(stream);
+	assert(envelope);
+	printf("error message: %s, streamed segments: %zu, complete: %u\n", ipa_buf_hexdump(envelope),
+	       ipa_bpp_segments_stream_count(stream), ipa_bpp_segments_stream_complete(stream));
+	assert(envelope->len == msg_encoded->len);
+	assert(memcmp(envelope->data, msg_encoded->data, envelope->len) == 0);
+	ipa_bpp_segments_stream_free(stream);
+	IPA_FREE(msg_encoded);
+
+	/* A segment that exceeds the largest legal ES8+ segment is rejected before it is buffered */
+	stream = ipa_bpp_segments_stream_alloc(stream_test_segment_cb, NULL);
+	printf("oversized segment: %s\n",
+	       ipa_bpp_segments_stream_feed(stream, oversized, sizeof(oversized)) < 0 ? "rejected" : "accepted");
+	ipa_bpp_segments_stream_free(stream);
+
+	/* The same with a length field that would overflow when the header length is added to it */
+	stream = ipa_bpp_segments_stream_alloc(stream_test_segment_cb, NULL);
+	printf("oversized segment length: %s\n",
+	       ipa_bpp_segments_stream_feed(stream, oversized_len, sizeof(oversized_len)) < 0 ? "rejected" : "accepted");
+	ipa_bpp_segments_stream_free(stream);
+
+	ipa_bpp_segments_free(segments);
+	ASN_STRUCT_FREE(asn_DEF_BoundProfilePackage, bpp_dec);
+}
+
+static void slice_test(struct ipa_bpp_segments *segments, const struct ipa_buf *encoded)
+{
+	struct ipa_bpp_slices *slices;
+	unsigned int i;
+
+	/* Each slice must match the segment that ipa_bpp_segments_encode generates */
+	slices = ipa_bpp_segments_slice(encoded->data, encoded->len);
+	assert(slices);
+	printf("encoded size: %zu, sliced segments: %zu\n", encoded->len, slices->count);
+	assert(slices->count == segments->count);
+	for (i = 0; i < slices->count; i++) {
+		assert(slices->slice[i].offset + slices->slice[i].len <= encoded->len);
+		assert(segments->segment[i]->len == slices->slice[i].len);
+		assert(memcmp(segments->segment[i]->data, slices->data + slices->slice[i].offset,
+			      slices->slice[i].len) == 0);
+	}
+	ipa_bpp_slices_free(slices);
+}
+
+void ipa_bpp_segments_slice_test(char *test_vector_path)
+{
+	struct ipa_buf *bpp = ipa_buf_alloc(20480);
+	FILE *bpp_file = NULL;
+	asn_dec_rval_t rc;
+	asn_enc_rval_t enc_rc;
+	struct BoundProfilePackage *bpp_dec = NULL;
+	struct ipa_bpp_segments *segments = NULL;
+	struct EsipaMessageFromEimToIpa msg_to_ipa = { 0 };
+	struct GetBoundProfilePackageOkEsipa *get_bnd_prfle_pkg_ok;
+	uint8_t transaction_id[] = { 0x01, 0x02, 0x03, 0x04 };
+	struct ipa_buf *msg_encoded = NULL;
+	size_t bpp_len;
+
+	/* Load test BPP test vector from file */
+	assert(test_vector_path);
+	bpp_file = fopen(test_vector_path, "r");
+	assert(bpp_file);
+	bpp->len = fread(bpp->data, sizeof(char), bpp->data_len, bpp_file);
+	fclose(bpp_file);
+
+	/* Decode BPP test vector and generate the segments as reference */
+	rc = ber_decode(0, &asn_DEF_BoundProfilePackage, (void **)&bpp_dec, bpp->data, bpp->len);
+	assert(rc.code == RC_OK);
+	segments = ipa_bpp_segments_encode(bpp_dec);
+	assert(segments);
+
+	/* Slice the plain BPP */
+	slice_test(segments, bpp);
+
+	/* Slice the BPP from the ESipa message, as it is received from the eIM */
+	msg_to_ipa.present = EsipaMessageFromEimToIpa_PR_getBoundProfilePackageResponseEsipa;
+	msg_to_ipa.choice.getBoundProfilePackageResponseEsipa.present =
+	    GetBoundProfilePackageResponseEsipa_PR_getBoundProfilePackageOkEsipa;
+	get_bnd_prfle_pkg_ok = &msg_to_ipa.choice.getBoundProfilePackageResponseEsipa.choice.getBoundProfilePackageOkEsipa;
+	get_bnd_prfle_pkg_ok->transactionId = IPA_ALLOC_ZERO(TransactionId_t);
+	get_bnd_prfle_pkg_ok->transactionId->buf = transaction_id;
+	get_bnd_prfle_pkg_ok->transactionId->size = sizeof(transaction_id);
+	get_bnd_prfle_pkg_ok->boundProfilePackage = *bpp_dec;
+	enc_rc = der_encode(&asn_DEF_EsipaMessageFromEimToIpa, &msg_to_ipa, ipa_asn1c_consume_bytes_cb, &msg_encoded);
+	assert(enc_rc.encoded > 0);
+	IPA_FREE(get_bnd_prfle_pkg_ok->transactionId);
+	slice_test(segments, msg_encoded);
+
+	/* A truncated BPP is rejected */
+	bpp_len = bpp->len;
+	for (bpp->len = 0; bpp->len < bpp_len; bpp->len += 997)
+		assert(ipa_bpp_segments_slice(bpp->data, bpp->len) == NULL);
+	printf("truncated BPP rejected\n");
+
+	IPA_FREE(msg_encoded);
+	IPA_FREE(bpp);
+	ipa_bpp_segments_free(segments);
+	ASN_STRUCT_FREE(asn_DEF_BoundProfilePackage, bpp_dec);
+}
+
 int main(int argc, char **argv)
 {
 	ipa_bpp_segments_encode_test(argv[1]);
+	ipa_bpp_segments_stream_test(argv[1]);
+	ipa_bpp_segments_slice_test(argv[1]);
 	return 0;
 }
 
@@ -57,11 +289,37 @@ struct ipa_buf *ipa_http_req(void *http_ctx, const struct ipa_buf *req, const ch
 	return NULL;
 }
 
+struct ipa_buf *ipa_http_req_timeout(void *http_ctx, const struct ipa_buf *req, const char *url, unsigned int timeout)
+{
+	return ipa_http_req(http_ctx, req, url);
+}
+
+int ipa_http_req_stream(void *http_ctx, const struct ipa_buf *req, const char *url, ipa_http_res_cb res_cb,
+			void *priv)
+{
+	return -1;
+}
+
+void ipa_http_recycle(void *http_ctx, struct ipa_buf *buf)
+{
+	return;
+}
+
 void ipa_http_close(void *http_ctx)
 {
 	return;
 }
 
+struct ipa_buf *ipa_http_export_session(void *http_ctx)
+{
+	return NULL;
+}
+
+int ipa_http_import_session(void *http_ctx, const struct ipa_buf *session)
+{
+	return 0;
+}
+
 void ipa_http_free(void *http_ctx)
 {
 	return;
@@ -82,11 +340,32 @@ int ipa_scard_atr(void *scard_ctx, struct ipa_buf *atr)
 	return 0;
 }
 
+int ipa_scard_protocol(void *scard_ctx)
+{
+	return 0;
+}
+
 int ipa_scard_transceive(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req)
 {
 	return 0;
 }
 
+int ipa_scard_transceive_v(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req_iov,
+			   unsigned int req_iov_count)
+{
+	return 0;
+}
+
+int ipa_scard_begin_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_end_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
 int ipa_scard_free(void *scard_ctx)
 {
 	return 0;
@@ -0,0 +1,525 @@
+/*
+ * Author: Philipp Maier <pmaier@sysmocom.de> / sysmocom - s.f.m.c. GmbH
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <openssl/ssl.h>
+#include <openssl/x509.h>
+#include <openssl/evp.h>
+#include <onomondo/ipa/utils.h>
+#include <onomondo/ipa/log.h>
+#include "src/ipa/coap.h"
+
+/* Minimal CoAP server (plain UDP or DTLS), which receives block-wise requests (Block1) and serves block-wise responses
+ * (Block2) from a test pattern. */
+struct test_server {
+	int fd;
+	uint16_t port;
+	pthread_t thread;
+	bool stop;
+
+	/* DTLS connection, the server serves one connection at a time */
+	SSL_CTX *ssl_ctx;
+	SSL *ssl;
+	struct sockaddr_in ssl_peer;
+	unsigned int dtls_conns;
+	unsigned int dtls_resumed;
+
+	/* Behaviour of the server */
+	uint8_t code;
+	size_t res_len;
+	uint8_t szx;
+	bool drop_first;
+	bool separate;
+
+	/* Request as it was reassembled by the server */
+	uint8_t req[16384];
+	size_t req_len;
+	char uri_path[256];
+	unsigned int datagrams;
+	unsigned int dropped;
+	size_t max_datagram_len;
+};
+
+static uint8_t pattern(size_t i, uint8_t seed)
+{
+	return (i * 7 + seed) & 0xff;
+}
+
+static uint32_t get_uint(const uint8_t *val, size_t len)
+{
+	uint32_t res = 0;
+	while (len--)
+		res = (res << 8) | *val++;
+	return res;
+}
+
+static uint8_t *put_opt_uint(uint8_t *ptr, unsigned int *last_num, unsigned int num, uint32_t val)
+{
+	uint8_t buf[4];
+	size_t len = 0;
+
+	if (val > 0xffff)
+		buf[len++] = val >> 16;
+	if (val > 0xff)
+		buf[len++] = val >> 8;
+	if (val > 0)
+		buf[len++] = val;
+
+	assert(num - *last_num < 13 || num - *last_num - 13 < 256);
+	if (num - *last_num < 13) {
+		*ptr++ = ((num - *last_num) << 4) | len;
+	} else {
+		*ptr++ = (13 << 4) | len;
+		*ptr++ = num - *last_num - 13;
+	}
+	*last_num = num;
+	memcpy(ptr, buf, len);
+	return ptr + len;
+}
+
+static void server_send(struct test_server *srv, const uint8_t *msg, size_t len, struct sockaddr_in *peer,
+			socklen_t peer_len)
+{
+	if (srv->ssl)
+		SSL_write(srv->ssl, msg, len);
+	else
+		sendto(srv->fd, msg, len, 0, (struct sockaddr *)peer, peer_len);
+}
+
+static void handle_msg(struct test_server *srv, const uint8_t *msg, size_t len, struct sockaddr_in *peer,
+		       socklen_t peer_len)
+{
+	const uint8_t *ptr;
+	const uint8_t *end = msg + len;
+	const uint8_t *payload = NULL;
+	size_t payload_len = 0;
+	unsigned int opt_num = 0;
+	unsigned int delta;
+	size_t opt_len;
+	uint8_t token_len = msg[0] & 0x0f;
+	bool block1_present = false;
+	uint32_t block1 = 0;
+	uint32_t block2 = 0;
+	bool block2_present = false;
+	uint8_t res[2048];
+	uint8_t *res_ptr;
+	unsigned int last_num = 0;
+	uint32_t num;
+	uint8_t szx;
+	size_t block_size;
+	size_t offset;
+	bool more;
+
+	/* Only confirmable requests are of interest, the ACKs for our separate responses are ignored */
+	if (((msg[0] >> 4) & 0x03) != 0 || msg[1] != 0x02)
+		return;
+
+	srv->datagrams++;
+	if (srv->drop_first && srv->dropped == 0) {
+		srv->dropped++;
+		return;
+	}
+
+	/* All messages of an exchange carry the same Uri-Path */
+	srv->uri_path[0] = '\0';
+	ptr = msg + 4 + token_len;
+	while (ptr < end) {
+		if (*ptr == 0xff) {
+			payload = ptr + 1;
+			payload_len = end - payload;
+			break;
+		}
+		delta = *ptr >> 4;
+		opt_len = *ptr & 0x0f;
+		ptr++;
+		if (delta == 13)
+			delta = *ptr++ + 13;
+		if (opt_len == 13)
+			opt_len = *ptr++ + 13;
+		opt_num += delta;
+		if (opt_num == 11) {
+			strcat(srv->uri_path, "/");
+			strncat(srv->uri_path, (char *)ptr, opt_len);
+		} else if (opt_num == 27) {
+			block1_present = true;
+			block1 = get_uint(ptr, opt_len);
+		} else if (opt_num == 23) {
+			block2_present = true;
+			block2 = get_uint(ptr, opt_len);
+		}
+		ptr += opt_len;
+	}
+
+	/* Header of the response, piggybacked on the ACK, unless a separate response is requested */
+	res_ptr = res;
+	memcpy(res_ptr, msg, 4 + token_len);
+	res_ptr[0] = (1 << 6) | (2 << 4) | token_len;
+	res_ptr += 4 + token_len;
+
+	/* Reassemble request */
+	if (block1_present) {
+		num = block1 >> 4;
+		more = (block1 >> 3) & 1;
+		szx = block1 & 0x07;
+		offset = num * (1 << (szx + 4));
+		assert(offset + payload_len <= sizeof(srv->req));
+		memcpy(srv->req + offset, payload, payload_len);
+		srv->req_len = offset + payload_len;
+		if (more) {
+			res[1] = (2 << 5) | 31;
+			if (szx > srv->szx)
+				szx = srv->szx;
+			res_ptr = put_opt_uint(res_ptr, &last_num, 27, (num << 4) | 0x08 | szx);
+			server_send(srv, res, res_ptr - res, peer, peer_len);
+			return;
+		}
+	} else if (payload_len) {
+		memcpy(srv->req, payload, payload_len);
+		srv->req_len = payload_len;
+	}
+
+	/* Response */
+	res[1] = srv->code;
+	num = block2_present ? block2 >> 4 : 0;
+	szx = block2_present ? block2 & 0x07 : srv->szx;
+	if (szx > srv->szx)
+		szx = srv->szx;
+	block_size = 1 << (szx + 4);
+	offset = num * block_size;
+	payload_len = srv->res_len - offset < block_size ? srv->res_len - offset : block_size;
+	more = offset + payload_len < srv->res_len;
+
+	if (srv->separate) {
+		uint8_t ack[4] = { (1 << 6) | (2 << 4), 0, msg[2], msg[3] };
+		server_send(srv, ack, sizeof(ack), peer, peer_len);
+		res[0] = (1 << 6) | (0 << 4) | token_len;
+		res[2] = 0x40;
+		res[3] = num;
+	}
+
+	if (srv->res_len > block_size)
+		res_ptr = put_opt_uint(res_ptr, &last_num, 23, (num << 4) | (more ? 0x08 : 0) | szx);
+	if (block1_present)
+		res_ptr = put_opt_uint(res_ptr, &last_num, 27, block1);
+	if (srv->res_len > block_size && num == 0)
+		res_ptr = put_opt_uint(res_ptr, &last_num, 28, srv->res_len);
+	if (payload_len) {
+		*res_ptr++ = 0xff;
+		for (size_t i = 0; i < payload_len; i++)
+			*res_ptr++ = pattern(offset + i, 0x55);
+	}
+	server_send(srv, res, res_ptr - res, peer, peer_len);
+}
+
+/* Accept a DTLS connection from the peer that sent the next datagram */
+static void dtls_accept(struct test_server *srv)
+{
+	socklen_t peer_len = sizeof(srv->ssl_peer);
+	uint8_t msg[1];
+	BIO *bio;
+
+	if (recvfrom(srv->fd, msg, sizeof(msg), MSG_PEEK, (struct sockaddr *)&srv->ssl_peer, &peer_len) < 0)
+		return;
+
+	srv->ssl = SSL_new(srv->ssl_ctx);
+	assert(srv->ssl);
+	bio = BIO_new_dgram(srv->fd, BIO_NOCLOSE);
+	assert(bio);
+	BIO_dgram_set_peer(bio, &srv->ssl_peer);
+	SSL_set_bio(srv->ssl, bio, bio);
+	if (SSL_accept(srv->ssl) != 1) {
+		SSL_free(srv->ssl);
+		srv->ssl = NULL;
+		return;
+	}
+
+	srv->dtls_conns++;
+	if (SSL_session_reused(srv->ssl))
+		srv->dtls_resumed++;
+}
+
+static void *dtls_server_thread(void *arg)
+{
+	struct test_server *srv = arg;
+	struct pollfd pfd = { .fd = srv->fd, .events = POLLIN };
+	uint8_t msg[2048];
+	int len;
+
+	while (!srv->stop) {
+		if ((!srv->ssl || !SSL_pending(srv->ssl)) && poll(&pfd, 1, 50) <= 0)
+			continue;
+		if (!srv->ssl) {
+			dtls_accept(srv);
+			continue;
+		}
+
+		len = SSL_read(srv->ssl, msg, sizeof(msg));
+		if (len >= 4) {
+			handle_msg(srv, msg, len, &srv->ssl_peer, sizeof(srv->ssl_peer));
+		} else if (len <= 0 && SSL_get_error(srv->ssl, len) != SSL_ERROR_WANT_READ) {
+			/* The client has closed the connection */
+			SSL_free(srv->ssl);
+			srv->ssl = NULL;
+		}
+	}
+
+	SSL_free(srv->ssl);
+	return NULL;
+}
+
+/* Create a self signed certificate for the DTLS server, so that no key material has to be kept in the repository */
+static SSL_CTX *dtls_server_ctx(void)
+{
+	SSL_CTX *ssl_ctx;
+	EVP_PKEY *key;
+	X509 *cert;
+	X509_NAME *name;
+
+	ssl_ctx = SSL_CTX_new(DTLS_server_method());
+	assert(ssl_ctx);
+	SSL_CTX_set_session_id_context(ssl_ctx, (const unsigned char *)"ipa", 3);
+
+	key = EVP_EC_gen("P-256");
+	assert(key);
+	cert = X509_new();
+	assert(cert);
+	ASN1_INTEGER_set(X509_get_serialNumber(cert), 1);
+	X509_gmtime_adj(X509_getm_notBefore(cert), 0);
+	X509_gmtime_adj(X509_getm_notAfter(cert), 3600);
+	X509_set_pubkey(cert, key);
+	name = X509_get_subject_name(cert);
+	X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, (const unsigned char *)"localhost", -1, -1, 0);
+	X509_set_issuer_name(cert, name);
+	assert(X509_sign(cert, key, EVP_sha256()) > 0);
+
+	assert(SSL_CTX_use_certificate(ssl_ctx, cert) == 1);
+	assert(SSL_CTX_use_PrivateKey(ssl_ctx, key) == 1);
+	X509_free(cert);
+	EVP_PKEY_free(key);
+	return ssl_ctx;
+}
+
+static void *server_thread(void *arg)
+{
+	struct test_server *srv = arg;
+	struct pollfd pfd = { .fd = srv->fd, .events = POLLIN };
+	struct sockaddr_in peer;
+	socklen_t peer_len;
+	uint8_t msg[2048];
+	ssize_t len;
+
+	if (srv->ssl_ctx)
+		return dtls_server_thread(srv);
+
+	while (!srv->stop) {
+		if (poll(&pfd, 1, 50) <= 0)
+			continue;
+		peer_len = sizeof(peer);
+		len = recvfrom(srv->fd, msg, sizeof(msg), 0, (struct sockaddr *)&peer, &peer_len);
+		if (len > 0 && (size_t)len > srv->max_datagram_len)
+			srv->max_datagram_len = len;
+		if (len >= 4)
+			handle_msg(srv, msg, len, &peer, peer_len);
+	}
+
+	return NULL;
+}
+
+static void server_start(struct test_server *srv, bool dtls)
+{
+	struct sockaddr_in addr = { 0 };
+	socklen_t addr_len = sizeof(addr);
+	int rc;
+
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	srv->fd = socket(AF_INET, SOCK_DGRAM, 0);
+	assert(srv->fd >= 0);
+	rc = bind(srv->fd, (struct sockaddr *)&addr, sizeof(addr));
+	assert(rc == 0);
+	rc = getsockname(srv->fd, (struct sockaddr *)&addr, &addr_len);
+	assert(rc == 0);
+	srv->port = ntohs(addr.sin_port);
+	srv->code = (2 << 5) | 4;
+	srv->szx = 6;
+	if (dtls)
+		srv->ssl_ctx = dtls_server_ctx();
+	rc = pthread_create(&srv->thread, NULL, server_thread, srv);
+	assert(rc == 0);
+}
+
+static void server_stop(struct test_server *srv)
+{
+	srv->stop = true;
+	pthread_join(srv->thread, NULL);
+	close(srv->fd);
+	SSL_CTX_free(srv->ssl_ctx);
+}
+
+static int stream_cb(const uint8_t *data, size_t len, void *priv)
+{
+	struct ipa_buf *buf = priv;
+
+	if (buf->len + len > buf->data_len)
+		return -ENOMEM;
+	memcpy(buf->data + buf->len, data, len);
+	buf->len += len;
+	return 0;
+}
+
+static bool check_res(const struct ipa_buf *res, size_t len)
+{
+	size_t i;
+
+	if (res->len != len)
+		return false;
+	for (i = 0; i < len; i++) {
+		if (res->data[i] != pattern(i, 0x55))
+			return false;
+	}
+	return true;
+}
+
+static void req_test(void *coap_ctx, struct test_server *srv, const char *url, size_t req_len, bool stream)
+{
+	struct ipa_buf *req = ipa_buf_alloc(req_len);
+	struct ipa_buf *res;
+	size_t i;
+	int rc;
+
+	for (i = 0; i < req_len; i++)
+		req->data[i] = pattern(i, 0xaa);
+	req->len = req_len;
+	srv->req_len = 0;
+	srv->datagrams = 0;
+	srv->dropped = 0;
+
+	printf(" request: %zu bytes, response: %zu bytes, code: %u.%02u, server block size: %u bytes%s%s%s\n", req_len,
+	       srv->res_len, srv->code >> 5, srv->code & 0x1f, 1 << (srv->szx + 4), stream ? ", streamed" : "",
+	       srv->drop_first ? ", first datagram lost" : "", srv->separate ? ", separate response" : "");
+
+	if (stream) {
+		res = ipa_buf_alloc(16384);
+		rc = ipa_coap_req_stream(coap_ctx, req, url, stream_cb, res);
+		if (rc < 0) {
+			ipa_buf_free(res);
+			res = NULL;
+		}
+	} else {
+		res = ipa_coap_req(coap_ctx, ipa_buf_alloc(64), req, url);
+	}
+
+	printf(" => request received by server: %s (path: %s, datagrams: %u)\n",
+	       srv->req_len == req_len && memcmp(srv->req, req->data, req_len) == 0 ? "ok" : "mismatch", srv->uri_path,
+	       srv->datagrams);
+	if (res)
+		printf(" => response: %zu bytes, %s\n", res->len, check_res(res, srv->res_len) ? "ok" : "mismatch");
+	else
+		printf(" => request failed\n");
+
+	ipa_buf_free(res);
+	ipa_buf_free(req);
+}
+
+int main(int argc, char **argv)
+{
+	struct test_server srv = { 0 };
+	void *coap_ctx;
+	char url[256];
+	char long_url[256];
+	unsigned int handshakes;
+	unsigned int reuses;
+
+	printf("URL scheme detection:\n");
+	printf(" coaps://eim.example.com/gsma/rsp2/asn1: %u\n", ipa_coap_url("coaps://eim.example.com/gsma/rsp2/asn1"));
+	printf(" coap://127.0.0.1/gsma/rsp2/asn1: %u\n", ipa_coap_url("coap://127.0.0.1/gsma/rsp2/asn1"));
+	printf(" https://eim.example.com/gsma/rsp2/asn1: %u\n", ipa_coap_url("https://eim.example.com/gsma/rsp2/asn1"));
+
+	server_start(&srv, false);
+	snprintf(url, sizeof(url), "coap://127.0.0.1:%u/gsma/rsp2/asn1", srv.port);
+	coap_ctx = ipa_coap_init(NULL, false);
+
+	printf("\nsmall request, small response:\n");
+	srv.res_len = 200;
+	req_test(coap_ctx, &srv, url, 100, false);
+
+	printf("\nlarge request, large response (block-wise transfer):\n");
+	srv.res_len = 7000;
+	req_test(coap_ctx, &srv, url, 5000, false);
+
+	printf("\nlarge request, large response (server prefers smaller blocks):\n");
+	srv.szx = 4;
+	req_test(coap_ctx, &srv, url, 3000, false);
+	srv.szx = 6;
+
+	printf("\nlarge response, passed to callback function:\n");
+	srv.res_len = 9000;
+	req_test(coap_ctx, &srv, url, 40, true);
+
+	printf("\nempty response:\n");
+	srv.res_len = 0;
+	req_test(coap_ctx, &srv, url, 40, false);
+
+	printf("\nerror response:\n");
+	srv.code = (4 << 5) | 4;
+	req_test(coap_ctx, &srv, url, 40, false);
+	srv.code = (2 << 5) | 4;
+
+	printf("\nseparate response:\n");
+	srv.separate = true;
+	srv.res_len = 3000;
+	req_test(coap_ctx, &srv, url, 40, false);
+	srv.separate = false;
+
+	printf("\nlost datagram (retransmission):\n");
+	srv.drop_first = true;
+	srv.res_len = 100;
+	req_test(coap_ctx, &srv, url, 40, false);
+	srv.drop_first = false;
+
+	printf("\nlong URL (smaller request blocks):\n");
+	snprintf(long_url, sizeof(long_url), "coap://127.0.0.1:%u/gsma/rsp2/asn1/%s/%s/%s/%s/%s/%s", srv.port,
+		 "aaaaaaaaaaaaaaaaaaaaaaaaaaaaa", "bbbbbbbbbbbbbbbbbbbbbbbbbbbbb", "ccccccccccccccccccccccccccccc",
+		 "ddddddddddddddddddddddddddddd", "eeeeeeeeeeeeeeeeeeeeeeeeeeeee", "fffffffffffffffffffffffffffff");
+	srv.res_len = 100;
+	srv.max_datagram_len = 0;
+	req_test(coap_ctx, &srv, long_url, 3000, false);
+	printf(" => largest datagram: %s\n", srv.max_datagram_len <= 1280 ? "ok" : "too large");
+
+	ipa_coap_stats(coap_ctx, &handshakes, &reuses);
+	printf("\nconnections: %u, reused: %u\n", handshakes, reuses);
+
+	ipa_coap_free(coap_ctx);
+	server_stop(&srv);
+
+	/* The DTLS session of a connection is offered to the server when the next connection is established, so that
+	 * the server can resume the session (abbreviated handshake) */
+	printf("\nDTLS, session resumption:\n");
+	memset(&srv, 0, sizeof(srv));
+	server_start(&srv, true);
+	snprintf(url, sizeof(url), "coaps://127.0.0.1:%u/gsma/rsp2/asn1", srv.port);
+	coap_ctx = ipa_coap_init(NULL, true);
+	srv.res_len = 3000;
+	req_test(coap_ctx, &srv, url, 2000, false);
+	ipa_coap_close(coap_ctx);
+	req_test(coap_ctx, &srv, url, 2000, false);
+	ipa_coap_close(coap_ctx);
+	server_stop(&srv);
+	printf(" => server: DTLS connections: %u, resumed: %u\n", srv.dtls_conns, srv.dtls_resumed);
+	ipa_coap_free(coap_ctx);
+	return 0;
+}
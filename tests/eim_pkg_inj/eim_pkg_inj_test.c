@@ -0,0 +1,204 @@
+/*
+ * Author: Philipp Maier <pmaier@sysmocom.de> / sysmocom - s.f.m.c. GmbH
+ *
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#include <onomondo/ipa/utils.h>
+#include <onomondo/ipa/http.h>
+#include <onomondo/ipa/ipad.h>
+#include <asn_application.h>
+#include <EsipaMessageFromEimToIpa.h>
+#include <EsipaMessageFromIpaToEim.h>
+#include "src/ipa/libipa/utils.h"
+#include "src/ipa/libipa/context.h"
+#include "src/ipa/libipa/esipa_get_eim_pkg.h"
+
+static struct ipa_buf *enc_transfer_eim_pkg_req(struct EsipaMessageFromEimToIpa *msg_to_ipa)
+{
+	struct ipa_buf *buf_encoded = NULL;
+	asn_enc_rval_t rc;
+
+	rc = der_encode(&asn_DEF_EsipaMessageFromEimToIpa, msg_to_ipa, ipa_asn1c_consume_bytes_cb, &buf_encoded);
+	assert(rc.encoded > 0);
+	return buf_encoded;
+}
+
+/* Inject an eIM package and display the response that would be sent back to the eIM */
+static void inject_test(struct ipa_context *ctx, const struct ipa_buf *eim_pkg)
+{
+	struct ipa_buf *res;
+	struct EsipaMessageFromIpaToEim *msg_to_eim = NULL;
+	struct TransferEimPackageResponse *transfer_eim_pkg_res;
+	asn_dec_rval_t rc;
+
+	printf(" eIM package: %s\n", ipa_hexdump(eim_pkg->data, eim_pkg->len));
+	res = ipa_inject_eim_pkg(ctx, eim_pkg);
+	assert(res);
+	printf(" response: %s\n", ipa_hexdump(res->data, res->len));
+
+	rc = ber_decode(0, &asn_DEF_EsipaMessageFromIpaToEim, (void **)&msg_to_eim, res->data, res->len);
+	assert(rc.code == RC_OK);
+	assert(msg_to_eim->present == EsipaMessageFromIpaToEim_PR_transferEimPackageResponse);
+	transfer_eim_pkg_res = &msg_to_eim->choice.transferEimPackageResponse;
+	if (transfer_eim_pkg_res->present == TransferEimPackageResponse_PR_eimPackageReceived)
+		printf(" => eimPackageReceived\n");
+	else if (transfer_eim_pkg_res->present == TransferEimPackageResponse_PR_eimPackageError)
+		printf(" => eimPackageError: %ld\n", transfer_eim_pkg_res->choice.eimPackageError);
+	else
+		printf(" => unexpected response\n");
+	printf(" pending eIM package: %s\n", ctx->eim_pkg_pending ? "yes" : "no");
+
+	ASN_STRUCT_FREE(asn_DEF_EsipaMessageFromIpaToEim, msg_to_eim);
+	IPA_FREE(res);
+}
+
+int main(int argc, char **argv)
+{
+	struct ipa_config cfg = { 0 };
+	struct ipa_context *ctx;
+	struct ipa_buf *nvstate;
+	struct EsipaMessageFromEimToIpa msg_to_ipa = { 0 };
+	struct IpaEuiccDataRequest *ipa_euicc_data_req;
+	struct EimAcknowledgements *eim_acknowledgements;
+	SequenceNumber_t seq_number = 1;
+	uint8_t tag_list[] = { 0x80, 0xBF, 0x20 };
+	uint8_t garbage[] = { 0xBF, 0x4E, 0x10, 0x00 };
+	struct ipa_buf *eim_pkg;
+
+	cfg.eim_inject = true;
+	ctx = ipa_new_ctx(&cfg, NULL);
+
+	printf("IpaEuiccDataRequest:\n");
+	msg_to_ipa.present = EsipaMessageFromEimToIpa_PR_transferEimPackageRequest;
+	msg_to_ipa.choice.transferEimPackageRequest.present = TransferEimPackageRequest_PR_ipaEuiccDataRequest;
+	ipa_euicc_data_req = &msg_to_ipa.choice.transferEimPackageRequest.choice.ipaEuiccDataRequest;
+	ipa_euicc_data_req->tagList.buf = tag_list;
+	ipa_euicc_data_req->tagList.size = sizeof(tag_list);
+	eim_pkg = enc_transfer_eim_pkg_req(&msg_to_ipa);
+	inject_test(ctx, eim_pkg);
+	assert(ctx->eim_pkg_pending && ctx->eim_pkg_pending->ipa_euicc_data_request);
+
+	/* A second eIM package is rejected as long as the first one has not been executed */
+	printf("\nIpaEuiccDataRequest (while another eIM package is pending):\n");
+	inject_test(ctx, eim_pkg);
+	IPA_FREE(eim_pkg);
+	ipa_esipa_get_eim_pkg_free(ctx->eim_pkg_pending);
+	ctx->eim_pkg_pending = NULL;
+
+	printf("\neimAcknowledgements:\n");
+	msg_to_ipa.choice.transferEimPackageRequest.present = TransferEimPackageRequest_PR_eimAcknowledgements;
+	eim_acknowledgements = &msg_to_ipa.choice.transferEimPackageRequest.choice.eimAcknowledgements;
+	memset(eim_acknowledgements, 0, sizeof(*eim_acknowledgements));
+	ASN_SEQUENCE_ADD(&eim_acknowledgements->list, &seq_number);
+	eim_pkg = enc_transfer_eim_pkg_req(&msg_to_ipa);
+	inject_test(ctx, eim_pkg);
+	IPA_FREE(eim_pkg);
+	asn_sequence_empty(&eim_acknowledgements->list);
+
+	printf("\ninvalid eIM package:\n");
+	eim_pkg = ipa_buf_alloc_data(sizeof(garbage), garbage);
+	inject_test(ctx, eim_pkg);
+	IPA_FREE(eim_pkg);
+
+	nvstate = ipa_free_ctx(ctx);
+	IPA_FREE(nvstate);
+	return 0;
+}
+
+/* Stubs */
+void *ipa_http_init(const char *cabundle, bool no_verif)
+{
+	static int http_ctx;
+	return &http_ctx;
+}
+
+struct ipa_buf *ipa_http_req(void *http_ctx, const struct ipa_buf *req, const char *url)
+{
+	return NULL;
+}
+
+struct ipa_buf *ipa_http_req_timeout(void *http_ctx, const struct ipa_buf *req, const char *url, unsigned int timeout)
+{
+	return ipa_http_req(http_ctx, req, url);
+}
+
+int ipa_http_req_stream(void *http_ctx, const struct ipa_buf *req, const char *url, ipa_http_res_cb res_cb,
+			void *priv)
+{
+	return -1;
+}
+
+void ipa_http_recycle(void *http_ctx, struct ipa_buf *buf)
+{
+	IPA_FREE(buf);
+}
+
+void ipa_http_close(void *http_ctx)
+{
+	return;
+}
+
+struct ipa_buf *ipa_http_export_session(void *http_ctx)
+{
+	return NULL;
+}
+
+int ipa_http_import_session(void *http_ctx, const struct ipa_buf *session)
+{
+	return 0;
+}
+
+void ipa_http_free(void *http_ctx)
+{
+	return;
+}
+
+void *ipa_scard_init(unsigned int reader_num)
+{
+	return NULL;
+}
+
+int ipa_scard_reset(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_atr(void *scard_ctx, struct ipa_buf *atr)
+{
+	return 0;
+}
+
+int ipa_scard_protocol(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_transceive(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req)
+{
+	return 0;
+}
+
+int ipa_scard_transceive_v(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req_iov,
+			   unsigned int req_iov_count)
+{
+	return 0;
+}
+
+int ipa_scard_begin_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_end_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_free(void *scard_ctx)
+{
+	return 0;
+}
@@ -0,0 +1,323 @@
+/*
+ * Author: Philipp Maier <pmaier@sysmocom.de> / sysmocom - s.f.m.c. GmbH
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#include <onomondo/ipa/utils.h>
+#include <onomondo/ipa/http.h>
+#include <onomondo/ipa/ipad.h>
+#include <onomondo/ipa/log.h>
+#include <asn_application.h>
+#include <ProfileInfoListResponse.h>
+#include "src/ipa/libipa/utils.h"
+#include "src/ipa/libipa/context.h"
+#include "src/ipa/libipa/euicc.h"
+#include "src/ipa/libipa/es10x.h"
+
+extern uint32_t ipa_log_mask;
+
+/* Emulated eUICC (see ipa_scard_transceive_v stub below), which answers each ES10x request with the response in
+ * card.res. The response is handed out in blocks (GET RESPONSE) of card.block_len bytes, in case card.block_len is 0,
+ * the block lengths are random. When card.split is set, a block ends at that offset. */
+static struct {
+	const struct ipa_buf *res;
+	size_t offset;
+	size_t next_block_len;
+	size_t block_len;
+	size_t split;
+	unsigned int seed;
+} card;
+
+/* Determine the length of the next block and the status word that announces it */
+static uint16_t card_next_block(void)
+{
+	size_t remaining = card.res->len - card.offset;
+
+	if (remaining == 0) {
+		card.next_block_len = 0;
+		return 0x9000;
+	}
+
+	card.next_block_len = card.block_len ? card.block_len : (size_t)(rand_r(&card.seed) % 256) + 1;
+	if (card.next_block_len > 256)
+		card.next_block_len = 256;
+	if (card.next_block_len > remaining)
+		card.next_block_len = remaining;
+	if (card.split > card.offset && card.offset + card.next_block_len > card.split)
+		card.next_block_len = card.split - card.offset;
+	return 0x6100 | (card.next_block_len & 0xff);
+}
+
+/* GetProfilesInfo request (without search criteria) */
+static const uint8_t get_prfle_info_req[] = { 0xBF, 0x2D, 0x00 };
+
+/* Encode a ProfileInfoListResponse with the given number of profiles */
+static struct ipa_buf *profile_info_list(unsigned int count)
+{
+	struct ProfileInfoListResponse res = { 0 };
+	struct ProfileInfo *info;
+	struct ipa_buf *encoded = NULL;
+	uint8_t iccid[] = { 0x98, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+	uint8_t isdp_aid[] = { 0xA0, 0x00, 0x00, 0x05, 0x59, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x10,
+		0x00
+	};
+	char name[32];
+	asn_enc_rval_t rc;
+	unsigned int i;
+
+	res.present = ProfileInfoListResponse_PR_profileInfoListOk;
+	for (i = 0; i < count; i++) {
+		info = CALLOC(1, sizeof(*info));
+		assert(info);
+		iccid[9] = i;
+		info->iccid = OCTET_STRING_new_fromBuf(&asn_DEF_Iccid, (char *)iccid, sizeof(iccid));
+		isdp_aid[15] = i;
+		info->isdpAid = OCTET_STRING_new_fromBuf(&asn_DEF_OctetTo16, (char *)isdp_aid, sizeof(isdp_aid));
+		info->profileState = CALLOC(1, sizeof(*info->profileState));
+		assert(info->profileState);
+		*info->profileState = i == 0 ? ProfileState_enabled : ProfileState_disabled;
+		snprintf(name, sizeof(name), "Profile %u", i);
+		info->profileNickname = OCTET_STRING_new_fromBuf(&asn_DEF_UTF8String, name, -1);
+		info->serviceProviderName = OCTET_STRING_new_fromBuf(&asn_DEF_UTF8String, "Test Operator", -1);
+		info->profileName = OCTET_STRING_new_fromBuf(&asn_DEF_UTF8String, name, -1);
+		info->profileClass = CALLOC(1, sizeof(*info->profileClass));
+		assert(info->profileClass);
+		*info->profileClass = ProfileClass_operational;
+		assert(ASN_SEQUENCE_ADD(&res.choice.profileInfoListOk.list, info) == 0);
+	}
+
+	rc = der_encode(&asn_DEF_ProfileInfoListResponse, &res, ipa_asn1c_consume_bytes_cb, &encoded);
+	assert(rc.encoded > 0);
+	ASN_STRUCT_RESET(asn_DEF_ProfileInfoListResponse, &res);
+
+	return encoded;
+}
+
+/* Let the emulated eUICC respond with the given data and decode the response while it is received, returns true
+ * when the response was decoded and matches the expected response */
+static bool transceive_res_dec(struct ipa_context *ctx, const struct ipa_buf *res, const struct ipa_buf *expected)
+{
+	IPA_BUF_STATIC(req, sizeof(get_prfle_info_req));
+	struct ProfileInfoListResponse *decoded;
+	struct ipa_buf *encoded = NULL;
+	asn_enc_rval_t rc;
+	bool match;
+
+	memcpy(req.data, get_prfle_info_req, sizeof(get_prfle_info_req));
+	req.len = sizeof(get_prfle_info_req);
+	card.res = res;
+
+	decoded = ipa_es10x_transceive_res_dec(ctx, &asn_DEF_ProfileInfoListResponse, &req, "GetProfilesInfo");
+	if (!decoded)
+		return false;
+
+	/* The response was DER encoded, so encoding the decoded response again must yield the same bytes */
+	rc = der_encode(&asn_DEF_ProfileInfoListResponse, decoded, ipa_asn1c_consume_bytes_cb, &encoded);
+	assert(rc.encoded > 0);
+	match = encoded->len == expected->len && memcmp(encoded->data, expected->data, expected->len) == 0;
+
+	IPA_FREE(encoded);
+	ASN_STRUCT_FREE(asn_DEF_ProfileInfoListResponse, decoded);
+	return match;
+}
+
+int main(int argc, char **argv)
+{
+	struct ipa_config cfg = { 0 };
+	struct ipa_context *ctx;
+	struct ipa_buf *nvstate;
+	struct ipa_buf *res;
+	struct ipa_buf *res_excess;
+	struct ipa_buf res_truncated;
+	unsigned int i;
+	int rc;
+
+	res = profile_info_list(8);
+	printf("response: %zu bytes\n", res->len);
+
+	/* Only the errors are of interest, the log of the successful runs would be huge */
+	ipa_log_mask = 0;
+
+	ctx = ipa_new_ctx(&cfg, NULL);
+	ctx->scard_ctx = &card;
+	rc = ipa_euicc_init_es10x(ctx);
+	assert(rc == 0);
+
+	/* The decoder must cope with blocks that end at any position within the message */
+	card.block_len = 1;
+	assert(transceive_res_dec(ctx, res, res));
+	printf("one byte per block: decoded\n");
+
+	card.block_len = 0;
+	card.seed = 1;
+	for (i = 0; i < 100; i++)
+		assert(transceive_res_dec(ctx, res, res));
+	printf("random block lengths: decoded\n");
+
+	ipa_log_mask = 1 << SES10X;
+
+	/* Data that follows the message must be rejected, no matter whether it is received in the same block as the
+	 * end of the message or in a separate block. */
+	res_excess = ipa_buf_alloc(res->len + 2);
+	memcpy(res_excess->data, res->data, res->len);
+	memset(res_excess->data + res->len, 0, 2);
+	res_excess->len = res->len + 2;
+
+	card.block_len = 256;
+	if (!transceive_res_dec(ctx, res_excess, res))
+		printf("excess data in the last block: rejected\n");
+
+	card.split = res->len;
+	if (!transceive_res_dec(ctx, res_excess, res))
+		printf("excess data in a separate block: rejected\n");
+	card.split = 0;
+
+	/* A response that ends before the message is complete must be rejected as well */
+	res_truncated = *res;
+	res_truncated.len = res->len - 1;
+	card.block_len = 0;
+	if (!transceive_res_dec(ctx, &res_truncated, res))
+		printf("truncated response: rejected\n");
+
+	ipa_log_mask = 0;
+	IPA_FREE(res_excess);
+	IPA_FREE(res);
+	nvstate = ipa_free_ctx(ctx);
+	IPA_FREE(nvstate);
+	return 0;
+}
+
+/* Stubs */
+void *ipa_http_init(const char *cabundle, bool no_verif)
+{
+	static int http_ctx;
+	return &http_ctx;
+}
+
+struct ipa_buf *ipa_http_req(void *http_ctx, const struct ipa_buf *req, const char *url)
+{
+	return NULL;
+}
+
+struct ipa_buf *ipa_http_req_timeout(void *http_ctx, const struct ipa_buf *req, const char *url, unsigned int timeout)
+{
+	return ipa_http_req(http_ctx, req, url);
+}
+
+int ipa_http_req_stream(void *http_ctx, const struct ipa_buf *req, const char *url, ipa_http_res_cb res_cb,
+			void *priv)
+{
+	return -1;
+}
+
+void ipa_http_recycle(void *http_ctx, struct ipa_buf *buf)
+{
+	IPA_FREE(buf);
+}
+
+void ipa_http_close(void *http_ctx)
+{
+	return;
+}
+
+struct ipa_buf *ipa_http_export_session(void *http_ctx)
+{
+	return NULL;
+}
+
+int ipa_http_import_session(void *http_ctx, const struct ipa_buf *session)
+{
+	return 0;
+}
+
+void ipa_http_free(void *http_ctx)
+{
+	return;
+}
+
+void *ipa_scard_init(unsigned int reader_num)
+{
+	return NULL;
+}
+
+int ipa_scard_reset(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_atr(void *scard_ctx, struct ipa_buf *atr)
+{
+	return -1;
+}
+
+int ipa_scard_protocol(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_transceive(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req)
+{
+	return -1;
+}
+
+int ipa_scard_transceive_v(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req_iov,
+			   unsigned int req_iov_count)
+{
+	const uint8_t *hdr = req_iov[0].data;
+	size_t le;
+	uint16_t sw;
+
+	assert(req_iov[0].len >= 5);
+	res->len = 0;
+
+	switch (hdr[1]) {
+	case 0xE2:
+		/* STORE DATA, the response is announced with the last block */
+		if (hdr[2] == 0x91) {
+			card.offset = 0;
+			sw = card_next_block();
+		} else
+			sw = 0x9000;
+		break;
+	case 0xC0:
+		/* GET RESPONSE, the requested length must match the announced length */
+		le = hdr[4] ? hdr[4] : 256;
+		assert(le == card.next_block_len);
+		memcpy(res->data, card.res->data + card.offset, le);
+		res->len = le;
+		card.offset += le;
+		sw = card_next_block();
+		break;
+	case 0xA4:
+		/* SELECT */
+		sw = 0x6120;
+		break;
+	default:
+		sw = 0x9000;
+		break;
+	}
+
+	res->data[res->len++] = sw >> 8;
+	res->data[res->len++] = sw & 0xff;
+	return 0;
+}
+
+int ipa_scard_begin_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_end_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_free(void *scard_ctx)
+{
+	return 0;
+}
@@ -0,0 +1,289 @@
+/*
+ * Author: Philipp Maier <pmaier@sysmocom.de> / sysmocom - s.f.m.c. GmbH
+ *
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <onomondo/ipa/utils.h>
+#include <onomondo/ipa/http.h>
+#include <onomondo/ipa/ipad.h>
+#include <asn_application.h>
+#include <EsipaMessageFromIpaToEim.h>
+#include <EsipaMessageFromEimToIpa.h>
+#include <ProfileInstallationResult.h>
+#include <AuthenticateServerResponse.h>
+#include "src/ipa/libipa/utils.h"
+#include "src/ipa/libipa/context.h"
+#include "src/ipa/libipa/esipa_init_auth.h"
+#include "src/ipa/libipa/esipa_auth_clnt.h"
+#include "src/ipa/libipa/esipa_get_bnd_prfle_pkg.h"
+#include "src/ipa/libipa/esipa_handle_notif.h"
+
+/* number of bytes of the last request that was sent to the eIM (see ipa_http_req stub below) */
+static size_t req_bytes;
+
+/* response the eIM sends (see ipa_http_req stub below), NULL for an empty response */
+static const struct ipa_buf *eim_res;
+
+/* Responses from the eUICC that an indirect profile download passes on to the eIM */
+struct test_vectors {
+	struct EUICCInfo1 *euicc_info_1;
+	struct AuthenticateServerResponse *auth_serv_res;
+	struct PrepareDownloadResponse *prep_dwnld_res;
+	struct ProfileInstallationResult *prfle_inst_res;
+};
+
+static void *load_test_vector(const char *dir, const char *name, asn_TYPE_descriptor_t *td)
+{
+	char path[1024];
+	uint8_t ber[4096];
+	FILE *ber_file = NULL;
+	size_t ber_len;
+	asn_dec_rval_t rc;
+	void *decoded = NULL;
+
+	snprintf(path, sizeof(path), "%s/%s", dir, name);
+	ber_file = fopen(path, "r");
+	assert(ber_file);
+	ber_len = fread(&ber, sizeof(char), sizeof(ber), ber_file);
+	fclose(ber_file);
+
+	rc = ber_decode(0, td, &decoded, ber, ber_len);
+	assert(rc.code == RC_OK);
+	return decoded;
+}
+
+/* Run the ESipa functions of an indirect profile download (SGP.32, section 3.2.3.2) and count the bytes that are sent
+ * to the eIM */
+static size_t prfle_dwnld_test(struct test_vectors *vectors, bool minimize_bytes, bool eim_knows)
+{
+	struct ipa_config cfg = { 0 };
+	struct ipa_context *ctx;
+	struct ipa_buf *nvstate;
+	uint8_t euicc_challenge[IPA_LEN_EUICC_CHLG] = { 0 };
+	struct ipa_esipa_init_auth_req init_auth_req = { 0 };
+	struct ipa_esipa_auth_clnt_req auth_clnt_req = { 0 };
+	struct ipa_esipa_get_bnd_prfle_pkg_req get_bnd_prfle_pkg_req = { 0 };
+	struct ipa_esipa_handle_notif_req handle_notif_req = { 0 };
+	size_t total = 0;
+
+	printf("minimize_bytes: %u, eim_knows: %u\n", minimize_bytes, eim_knows);
+
+	cfg.esipa_minimize_bytes = minimize_bytes;
+	ctx = ipa_new_ctx(&cfg, NULL);
+	ctx->eim_fqdn = IPA_ALLOC_N(strlen("eim.example.com") + 1);
+	strcpy(ctx->eim_fqdn, "eim.example.com");
+	ctx->eim_knows.euicc_info_1 = eim_knows;
+	ctx->eim_knows.certs = eim_knows;
+
+	init_auth_req.euicc_challenge = euicc_challenge;
+	init_auth_req.smdp_addr = "smdp.example.com";
+	init_auth_req.euicc_info_1 = vectors->euicc_info_1;
+	ipa_esipa_init_auth_res_free(ipa_esipa_init_auth(ctx, &init_auth_req));
+	printf(" InitiateAuthentication: %zu bytes\n", req_bytes);
+	total += req_bytes;
+
+	auth_clnt_req.req.transactionId =
+	    vectors->auth_serv_res->choice.authenticateResponseOk.euiccSigned1.transactionId;
+	auth_clnt_req.req.authenticateServerResponse.present = SGP32_AuthenticateServerResponse_PR_authenticateResponseOk;
+	auth_clnt_req.req.authenticateServerResponse.choice.authenticateResponseOk =
+	    vectors->auth_serv_res->choice.authenticateResponseOk;
+	ipa_esipa_auth_clnt_res_free(ipa_esipa_auth_clnt(ctx, &auth_clnt_req));
+	printf(" AuthenticateClient: %zu bytes\n", req_bytes);
+	total += req_bytes;
+
+	get_bnd_prfle_pkg_req.prep_dwnld_res = vectors->prep_dwnld_res;
+	ipa_esipa_get_bnd_prfle_pkg_res_free(ipa_esipa_get_bnd_prfle_pkg(ctx, &get_bnd_prfle_pkg_req));
+	printf(" GetBoundProfilePackage: %zu bytes\n", req_bytes);
+	total += req_bytes;
+
+	handle_notif_req.profile_installation_result = vectors->prfle_inst_res;
+	assert(ipa_esipa_handle_notif(ctx, &handle_notif_req) == 0);
+	printf(" HandleNotification: %zu bytes\n", req_bytes);
+	total += req_bytes;
+
+	printf(" total: %zu bytes\n", total);
+
+	nvstate = ipa_free_ctx(ctx);
+	IPA_FREE(nvstate);
+	return total;
+}
+
+static void eim_error_test(void)
+{
+	struct ipa_config cfg = { 0 };
+	struct ipa_context *ctx;
+	struct ipa_buf *nvstate;
+	uint8_t euicc_challenge[IPA_LEN_EUICC_CHLG] = { 0 };
+	struct ipa_esipa_init_auth_req init_auth_req = { 0 };
+	struct ipa_esipa_init_auth_res *init_auth_res;
+	struct EsipaMessageFromEimToIpa msg_to_ipa = { 0 };
+	struct ipa_buf *msg_encoded = NULL;
+	asn_enc_rval_t enc_rc;
+
+	/* An eIM that responds with an error receives euiccInfo1 and the certificates again */
+	printf("eIM responds with an error:\n");
+	msg_to_ipa.present = EsipaMessageFromEimToIpa_PR_initiateAuthenticationResponseEsipa;
+	msg_to_ipa.choice.initiateAuthenticationResponseEsipa.present =
+	    InitiateAuthenticationResponseEsipa_PR_initiateAuthenticationErrorEsipa;
+	msg_to_ipa.choice.initiateAuthenticationResponseEsipa.choice.initiateAuthenticationErrorEsipa =
+	    InitiateAuthenticationResponseEsipa__initiateAuthenticationErrorEsipa_invalidDpAddress;
+	enc_rc = der_encode(&asn_DEF_EsipaMessageFromEimToIpa, &msg_to_ipa, ipa_asn1c_consume_bytes_cb, &msg_encoded);
+	assert(enc_rc.encoded > 0);
+
+	cfg.esipa_minimize_bytes = true;
+	ctx = ipa_new_ctx(&cfg, NULL);
+	ctx->eim_fqdn = IPA_ALLOC_N(strlen("eim.example.com") + 1);
+	strcpy(ctx->eim_fqdn, "eim.example.com");
+	ctx->eim_knows.euicc_info_1 = true;
+	ctx->eim_knows.certs = true;
+
+	init_auth_req.euicc_challenge = euicc_challenge;
+	init_auth_req.smdp_addr = "smdp.example.com";
+	eim_res = msg_encoded;
+	init_auth_res = ipa_esipa_init_auth(ctx, &init_auth_req);
+	eim_res = NULL;
+	assert(init_auth_res && init_auth_res->init_auth_err);
+	ipa_esipa_init_auth_res_free(init_auth_res);
+	printf(" eIM knows euiccInfo1: %u, certificates: %u\n", ctx->eim_knows.euicc_info_1, ctx->eim_knows.certs);
+
+	IPA_FREE(msg_encoded);
+	nvstate = ipa_free_ctx(ctx);
+	IPA_FREE(nvstate);
+}
+
+int main(int argc, char **argv)
+{
+	struct test_vectors vectors;
+	size_t full;
+	size_t compact;
+
+	vectors.euicc_info_1 = load_test_vector(argv[1], "euicc_info1.ber", &asn_DEF_EUICCInfo1);
+	vectors.auth_serv_res = load_test_vector(argv[1], "auth_serv_res.ber", &asn_DEF_AuthenticateServerResponse);
+	vectors.prep_dwnld_res = load_test_vector(argv[1], "prep_dwnld_res.ber", &asn_DEF_PrepareDownloadResponse);
+	vectors.prfle_inst_res = load_test_vector(argv[1], "prfle_inst_res.ber", &asn_DEF_ProfileInstallationResult);
+
+	/* Compare the full format with the compact format, first with an eIM that has not seen the eUICC before and
+	 * then with an eIM that has already received euiccInfo1 and the certificates. */
+	full = prfle_dwnld_test(&vectors, false, false);
+	compact = prfle_dwnld_test(&vectors, true, false);
+	printf("saved: %zu bytes\n", full - compact);
+	compact = prfle_dwnld_test(&vectors, true, true);
+	printf("saved: %zu bytes\n", full - compact);
+	eim_error_test();
+
+	ASN_STRUCT_FREE(asn_DEF_EUICCInfo1, vectors.euicc_info_1);
+	ASN_STRUCT_FREE(asn_DEF_AuthenticateServerResponse, vectors.auth_serv_res);
+	ASN_STRUCT_FREE(asn_DEF_PrepareDownloadResponse, vectors.prep_dwnld_res);
+	ASN_STRUCT_FREE(asn_DEF_ProfileInstallationResult, vectors.prfle_inst_res);
+	return 0;
+}
+
+/* Stubs */
+void *ipa_http_init(const char *cabundle, bool no_verif)
+{
+	static int http_ctx;
+	return &http_ctx;
+}
+
+struct ipa_buf *ipa_http_req(void *http_ctx, const struct ipa_buf *req, const char *url)
+{
+	asn_dec_rval_t rc;
+	struct EsipaMessageFromIpaToEim *msg_to_eim = NULL;
+
+	/* Make sure that the request is a valid ESipa message and count its bytes */
+	rc = ber_decode(0, &asn_DEF_EsipaMessageFromIpaToEim, (void **)&msg_to_eim, req->data, req->len);
+	assert(rc.code == RC_OK);
+	assert(rc.consumed == req->len);
+	ASN_STRUCT_FREE(asn_DEF_EsipaMessageFromIpaToEim, msg_to_eim);
+	req_bytes = req->len;
+
+	/* An empty response is sufficient, we are only interested in the requests */
+	if (eim_res)
+		return ipa_buf_alloc_data(eim_res->len, eim_res->data);
+	return ipa_buf_alloc(0);
+}
+
+struct ipa_buf *ipa_http_req_timeout(void *http_ctx, const struct ipa_buf *req, const char *url, unsigned int timeout)
+{
+	return ipa_http_req(http_ctx, req, url);
+}
+
+int ipa_http_req_stream(void *http_ctx, const struct ipa_buf *req, const char *url, ipa_http_res_cb res_cb,
+			void *priv)
+{
+	return -1;
+}
+
+void ipa_http_recycle(void *http_ctx, struct ipa_buf *buf)
+{
+	IPA_FREE(buf);
+}
+
+void ipa_http_close(void *http_ctx)
+{
+	return;
+}
+
+struct ipa_buf *ipa_http_export_session(void *http_ctx)
+{
+	return NULL;
+}
+
+int ipa_http_import_session(void *http_ctx, const struct ipa_buf *session)
+{
+	return 0;
+}
+
+void ipa_http_free(void *http_ctx)
+{
+	return;
+}
+
+void *ipa_scard_init(unsigned int reader_num)
+{
+	return NULL;
+}
+
+int ipa_scard_reset(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_atr(void *scard_ctx, struct ipa_buf *atr)
+{
+	return 0;
+}
+
+int ipa_scard_protocol(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_transceive(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req)
+{
+	return 0;
+}
+
+int ipa_scard_transceive_v(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req_iov,
+			   unsigned int req_iov_count)
+{
+	return 0;
+}
+
+int ipa_scard_begin_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_end_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_free(void *scard_ctx)
+{
+	return 0;
+}
@@ -0,0 +1,260 @@
+/*
+ * Author: Philipp Maier <pmaier@sysmocom.de> / sysmocom - s.f.m.c. GmbH
+ *
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#include <limits.h>
+#include <onomondo/ipa/utils.h>
+#include <onomondo/ipa/http.h>
+#include <onomondo/ipa/ipad.h>
+#include "src/ipa/libipa/utils.h"
+#include "src/ipa/libipa/context.h"
+#include "src/ipa/libipa/esipa.h"
+#include "src/ipa/libipa/esipa_get_eim_pkg.h"
+#include "src/ipa/libipa/proc_eim_pkg_retr.h"
+
+/* behaviour of the ipa_http_req stub below */
+static bool http_fail;
+static unsigned int http_reqs;
+
+void backoff_test(void)
+{
+	unsigned int seed = 1;
+	unsigned int count;
+	unsigned int upper;
+	unsigned int min;
+	unsigned int max;
+	unsigned int delay;
+	unsigned int i;
+
+	/* The delay starts at one second and doubles with each retry until it reaches one minute. The jitter takes
+	 * away up to half of the delay. */
+	printf("backoff delays\n");
+	for (count = 0; count < 10; count++) {
+		upper = count < 6 ? 1000 << count : 60000;
+		min = UINT_MAX;
+		max = 0;
+		for (i = 0; i < 10000; i++) {
+			delay = ipa_esipa_retry_backoff(count, &seed);
+			if (delay < min)
+				min = delay;
+			if (delay > max)
+				max = delay;
+		}
+		/* All delays must be in range and the jitter must cover most of the range */
+		assert(min >= upper / 2 && max <= upper);
+		assert(max - min > upper / 2 * 9 / 10);
+		printf(" retry %u: within %u..%u ms\n", count, upper / 2, upper);
+	}
+
+	/* No overflow for large retry counts */
+	delay = ipa_esipa_retry_backoff(UINT_MAX, &seed);
+	assert(delay >= 30000 && delay <= 60000);
+	printf(" retry %u: within 30000..60000 ms\n", UINT_MAX);
+}
+
+void gating_test(void)
+{
+	struct ipa_config cfg = { 0 };
+	struct ipa_context *ctx;
+	struct ipa_buf *nvstate;
+	struct ipa_buf *req = ipa_buf_alloc(0);
+	struct ipa_buf *res;
+
+	printf("retry gating\n");
+	cfg.esipa_req_retries = 3;
+	ctx = ipa_new_ctx(&cfg, NULL);
+	ctx->eim_fqdn = IPA_ALLOC_N(strlen("eim.example.com") + 1);
+	strcpy(ctx->eim_fqdn, "eim.example.com");
+	ctx->esipa_retry.seed = 1;
+
+	/* A failed request schedules a retry */
+	http_fail = true;
+	assert(ipa_esipa_req(ctx, req, "GetEimPackage") == NULL);
+	printf(" GetEimPackage failed, retry pending: %u, requests: %u\n", ipa_esipa_retry_pending(ctx), http_reqs);
+
+	/* The failed function is held back until the retry is due */
+	http_fail = false;
+	assert(ipa_esipa_req(ctx, req, "GetEimPackage") == NULL);
+	printf(" GetEimPackage deferred, requests: %u\n", http_reqs);
+
+	/* Other functions are still sent, the scheduled retry stays in place */
+	res = ipa_esipa_req(ctx, req, "CancelSession");
+	assert(res);
+	ipa_esipa_res_free(ctx, res);
+	printf(" CancelSession sent, retry pending: %u, requests: %u\n", ipa_esipa_retry_pending(ctx), http_reqs);
+
+	http_fail = true;
+	assert(ipa_esipa_req(ctx, req, "HandleNotification") == NULL);
+	printf(" HandleNotification failed, retry of %s pending, retries: %u, requests: %u\n",
+	       ctx->esipa_retry.function_name, ctx->esipa_retry.count, http_reqs);
+
+	/* A successful retry of the failed function resets the scheduler */
+	http_fail = false;
+	ctx->esipa_retry.deadline = 0;
+	res = ipa_esipa_req(ctx, req, "GetEimPackage");
+	assert(res);
+	ipa_esipa_res_free(ctx, res);
+	printf(" GetEimPackage retried, retry pending: %u, requests: %u\n", ipa_esipa_retry_pending(ctx), http_reqs);
+
+	IPA_FREE(req);
+	nvstate = ipa_free_ctx(ctx);
+	IPA_FREE(nvstate);
+}
+
+void cancel_test(void)
+{
+	struct ipa_config cfg = { 0 };
+	struct ipa_context *ctx;
+	struct ipa_buf *nvstate;
+	struct ipa_buf *req = ipa_buf_alloc(0);
+	struct ipa_buf *res;
+	struct ipa_esipa_get_eim_pkg_res *eim_pkg;
+	int rc;
+
+	printf("retry of a canceled procedure\n");
+	cfg.esipa_req_retries = 3;
+	ctx = ipa_new_ctx(&cfg, NULL);
+	ctx->eim_fqdn = IPA_ALLOC_N(strlen("eim.example.com") + 1);
+	strcpy(ctx->eim_fqdn, "eim.example.com");
+	ctx->esipa_retry.seed = 1;
+
+	/* The profile download fails, the indirect profile download procedure cancels the session and gives up */
+	http_fail = true;
+	assert(ipa_esipa_req(ctx, req, "GetBoundProfilePackage") == NULL);
+	http_fail = false;
+	res = ipa_esipa_req(ctx, req, "CancelSession");
+	assert(res);
+	ipa_esipa_res_free(ctx, res);
+	printf(" GetBoundProfilePackage failed, CancelSession sent, retry of %s pending\n",
+	       ctx->esipa_retry.function_name);
+
+	/* The eIM package that contained the profile download trigger is not resumed (here, because it lacks the
+	 * ProfileDownloadData), so the retry must not stay in place, otherwise ipa_poll would return IPA_POLL_RETRY
+	 * forever */
+	eim_pkg = IPA_ALLOC_ZERO(struct ipa_esipa_get_eim_pkg_res);
+	eim_pkg->msg_to_ipa = IPA_ALLOC_ZERO(struct EsipaMessageFromEimToIpa);
+	eim_pkg->msg_to_ipa->present = EsipaMessageFromEimToIpa_PR_getEimPackageResponse;
+	eim_pkg->msg_to_ipa->choice.getEimPackageResponse.present =
+	    GetEimPackageResponse_PR_profileDownloadTriggerRequest;
+	eim_pkg->dwnld_trigger_request =
+	    &eim_pkg->msg_to_ipa->choice.getEimPackageResponse.choice.profileDownloadTriggerRequest;
+	ctx->eim_pkg_pending = eim_pkg;
+	rc = ipa_proc_eim_pkg_retr(ctx);
+	printf(" eIM package execution ended, rc: %d, retry pending: %u, poll delay: %u\n", rc,
+	       ipa_esipa_retry_pending(ctx), ipa_poll_delay(ctx));
+	assert(!ipa_esipa_retry_pending(ctx));
+
+	IPA_FREE(req);
+	nvstate = ipa_free_ctx(ctx);
+	IPA_FREE(nvstate);
+}
+
+int main(int argc, char **argv)
+{
+	backoff_test();
+	gating_test();
+	cancel_test();
+	return 0;
+}
+
+/* Stubs */
+void *ipa_http_init(const char *cabundle, bool no_verif)
+{
+	static int http_ctx;
+	return &http_ctx;
+}
+
+struct ipa_buf *ipa_http_req(void *http_ctx, const struct ipa_buf *req, const char *url)
+{
+	http_reqs++;
+	if (http_fail)
+		return NULL;
+	return ipa_buf_alloc(0);
+}
+
+struct ipa_buf *ipa_http_req_timeout(void *http_ctx, const struct ipa_buf *req, const char *url, unsigned int timeout)
+{
+	return ipa_http_req(http_ctx, req, url);
+}
+
+int ipa_http_req_stream(void *http_ctx, const struct ipa_buf *req, const char *url, ipa_http_res_cb res_cb,
+			void *priv)
+{
+	return -1;
+}
+
+void ipa_http_recycle(void *http_ctx, struct ipa_buf *buf)
+{
+	IPA_FREE(buf);
+}
+
+void ipa_http_close(void *http_ctx)
+{
+	return;
+}
+
+struct ipa_buf *ipa_http_export_session(void *http_ctx)
+{
+	return NULL;
+}
+
+int ipa_http_import_session(void *http_ctx, const struct ipa_buf *session)
+{
+	return 0;
+}
+
+void ipa_http_free(void *http_ctx)
+{
+	return;
+}
+
+void *ipa_scard_init(unsigned int reader_num)
+{
+	return NULL;
+}
+
+int ipa_scard_reset(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_atr(void *scard_ctx, struct ipa_buf *atr)
+{
+	return 0;
+}
+
+int ipa_scard_protocol(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_transceive(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req)
+{
+	return 0;
+}
+
+int ipa_scard_transceive_v(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req_iov,
+			   unsigned int req_iov_count)
+{
+	return 0;
+}
+
+int ipa_scard_begin_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_end_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_free(void *scard_ctx)
+{
+	return 0;
+}
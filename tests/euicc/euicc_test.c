@@ -0,0 +1,450 @@
+/*
+ * Author: Philipp Maier <pmaier@sysmocom.de> / sysmocom - s.f.m.c. GmbH
+ *
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#include <onomondo/ipa/utils.h>
+#include <onomondo/ipa/http.h>
+#include <onomondo/ipa/ipad.h>
+#include <onomondo/ipa/log.h>
+#include "src/ipa/libipa/utils.h"
+#include "src/ipa/libipa/context.h"
+#include "src/ipa/libipa/euicc.h"
+
+extern uint32_t ipa_log_mask;
+
+/* Emulated eUICC (see ipa_scard_* stubs below) */
+static struct {
+	const uint8_t *atr;
+	size_t atr_len;
+	int protocol;
+	/* status word to answer extended length APDUs with (0 = accept them) */
+	uint16_t ext_sw;
+	/* fail to transmit extended length APDUs */
+	bool ext_fail;
+	/* print the APDUs that are sent */
+	bool trace;
+	size_t res_offset;
+} card;
+
+/* Response of the emulated eUICC to each ES10x request */
+static const uint8_t es10x_res[] = { 0xBF, 0x2D, 0x03, 0xA0, 0x01, 0x00 };
+
+/* A request with the given length (the content does not matter for the emulated eUICC) */
+static struct ipa_buf *es10x_req(size_t len)
+{
+	struct ipa_buf *req = ipa_buf_alloc(len);
+
+	memset(req->data, 0xAA, len);
+	req->len = len;
+	return req;
+}
+
+static struct ipa_context *init(struct ipa_config *cfg, const uint8_t *atr, size_t atr_len, int protocol)
+{
+	struct ipa_context *ctx;
+	int rc;
+
+	card.atr = atr;
+	card.atr_len = atr_len;
+	card.protocol = protocol;
+	card.ext_sw = 0;
+	card.ext_fail = false;
+
+	ctx = ipa_new_ctx(cfg, NULL);
+	ctx->scard_ctx = &card;
+	rc = ipa_euicc_init_es10x(ctx);
+	assert(rc == 0);
+	return ctx;
+}
+
+static void cleanup(struct ipa_context *ctx)
+{
+	struct ipa_buf *nvstate;
+
+	nvstate = ipa_free_ctx(ctx);
+	IPA_FREE(nvstate);
+}
+
+/* Check which ATRs announce support for extended length APDUs (see also atr_ext_apdu_supported) */
+static void atr_test(void)
+{
+	struct ipa_config cfg = { 0 };
+	struct ipa_context *ctx;
+	unsigned int i;
+
+	/* TS, T0, interface bytes (TA1, TD1, TD2, TA3), historical bytes (category '80', compact-TLV), TCK */
+	const uint8_t atr_ext[] = { 0x3B, 0x9F, 0x96, 0x80, 0x1F, 0xC7, 0x80, 0x31, 0xE0, 0x73, 0xFE, 0x21, 0x5B, 0x63,
+		0x3A, 0x20, 0x4E, 0x83, 0x00, 0x90, 0x00, 0x2B
+	};
+	const uint8_t atr_no_ext[] = { 0x3B, 0x9F, 0x96, 0x80, 0x1F, 0xC7, 0x80, 0x31, 0xE0, 0x73, 0xFE, 0x21, 0x1B, 0x63,
+		0x3A, 0x20, 0x4E, 0x83, 0x00, 0x90, 0x00, 0x6B
+	};
+	/* Historical bytes with category '00', the last three bytes are the status indicator */
+	const uint8_t atr_cat00_ext[] = { 0x3B, 0x88, 0x80, 0x01, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00, 0x90, 0x00, 0x00 };
+	/* Unsupported category */
+	const uint8_t atr_cat10[] = { 0x3B, 0x85, 0x80, 0x01, 0x10, 0x73, 0x00, 0x00, 0x40, 0x00 };
+	/* No card capabilities */
+	const uint8_t atr_no_caps[] = { 0x3B, 0x83, 0x80, 0x01, 0x80, 0x31, 0xE0, 0x00 };
+	/* The card capabilities exceed the historical bytes */
+	const uint8_t atr_truncated[] = { 0x3B, 0x83, 0x80, 0x01, 0x80, 0x73, 0x00, 0x00, 0x40, 0x00 };
+	/* No historical bytes */
+	const uint8_t atr_no_hist[] = { 0x3B, 0x00 };
+	const struct {
+		const char *name;
+		const uint8_t *atr;
+		size_t atr_len;
+	} atrs[] = {
+		{ "extended length", atr_ext, sizeof(atr_ext) },
+		{ "no extended length", atr_no_ext, sizeof(atr_no_ext) },
+		{ "category 00, extended length", atr_cat00_ext, sizeof(atr_cat00_ext) },
+		{ "category 10", atr_cat10, sizeof(atr_cat10) },
+		{ "no card capabilities", atr_no_caps, sizeof(atr_no_caps) },
+		{ "truncated card capabilities", atr_truncated, sizeof(atr_truncated) },
+		{ "no historical bytes", atr_no_hist, sizeof(atr_no_hist) },
+		{ "no ATR", NULL, 0 },
+	};
+
+	printf("ATR negotiation:\n");
+	for (i = 0; i < IPA_ARRAY_SIZE(atrs); i++) {
+		ctx = init(&cfg, atrs[i].atr, atrs[i].atr_len, 0);
+		printf(" %s: extended length APDUs: %u\n", atrs[i].name, ctx->euicc.ext_apdu);
+		cleanup(ctx);
+	}
+
+	cfg.euicc_disable_ext_apdu = true;
+	ctx = init(&cfg, atr_ext, sizeof(atr_ext), 0);
+	printf(" extended length, disabled by configuration: extended length APDUs: %u\n", ctx->euicc.ext_apdu);
+	cleanup(ctx);
+}
+
+/* Check the encoding of the APDUs (see also format_req_apdu) */
+static void apdu_test(void)
+{
+	struct ipa_config cfg = { 0 };
+	struct ipa_context *ctx;
+	struct ipa_buf *req;
+	struct ipa_buf *res;
+	unsigned int i;
+	const uint8_t atr_ext[] = { 0x3B, 0x88, 0x80, 0x01, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00, 0x90, 0x00, 0x00 };
+	const uint8_t atr_short[] = { 0x3B, 0x00 };
+	const struct {
+		const char *name;
+		const uint8_t *atr;
+		size_t atr_len;
+		int protocol;
+	} modes[] = {
+		{ "short, T=0", atr_short, sizeof(atr_short), 0 },
+		{ "short, T=1", atr_short, sizeof(atr_short), 1 },
+		{ "extended length, T=0", atr_ext, sizeof(atr_ext), 0 },
+		{ "extended length, T=1", atr_ext, sizeof(atr_ext), 1 },
+	};
+
+	req = es10x_req(300);
+	for (i = 0; i < IPA_ARRAY_SIZE(modes); i++) {
+		printf("APDUs (%s):\n", modes[i].name);
+		ctx = init(&cfg, modes[i].atr, modes[i].atr_len, modes[i].protocol);
+		card.trace = true;
+		res = ipa_euicc_transceive_es10x(ctx, req);
+		card.trace = false;
+		assert(res);
+		assert(res->len == sizeof(es10x_res) && memcmp(res->data, es10x_res, sizeof(es10x_res)) == 0);
+		IPA_FREE(res);
+		cleanup(ctx);
+	}
+	IPA_FREE(req);
+}
+
+/* Check under which conditions the IPAd falls back from extended length to short APDUs */
+static void fallback_test(void)
+{
+	struct ipa_config cfg = { 0 };
+	struct ipa_context *ctx;
+	struct ipa_buf *req;
+	struct ipa_buf *res;
+	const uint8_t atr_ext[] = { 0x3B, 0x88, 0x80, 0x01, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00, 0x90, 0x00, 0x00 };
+
+	req = es10x_req(300);
+
+	/* The eUICC rejects the extended length APDU with a status word */
+	printf("extended length APDU rejected with sw=6700:\n");
+	ctx = init(&cfg, atr_ext, sizeof(atr_ext), 0);
+	card.ext_sw = 0x6700;
+	card.trace = true;
+	res = ipa_euicc_transceive_es10x(ctx, req);
+	card.trace = false;
+	printf(" response: %s, extended length APDUs: %u, check_scard: %u\n", res ? "ok" : "none", ctx->euicc.ext_apdu,
+	       ctx->check_scard);
+	IPA_FREE(res);
+	cleanup(ctx);
+
+	/* A transport error says nothing about the capabilities of the eUICC */
+	printf("extended length APDU fails with transport error:\n");
+	ctx = init(&cfg, atr_ext, sizeof(atr_ext), 0);
+	card.ext_fail = true;
+	card.trace = true;
+	res = ipa_euicc_transceive_es10x(ctx, req);
+	card.trace = false;
+	printf(" response: %s, extended length APDUs: %u, check_scard: %u\n", res ? "ok" : "none", ctx->euicc.ext_apdu,
+	       ctx->check_scard);
+	IPA_FREE(res);
+	cleanup(ctx);
+
+	IPA_FREE(req);
+}
+
+/* Check that a request that requires more than 256 STORE DATA blocks is refused */
+static void block_limit_test(void)
+{
+	struct ipa_config cfg = { 0 };
+	struct ipa_context *ctx;
+	struct ipa_buf *req;
+	struct ipa_buf *res;
+	const uint8_t atr_short[] = { 0x3B, 0x00 };
+
+	printf("block limit:\n");
+	ctx = init(&cfg, atr_short, sizeof(atr_short), 0);
+
+	/* The log of 256 blocks would be huge */
+	ipa_log_mask = 0;
+	req = es10x_req(256 * 255);
+	res = ipa_euicc_transceive_es10x(ctx, req);
+	printf(" 256 blocks: %s\n", res ? "ok" : "none");
+	IPA_FREE(res);
+	IPA_FREE(req);
+	ipa_log_mask = 0xffffffff;
+
+	req = es10x_req(256 * 255 + 1);
+	res = ipa_euicc_transceive_es10x(ctx, req);
+	printf(" 257 blocks: %s\n", res ? "ok" : "none");
+	IPA_FREE(res);
+	IPA_FREE(req);
+
+	cleanup(ctx);
+}
+
+/* Check that the block limit applies again when the IPAd falls back from extended length to short APDUs: A request
+ * that fits into a single extended length APDU may require more than 256 short STORE DATA blocks. */
+static void fallback_block_limit_test(void)
+{
+	struct ipa_config cfg = { 0 };
+	struct ipa_context *ctx;
+	struct ipa_buf *req;
+	struct ipa_buf *res;
+	const uint8_t atr_ext[] = { 0x3B, 0x88, 0x80, 0x01, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00, 0x90, 0x00, 0x00 };
+
+	printf("block limit after fallback to short APDUs:\n");
+
+	/* The log of 256 blocks would be huge */
+	ipa_log_mask = 0;
+	ctx = init(&cfg, atr_ext, sizeof(atr_ext), 0);
+	card.ext_sw = 0x6700;
+	req = es10x_req(256 * 255);
+	res = ipa_euicc_transceive_es10x(ctx, req);
+	printf(" 256 blocks: %s, extended length APDUs: %u\n", res ? "ok" : "none", ctx->euicc.ext_apdu);
+	IPA_FREE(res);
+	IPA_FREE(req);
+	cleanup(ctx);
+
+	ctx = init(&cfg, atr_ext, sizeof(atr_ext), 0);
+	card.ext_sw = 0x6700;
+	req = es10x_req(256 * 255 + 1);
+	res = ipa_euicc_transceive_es10x(ctx, req);
+	printf(" 257 blocks: %s, extended length APDUs: %u\n", res ? "ok" : "none", ctx->euicc.ext_apdu);
+	IPA_FREE(res);
+	IPA_FREE(req);
+	cleanup(ctx);
+	ipa_log_mask = 0xffffffff;
+}
+
+int main(int argc, char **argv)
+{
+	atr_test();
+	apdu_test();
+	fallback_test();
+	block_limit_test();
+	fallback_block_limit_test();
+	return 0;
+}
+
+/* Stubs */
+void *ipa_http_init(const char *cabundle, bool no_verif)
+{
+	static int http_ctx;
+	return &http_ctx;
+}
+
+struct ipa_buf *ipa_http_req(void *http_ctx, const struct ipa_buf *req, const char *url)
+{
+	return NULL;
+}
+
+struct ipa_buf *ipa_http_req_timeout(void *http_ctx, const struct ipa_buf *req, const char *url, unsigned int timeout)
+{
+	return ipa_http_req(http_ctx, req, url);
+}
+
+int ipa_http_req_stream(void *http_ctx, const struct ipa_buf *req, const char *url, ipa_http_res_cb res_cb,
+			void *priv)
+{
+	return -1;
+}
+
+void ipa_http_recycle(void *http_ctx, struct ipa_buf *buf)
+{
+	IPA_FREE(buf);
+}
+
+void ipa_http_close(void *http_ctx)
+{
+	return;
+}
+
+struct ipa_buf *ipa_http_export_session(void *http_ctx)
+{
+	return NULL;
+}
+
+int ipa_http_import_session(void *http_ctx, const struct ipa_buf *session)
+{
+	return 0;
+}
+
+void ipa_http_free(void *http_ctx)
+{
+	return;
+}
+
+void *ipa_scard_init(unsigned int reader_num)
+{
+	return NULL;
+}
+
+int ipa_scard_reset(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_atr(void *scard_ctx, struct ipa_buf *atr)
+{
+	if (!card.atr)
+		return -1;
+	assert(atr->data_len >= card.atr_len);
+	memcpy(atr->data, card.atr, card.atr_len);
+	atr->len = card.atr_len;
+	return 0;
+}
+
+int ipa_scard_protocol(void *scard_ctx)
+{
+	return card.protocol;
+}
+
+int ipa_scard_transceive(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req)
+{
+	return -1;
+}
+
+/* Append (part of) the response data and the status word that announces the remaining response data */
+static void card_res(struct ipa_buf *res, size_t le)
+{
+	size_t remaining = sizeof(es10x_res) - card.res_offset;
+	uint16_t sw;
+
+	if (le > remaining)
+		le = remaining;
+	memcpy(res->data + res->len, es10x_res + card.res_offset, le);
+	res->len += le;
+	card.res_offset += le;
+
+	remaining -= le;
+	sw = remaining ? 0x6100 | (remaining & 0xff) : 0x9000;
+	res->data[res->len++] = sw >> 8;
+	res->data[res->len++] = sw & 0xff;
+}
+
+int ipa_scard_transceive_v(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req_iov,
+			   unsigned int req_iov_count)
+{
+	const uint8_t *hdr = req_iov[0].data;
+	const uint8_t *trl = req_iov[2].data;
+	bool ext = req_iov[0].len == 7;
+	size_t le;
+
+	assert(req_iov_count == 3);
+	assert(req_iov[0].len >= 5);
+
+	if (card.trace) {
+		printf(" %s", ipa_hexdump(req_iov[0].data, req_iov[0].len));
+		if (req_iov[1].len)
+			printf(" <%zu bytes>", req_iov[1].len);
+		if (req_iov[2].len)
+			printf(" %s", ipa_hexdump(req_iov[2].data, req_iov[2].len));
+		printf("\n");
+	}
+
+	if (ext && card.ext_fail)
+		return -1;
+
+	res->len = 0;
+	if (ext && card.ext_sw) {
+		res->data[res->len++] = card.ext_sw >> 8;
+		res->data[res->len++] = card.ext_sw & 0xff;
+		return 0;
+	}
+
+	switch (hdr[1]) {
+	case 0xE2:
+		/* STORE DATA, the response is returned directly (case 4) or announced with the last block */
+		if (hdr[2] != 0x91) {
+			res->data[res->len++] = 0x90;
+			res->data[res->len++] = 0x00;
+			break;
+		}
+		card.res_offset = 0;
+		if (req_iov[2].len) {
+			le = req_iov[2].len == 2 ? trl[0] << 8 | trl[1] : trl[0];
+			card_res(res, le ? le : (ext ? 65536 : 256));
+		} else
+			card_res(res, 0);
+		break;
+	case 0xC0:
+		/* GET RESPONSE */
+		if (ext)
+			le = hdr[5] << 8 | hdr[6];
+		else
+			le = hdr[4];
+		card_res(res, le ? le : (ext ? 65536 : 256));
+		break;
+	case 0xA4:
+		/* SELECT */
+		res->data[res->len++] = 0x61;
+		res->data[res->len++] = 0x20;
+		break;
+	default:
+		res->data[res->len++] = 0x90;
+		res->data[res->len++] = 0x00;
+		break;
+	}
+
+	return 0;
+}
+
+int ipa_scard_begin_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_end_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_free(void *scard_ctx)
+{
+	return 0;
+}
@@ -0,0 +1,208 @@
+/*
+ * Author: Philipp Maier <pmaier@sysmocom.de> / sysmocom - s.f.m.c. GmbH
+ *
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <openssl/ssl.h>
+#include <openssl/x509.h>
+#include <openssl/evp.h>
+#include <onomondo/ipa/utils.h>
+#include <onomondo/ipa/http.h>
+#include <onomondo/ipa/log.h>
+
+/* Minimal HTTPS server, which answers each request with an empty response and closes the connection afterwards. For
+ * each connection the server notes whether the client has resumed a TLS session. */
+struct test_server {
+	int fd;
+	uint16_t port;
+	pthread_t thread;
+	SSL_CTX *ssl_ctx;
+
+	/* Number of connections to serve */
+	unsigned int conns;
+	bool reused[8];
+};
+
+/* Create a self signed certificate, so that no key material has to be kept in the repository */
+static void server_cert(SSL_CTX *ssl_ctx)
+{
+	EVP_PKEY *key;
+	X509 *cert;
+	X509_NAME *name;
+
+	key = EVP_EC_gen("P-256");
+	assert(key);
+	cert = X509_new();
+	assert(cert);
+	ASN1_INTEGER_set(X509_get_serialNumber(cert), 1);
+	X509_gmtime_adj(X509_getm_notBefore(cert), 0);
+	X509_gmtime_adj(X509_getm_notAfter(cert), 3600);
+	X509_set_pubkey(cert, key);
+	name = X509_get_subject_name(cert);
+	X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, (const unsigned char *)"localhost", -1, -1, 0);
+	X509_set_issuer_name(cert, name);
+	assert(X509_sign(cert, key, EVP_sha256()) > 0);
+
+	assert(SSL_CTX_use_certificate(ssl_ctx, cert) == 1);
+	assert(SSL_CTX_use_PrivateKey(ssl_ctx, key) == 1);
+	X509_free(cert);
+	EVP_PKEY_free(key);
+}
+
+/* Read the HTTP request (header and body), so that the response is not sent before the request is complete */
+static int read_request(SSL *ssl)
+{
+	char buf[4096];
+	size_t len = 0;
+	char *body;
+	long content_len = 0;
+	char *hdr;
+	int rc;
+
+	while (true) {
+		rc = SSL_read(ssl, buf + len, sizeof(buf) - len - 1);
+		if (rc <= 0)
+			return -EIO;
+		len += rc;
+		buf[len] = '\0';
+		body = strstr(buf, "\r\n\r\n");
+		if (!body)
+			continue;
+		body += 4;
+		hdr = strcasestr(buf, "Content-Length:");
+		if (hdr)
+			content_len = strtol(hdr + strlen("Content-Length:"), NULL, 10);
+		if ((size_t)(buf + len - body) >= (size_t)content_len)
+			return 0;
+	}
+}
+
+static void *server_thread(void *arg)
+{
+	static const char res[] = "HTTP/1.1 200 OK\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+	struct test_server *srv = arg;
+	unsigned int i;
+	SSL *ssl;
+	int fd;
+
+	for (i = 0; i < srv->conns; i++) {
+		fd = accept(srv->fd, NULL, NULL);
+		assert(fd >= 0);
+		ssl = SSL_new(srv->ssl_ctx);
+		assert(ssl);
+		SSL_set_fd(ssl, fd);
+		if (SSL_accept(ssl) == 1 && read_request(ssl) == 0) {
+			srv->reused[i] = SSL_session_reused(ssl);
+			SSL_write(ssl, res, strlen(res));
+			SSL_shutdown(ssl);
+		}
+		SSL_free(ssl);
+		close(fd);
+	}
+
+	return NULL;
+}
+
+static void server_start(struct test_server *srv, unsigned int conns)
+{
+	struct sockaddr_in addr = { 0 };
+	socklen_t addr_len = sizeof(addr);
+	int rc;
+
+	srv->ssl_ctx = SSL_CTX_new(TLS_server_method());
+	assert(srv->ssl_ctx);
+	server_cert(srv->ssl_ctx);
+	SSL_CTX_set_session_id_context(srv->ssl_ctx, (const unsigned char *)"ipa", 3);
+
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	srv->fd = socket(AF_INET, SOCK_STREAM, 0);
+	assert(srv->fd >= 0);
+	rc = bind(srv->fd, (struct sockaddr *)&addr, sizeof(addr));
+	assert(rc == 0);
+	rc = listen(srv->fd, 1);
+	assert(rc == 0);
+	rc = getsockname(srv->fd, (struct sockaddr *)&addr, &addr_len);
+	assert(rc == 0);
+	srv->port = ntohs(addr.sin_port);
+	srv->conns = conns;
+	rc = pthread_create(&srv->thread, NULL, server_thread, srv);
+	assert(rc == 0);
+}
+
+static void server_stop(struct test_server *srv)
+{
+	pthread_join(srv->thread, NULL);
+	close(srv->fd);
+	SSL_CTX_free(srv->ssl_ctx);
+}
+
+/* Perform one request with the given HTTP client, so that a connection is established */
+static void request(void *http_ctx, const char *url)
+{
+	IPA_BUF_STATIC(req, 4);
+	struct ipa_buf *res;
+
+	memset(req.data, 0xAA, 4);
+	req.len = 4;
+	res = ipa_http_req(http_ctx, &req, url);
+	assert(res);
+	ipa_http_recycle(http_ctx, res);
+	ipa_http_close(http_ctx);
+}
+
+int main(int argc, char **argv)
+{
+	struct test_server srv = { 0 };
+	char url[64];
+	void *http_ctx;
+	struct ipa_buf *session;
+	struct ipa_buf invalid_session = { 0 };
+	uint8_t invalid_data[] = { 0x00, 0x20, 0x01, 0x02 };
+	int rc;
+
+	server_start(&srv, 2);
+	snprintf(url, sizeof(url), "https://127.0.0.1:%u/gsma/rsp2/asn1", srv.port);
+
+	/* The first connection of an HTTP client performs a full handshake, the TLS session is exported afterwards (as
+	 * ipa_free_ctx does when the IPAd is shut down) */
+	http_ctx = ipa_http_init(NULL, true);
+	assert(http_ctx);
+	request(http_ctx, url);
+	session = ipa_http_export_session(http_ctx);
+	ipa_http_free(http_ctx);
+	printf("first HTTP client: session resumed: %u, session exported: %u\n", srv.reused[0], session != NULL);
+	assert(session);
+
+	/* A new HTTP client (as after a restart of the IPAd) resumes the imported TLS session */
+	http_ctx = ipa_http_init(NULL, true);
+	assert(http_ctx);
+	rc = ipa_http_import_session(http_ctx, session);
+	printf("second HTTP client: session imported: %d\n", rc);
+	request(http_ctx, url);
+	server_stop(&srv);
+	printf("second HTTP client: session resumed: %u\n", srv.reused[1]);
+
+	/* Invalid data (e.g. a session stored by a previous version) is rejected */
+	invalid_session.data = invalid_data;
+	invalid_session.len = sizeof(invalid_data);
+	invalid_session.data_len = sizeof(invalid_data);
+	rc = ipa_http_import_session(http_ctx, &invalid_session);
+	printf("invalid session imported: %d\n", rc);
+
+	ipa_http_free(http_ctx);
+	IPA_FREE(session);
+	return 0;
+}
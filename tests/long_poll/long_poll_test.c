@@ -0,0 +1,239 @@
+/*
+ * Author: Philipp Maier <pmaier@sysmocom.de> / sysmocom - s.f.m.c. GmbH
+ *
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <onomondo/ipa/utils.h>
+#include <onomondo/ipa/ipad.h>
+#include <asn_application.h>
+#include <EsipaMessageFromEimToIpa.h>
+#include "src/ipa/http_srv.h"
+#include "src/ipa/libipa/utils.h"
+#include "src/ipa/libipa/length.h"
+#include "src/ipa/libipa/context.h"
+#include "src/ipa/libipa/esipa_get_eim_pkg.h"
+
+/* Stand-in for an eIM that supports long polling: it holds each GetEimPackage request for a configurable time before
+ * it responds. */
+struct test_eim {
+	void *http_srv;
+	uint16_t port;
+	pthread_t thread;
+	pthread_mutex_t lock;
+	bool stop;
+	bool busy;
+
+	/* Behaviour of the eIM */
+	unsigned int hold_ms;
+	struct ipa_buf *res;
+};
+
+static struct ipa_buf *enc_get_eim_pkg_res(bool eim_pkg_available)
+{
+	struct EsipaMessageFromEimToIpa msg_to_ipa = { 0 };
+	struct GetEimPackageResponse *get_eim_pkg_res = &msg_to_ipa.choice.getEimPackageResponse;
+	uint8_t tag_list[] = { 0x80, 0xBF, 0x20 };
+	struct ipa_buf *buf_encoded = NULL;
+	asn_enc_rval_t rc;
+
+	msg_to_ipa.present = EsipaMessageFromEimToIpa_PR_getEimPackageResponse;
+	if (eim_pkg_available) {
+		get_eim_pkg_res->present = GetEimPackageResponse_PR_ipaEuiccDataRequest;
+		get_eim_pkg_res->choice.ipaEuiccDataRequest.tagList.buf = tag_list;
+		get_eim_pkg_res->choice.ipaEuiccDataRequest.tagList.size = sizeof(tag_list);
+	} else {
+		get_eim_pkg_res->present = GetEimPackageResponse_PR_eimPackageError;
+		get_eim_pkg_res->choice.eimPackageError = GetEimPackageResponse__eimPackageError_noEimPackageAvailable;
+	}
+
+	rc = der_encode(&asn_DEF_EsipaMessageFromEimToIpa, &msg_to_ipa, ipa_asn1c_consume_bytes_cb, &buf_encoded);
+	assert(rc.encoded > 0);
+	return buf_encoded;
+}
+
+static void *eim_thread(void *arg)
+{
+	struct test_eim *eim = arg;
+	struct ipa_buf *req;
+
+	while (1) {
+		pthread_mutex_lock(&eim->lock);
+		if (eim->stop) {
+			pthread_mutex_unlock(&eim->lock);
+			break;
+		}
+		pthread_mutex_unlock(&eim->lock);
+
+		if (ipa_http_srv_recv(eim->http_srv, &req, 100) != 1)
+			continue;
+		pthread_mutex_lock(&eim->lock);
+		eim->busy = true;
+		pthread_mutex_unlock(&eim->lock);
+
+		usleep(eim->hold_ms * 1000);
+		ipa_http_srv_send(eim->http_srv, eim->res);
+		IPA_FREE(req);
+
+		pthread_mutex_lock(&eim->lock);
+		eim->busy = false;
+		pthread_mutex_unlock(&eim->lock);
+	}
+
+	return NULL;
+}
+
+/* Wait until the eIM has finished with the last request (also when the IPAd has already given up on it) */
+static void eim_wait_idle(struct test_eim *eim)
+{
+	bool busy = true;
+
+	while (busy) {
+		pthread_mutex_lock(&eim->lock);
+		busy = eim->busy;
+		pthread_mutex_unlock(&eim->lock);
+		usleep(10000);
+	}
+}
+
+static void long_poll_test(struct ipa_context *ctx, struct test_eim *eim, unsigned int hold_ms, struct ipa_buf *res)
+{
+	uint8_t eid[IPA_LEN_EID] = { 0 };
+	struct ipa_esipa_get_eim_pkg_res *get_eim_pkg_res;
+
+	printf(" long poll timeout: %u s, eIM holds request for: %u ms, eIM response: %zu bytes\n",
+	       ctx->cfg->eim_long_poll_timeout, hold_ms, res->len);
+
+	eim_wait_idle(eim);
+	eim->hold_ms = hold_ms;
+	eim->res = res;
+
+	get_eim_pkg_res = ipa_esipa_get_eim_pkg(ctx, eid);
+	if (!get_eim_pkg_res)
+		printf(" => request failed\n");
+	else if (get_eim_pkg_res->long_poll_timeout)
+		printf(" => long poll ended without eIM package\n");
+	else if (get_eim_pkg_res->eim_pkg_err)
+		printf(" => eimPackageError: %ld\n", get_eim_pkg_res->eim_pkg_err);
+	else if (get_eim_pkg_res->ipa_euicc_data_request)
+		printf(" => eIM package: ipaEuiccDataRequest\n");
+	else
+		printf(" => unexpected eIM package\n");
+	ipa_esipa_get_eim_pkg_free(get_eim_pkg_res);
+}
+
+int main(int argc, char **argv)
+{
+	struct test_eim eim = { 0 };
+	struct ipa_config cfg = { 0 };
+	struct ipa_context *ctx;
+	struct ipa_buf *nvstate;
+	struct ipa_buf *eim_pkg = enc_get_eim_pkg_res(true);
+	struct ipa_buf *no_eim_pkg = enc_get_eim_pkg_res(false);
+	struct ipa_buf *empty = ipa_buf_alloc(0);
+	char eim_fqdn[32];
+	int rc;
+
+	/* Start the eIM on the first free port */
+	for (eim.port = 18700; eim.port < 18800 && !eim.http_srv; eim.port++)
+		eim.http_srv = ipa_http_srv_init(NULL, eim.port, NULL, NULL);
+	assert(eim.http_srv);
+	eim.port--;
+	pthread_mutex_init(&eim.lock, NULL);
+	rc = pthread_create(&eim.thread, NULL, eim_thread, &eim);
+	assert(rc == 0);
+
+	cfg.eim_disable_ssl = true;
+	cfg.eim_keep_alive = true;
+	cfg.eim_long_poll_timeout = 2;
+	ctx = ipa_new_ctx(&cfg, NULL);
+	snprintf(eim_fqdn, sizeof(eim_fqdn), "127.0.0.1:%u", eim.port);
+	ctx->eim_fqdn = IPA_ALLOC_N(strlen(eim_fqdn) + 1);
+	strcpy(ctx->eim_fqdn, eim_fqdn);
+
+	printf("eIM package available immediately:\n");
+	long_poll_test(ctx, &eim, 0, eim_pkg);
+
+	printf("\neIM package becomes available during the long poll:\n");
+	long_poll_test(ctx, &eim, 1000, eim_pkg);
+
+	printf("\nno eIM package until the long poll times out:\n");
+	long_poll_test(ctx, &eim, 3000, eim_pkg);
+
+	printf("\nno eIM package, eIM ends the long poll without content:\n");
+	long_poll_test(ctx, &eim, 500, empty);
+
+	printf("\nno eIM package, eIM does not hold the request (no long poll support):\n");
+	long_poll_test(ctx, &eim, 0, no_eim_pkg);
+
+	/* Without long polling, the regular timeout applies and an empty response is an error */
+	printf("\nno eIM package, long poll disabled:\n");
+	cfg.eim_long_poll_timeout = 0;
+	long_poll_test(ctx, &eim, 0, empty);
+
+	nvstate = ipa_free_ctx(ctx);
+	IPA_FREE(nvstate);
+
+	eim_wait_idle(&eim);
+	pthread_mutex_lock(&eim.lock);
+	eim.stop = true;
+	pthread_mutex_unlock(&eim.lock);
+	pthread_join(eim.thread, NULL);
+	ipa_http_srv_free(eim.http_srv);
+	IPA_FREE(eim_pkg);
+	IPA_FREE(no_eim_pkg);
+	IPA_FREE(empty);
+	return 0;
+}
+
+/* Stubs */
+void *ipa_scard_init(unsigned int reader_num)
+{
+	return NULL;
+}
+
+int ipa_scard_reset(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_atr(void *scard_ctx, struct ipa_buf *atr)
+{
+	return 0;
+}
+
+int ipa_scard_protocol(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_transceive(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req)
+{
+	return 0;
+}
+
+int ipa_scard_transceive_v(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req_iov,
+			   unsigned int req_iov_count)
+{
+	return 0;
+}
+
+int ipa_scard_begin_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_end_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_free(void *scard_ctx)
+{
+	return 0;
+}
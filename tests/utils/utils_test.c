@@ -5,7 +5,15 @@
 
 #include <stdio.h>
 #include <stdbool.h>
+#include <string.h>
 #include <onomondo/ipa/utils.h>
+#include <onomondo/ipa/http.h>
+#include <asn_application.h>
+#include <EUICCInfo1.h>
+#include <AuthenticateServerResponse.h>
+#include <PrepareDownloadResponse.h>
+#include <ProfileInstallationResult.h>
+#include <BoundProfilePackage.h>
 #include "src/ipa/libipa/utils.h"
 
 void ipa_tag_in_taglist_test(void)
@@ -48,9 +56,118 @@ void ipa_tag_in_taglist_test(void)
 	IPA_FREE(tag_list);
 }
 
+/* Duplicate a decoded ASN.1 struct and check that the copy encodes to the same bytes, even after the original has
+ * been freed */
+static void ipa_asn1c_dup_test(const char *dir, const char *name, const asn_TYPE_descriptor_t *td)
+{
+	char path[1024];
+	static uint8_t ber[16384];
+	FILE *ber_file;
+	size_t ber_len;
+	asn_dec_rval_t rc_dec;
+	asn_enc_rval_t rc_enc;
+	void *decoded = NULL;
+	void *dup;
+	struct ipa_buf *encoded = NULL;
+	struct ipa_buf *encoded_dup = NULL;
+
+	snprintf(path, sizeof(path), "%s/%s", dir, name);
+	ber_file = fopen(path, "r");
+	assert(ber_file);
+	ber_len = fread(&ber, sizeof(char), sizeof(ber), ber_file);
+	fclose(ber_file);
+
+	rc_dec = ber_decode(0, td, &decoded, ber, ber_len);
+	assert(rc_dec.code == RC_OK);
+	rc_enc = der_encode(td, decoded, ipa_asn1c_consume_bytes_cb, &encoded);
+	assert(rc_enc.encoded > 0);
+
+	dup = ipa_asn1c_dup(td, decoded);
+	assert(dup);
+	ASN_STRUCT_FREE(*td, decoded);
+
+	rc_enc = der_encode(td, dup, ipa_asn1c_consume_bytes_cb, &encoded_dup);
+	assert(rc_enc.encoded > 0);
+	assert(encoded_dup->len == encoded->len);
+	assert(memcmp(encoded_dup->data, encoded->data, encoded->len) == 0);
+
+	ASN_STRUCT_FREE(*td, dup);
+	IPA_FREE(encoded);
+	IPA_FREE(encoded_dup);
+
+	assert(ipa_asn1c_dup(td, NULL) == NULL);
+}
+
+/* Encode a BoundProfilePackage into an exactly sized buffer, into a caller provided buffer and encode only its tag and
+ * length fields */
+static void ipa_asn1c_encode_test(const char *dir)
+{
+	char path[1024];
+	static uint8_t ber[16384];
+	FILE *ber_file;
+	size_t ber_len;
+	asn_dec_rval_t rc_dec;
+	struct BoundProfilePackage *bpp = NULL;
+	struct ipa_buf *encoded;
+	struct ipa_buf *buf;
+	ssize_t rc;
+
+	snprintf(path, sizeof(path), "%s/bpp_segments/bpp.ber", dir);
+	ber_file = fopen(path, "r");
+	assert(ber_file);
+	ber_len = fread(&ber, sizeof(char), sizeof(ber), ber_file);
+	fclose(ber_file);
+	rc_dec = ber_decode(0, &asn_DEF_BoundProfilePackage, (void **)&bpp, ber, ber_len);
+	assert(rc_dec.code == RC_OK);
+
+	encoded = ipa_asn1c_encode(&asn_DEF_BoundProfilePackage, bpp);
+	assert(encoded);
+	assert(encoded->len == ber_len);
+	assert(encoded->data_len == ber_len);
+	assert(memcmp(encoded->data, ber, ber_len) == 0);
+	assert(ipa_asn1c_encoded_len(&asn_DEF_BoundProfilePackage, bpp) == (ssize_t)ber_len);
+
+	/* A buffer that is too small is left untouched */
+	buf = ipa_buf_alloc(ber_len - 1);
+	buf->data[0] = 0xAA;
+	buf->len = 1;
+	rc = ipa_asn1c_encode_to(buf, &asn_DEF_BoundProfilePackage, bpp);
+	assert(rc == -ENOMEM);
+	assert(buf->len == 1);
+	IPA_FREE(buf);
+
+	buf = ipa_buf_alloc(ber_len + 1);
+	buf->data[0] = 0xAA;
+	buf->len = 1;
+	rc = ipa_asn1c_encode_to(buf, &asn_DEF_BoundProfilePackage, bpp);
+	assert(rc == (ssize_t)ber_len);
+	assert(buf->len == ber_len + 1);
+	assert(memcmp(buf->data + 1, ber, ber_len) == 0);
+
+	/* Tag and length fields only */
+	buf->len = 0;
+	rc = ipa_asn1c_encode_hdr_to(buf, &asn_DEF_BoundProfilePackage, bpp);
+	assert(rc > 0);
+	assert((size_t)rc == ipa_parse_btlv_hdr(NULL, NULL, encoded));
+	assert(buf->len == (size_t)rc);
+	assert(memcmp(buf->data, ber, rc) == 0);
+
+	IPA_FREE(buf);
+	IPA_FREE(encoded);
+	ASN_STRUCT_FREE(asn_DEF_BoundProfilePackage, bpp);
+}
+
 int main(int argc, char **argv)
 {
 	ipa_tag_in_taglist_test();
+
+	assert(argc == 2);
+	ipa_asn1c_dup_test(argv[1], "esipa_compact/euicc_info1.ber", &asn_DEF_EUICCInfo1);
+	ipa_asn1c_dup_test(argv[1], "esipa_compact/auth_serv_res.ber", &asn_DEF_AuthenticateServerResponse);
+	ipa_asn1c_dup_test(argv[1], "esipa_compact/prep_dwnld_res.ber", &asn_DEF_PrepareDownloadResponse);
+	ipa_asn1c_dup_test(argv[1], "esipa_compact/prfle_inst_res.ber", &asn_DEF_ProfileInstallationResult);
+	ipa_asn1c_dup_test(argv[1], "bpp_segments/bpp.ber", &asn_DEF_BoundProfilePackage);
+	ipa_asn1c_encode_test(argv[1]);
 	return 0;
 }
 
@@ -65,11 +182,37 @@ struct ipa_buf *ipa_http_req(void *http_ctx, const struct ipa_buf *req, const ch
 	return NULL;
 }
 
+struct ipa_buf *ipa_http_req_timeout(void *http_ctx, const struct ipa_buf *req, const char *url, unsigned int timeout)
+{
+	return ipa_http_req(http_ctx, req, url);
+}
+
+int ipa_http_req_stream(void *http_ctx, const struct ipa_buf *req, const char *url, ipa_http_res_cb res_cb,
+			void *priv)
+{
+	return -1;
+}
+
+void ipa_http_recycle(void *http_ctx, struct ipa_buf *buf)
+{
+	return;
+}
+
 void ipa_http_close(void *http_ctx)
 {
 	return;
 }
 
+struct ipa_buf *ipa_http_export_session(void *http_ctx)
+{
+	return NULL;
+}
+
+int ipa_http_import_session(void *http_ctx, const struct ipa_buf *session)
+{
+	return 0;
+}
+
 void ipa_http_free(void *http_ctx)
 {
 	return;
@@ -90,11 +233,32 @@ int ipa_scard_atr(void *scard_ctx, struct ipa_buf *atr)
 	return 0;
 }
 
+int ipa_scard_protocol(void *scard_ctx)
+{
+	return 0;
+}
+
 int ipa_scard_transceive(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req)
 {
 	return 0;
 }
 
+int ipa_scard_transceive_v(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req_iov,
+			   unsigned int req_iov_count)
+{
+	return 0;
+}
+
+int ipa_scard_begin_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_end_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
 int ipa_scard_free(void *scard_ctx)
 {
 	return 0;
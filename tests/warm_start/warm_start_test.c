@@ -0,0 +1,264 @@
+/*
+ * Author: Philipp Maier <pmaier@sysmocom.de> / sysmocom - s.f.m.c. GmbH
+ *
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
+#include <onomondo/ipa/utils.h>
+#include <onomondo/ipa/http.h>
+#include <onomondo/ipa/ipad.h>
+#include <onomondo/ipa/log.h>
+
+extern uint32_t ipa_log_mask;
+
+/* Time the emulated eUICC takes to answer an APDU (typical for an eUICC that is accessed through a modem) */
+#define APDU_LATENCY_MS 10
+
+/* Emulated eUICC (see ipa_scard_* stubs below), which answers the APDUs that ipa_init sends. The eUICC stays powered
+ * between the starts of the IPAd, so a logical channel that is not closed stays open. */
+static struct {
+	const uint8_t *atr;
+	size_t atr_len;
+	bool channel_open;
+	size_t res_offset;
+	/* APDUs (INS bytes) that were sent since the last start */
+	char log[256];
+	unsigned int apdus;
+} card;
+
+/* Response to GetEID */
+static const uint8_t get_eid_res[] = { 0xBF, 0x3E, 0x12, 0x5A, 0x10, 0x89, 0x04, 0x90, 0x32, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+};
+
+static const uint8_t atr_a[] = { 0x3B, 0x9F, 0x96, 0x80, 0x1F, 0xC7, 0x80, 0x31, 0xE0, 0x73, 0xFE, 0x21, 0x1B, 0x63,
+	0x3A, 0x20, 0x4E, 0x83, 0x00, 0x90, 0x00, 0x6B
+};
+static const uint8_t atr_b[] = { 0x3B, 0x9F, 0x96, 0x80, 0x1F, 0xC7, 0x80, 0x31, 0xE0, 0x73, 0xFE, 0x21, 0x1B, 0x63,
+	0x3A, 0x20, 0x4E, 0x83, 0x00, 0x90, 0x01, 0x6A
+};
+
+/* Start the IPAd with the given configuration and nvstate, report which APDUs ipa_init sent and how long it took,
+ * returns the nvstate that the IPAd leaves behind */
+static struct ipa_buf *start(const char *name, struct ipa_config *cfg, struct ipa_buf *nvstate)
+{
+	struct ipa_context *ctx;
+	struct ipa_buf *nvstate_new;
+	struct timespec t_start;
+	struct timespec t_end;
+	long duration;
+	int rc;
+
+	card.log[0] = '\0';
+	card.apdus = 0;
+
+	ctx = ipa_new_ctx(cfg, nvstate);
+	assert(ctx);
+	clock_gettime(CLOCK_MONOTONIC, &t_start);
+	rc = ipa_init(ctx);
+	clock_gettime(CLOCK_MONOTONIC, &t_end);
+	assert(rc == 0);
+	duration = (t_end.tv_sec - t_start.tv_sec) * 1000 + (t_end.tv_nsec - t_start.tv_nsec) / 1000000;
+
+	/* The duration depends on the machine, so it is printed to stderr, which is not compared */
+	printf("%s: %u APDUs (%s)\n", name, card.apdus, card.log);
+	fprintf(stderr, "%s: %u APDUs, ipa_init took %ld ms\n", name, card.apdus, duration);
+
+	nvstate_new = ipa_free_ctx(ctx);
+	IPA_FREE(nvstate);
+	return nvstate_new;
+}
+
+int main(int argc, char **argv)
+{
+	struct ipa_config cfg = { 0 };
+	struct ipa_buf *nvstate = NULL;
+
+	/* Only the APDUs are of interest */
+	ipa_log_mask = 0;
+	fprintf(stderr, "emulated APDU latency: %u ms\n", APDU_LATENCY_MS);
+
+	cfg.euicc_channel = 1;
+	card.atr = atr_a;
+	card.atr_len = sizeof(atr_a);
+
+	/* Without warm start, each start is a cold start, no matter what is in the nvstate */
+	nvstate = start("cold start (warm start disabled)", &cfg, nvstate);
+	nvstate = start("cold start (warm start disabled, second start)", &cfg, nvstate);
+
+	/* The first start fills the cache in the nvstate, the next start uses it */
+	cfg.euicc_warm_start = true;
+	IPA_FREE(nvstate);
+	nvstate = start("cold start (empty cache)", &cfg, NULL);
+	nvstate = start("warm start", &cfg, nvstate);
+
+	/* When the logical channel is kept open, it is reused on the next start */
+	cfg.euicc_keep_channel = true;
+	nvstate = start("warm start (keeping the channel, it was closed on the last exit)", &cfg, nvstate);
+	nvstate = start("warm start (reusing the kept channel)", &cfg, nvstate);
+
+	/* The kept channel was closed meanwhile (e.g. the eUICC was reset), so it is opened again */
+	card.channel_open = false;
+	nvstate = start("warm start (kept channel was closed)", &cfg, nvstate);
+
+	/* A different ATR means that the eUICC may have been swapped */
+	card.atr = atr_b;
+	card.atr_len = sizeof(atr_b);
+	nvstate = start("cold start (ATR changed)", &cfg, nvstate);
+
+	IPA_FREE(nvstate);
+	return 0;
+}
+
+/* Stubs */
+void *ipa_http_init(const char *cabundle, bool no_verif)
+{
+	static int http_ctx;
+	return &http_ctx;
+}
+
+struct ipa_buf *ipa_http_req(void *http_ctx, const struct ipa_buf *req, const char *url)
+{
+	return NULL;
+}
+
+struct ipa_buf *ipa_http_req_timeout(void *http_ctx, const struct ipa_buf *req, const char *url, unsigned int timeout)
+{
+	return ipa_http_req(http_ctx, req, url);
+}
+
+int ipa_http_req_stream(void *http_ctx, const struct ipa_buf *req, const char *url, ipa_http_res_cb res_cb,
+			void *priv)
+{
+	return -1;
+}
+
+void ipa_http_recycle(void *http_ctx, struct ipa_buf *buf)
+{
+	IPA_FREE(buf);
+}
+
+void ipa_http_close(void *http_ctx)
+{
+	return;
+}
+
+struct ipa_buf *ipa_http_export_session(void *http_ctx)
+{
+	return NULL;
+}
+
+int ipa_http_import_session(void *http_ctx, const struct ipa_buf *session)
+{
+	return 0;
+}
+
+void ipa_http_free(void *http_ctx)
+{
+	return;
+}
+
+void *ipa_scard_init(unsigned int reader_num)
+{
+	return &card;
+}
+
+int ipa_scard_reset(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_atr(void *scard_ctx, struct ipa_buf *atr)
+{
+	assert(atr->data_len >= card.atr_len);
+	memcpy(atr->data, card.atr, card.atr_len);
+	atr->len = card.atr_len;
+	return 0;
+}
+
+int ipa_scard_protocol(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_transceive(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req)
+{
+	return -1;
+}
+
+/* Append (part of) the GetEID response and the status word that announces the remaining response data */
+static void card_res(struct ipa_buf *res, size_t le)
+{
+	size_t remaining = sizeof(get_eid_res) - card.res_offset;
+	uint16_t sw;
+
+	if (le > remaining)
+		le = remaining;
+	memcpy(res->data + res->len, get_eid_res + card.res_offset, le);
+	res->len += le;
+	card.res_offset += le;
+
+	remaining -= le;
+	sw = remaining ? 0x6100 | (remaining & 0xff) : 0x9000;
+	res->data[res->len++] = sw >> 8;
+	res->data[res->len++] = sw & 0xff;
+}
+
+int ipa_scard_transceive_v(void *scard_ctx, struct ipa_buf *res, const struct ipa_buf *req_iov,
+			   unsigned int req_iov_count)
+{
+	const uint8_t *hdr = req_iov[0].data;
+	struct timespec delay = { 0, APDU_LATENCY_MS * 1000000L };
+	uint16_t sw = 0x9000;
+
+	assert(req_iov[0].len >= 5);
+	nanosleep(&delay, NULL);
+
+	card.apdus++;
+	snprintf(card.log + strlen(card.log), sizeof(card.log) - strlen(card.log), "%s%02X", card.apdus > 1 ? " " : "",
+		 hdr[1]);
+
+	res->len = 0;
+	switch (hdr[1]) {
+	case 0x70:
+		/* MANAGE CHANNEL */
+		card.channel_open = hdr[2] == 0x00;
+		break;
+	case 0xA4:
+		/* SELECT */
+		sw = card.channel_open ? 0x6120 : 0x6881;
+		break;
+	case 0xE2:
+		/* STORE DATA (GetEID), the response is announced with the last block */
+		card.res_offset = 0;
+		card_res(res, 0);
+		return 0;
+	case 0xC0:
+		/* GET RESPONSE */
+		card_res(res, hdr[4] ? hdr[4] : 256);
+		return 0;
+	}
+
+	res->data[res->len++] = sw >> 8;
+	res->data[res->len++] = sw & 0xff;
+	return 0;
+}
+
+int ipa_scard_begin_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_end_transaction(void *scard_ctx)
+{
+	return 0;
+}
+
+int ipa_scard_free(void *scard_ctx)
+{
+	return 0;
+}